@@ -94,12 +94,28 @@ typedef int16_t lv_coord_t;
 
 /* Automatically defrag. on free. Defrag. means joining the adjacent free cells. */
 #  define LV_MEM_AUTO_DEFRAG  1
+
+/* Keep the freed blocks up to this size in lists per size and reuse them for the next allocations
+ * of the same size without searching the heap. Makes creating and deleting objects much faster.
+ * The kept blocks are given back to the heap if an allocation fails or by `lv_mem_slab_flush()`.
+ * 0: disable*/
+#  define LV_MEM_SLAB_MAX_SIZE  0
 #else       /*LV_MEM_CUSTOM*/
 #  define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
 #  define LV_MEM_CUSTOM_ALLOC   malloc       /*Wrapper to malloc*/
 #  define LV_MEM_CUSTOM_FREE    free         /*Wrapper to free*/
 #endif     /*LV_MEM_CUSTOM*/
 
+/* 1: Attribute the allocations to tags (see `lv_mem_tag_set()`), keep a histogram of the block sizes
+ * and high-water marks per tag, and enable the snapshot/diff API (`lv_mem_snapshot()`).
+ * A block can't be larger than 16 MB (8 MB with `LV_MEM_SLAB_MAX_SIZE`) in this mode.
+ * Not supported with `LV_ENABLE_GC`. */
+#define LV_MEM_TELEMETRY    0
+#if LV_MEM_TELEMETRY
+#  define LV_MEM_TELEMETRY_TAG_CNT  32  /*Max. number of tags (<= 128). If full, a tag without live blocks is reused*/
+#  define LV_MEM_TELEMETRY_CALLER   1   /*1: Tag with the caller's address if no tag is set (GCC and Clang only)*/
+#endif
+
 /* Use the standard memcpy and memset instead of LVGL's own functions.
  * The standard functions might or might not be faster depending on their implementation. */
 #define LV_MEMCPY_MEMSET_STD    0
@@ -143,6 +159,10 @@ typedef int16_t lv_coord_t;
 /* Gesture min velocity at release before swipe (pixels)*/
 #define LV_INDEV_DEF_GESTURE_MIN_VELOCITY 3
 
+/* 1: Keep a grid of the clickable objects of the screens and layers
+ * to find the pressed object without visiting all objects. It's rebuilt only after the objects changed*/
+#define LV_USE_HIT_INDEX                  0
+
 /*==================
  * Feature usage
  *==================*/
@@ -188,6 +208,10 @@ typedef void * lv_anim_user_data_t;
 #define LV_USE_GROUP            1
 #if LV_USE_GROUP
 typedef void * lv_group_user_data_t;
+
+/* 1: Keep an index of the objects of the groups to change the focus without walking the list of objects
+ * and to focus the nearest object in a direction with `lv_group_focus_dir()`*/
+#define LV_USE_GROUP_INDEX      0
 #endif  /*LV_USE_GROUP*/
 
 /* 1: Enable GPU interface*/
@@ -210,6 +234,25 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
 /*1: Use VG-Lite for CPU offload on NXP RTxxx platforms */
 #define LV_USE_GPU_NXP_VG_LITE   0
 
+/*1: Enable `draw_backend` in the display driver to let a display controller draw
+ * rectangles, lines, letters and images natively (e.g. as an FT81x display list).
+ * If anything can't be drawn by the backend the frame is rendered by software. */
+#define LV_USE_DRAW_BACKEND      0
+
+/*1: Move the content of a scrolled page instead of redrawing it and redraw only the newly exposed band.
+ * The content is moved by `scroll_cb` of the display driver (e.g. with the controller's hardware scrolling)
+ * or in the frame buffer if 2 screen sized buffers are used.*/
+#define LV_USE_FAST_SCROLL       0
+
+/*1: Enable screen snapshots (`lv_scr_snapshot_enable()`).
+ * The screens are rendered off-screen, run length encoded, when the display is idle
+ * and `lv_scr_load()` flushes the snapshot instead of drawing the screen.*/
+#define LV_USE_SCR_SNAPSHOT      0
+
+/*1: Cache the area covered by the children of each object.
+ * The refresher skips all the children at once if they are not on the redrawn area.*/
+#define LV_USE_SUBTREE_BOUNDS    0
+
 /* 1: Enable file system (might be required for images */
 #define LV_USE_FILESYSTEM       1
 #if LV_USE_FILESYSTEM
@@ -217,12 +260,38 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
 typedef void * lv_fs_drv_user_data_t;
 #endif
 
+/* Size of the read cache of the files opened only for reading [bytes].
+ * Small reads (e.g. image lines or font data) are served from this buffer
+ * which is refilled with one large read. Seeking inside the buffer doesn't call the driver.
+ * Set it to 0 to disable the cache. Used only if `LV_USE_FILESYSTEM` is enabled. */
+#define LV_FS_CACHE_SIZE    0
+
+/* Size of the block the font loader (`lv_font_load()`) reads from the font file at once [bytes].
+ * Allocated only while a font is loaded. Used only if `LV_USE_FILESYSTEM` is enabled. */
+#define LV_FONT_LOADER_BUF_SIZE 1024
+
 /*1: Add a `user_data` to drivers and objects*/
 #define LV_USE_USER_DATA        0
 
 /*1: Show CPU usage and FPS count in the right bottom corner*/
 #define LV_USE_PERF_MONITOR     0
 
+/*1: Enable the built-in profiler: refresh phase timers, draw time per widget type,
+ * counters and a history of the last frames. See `lv_prof.h`.
+ * With `LV_USE_PERF_MONITOR` the label shows the breakdown of the last frame too.*/
+#define LV_USE_PROFILER         0
+#if LV_USE_PROFILER
+#define LV_PROFILER_HISTORY     16      /*Number of frames kept in the history*/
+#define LV_PROFILER_OBJ_TYPES   16      /*Max. number of widget types with separate draw time*/
+
+/*1: Use a custom time source with µs resolution. 0: use `lv_tick_get()` (ms resolution)*/
+#define LV_PROFILER_TIME_CUSTOM 0
+#if LV_PROFILER_TIME_CUSTOM
+#define LV_PROFILER_TIME_INCLUDE    "esp_timer.h"                   /*Header for the time function*/
+#define LV_PROFILER_TIME_US_EXPR    ((uint32_t)esp_timer_get_time()) /*Expression evaluating to current time in µs*/
+#endif  /*LV_PROFILER_TIME_CUSTOM*/
+#endif  /*LV_USE_PROFILER*/
+
 /*1: Use the functions and types from the older API if possible */
 #define LV_USE_API_EXTENSION_V6  1
 #define LV_USE_API_EXTENSION_V7  1
@@ -245,6 +314,18 @@ typedef void * lv_fs_drv_user_data_t;
  * Set it to 0 to disable caching */
 #define LV_IMG_CACHE_DEF_SIZE       1
 
+/* Size of the rotated/zoomed image cache in bytes (requires LV_USE_IMG_TRANSFORM).
+ * The result of a transformation is kept as an ARGB bitmap so redrawing
+ * a statically rotated or zoomed image costs the same as drawing a plain ARGB image.
+ * Call `lv_img_cache_invalidate_src()` if the pixels of a variable image are modified in place.
+ * Set it to 0 to disable the cache */
+#define LV_IMG_TRANSFORM_CACHE_SIZE         0
+
+/* Round the angle of the cached transformations to this step [0.1 degree].
+ * Larger values let rotating animations reuse more cached entries
+ * at the expense of angle precision. */
+#define LV_IMG_TRANSFORM_CACHE_ANGLE_STEP   1
+
 /*Declare the type of the user data of image decoder (can be e.g. `void *`, `int`, `struct`)*/
 typedef void * lv_img_decoder_user_data_t;
 
@@ -561,6 +642,25 @@ typedef void * lv_obj_user_data_t;
 /*1: enable `lv_obj_realign()` based on `lv_obj_align()` parameters*/
 #define LV_USE_OBJ_REALIGN          1
 
+/*1: Refresh the layout and auto fit of the containers only once before the next refresh
+ * (or when a coordinate is read) instead of after every change of their children.
+ * The areas invalidated meanwhile are merged. See `lv_obj_update_layout()`*/
+#define LV_USE_LAYOUT_DEFER         0
+
+/*1: Keep a list of the objects using a style in the style itself
+ * so `lv_obj_report_style_mod(style)` refreshes only those objects instead of all*/
+#define LV_USE_STYLE_INDEX          0
+
+/*1: Store the objects in a more compact way to use less RAM per widget:
+ * - the signal and design functions are shared by the objects of the same type,
+ * - the realign parameters and the `LV_EXT_CLICK_AREA_FULL` paddings are stored in hash tables,
+ *   only for the objects really using them. The align parameters are kept only for the objects
+ *   with auto realign and for the last aligned object, so `lv_obj_realign()` works only for these.
+ * It saves about 24 bytes per object on 32 bit targets. The node in the parent's child list and the
+ * ext. data are still allocated separately for every object.
+ * Calling the signal/design functions and reading these properties gets a little slower*/
+#define LV_USE_OBJ_COMPACT          0
+
 /* Enable to make the object clickable on a larger area.
  * LV_EXT_CLICK_AREA_OFF or 0: Disable this feature
  * LV_EXT_CLICK_AREA_TINY: The extra area can be adjusted horizontally and vertically (0..255 px)
@@ -731,6 +831,8 @@ typedef void * lv_obj_user_data_t;
 #if LV_USE_TABLE
 #  define LV_TABLE_COL_MAX    12
 #  define LV_TABLE_CELL_STYLE_CNT 4
+/*Size of the buffer the data callback can print a cell's text to (on the stack while drawing)*/
+#  define LV_TABLE_DATA_BUF_SIZE  64
 #endif
 
 /*Tab (dependencies: lv_page, lv_btnm)*/
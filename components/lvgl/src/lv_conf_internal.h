@@ -231,6 +231,18 @@
 #    define  LV_MEM_AUTO_DEFRAG  1
 #  endif
 #endif
+
+/* Keep the freed blocks up to this size in lists per size and reuse them for the next allocations
+ * of the same size without searching the heap. Makes creating and deleting objects much faster.
+ * The kept blocks are given back to the heap if an allocation fails or by `lv_mem_slab_flush()`.
+ * 0: disable*/
+#ifndef LV_MEM_SLAB_MAX_SIZE
+#  ifdef CONFIG_LV_MEM_SLAB_MAX_SIZE
+#    define LV_MEM_SLAB_MAX_SIZE CONFIG_LV_MEM_SLAB_MAX_SIZE
+#  else
+#    define  LV_MEM_SLAB_MAX_SIZE  0
+#  endif
+#endif
 #else       /*LV_MEM_CUSTOM*/
 #ifndef LV_MEM_CUSTOM_INCLUDE
 #  ifdef CONFIG_LV_MEM_CUSTOM_INCLUDE
@@ -255,6 +267,34 @@
 #endif
 #endif     /*LV_MEM_CUSTOM*/
 
+/* 1: Attribute the allocations to tags (see `lv_mem_tag_set()`), keep a histogram of the block sizes
+ * and high-water marks per tag, and enable the snapshot/diff API (`lv_mem_snapshot()`).
+ * A block can't be larger than 16 MB (8 MB with `LV_MEM_SLAB_MAX_SIZE`) in this mode.
+ * Not supported with `LV_ENABLE_GC`. */
+#ifndef LV_MEM_TELEMETRY
+#  ifdef CONFIG_LV_MEM_TELEMETRY
+#    define LV_MEM_TELEMETRY CONFIG_LV_MEM_TELEMETRY
+#  else
+#    define  LV_MEM_TELEMETRY    0
+#  endif
+#endif
+#if LV_MEM_TELEMETRY
+#ifndef LV_MEM_TELEMETRY_TAG_CNT
+#  ifdef CONFIG_LV_MEM_TELEMETRY_TAG_CNT
+#    define LV_MEM_TELEMETRY_TAG_CNT CONFIG_LV_MEM_TELEMETRY_TAG_CNT
+#  else
+#    define  LV_MEM_TELEMETRY_TAG_CNT  32  /*Max. number of tags (<= 128). If full, a tag without live blocks is reused*/
+#  endif
+#endif
+#ifndef LV_MEM_TELEMETRY_CALLER
+#  ifdef CONFIG_LV_MEM_TELEMETRY_CALLER
+#    define LV_MEM_TELEMETRY_CALLER CONFIG_LV_MEM_TELEMETRY_CALLER
+#  else
+#    define  LV_MEM_TELEMETRY_CALLER   1   /*1: Tag with the caller's address if no tag is set (GCC and Clang only)*/
+#  endif
+#endif
+#endif
+
 /* Use the standard memcpy and memset instead of LVGL's own functions.
  * The standard functions might or might not be faster depending on their implementation. */
 #ifndef LV_MEMCPY_MEMSET_STD
@@ -370,6 +410,16 @@
 #  endif
 #endif
 
+/* 1: Keep a grid of the clickable objects of the screens and layers
+ * to find the pressed object without visiting all objects. It's rebuilt only after the objects changed*/
+#ifndef LV_USE_HIT_INDEX
+#  ifdef CONFIG_LV_USE_HIT_INDEX
+#    define LV_USE_HIT_INDEX CONFIG_LV_USE_HIT_INDEX
+#  else
+#    define  LV_USE_HIT_INDEX                  0
+#  endif
+#endif
+
 /*==================
  * Feature usage
  *==================*/
@@ -473,6 +523,16 @@
 #  endif
 #endif
 #if LV_USE_GROUP
+
+/* 1: Keep an index of the objects of the groups to change the focus without walking the list of objects
+ * and to focus the nearest object in a direction with `lv_group_focus_dir()`*/
+#ifndef LV_USE_GROUP_INDEX
+#  ifdef CONFIG_LV_USE_GROUP_INDEX
+#    define LV_USE_GROUP_INDEX CONFIG_LV_USE_GROUP_INDEX
+#  else
+#    define  LV_USE_GROUP_INDEX      0
+#  endif
+#endif
 #endif  /*LV_USE_GROUP*/
 
 /* 1: Enable GPU interface*/
@@ -531,6 +591,49 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
 #  endif
 #endif
 
+/*1: Enable `draw_backend` in the display driver to let a display controller draw
+ * rectangles, lines, letters and images natively (e.g. as an FT81x display list).
+ * If anything can't be drawn by the backend the frame is rendered by software. */
+#ifndef LV_USE_DRAW_BACKEND
+#  ifdef CONFIG_LV_USE_DRAW_BACKEND
+#    define LV_USE_DRAW_BACKEND CONFIG_LV_USE_DRAW_BACKEND
+#  else
+#    define  LV_USE_DRAW_BACKEND      0
+#  endif
+#endif
+
+/*1: Move the content of a scrolled page instead of redrawing it and redraw only the newly exposed band.
+ * The content is moved by `scroll_cb` of the display driver (e.g. with the controller's hardware scrolling)
+ * or in the frame buffer if 2 screen sized buffers are used.*/
+#ifndef LV_USE_FAST_SCROLL
+#  ifdef CONFIG_LV_USE_FAST_SCROLL
+#    define LV_USE_FAST_SCROLL CONFIG_LV_USE_FAST_SCROLL
+#  else
+#    define  LV_USE_FAST_SCROLL       0
+#  endif
+#endif
+
+/*1: Enable screen snapshots (`lv_scr_snapshot_enable()`).
+ * The screens are rendered off-screen, run length encoded, when the display is idle
+ * and `lv_scr_load()` flushes the snapshot instead of drawing the screen.*/
+#ifndef LV_USE_SCR_SNAPSHOT
+#  ifdef CONFIG_LV_USE_SCR_SNAPSHOT
+#    define LV_USE_SCR_SNAPSHOT CONFIG_LV_USE_SCR_SNAPSHOT
+#  else
+#    define  LV_USE_SCR_SNAPSHOT      0
+#  endif
+#endif
+
+/*1: Cache the area covered by the children of each object.
+ * The refresher skips all the children at once if they are not on the redrawn area.*/
+#ifndef LV_USE_SUBTREE_BOUNDS
+#  ifdef CONFIG_LV_USE_SUBTREE_BOUNDS
+#    define LV_USE_SUBTREE_BOUNDS CONFIG_LV_USE_SUBTREE_BOUNDS
+#  else
+#    define  LV_USE_SUBTREE_BOUNDS    0
+#  endif
+#endif
+
 /* 1: Enable file system (might be required for images */
 #ifndef LV_USE_FILESYSTEM
 #  ifdef CONFIG_LV_USE_FILESYSTEM
@@ -543,6 +646,28 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
 /*Declare the type of the user data of file system drivers (can be e.g. `void *`, `int`, `struct`)*/
 #endif
 
+/* Size of the read cache of the files opened only for reading [bytes].
+ * Small reads (e.g. image lines or font data) are served from this buffer
+ * which is refilled with one large read. Seeking inside the buffer doesn't call the driver.
+ * Set it to 0 to disable the cache. Used only if `LV_USE_FILESYSTEM` is enabled. */
+#ifndef LV_FS_CACHE_SIZE
+#  ifdef CONFIG_LV_FS_CACHE_SIZE
+#    define LV_FS_CACHE_SIZE CONFIG_LV_FS_CACHE_SIZE
+#  else
+#    define  LV_FS_CACHE_SIZE    0
+#  endif
+#endif
+
+/* Size of the block the font loader (`lv_font_load()`) reads from the font file at once [bytes].
+ * Allocated only while a font is loaded. Used only if `LV_USE_FILESYSTEM` is enabled. */
+#ifndef LV_FONT_LOADER_BUF_SIZE
+#  ifdef CONFIG_LV_FONT_LOADER_BUF_SIZE
+#    define LV_FONT_LOADER_BUF_SIZE CONFIG_LV_FONT_LOADER_BUF_SIZE
+#  else
+#    define  LV_FONT_LOADER_BUF_SIZE 1024
+#  endif
+#endif
+
 /*1: Add a `user_data` to drivers and objects*/
 #ifndef LV_USE_USER_DATA
 #  ifdef CONFIG_LV_USE_USER_DATA
@@ -561,6 +686,58 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
 #  endif
 #endif
 
+/*1: Enable the built-in profiler: refresh phase timers, draw time per widget type,
+ * counters and a history of the last frames. See `lv_prof.h`.
+ * With `LV_USE_PERF_MONITOR` the label shows the breakdown of the last frame too.*/
+#ifndef LV_USE_PROFILER
+#  ifdef CONFIG_LV_USE_PROFILER
+#    define LV_USE_PROFILER CONFIG_LV_USE_PROFILER
+#  else
+#    define  LV_USE_PROFILER         0
+#  endif
+#endif
+#if LV_USE_PROFILER
+#ifndef LV_PROFILER_HISTORY
+#  ifdef CONFIG_LV_PROFILER_HISTORY
+#    define LV_PROFILER_HISTORY CONFIG_LV_PROFILER_HISTORY
+#  else
+#    define  LV_PROFILER_HISTORY     16      /*Number of frames kept in the history*/
+#  endif
+#endif
+#ifndef LV_PROFILER_OBJ_TYPES
+#  ifdef CONFIG_LV_PROFILER_OBJ_TYPES
+#    define LV_PROFILER_OBJ_TYPES CONFIG_LV_PROFILER_OBJ_TYPES
+#  else
+#    define  LV_PROFILER_OBJ_TYPES   16      /*Max. number of widget types with separate draw time*/
+#  endif
+#endif
+
+/*1: Use a custom time source with µs resolution. 0: use `lv_tick_get()` (ms resolution)*/
+#ifndef LV_PROFILER_TIME_CUSTOM
+#  ifdef CONFIG_LV_PROFILER_TIME_CUSTOM
+#    define LV_PROFILER_TIME_CUSTOM CONFIG_LV_PROFILER_TIME_CUSTOM
+#  else
+#    define  LV_PROFILER_TIME_CUSTOM 0
+#  endif
+#endif
+#if LV_PROFILER_TIME_CUSTOM
+#ifndef LV_PROFILER_TIME_INCLUDE
+#  ifdef CONFIG_LV_PROFILER_TIME_INCLUDE
+#    define LV_PROFILER_TIME_INCLUDE CONFIG_LV_PROFILER_TIME_INCLUDE
+#  else
+#    define  LV_PROFILER_TIME_INCLUDE    "esp_timer.h"                   /*Header for the time function*/
+#  endif
+#endif
+#ifndef LV_PROFILER_TIME_US_EXPR
+#  ifdef CONFIG_LV_PROFILER_TIME_US_EXPR
+#    define LV_PROFILER_TIME_US_EXPR CONFIG_LV_PROFILER_TIME_US_EXPR
+#  else
+#    define  LV_PROFILER_TIME_US_EXPR    ((uint32_t)esp_timer_get_time()) /*Expression evaluating to current time in µs*/
+#  endif
+#endif
+#endif  /*LV_PROFILER_TIME_CUSTOM*/
+#endif  /*LV_USE_PROFILER*/
+
 /*1: Use the functions and types from the older API if possible */
 #ifndef LV_USE_API_EXTENSION_V6
 #  ifdef CONFIG_LV_USE_API_EXTENSION_V6
@@ -613,6 +790,30 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
 #  endif
 #endif
 
+/* Size of the rotated/zoomed image cache in bytes (requires LV_USE_IMG_TRANSFORM).
+ * The result of a transformation is kept as an ARGB bitmap so redrawing
+ * a statically rotated or zoomed image costs the same as drawing a plain ARGB image.
+ * Call `lv_img_cache_invalidate_src()` if the pixels of a variable image are modified in place.
+ * Set it to 0 to disable the cache */
+#ifndef LV_IMG_TRANSFORM_CACHE_SIZE
+#  ifdef CONFIG_LV_IMG_TRANSFORM_CACHE_SIZE
+#    define LV_IMG_TRANSFORM_CACHE_SIZE CONFIG_LV_IMG_TRANSFORM_CACHE_SIZE
+#  else
+#    define  LV_IMG_TRANSFORM_CACHE_SIZE         0
+#  endif
+#endif
+
+/* Round the angle of the cached transformations to this step [0.1 degree].
+ * Larger values let rotating animations reuse more cached entries
+ * at the expense of angle precision. */
+#ifndef LV_IMG_TRANSFORM_CACHE_ANGLE_STEP
+#  ifdef CONFIG_LV_IMG_TRANSFORM_CACHE_ANGLE_STEP
+#    define LV_IMG_TRANSFORM_CACHE_ANGLE_STEP CONFIG_LV_IMG_TRANSFORM_CACHE_ANGLE_STEP
+#  else
+#    define  LV_IMG_TRANSFORM_CACHE_ANGLE_STEP   1
+#  endif
+#endif
+
 /*Declare the type of the user data of image decoder (can be e.g. `void *`, `int`, `struct`)*/
 
 /*=====================
@@ -1440,6 +1641,43 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
 #  endif
 #endif
 
+/*1: Refresh the layout and auto fit of the containers only once before the next refresh
+ * (or when a coordinate is read) instead of after every change of their children.
+ * The areas invalidated meanwhile are merged. See `lv_obj_update_layout()`*/
+#ifndef LV_USE_LAYOUT_DEFER
+#  ifdef CONFIG_LV_USE_LAYOUT_DEFER
+#    define LV_USE_LAYOUT_DEFER CONFIG_LV_USE_LAYOUT_DEFER
+#  else
+#    define  LV_USE_LAYOUT_DEFER         0
+#  endif
+#endif
+
+/*1: Keep a list of the objects using a style in the style itself
+ * so `lv_obj_report_style_mod(style)` refreshes only those objects instead of all*/
+#ifndef LV_USE_STYLE_INDEX
+#  ifdef CONFIG_LV_USE_STYLE_INDEX
+#    define LV_USE_STYLE_INDEX CONFIG_LV_USE_STYLE_INDEX
+#  else
+#    define  LV_USE_STYLE_INDEX          0
+#  endif
+#endif
+
+/*1: Store the objects in a more compact way to use less RAM per widget:
+ * - the signal and design functions are shared by the objects of the same type,
+ * - the realign parameters and the `LV_EXT_CLICK_AREA_FULL` paddings are stored in hash tables,
+ *   only for the objects really using them. The align parameters are kept only for the objects
+ *   with auto realign and for the last aligned object, so `lv_obj_realign()` works only for these.
+ * It saves about 24 bytes per object on 32 bit targets. The node in the parent's child list and the
+ * ext. data are still allocated separately for every object.
+ * Calling the signal/design functions and reading these properties gets a little slower*/
+#ifndef LV_USE_OBJ_COMPACT
+#  ifdef CONFIG_LV_USE_OBJ_COMPACT
+#    define LV_USE_OBJ_COMPACT CONFIG_LV_USE_OBJ_COMPACT
+#  else
+#    define  LV_USE_OBJ_COMPACT          0
+#  endif
+#endif
+
 /* Enable to make the object clickable on a larger area.
  * LV_EXT_CLICK_AREA_OFF or 0: Disable this feature
  * LV_EXT_CLICK_AREA_TINY: The extra area can be adjusted horizontally and vertically (0..255 px)
@@ -1928,6 +2166,14 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
 #    define  LV_TABLE_CELL_STYLE_CNT 4
 #  endif
 #endif
+/*Size of the buffer the data callback can print a cell's text to (on the stack while drawing)*/
+#ifndef LV_TABLE_DATA_BUF_SIZE
+#  ifdef CONFIG_LV_TABLE_DATA_BUF_SIZE
+#    define LV_TABLE_DATA_BUF_SIZE CONFIG_LV_TABLE_DATA_BUF_SIZE
+#  else
+#    define  LV_TABLE_DATA_BUF_SIZE  64
+#  endif
+#endif
 #endif
 
 /*Tab (dependencies: lv_page, lv_btnm)*/
@@ -13,6 +13,21 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_USE_SCR_SNAPSHOT
+/*Number of rows rendered at once when a snapshot is created. The task renders one strip per run.*/
+#define SNAPSHOT_STRIP_ROWS     10
+
+/*Period of checking for outdated snapshots [ms]*/
+#define SNAPSHOT_TASK_PERIOD    100
+
+/* The pixels are stored in blocks. A block starts with a 2 bytes header: the number of pixels
+ * and a flag telling the block is one color repeated. Else the colors of the pixels follow the header.*/
+#define SNAPSHOT_BLOCK_REPEAT   0x8000
+#define SNAPSHOT_BLOCK_MAX      0x7FFF
+
+/*Store the same color only this many times in a row as a repeated block*/
+#define SNAPSHOT_REPEAT_MIN     3
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -28,9 +43,21 @@
     static void scr_anim_ready(lv_anim_t * a);
 #endif
 
+#if LV_USE_SCR_SNAPSHOT
+    static lv_res_t snapshot_render_strip(lv_disp_t * disp, lv_scr_snapshot_t * snapshot, bool * ready);
+    static void snapshot_enc_reset(lv_scr_snapshot_t * snapshot);
+    static bool snapshot_encode(lv_scr_snapshot_enc_t * enc, const lv_color_t * px, uint32_t px_cnt);
+    static bool snapshot_enc_reserve(lv_scr_snapshot_enc_t * enc, uint32_t size);
+    static void snapshot_enc_header(lv_scr_snapshot_enc_t * enc, uint16_t header);
+    static void snapshot_task(lv_task_t * task);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_USE_SCR_SNAPSHOT
+    static uint32_t snapshot_cnt;   /*Number of enabled snapshots on all displays*/
+#endif
 
 /**********************
  *      MACROS
@@ -84,6 +111,22 @@ void lv_disp_load_scr(lv_obj_t * scr)
     if(!d) return;  /*Shouldn't happen, just to be sure*/
     d->act_scr = scr;
 
+#if LV_USE_SCR_SNAPSHOT
+    lv_scr_snapshot_t * snapshot = _lv_scr_snapshot_find(scr);
+    if(snapshot && snapshot->data) {
+        d->snapshot_show = snapshot;
+
+        /*Loading doesn't change the screen so its snapshot remains valid*/
+        lv_area_t dirty[LV_SCR_SNAPSHOT_DIRTY_CNT];
+        uint8_t dirty_cnt = snapshot->dirty_cnt;
+        _lv_memcpy_small(dirty, snapshot->dirty, sizeof(dirty));
+        lv_obj_invalidate(scr);
+        _lv_memcpy_small(snapshot->dirty, dirty, sizeof(dirty));
+        snapshot->dirty_cnt = dirty_cnt;
+        return;
+    }
+#endif
+
     lv_obj_invalidate(scr);
 }
 
@@ -157,6 +200,10 @@ void lv_disp_set_bg_color(lv_disp_t * disp, lv_color_t color)
     lv_area_t a;
     lv_area_set(&a, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
     _lv_inv_area(disp, &a);
+#if LV_USE_SCR_SNAPSHOT
+    /*The background is visible on the transparent screens*/
+    _lv_scr_snapshot_clean(disp);
+#endif
 
 }
 
@@ -178,6 +225,10 @@ void lv_disp_set_bg_image(lv_disp_t * disp, const void  * img_src)
     lv_area_t a;
     lv_area_set(&a, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
     _lv_inv_area(disp, &a);
+#if LV_USE_SCR_SNAPSHOT
+    /*The background is visible on the transparent screens*/
+    _lv_scr_snapshot_clean(disp);
+#endif
 }
 
 /**
@@ -198,8 +249,266 @@ void lv_disp_set_bg_opa(lv_disp_t * disp, lv_opa_t opa)
     lv_area_t a;
     lv_area_set(&a, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
     _lv_inv_area(disp, &a);
+#if LV_USE_SCR_SNAPSHOT
+    /*The background is visible on the transparent screens*/
+    _lv_scr_snapshot_clean(disp);
+#endif
+}
+
+#if LV_USE_SCR_SNAPSHOT
+
+/**
+ * Keep a pre-rendered snapshot of a screen. When the screen is loaded the snapshot is flushed
+ * at once instead of drawing the screen and only the parts changed since the snapshot are redrawn.
+ * The snapshot is rendered strip by strip when the display is idle and rendered again after the screen has changed.
+ * @param scr pointer to a screen
+ * @return LV_RES_OK: the snapshot is enabled;
+ *         LV_RES_INV: the display can't use snapshots (e.g. `set_px_cb` or `rounder_cb` is used)
+ */
+lv_res_t lv_scr_snapshot_enable(lv_obj_t * scr)
+{
+    if(lv_obj_get_parent(scr) != NULL) {
+        LV_LOG_WARN("lv_scr_snapshot_enable: not a screen");
+        return LV_RES_INV;
+    }
+
+    lv_disp_t * disp = lv_obj_get_disp(scr);
+    if(_lv_scr_snapshot_is_supported(disp) == false) {
+        LV_LOG_WARN("lv_scr_snapshot_enable: the display can't show snapshots");
+        return LV_RES_INV;
+    }
+
+    if(_lv_scr_snapshot_find(scr)) return LV_RES_OK;
+
+    if(disp->snapshot_task == NULL) {
+        disp->snapshot_task = lv_task_create(snapshot_task, SNAPSHOT_TASK_PERIOD, LV_TASK_PRIO_LOWEST, disp);
+        LV_ASSERT_MEM(disp->snapshot_task);
+        if(disp->snapshot_task == NULL) return LV_RES_INV;
+    }
+
+    lv_scr_snapshot_t * snapshot = _lv_ll_ins_tail(&disp->snapshot_ll);
+    LV_ASSERT_MEM(snapshot);
+    if(snapshot == NULL) return LV_RES_INV;
+
+    _lv_memset_00(snapshot, sizeof(lv_scr_snapshot_t));
+    snapshot->scr = scr;
+    snapshot_cnt++;
+
+    return LV_RES_OK;
+}
+
+/**
+ * Stop keeping the snapshot of a screen and free its memory
+ * @param scr pointer to a screen
+ */
+void lv_scr_snapshot_disable(lv_obj_t * scr)
+{
+    lv_scr_snapshot_t * snapshot = _lv_scr_snapshot_find(scr);
+    if(snapshot == NULL) return;
+
+    lv_disp_t * disp = lv_obj_get_disp(scr);
+    if(disp->snapshot_show == snapshot) disp->snapshot_show = NULL;
+
+    if(snapshot->data) lv_mem_free(snapshot->data);
+    snapshot_enc_reset(snapshot);
+    _lv_ll_remove(&disp->snapshot_ll, snapshot);
+    lv_mem_free(snapshot);
+    snapshot_cnt--;
+}
+
+/**
+ * Render the snapshot of a screen now, without waiting for the display to be idle
+ * @param scr pointer to a screen with enabled snapshot
+ * @return LV_RES_OK: the snapshot is rendered; LV_RES_INV: the snapshot is not enabled or out of memory
+ */
+lv_res_t lv_scr_snapshot_update(lv_obj_t * scr)
+{
+    lv_scr_snapshot_t * snapshot = _lv_scr_snapshot_find(scr);
+    if(snapshot == NULL) return LV_RES_INV;
+
+    lv_disp_t * disp = lv_obj_get_disp(scr);
+    bool ready = false;
+    while(!ready) {
+        if(snapshot_render_strip(disp, snapshot, &ready) != LV_RES_OK) return LV_RES_INV;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Tell whether the snapshot of a screen is rendered and up to date
+ * @param scr pointer to a screen
+ * @return true: loading the screen needs only flushing the snapshot
+ */
+bool lv_scr_snapshot_is_ready(const lv_obj_t * scr)
+{
+    lv_scr_snapshot_t * snapshot = _lv_scr_snapshot_find(scr);
+    if(snapshot == NULL) return false;
+
+    return snapshot->data != NULL && snapshot->dirty_cnt == 0;
+}
+
+/**
+ * Get the size of the encoded pixels of a screen's snapshot
+ * @param scr pointer to a screen
+ * @return the size in bytes or 0 if there is no rendered snapshot
+ */
+uint32_t lv_scr_snapshot_get_size(const lv_obj_t * scr)
+{
+    lv_scr_snapshot_t * snapshot = _lv_scr_snapshot_find(scr);
+    if(snapshot == NULL || snapshot->data == NULL) return 0;
+
+    return snapshot->data_size;
+}
+
+/**
+ * Get the snapshot of a screen
+ * @param scr pointer to a screen
+ * @return pointer to the snapshot or NULL if it's not enabled
+ */
+lv_scr_snapshot_t * _lv_scr_snapshot_find(const lv_obj_t * scr)
+{
+    if(snapshot_cnt == 0) return NULL;
+
+    lv_disp_t * disp = lv_obj_get_disp(scr);
+    if(disp == NULL) return NULL;
+
+    lv_scr_snapshot_t * snapshot;
+    _LV_LL_READ(disp->snapshot_ll, snapshot) {
+        if(snapshot->scr == scr) return snapshot;
+    }
+
+    return NULL;
 }
 
+/**
+ * Tell whether the screens of a display can be shown from snapshots
+ * @param disp pointer to a display
+ * @return true: the display uses `lv_color_t` buffers without rounding
+ */
+bool _lv_scr_snapshot_is_supported(lv_disp_t * disp)
+{
+    if(disp == NULL) return false;
+
+    lv_disp_drv_t * drv = &disp->driver;
+    if(drv->set_px_cb || drv->mono_page || drv->rounder_cb) return false;
+#if LV_COLOR_SCREEN_TRANSP
+    if(drv->screen_transp) return false;
+#endif
+#if LV_USE_DRAW_BACKEND
+    if(drv->draw_backend) return false;
+#endif
+
+    return true;
+}
+
+/**
+ * Mark an area of a screen as changed in its snapshot
+ * @param obj pointer to an object which has changed
+ * @param area the changed area
+ */
+void _lv_scr_snapshot_inv(const lv_obj_t * obj, const lv_area_t * area)
+{
+    if(snapshot_cnt == 0) return;
+
+    lv_obj_t * scr = lv_obj_get_screen(obj);
+    lv_scr_snapshot_t * snapshot = _lv_scr_snapshot_find(scr);
+    if(snapshot == NULL) return;
+    if(snapshot->data == NULL && snapshot->enc.data == NULL) return;
+
+    lv_disp_t * disp = lv_obj_get_disp(scr);
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+
+    lv_area_t a;
+    if(_lv_area_intersect(&a, area, &scr_area) == false) return;
+
+    /*The strips rendered so far are outdated so start the rendering again.
+     *The strips not rendered yet will have the change.*/
+    if(snapshot->enc.data && a.y1 < snapshot->enc.y) snapshot_enc_reset(snapshot);
+
+    if(snapshot->data == NULL) return;
+
+    /*If all areas are used the closest ones are joined. Their bounding box might cover the whole
+     *screen and then the snapshot is not used until it's rendered again.*/
+    _lv_area_list_add(snapshot->dirty, &snapshot->dirty_cnt, LV_SCR_SNAPSHOT_DIRTY_CNT, &a);
+}
+
+/**
+ * Free the rendered data of all the snapshots of a display. They will be rendered again.
+ * @param disp pointer to a display
+ */
+void _lv_scr_snapshot_clean(lv_disp_t * disp)
+{
+    lv_scr_snapshot_t * snapshot;
+    _LV_LL_READ(disp->snapshot_ll, snapshot) {
+        if(snapshot->data) lv_mem_free(snapshot->data);
+        snapshot->data = NULL;
+        snapshot->data_size = 0;
+        snapshot->dirty_cnt = 0;
+        snapshot_enc_reset(snapshot);
+    }
+
+    disp->snapshot_show = NULL;
+}
+
+/**
+ * Start reading the pixels of a snapshot
+ * @param dec pointer to a decoder state to initialize
+ * @param snapshot pointer to a rendered snapshot
+ */
+void _lv_scr_snapshot_dec_init(lv_scr_snapshot_dec_t * dec, const lv_scr_snapshot_t * snapshot)
+{
+    dec->data = snapshot->data;
+    dec->end = snapshot->data + snapshot->data_size;
+    dec->cnt = 0;
+    dec->repeat = 0;
+}
+
+/**
+ * Read the next pixels of a snapshot
+ * @param dec pointer to a decoder state
+ * @param buf store the pixels here
+ * @param px_cnt number of pixels to read
+ */
+void _lv_scr_snapshot_decode(lv_scr_snapshot_dec_t * dec, lv_color_t * buf, uint32_t px_cnt)
+{
+    while(px_cnt) {
+        /*Start the next block*/
+        if(dec->cnt == 0) {
+            if(dec->data + 2 > dec->end) {
+                LV_LOG_WARN("_lv_scr_snapshot_decode: out of data");
+                return;
+            }
+            uint16_t header = dec->data[0] | (dec->data[1] << 8);
+            dec->data += 2;
+            dec->repeat = header & SNAPSHOT_BLOCK_REPEAT ? 1 : 0;
+            dec->cnt = header & SNAPSHOT_BLOCK_MAX;
+        }
+
+        uint32_t n = LV_MATH_MIN(dec->cnt, px_cnt);
+        if(dec->repeat) {
+            lv_color_t color;
+            _lv_memcpy_small(&color, dec->data, sizeof(lv_color_t));
+            uint32_t i;
+            for(i = 0; i < n; i++) buf[i] = color;
+        }
+        else {
+            _lv_memcpy(buf, dec->data, n * sizeof(lv_color_t));
+            dec->data += n * sizeof(lv_color_t);
+        }
+
+        buf += n;
+        px_cnt -= n;
+        dec->cnt -= n;
+
+        /*The color of a repeated block can be skipped only at its end*/
+        if(dec->repeat && dec->cnt == 0) dec->data += sizeof(lv_color_t);
+    }
+}
+
+#endif /*LV_USE_SCR_SNAPSHOT*/
+
 #if LV_USE_ANIMATION
 
 /**
@@ -418,3 +727,159 @@ static void scr_anim_ready(lv_anim_t * a)
     lv_style_remove_prop(lv_obj_get_local_style(a->var, LV_OBJ_PART_MAIN), LV_STYLE_OPA_SCALE);
 }
 #endif
+
+#if LV_USE_SCR_SNAPSHOT
+/**
+ * Render the next strip of a snapshot. The finished snapshot replaces the old one.
+ * @param disp pointer to the display of the snapshot
+ * @param snapshot pointer to a snapshot
+ * @param ready set to true if the last strip was rendered
+ * @return LV_RES_OK: the strip is rendered; LV_RES_INV: out of memory, the rendering is dropped
+ */
+static lv_res_t snapshot_render_strip(lv_disp_t * disp, lv_scr_snapshot_t * snapshot, bool * ready)
+{
+    *ready = false;
+
+#if LV_USE_LAYOUT_DEFER
+    /*Render the final positions. The changes might restart the rendering.*/
+    lv_obj_update_layout();
+#endif
+
+    lv_scr_snapshot_enc_t * enc = &snapshot->enc;
+    lv_coord_t hres = lv_disp_get_hor_res(disp);
+    lv_coord_t vres = lv_disp_get_ver_res(disp);
+    lv_coord_t strip_h = LV_MATH_MIN(SNAPSHOT_STRIP_ROWS, vres - enc->y);
+    lv_color_t * strip = _lv_mem_buf_get(hres * strip_h * sizeof(lv_color_t));
+    if(strip == NULL) return LV_RES_INV;
+
+    lv_area_t area;
+    lv_area_set(&area, 0, enc->y, hres - 1, enc->y + strip_h - 1);
+    _lv_refr_render_scr(disp, snapshot->scr, &area, strip);
+    bool ok = snapshot_encode(enc, strip, lv_area_get_size(&area));
+
+    _lv_mem_buf_release(strip);
+
+    if(!ok) {
+        snapshot_enc_reset(snapshot);
+        return LV_RES_INV;
+    }
+
+    enc->y += strip_h;
+    if(enc->y < vres) return LV_RES_OK;
+
+    /*Give back the unused capacity*/
+    uint8_t * data = lv_mem_realloc(enc->data, enc->size);
+    if(data) enc->data = data;
+
+    if(snapshot->data) lv_mem_free(snapshot->data);
+    snapshot->data = enc->data;
+    snapshot->data_size = enc->size;
+    snapshot->dirty_cnt = 0;
+    _lv_memset_00(enc, sizeof(lv_scr_snapshot_enc_t));
+
+    *ready = true;
+    return LV_RES_OK;
+}
+
+/**
+ * Drop the strips of a snapshot rendered so far
+ * @param snapshot pointer to a snapshot
+ */
+static void snapshot_enc_reset(lv_scr_snapshot_t * snapshot)
+{
+    if(snapshot->enc.data) lv_mem_free(snapshot->enc.data);
+    _lv_memset_00(&snapshot->enc, sizeof(lv_scr_snapshot_enc_t));
+}
+
+/**
+ * Append pixels to a snapshot being rendered
+ * @param enc pointer to the data being rendered
+ * @param px pointer to the pixels
+ * @param px_cnt number of pixels
+ * @return true: success; false: out of memory
+ */
+static bool snapshot_encode(lv_scr_snapshot_enc_t * enc, const lv_color_t * px, uint32_t px_cnt)
+{
+    uint32_t i = 0;
+    while(i < px_cnt) {
+        uint32_t run = 1;
+        while(i + run < px_cnt && run < SNAPSHOT_BLOCK_MAX && px[i + run].full == px[i].full) run++;
+
+        if(run >= SNAPSHOT_REPEAT_MIN) {
+            if(!snapshot_enc_reserve(enc, 2 + sizeof(lv_color_t))) return false;
+            snapshot_enc_header(enc, SNAPSHOT_BLOCK_REPEAT | run);
+            _lv_memcpy_small(enc->data + enc->size, &px[i], sizeof(lv_color_t));
+            enc->size += sizeof(lv_color_t);
+            i += run;
+            continue;
+        }
+
+        /*Store the pixels as they are until a repeated block could start*/
+        uint32_t cnt = run;
+        while(i + cnt < px_cnt && cnt < SNAPSHOT_BLOCK_MAX) {
+            const lv_color_t * p = &px[i + cnt];
+            if(i + cnt + 2 < px_cnt && p[0].full == p[1].full && p[0].full == p[2].full) break;
+            cnt++;
+        }
+
+        if(!snapshot_enc_reserve(enc, 2 + cnt * sizeof(lv_color_t))) return false;
+        snapshot_enc_header(enc, cnt);
+        _lv_memcpy(enc->data + enc->size, &px[i], cnt * sizeof(lv_color_t));
+        enc->size += cnt * sizeof(lv_color_t);
+        i += cnt;
+    }
+
+    return true;
+}
+
+/**
+ * Be sure a snapshot being rendered has space for some more bytes
+ * @param enc pointer to the data being rendered
+ * @param size number of bytes to add
+ * @return true: success; false: out of memory
+ */
+static bool snapshot_enc_reserve(lv_scr_snapshot_enc_t * enc, uint32_t size)
+{
+    if(enc->size + size <= enc->capacity) return true;
+
+    uint32_t capacity = LV_MATH_MAX(enc->capacity * 2, enc->size + size);
+    uint8_t * data = lv_mem_realloc(enc->data, capacity);
+    if(data == NULL) return false;
+
+    enc->data = data;
+    enc->capacity = capacity;
+    return true;
+}
+
+static void snapshot_enc_header(lv_scr_snapshot_enc_t * enc, uint16_t header)
+{
+    enc->data[enc->size] = header & 0xFF;
+    enc->data[enc->size + 1] = header >> 8;
+    enc->size += 2;
+}
+
+/**
+ * Render an outdated snapshot of a not loaded screen if the display is idle
+ * @param task pointer to the task, its `user_data` is the display
+ */
+static void snapshot_task(lv_task_t * task)
+{
+    lv_disp_t * disp = task->user_data;
+
+    /*Not idle if something will be redrawn or a screen is being loaded*/
+    if(disp->inv_p != 0 || disp->prev_scr || disp->snapshot_show) return;
+    if(_lv_scr_snapshot_is_supported(disp) == false) return;
+
+    /*Render only one strip of one snapshot at once to keep the UI responsive*/
+    lv_scr_snapshot_t * snapshot;
+    _LV_LL_READ(disp->snapshot_ll, snapshot) {
+        if(snapshot->scr == disp->act_scr) continue;
+        if(snapshot->data == NULL || snapshot->dirty_cnt) {
+            /*Continue in the next round of the task handler if more strips are needed*/
+            bool ready;
+            if(snapshot_render_strip(disp, snapshot, &ready) == LV_RES_OK && !ready) lv_task_ready(task);
+            break;
+        }
+    }
+}
+#endif
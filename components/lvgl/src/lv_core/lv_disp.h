@@ -37,6 +37,16 @@ typedef enum {
     LV_SCR_LOAD_ANIM_FADE_ON,
 } lv_scr_load_anim_t;
 
+#if LV_USE_SCR_SNAPSHOT
+/** State of reading the pixels of a snapshot*/
+typedef struct {
+    const uint8_t * data;   /**< The next header or color to read*/
+    const uint8_t * end;    /**< End of the snapshot's data*/
+    uint16_t cnt;           /**< Number of pixels left from the current block*/
+    uint8_t repeat : 1;     /**< 1: the current block is one color repeated `cnt` times*/
+} lv_scr_snapshot_dec_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -106,6 +116,89 @@ void lv_disp_set_bg_image(lv_disp_t * disp, const void  * img_src);
  */
 void lv_disp_set_bg_opa(lv_disp_t * disp, lv_opa_t opa);
 
+#if LV_USE_SCR_SNAPSHOT
+
+/**
+ * Keep a pre-rendered snapshot of a screen. When the screen is loaded the snapshot is flushed
+ * at once instead of drawing the screen and only the parts changed since the snapshot are redrawn.
+ * The snapshot is rendered when the display is idle and rendered again after the screen has changed.
+ * @param scr pointer to a screen
+ * @return LV_RES_OK: the snapshot is enabled;
+ *         LV_RES_INV: the display can't use snapshots (e.g. `set_px_cb` or `rounder_cb` is used)
+ */
+lv_res_t lv_scr_snapshot_enable(lv_obj_t * scr);
+
+/**
+ * Stop keeping the snapshot of a screen and free its memory
+ * @param scr pointer to a screen
+ */
+void lv_scr_snapshot_disable(lv_obj_t * scr);
+
+/**
+ * Render the snapshot of a screen now, without waiting for the display to be idle
+ * @param scr pointer to a screen with enabled snapshot
+ * @return LV_RES_OK: the snapshot is rendered; LV_RES_INV: the snapshot is not enabled or out of memory
+ */
+lv_res_t lv_scr_snapshot_update(lv_obj_t * scr);
+
+/**
+ * Tell whether the snapshot of a screen is rendered and up to date
+ * @param scr pointer to a screen
+ * @return true: loading the screen needs only flushing the snapshot
+ */
+bool lv_scr_snapshot_is_ready(const lv_obj_t * scr);
+
+/**
+ * Get the size of the encoded pixels of a screen's snapshot
+ * @param scr pointer to a screen
+ * @return the size in bytes or 0 if there is no rendered snapshot
+ */
+uint32_t lv_scr_snapshot_get_size(const lv_obj_t * scr);
+
+/**
+ * Get the snapshot of a screen
+ * @param scr pointer to a screen
+ * @return pointer to the snapshot or NULL if it's not enabled
+ */
+lv_scr_snapshot_t * _lv_scr_snapshot_find(const lv_obj_t * scr);
+
+/**
+ * Tell whether the screens of a display can be shown from snapshots
+ * @param disp pointer to a display
+ * @return true: the display uses `lv_color_t` buffers without rounding
+ */
+bool _lv_scr_snapshot_is_supported(lv_disp_t * disp);
+
+/**
+ * Mark an area of a screen as changed in its snapshot
+ * @param obj pointer to an object which has changed
+ * @param area the changed area
+ */
+void _lv_scr_snapshot_inv(const lv_obj_t * obj, const lv_area_t * area);
+
+/**
+ * Free the rendered data of all the snapshots of a display. They will be rendered again.
+ * @param disp pointer to a display
+ */
+void _lv_scr_snapshot_clean(lv_disp_t * disp);
+
+/**
+ * Start reading the pixels of a snapshot
+ * @param dec pointer to a decoder state to initialize
+ * @param snapshot pointer to a rendered snapshot
+ */
+void _lv_scr_snapshot_dec_init(lv_scr_snapshot_dec_t * dec, const lv_scr_snapshot_t * snapshot);
+
+/**
+ * Read the next pixels of a snapshot
+ * @param dec pointer to a decoder state
+ * @param buf store the pixels here
+ * @param px_cnt number of pixels to read
+ */
+void _lv_scr_snapshot_decode(lv_scr_snapshot_dec_t * dec, lv_color_t * buf, uint32_t px_cnt);
+
+#endif /*LV_USE_SCR_SNAPSHOT*/
+
 #if LV_USE_ANIMATION
 
 /**
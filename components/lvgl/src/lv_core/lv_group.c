@@ -9,13 +9,21 @@
 #include "lv_group.h"
 #if LV_USE_GROUP != 0
 #include <stddef.h>
+#include <string.h>
 #include "../lv_misc/lv_debug.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_misc/lv_gc.h"
+#include "../lv_misc/lv_math.h"
 
 /*********************
  *      DEFINES
  *********************/
+#if LV_USE_GROUP_INDEX
+#define GROUP_INDEX_MIN_SIZE    8
+#define GROUP_INDEX_MAX_CNT     0x3FFF  /*Larger groups are handled by walking `obj_ll`*/
+#define GROUP_INDEX_NONE        0xFFFF  /*No item (empty map slot or no neighbor)*/
+#define GROUP_INDEX_UNKNOWN     0xFFFE  /*The neighbor wasn't searched yet*/
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -26,8 +34,27 @@
  **********************/
 static void focus_next_core(lv_group_t * group, void * (*begin)(const lv_ll_t *),
                             void * (*move)(const lv_ll_t *, const void *));
+static void focus_node(lv_group_t * group, lv_obj_t ** obj_next);
 static void lv_group_refocus(lv_group_t * g);
 static void obj_to_foreground(lv_obj_t * obj);
+static bool obj_is_focusable(lv_obj_t * obj);
+#if LV_USE_GROUP_INDEX
+static lv_group_index_t * index_get(lv_group_t * group);
+static bool index_build(lv_group_t * group);
+static void index_free(lv_group_index_t * index);
+static void index_add(lv_group_t * group, lv_obj_t ** node);
+static lv_obj_t ** index_remove(lv_group_t * group, lv_obj_t * obj);
+static bool index_find_next(lv_group_t * group, bool next, lv_obj_t *** obj_next);
+static uint16_t index_find(const lv_group_index_t * index, const lv_obj_t * obj);
+static uint32_t index_hash(const lv_group_index_t * index, const lv_obj_t * obj);
+static void index_map_add(lv_group_index_t * index, uint16_t id);
+static void index_map_remove(lv_group_index_t * index, uint16_t id);
+static uint32_t index_focusable_pos(const lv_group_index_t * index, uint16_t id);
+static void index_set_focusable(lv_group_index_t * index, uint16_t id, bool en);
+static uint16_t index_get_neighbor(lv_group_index_t * index, uint16_t id, lv_key_t dir);
+static lv_obj_t * index_get_root(const lv_group_index_t * index);
+static bool index_is_parent(const lv_obj_t * par, const lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -68,6 +95,10 @@ lv_group_t * lv_group_create(void)
     group->refocus_policy = LV_GROUP_REFOCUS_POLICY_PREV;
     group->wrap           = 1;
 
+#if LV_USE_GROUP_INDEX
+    _lv_memset_00(&group->index, sizeof(lv_group_index_t));
+#endif
+
 #if LV_USE_USER_DATA
     _lv_memset_00(&group->user_data, sizeof(lv_group_user_data_t));
 #endif
@@ -83,7 +114,7 @@ void lv_group_del(lv_group_t * group)
 {
     /*Defocus the currently focused object*/
     if(group->obj_focus != NULL) {
-        (*group->obj_focus)->signal_cb(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
+        _LV_OBJ_SIGNAL_CB(*group->obj_focus)(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
         lv_obj_invalidate(*group->obj_focus);
     }
 
@@ -94,6 +125,9 @@ void lv_group_del(lv_group_t * group)
     }
 
     _lv_ll_clear(&(group->obj_ll));
+#if LV_USE_GROUP_INDEX
+    index_free(&group->index);
+#endif
     _lv_ll_remove(&LV_GC_ROOT(_lv_group_ll), group);
     lv_mem_free(group);
 }
@@ -107,14 +141,27 @@ void lv_group_add_obj(lv_group_t * group, lv_obj_t * obj)
 {
     if(group == NULL) return;
     /*Do not add the object twice*/
-    lv_obj_t ** obj_i;
-    _LV_LL_READ(group->obj_ll, obj_i) {
-        if((*obj_i) == obj) {
-            LV_LOG_INFO("lv_group_add_obj: the object is already added to this group");
-            return;
+    bool added = false;
+#if LV_USE_GROUP_INDEX
+    lv_group_index_t * index = index_get(group);
+    if(index) added = index_find(index, obj) != GROUP_INDEX_NONE;
+    else
+#endif
+    {
+        lv_obj_t ** obj_i;
+        _LV_LL_READ(group->obj_ll, obj_i) {
+            if((*obj_i) == obj) {
+                added = true;
+                break;
+            }
         }
     }
 
+    if(added) {
+        LV_LOG_INFO("lv_group_add_obj: the object is already added to this group");
+        return;
+    }
+
     /*If the object is already in a group and focused then defocus it*/
     if(obj->group_p) {
         if(lv_obj_is_focused(obj)) {
@@ -130,6 +177,10 @@ void lv_group_add_obj(lv_group_t * group, lv_obj_t * obj)
     if(next == NULL) return;
     *next = obj;
 
+#if LV_USE_GROUP_INDEX
+    index_add(group, next);
+#endif
+
     /* If the head and the tail is equal then there is only one object in the linked list.
      * In this case automatically activate it*/
     if(_lv_ll_get_head(&group->obj_ll) == next) {
@@ -152,7 +203,7 @@ void lv_group_remove_obj(lv_obj_t * obj)
 
         /*If this is the only object in the group then focus to nothing.*/
         if(_lv_ll_get_head(&g->obj_ll) == g->obj_focus && _lv_ll_get_tail(&g->obj_ll) == g->obj_focus) {
-            (*g->obj_focus)->signal_cb(*g->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
+            _LV_OBJ_SIGNAL_CB(*g->obj_focus)(*g->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
         }
         /*If there more objects in the group then focus to the next/prev object*/
         else {
@@ -168,15 +219,21 @@ void lv_group_remove_obj(lv_obj_t * obj)
     }
 
     /*Search the object and remove it from its group */
-    lv_obj_t ** i;
-    _LV_LL_READ(g->obj_ll, i) {
-        if(*i == obj) {
-            _lv_ll_remove(&g->obj_ll, i);
-            lv_mem_free(i);
-            obj->group_p = NULL;
-            break;
+    lv_obj_t ** i = NULL;
+#if LV_USE_GROUP_INDEX
+    i = index_remove(g, obj);
+#endif
+    if(i == NULL) {
+        _LV_LL_READ(g->obj_ll, i) {
+            if(*i == obj) break;
         }
     }
+
+    if(i) {
+        _lv_ll_remove(&g->obj_ll, i);
+        lv_mem_free(i);
+        obj->group_p = NULL;
+    }
 }
 
 /**
@@ -187,7 +244,7 @@ void lv_group_remove_all_objs(lv_group_t * group)
 {
     /*Defocus the currently focused object*/
     if(group->obj_focus != NULL) {
-        (*group->obj_focus)->signal_cb(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
+        _LV_OBJ_SIGNAL_CB(*group->obj_focus)(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
         lv_obj_invalidate(*group->obj_focus);
         group->obj_focus = NULL;
     }
@@ -199,6 +256,9 @@ void lv_group_remove_all_objs(lv_group_t * group)
     }
 
     _lv_ll_clear(&(group->obj_ll));
+#if LV_USE_GROUP_INDEX
+    index_free(&group->index);
+#endif
 }
 
 /**
@@ -218,31 +278,40 @@ void lv_group_focus_obj(lv_obj_t * obj)
     /*On defocus edit mode must be leaved*/
     lv_group_set_editing(g, false);
 
-    lv_obj_t ** i;
-    _LV_LL_READ(g->obj_ll, i) {
-        if(*i == obj) {
-            if(g->obj_focus != NULL) {
-                (*g->obj_focus)->signal_cb(*g->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
-                lv_res_t res = lv_event_send(*g->obj_focus, LV_EVENT_DEFOCUSED, NULL);
-                if(res != LV_RES_OK) return;
-                lv_obj_invalidate(*g->obj_focus);
-            }
-
-            g->obj_focus = i;
+    lv_obj_t ** i = NULL;
+#if LV_USE_GROUP_INDEX
+    lv_group_index_t * index = index_get(g);
+    if(index) {
+        uint16_t id = index_find(index, obj);
+        if(id != GROUP_INDEX_NONE) i = index->items[id].node;
+    }
+    else
+#endif
+    {
+        _LV_LL_READ(g->obj_ll, i) {
+            if(*i == obj) break;
+        }
+    }
 
-            if(g->obj_focus != NULL) {
-                (*g->obj_focus)->signal_cb(*g->obj_focus, LV_SIGNAL_FOCUS, NULL);
-                if(g->focus_cb) g->focus_cb(g);
-                lv_res_t res = lv_event_send(*g->obj_focus, LV_EVENT_FOCUSED, NULL);
-                if(res != LV_RES_OK) return;
-                lv_obj_invalidate(*g->obj_focus);
+    if(i == NULL) return;
 
-                /*If the object or its parent has `top == true` bring it to the foreground*/
-                obj_to_foreground(*g->obj_focus);
-            }
-            break;
-        }
+    if(g->obj_focus != NULL) {
+        _LV_OBJ_SIGNAL_CB(*g->obj_focus)(*g->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
+        lv_res_t res = lv_event_send(*g->obj_focus, LV_EVENT_DEFOCUSED, NULL);
+        if(res != LV_RES_OK) return;
+        lv_obj_invalidate(*g->obj_focus);
     }
+
+    g->obj_focus = i;
+
+    _LV_OBJ_SIGNAL_CB(*g->obj_focus)(*g->obj_focus, LV_SIGNAL_FOCUS, NULL);
+    if(g->focus_cb) g->focus_cb(g);
+    lv_res_t res = lv_event_send(*g->obj_focus, LV_EVENT_FOCUSED, NULL);
+    if(res != LV_RES_OK) return;
+    lv_obj_invalidate(*g->obj_focus);
+
+    /*If the object or its parent has `top == true` bring it to the foreground*/
+    obj_to_foreground(*g->obj_focus);
 }
 
 /**
@@ -263,6 +332,37 @@ void lv_group_focus_prev(lv_group_t * group)
     focus_next_core(group, _lv_ll_get_tail, _lv_ll_get_prev);
 }
 
+#if LV_USE_GROUP_INDEX
+/**
+ * Focus the nearest visible and enabled object of a group in a direction from the focused object.
+ * The distance is measured between the centers of the objects.
+ * @param group pointer to a group
+ * @param dir `LV_KEY_UP`, `LV_KEY_DOWN`, `LV_KEY_RIGHT` or `LV_KEY_LEFT`
+ */
+void lv_group_focus_dir(lv_group_t * group, lv_key_t dir)
+{
+    if(group->frozen) return;
+    if(dir != LV_KEY_UP && dir != LV_KEY_DOWN && dir != LV_KEY_RIGHT && dir != LV_KEY_LEFT) return;
+
+    /*Nothing is focused yet: focus the first object*/
+    if(group->obj_focus == NULL) {
+        lv_group_focus_next(group);
+        return;
+    }
+
+    lv_group_index_t * index = index_get(group);
+    if(index == NULL) return;
+
+    uint16_t id = index_find(index, *group->obj_focus);
+    if(id == GROUP_INDEX_NONE) return;
+
+    uint16_t nb = index_get_neighbor(index, id, dir);
+    if(nb == GROUP_INDEX_NONE) return;
+
+    focus_node(group, index->items[nb].node);
+}
+#endif
+
 /**
  * Do not let to change the focus from the current object
  * @param group pointer to a group
@@ -289,7 +389,7 @@ lv_res_t lv_group_send_data(lv_group_t * group, uint32_t c)
 
     lv_res_t res;
 
-    res = act->signal_cb(act, LV_SIGNAL_CONTROL, &c);
+    res = _LV_OBJ_SIGNAL_CB(act)(act, LV_SIGNAL_CONTROL, &c);
     if(res != LV_RES_OK) return res;
 
     res = lv_event_send(act, LV_EVENT_KEY, &c);
@@ -324,7 +424,7 @@ void lv_group_set_editing(lv_group_t * group, bool edit)
     lv_obj_t * focused = lv_group_get_focused(group);
 
     if(focused) {
-        focused->signal_cb(focused, LV_SIGNAL_FOCUS, NULL); /*Focus again to properly leave/open edit/navigate mode*/
+        _LV_OBJ_SIGNAL_CB(focused)(focused, LV_SIGNAL_FOCUS, NULL); /*Focus again to properly leave/open edit/navigate mode*/
         lv_res_t res = lv_event_send(*group->obj_focus, LV_EVENT_FOCUSED, NULL);
         if(res != LV_RES_OK) return;
 
@@ -426,6 +526,48 @@ bool lv_group_get_wrap(lv_group_t * group)
     return group->wrap ? true : false;
 }
 
+#if LV_USE_GROUP_INDEX
+/**
+ * Update the navigation index of an object's group after the object was hidden, shown, disabled or enabled.
+ * @param obj pointer to an object
+ */
+void _lv_group_index_update_obj(lv_obj_t * obj)
+{
+    lv_group_t * group = obj->group_p;
+    if(group == NULL || group->index.valid == 0) return;
+
+    lv_group_index_t * index = &group->index;
+    uint16_t id = index_find(index, obj);
+    if(id == GROUP_INDEX_NONE) return;
+
+    index_set_focusable(index, id, obj_is_focusable(obj));
+}
+
+/**
+ * Mark the geometry of the navigation indexes affected by an object outdated. Called when an object is moved or
+ * resized. The centers are read again on the next `lv_group_focus_dir`.
+ * @param obj pointer to the moved or resized object
+ * @note only the indexes whose root (the common parent of the group's objects) contains `obj` (or which are in
+ * `obj`) are marked, like the hit-test grids of `_lv_indev_hit_index_invalidate`.
+ */
+void _lv_group_index_invalidate_geometry(lv_obj_t * obj)
+{
+    /*An object without children which is not in a group can't move the objects of a group*/
+    if(obj->group_p == NULL && _lv_ll_get_head(&obj->child_ll) == NULL) return;
+
+    lv_group_t * group;
+    _LV_LL_READ(LV_GC_ROOT(_lv_group_ll), group) {
+        lv_group_index_t * index = &group->index;
+        if(index->valid == 0 || index->geometry_valid == 0) continue;
+
+        /*Without a common parent (e.g. objects on more displays) every change matters*/
+        if(index->root == NULL || index_is_parent(index->root, obj) || index_is_parent(obj, index->root)) {
+            index->geometry_valid = 0;
+        }
+    }
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -449,6 +591,14 @@ static void focus_next_core(lv_group_t * group, void * (*begin)(const lv_ll_t *)
 {
     if(group->frozen) return;
 
+#if LV_USE_GROUP_INDEX
+    lv_obj_t ** obj_found;
+    if(index_find_next(group, begin == _lv_ll_get_head, &obj_found)) {
+        if(obj_found) focus_node(group, obj_found);
+        return;
+    }
+#endif
+
     lv_obj_t ** obj_next     = group->obj_focus;
     lv_obj_t ** obj_sentinel = NULL;
     bool can_move            = true;
@@ -483,16 +633,20 @@ static void focus_next_core(lv_group_t * group, void * (*begin)(const lv_ll_t *)
         can_move = true;
 
         if(obj_next == NULL) continue;
-        if(lv_obj_get_state(*obj_next, LV_OBJ_PART_MAIN) & LV_STATE_DISABLED) continue;
 
         /*Hidden and disabled objects don't receive focus*/
-        if(!lv_obj_get_hidden(*obj_next)) break;
+        if(obj_is_focusable(*obj_next)) break;
     }
 
+    focus_node(group, obj_next);
+}
+
+static void focus_node(lv_group_t * group, lv_obj_t ** obj_next)
+{
     if(obj_next == group->obj_focus) return; /*There's only one visible object and it's already focused*/
 
     if(group->obj_focus) {
-        (*group->obj_focus)->signal_cb(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
+        _LV_OBJ_SIGNAL_CB(*group->obj_focus)(*group->obj_focus, LV_SIGNAL_DEFOCUS, NULL);
         lv_res_t res = lv_event_send(*group->obj_focus, LV_EVENT_DEFOCUSED, NULL);
         if(res != LV_RES_OK) return;
         lv_obj_invalidate(*group->obj_focus);
@@ -500,7 +654,7 @@ static void focus_next_core(lv_group_t * group, void * (*begin)(const lv_ll_t *)
 
     group->obj_focus = obj_next;
 
-    (*group->obj_focus)->signal_cb(*group->obj_focus, LV_SIGNAL_FOCUS, NULL);
+    _LV_OBJ_SIGNAL_CB(*group->obj_focus)(*group->obj_focus, LV_SIGNAL_FOCUS, NULL);
     lv_res_t res = lv_event_send(*group->obj_focus, LV_EVENT_FOCUSED, NULL);
     if(res != LV_RES_OK) return;
 
@@ -528,4 +682,396 @@ static void obj_to_foreground(lv_obj_t * obj)
     }
 }
 
+static bool obj_is_focusable(lv_obj_t * obj)
+{
+    if(lv_obj_get_state(obj, LV_OBJ_PART_MAIN) & LV_STATE_DISABLED) return false;
+    if(lv_obj_get_hidden(obj)) return false;
+
+    return true;
+}
+
+#if LV_USE_GROUP_INDEX
+
+/**
+ * Get the index of a group and build it if required
+ * @param group pointer to a group
+ * @return pointer to the index or NULL if the group can't be indexed
+ */
+static lv_group_index_t * index_get(lv_group_t * group)
+{
+    if(group->index.valid == 0 && index_build(group) == false) return NULL;
+    return &group->index;
+}
+
+/**
+ * Collect the objects of a group into its index
+ * @param group pointer to a group
+ * @return true: the index is ready; false: too many objects or out of memory
+ */
+static bool index_build(lv_group_t * group)
+{
+    lv_group_index_t * index = &group->index;
+    index_free(index);
+
+    uint32_t cnt = _lv_ll_get_len(&group->obj_ll);
+    if(cnt > GROUP_INDEX_MAX_CNT) return false;
+
+    /*Leave room to add objects without rebuilding*/
+    uint32_t size = LV_MATH_MAX(cnt * 2, GROUP_INDEX_MIN_SIZE);
+    if(size > GROUP_INDEX_MAX_CNT) size = GROUP_INDEX_MAX_CNT;
+    uint32_t map_size = GROUP_INDEX_MIN_SIZE;
+    while(map_size < size * 2) map_size <<= 1;
+
+    index->items = lv_mem_alloc(size * sizeof(lv_group_index_item_t));
+    index->focusable = lv_mem_alloc(size * sizeof(uint16_t));
+    index->map = lv_mem_alloc(map_size * sizeof(uint16_t));
+    if(index->items == NULL || index->focusable == NULL || index->map == NULL) {
+        LV_LOG_WARN("lv_group: couldn't allocate the navigation index");
+        index_free(index);
+        return false;
+    }
+
+    index->item_size = size;
+    index->map_size = map_size;
+    _lv_memset_ff(index->map, map_size * sizeof(uint16_t));
+
+    lv_obj_t ** node;
+    _LV_LL_READ(group->obj_ll, node) {
+        uint16_t id = index->item_cnt;
+        index->items[id].node = node;
+        index->item_cnt++;
+        index_map_add(index, id);
+        if(obj_is_focusable(*node)) {
+            index->focusable[index->focusable_cnt] = id;
+            index->focusable_cnt++;
+        }
+    }
+
+    index->valid = 1;
+    return true;
+}
+
+static void index_free(lv_group_index_t * index)
+{
+    if(index->items) lv_mem_free(index->items);
+    if(index->focusable) lv_mem_free(index->focusable);
+    if(index->map) lv_mem_free(index->map);
+    _lv_memset_00(index, sizeof(lv_group_index_t));
+}
+
+/**
+ * Append an object to the index after it was added to the tail of `obj_ll`
+ * @param group pointer to a group
+ * @param node the new node of `obj_ll`
+ */
+static void index_add(lv_group_t * group, lv_obj_t ** node)
+{
+    lv_group_index_t * index = &group->index;
+    if(index->valid == 0) return;
+
+    /*Rebuild with more room on the next use*/
+    if(index->item_cnt >= index->item_size) {
+        index->valid = 0;
+        return;
+    }
+
+    uint16_t id = index->item_cnt;
+    index->items[id].node = node;
+    index->item_cnt++;
+    index_map_add(index, id);
+    if(obj_is_focusable(*node)) index_set_focusable(index, id, true);
+
+    /*The new object has no center and neighbors yet and it can change the root too.
+     *It might be focused directly even if it's not focusable.*/
+    index->geometry_valid = 0;
+}
+
+/**
+ * Remove an object from the index
+ * @param group pointer to a group
+ * @param obj pointer to an object
+ * @return the node of the object in `obj_ll` or NULL if the index can't tell it
+ */
+static lv_obj_t ** index_remove(lv_group_t * group, lv_obj_t * obj)
+{
+    lv_group_index_t * index = &group->index;
+    if(index->valid == 0) return NULL;
+
+    uint16_t id = index_find(index, obj);
+    if(id == GROUP_INDEX_NONE) return NULL;
+
+    lv_obj_t ** node = index->items[id].node;
+    index_set_focusable(index, id, false);
+    index_map_remove(index, id);
+    index->items[id].node = NULL;
+    index->removed_cnt++;
+
+    /*Compact the items on the next use if most of them are removed*/
+    if(index->removed_cnt > index->item_cnt / 2) index->valid = 0;
+
+    return node;
+}
+
+/**
+ * Find the next or previous focusable object from the focused one
+ * @param group pointer to a group
+ * @param next true: search forward; false: search backward
+ * @param obj_next store the found node here (NULL if the focus shouldn't change)
+ * @return true: the index was used; false: walk `obj_ll` instead
+ */
+static bool index_find_next(lv_group_t * group, bool next, lv_obj_t *** obj_next)
+{
+    lv_group_index_t * index = index_get(group);
+    if(index == NULL) return false;
+
+    *obj_next = NULL;
+    if(index->focusable_cnt == 0) return true;
+
+    uint32_t pos;
+    if(group->obj_focus == NULL) {
+        pos = next ? 0 : index->focusable_cnt - 1;
+    }
+    else {
+        uint16_t id = index_find(index, *group->obj_focus);
+        if(id == GROUP_INDEX_NONE) return false;
+
+        pos = index_focusable_pos(index, id);
+        if(next) {
+            if(pos < index->focusable_cnt && index->focusable[pos] == id) pos++;
+            if(pos == index->focusable_cnt) {
+                if(group->wrap == 0) return true;
+                pos = 0;
+            }
+        }
+        else {
+            if(pos == 0) {
+                if(group->wrap == 0) return true;
+                pos = index->focusable_cnt;
+            }
+            pos--;
+        }
+    }
+
+    lv_obj_t ** node = index->items[index->focusable[pos]].node;
+
+    /*Hiding and disabling are followed, so it's only a safety check*/
+    if(obj_is_focusable(*node) == false) {
+        index->valid = 0;
+        return false;
+    }
+
+    *obj_next = node;
+    return true;
+}
+
+/**
+ * Get the index of an object in `items`
+ * @param index pointer to a valid index
+ * @param obj pointer to an object
+ * @return the index of the object or `GROUP_INDEX_NONE` if the object isn't in the group
+ */
+static uint16_t index_find(const lv_group_index_t * index, const lv_obj_t * obj)
+{
+    uint32_t mask = index->map_size - 1;
+    uint32_t slot = index_hash(index, obj);
+    while(index->map[slot] != GROUP_INDEX_NONE) {
+        uint16_t id = index->map[slot];
+        if(*index->items[id].node == obj) return id;
+        slot = (slot + 1) & mask;
+    }
+
+    return GROUP_INDEX_NONE;
+}
+
+static uint32_t index_hash(const lv_group_index_t * index, const lv_obj_t * obj)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)obj >> 3);
+    h *= 2654435761u;   /*Knuth's multiplicative hash*/
+    return (h >> 8) & (index->map_size - 1);
+}
+
+static void index_map_add(lv_group_index_t * index, uint16_t id)
+{
+    uint32_t mask = index->map_size - 1;
+    uint32_t slot = index_hash(index, *index->items[id].node);
+    while(index->map[slot] != GROUP_INDEX_NONE) slot = (slot + 1) & mask;
+    index->map[slot] = id;
+}
+
+static void index_map_remove(lv_group_index_t * index, uint16_t id)
+{
+    uint32_t mask = index->map_size - 1;
+    uint32_t slot = index_hash(index, *index->items[id].node);
+    while(index->map[slot] != id) slot = (slot + 1) & mask;
+
+    /*Move back the following elements of the probe sequence to fill the gap*/
+    index->map[slot] = GROUP_INDEX_NONE;
+    uint32_t i = slot;
+    uint32_t j = slot;
+    while(1) {
+        j = (j + 1) & mask;
+        if(index->map[j] == GROUP_INDEX_NONE) break;
+
+        uint32_t home = index_hash(index, *index->items[index->map[j]].node);
+        bool stays = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+        if(stays) continue;
+
+        index->map[i] = index->map[j];
+        index->map[j] = GROUP_INDEX_NONE;
+        i = j;
+    }
+}
+
+/**
+ * Get the position of an item in `focusable` or where it would be inserted
+ */
+static uint32_t index_focusable_pos(const lv_group_index_t * index, uint16_t id)
+{
+    uint32_t min = 0;
+    uint32_t max = index->focusable_cnt;
+    while(min < max) {
+        uint32_t mid = (min + max) >> 1;
+        if(index->focusable[mid] < id) min = mid + 1;
+        else max = mid;
+    }
+
+    return min;
+}
+
+static void index_set_focusable(lv_group_index_t * index, uint16_t id, bool en)
+{
+    uint32_t pos = index_focusable_pos(index, id);
+    bool in = pos < index->focusable_cnt && index->focusable[pos] == id;
+    if(in == en) return;
+
+    uint16_t * f = &index->focusable[pos];
+    uint32_t move_cnt = index->focusable_cnt - pos;
+    if(en) {
+        memmove(f + 1, f, move_cnt * sizeof(uint16_t));
+        *f = id;
+        index->focusable_cnt++;
+    }
+    else {
+        memmove(f, f + 1, (move_cnt - 1) * sizeof(uint16_t));
+        index->focusable_cnt--;
+    }
+
+    /*The cached neighbors might be outdated*/
+    index->geometry_valid = 0;
+}
+
+/**
+ * Get the nearest focusable item in a direction. The neighbors are searched only once after the
+ * objects were moved or the focusable objects changed.
+ */
+static uint16_t index_get_neighbor(lv_group_index_t * index, uint16_t id, lv_key_t dir)
+{
+    if(index->geometry_valid == 0) {
+        uint32_t i;
+        for(i = 0; i < index->item_cnt; i++) {
+            lv_group_index_item_t * item = &index->items[i];
+            if(item->node == NULL) continue;
+            const lv_area_t * coords = &(*item->node)->coords;
+            item->center.x = coords->x1 + lv_area_get_width(coords) / 2;
+            item->center.y = coords->y1 + lv_area_get_height(coords) / 2;
+            item->neighbor[0] = GROUP_INDEX_UNKNOWN;
+            item->neighbor[1] = GROUP_INDEX_UNKNOWN;
+            item->neighbor[2] = GROUP_INDEX_UNKNOWN;
+            item->neighbor[3] = GROUP_INDEX_UNKNOWN;
+        }
+        index->root = index_get_root(index);
+        index->geometry_valid = 1;
+    }
+
+    uint8_t d = dir - LV_KEY_UP;    /*The keys are in the order of `neighbor`*/
+    lv_group_index_item_t * item = &index->items[id];
+    if(item->neighbor[d] != GROUP_INDEX_UNKNOWN) return item->neighbor[d];
+
+    /*The distance across the direction counts more to prefer the objects in the same row or column*/
+    uint16_t best = GROUP_INDEX_NONE;
+    uint32_t best_dist = UINT32_MAX;
+    uint32_t i;
+    for(i = 0; i < index->focusable_cnt; i++) {
+        uint16_t cand = index->focusable[i];
+        if(cand == id) continue;
+
+        int32_t dx = index->items[cand].center.x - item->center.x;
+        int32_t dy = index->items[cand].center.y - item->center.y;
+        int32_t along;
+        int32_t across;
+        switch(dir) {
+            case LV_KEY_UP:
+                along = -dy;
+                across = dx;
+                break;
+            case LV_KEY_DOWN:
+                along = dy;
+                across = dx;
+                break;
+            case LV_KEY_RIGHT:
+                along = dx;
+                across = dy;
+                break;
+            default:
+                along = -dx;
+                across = dy;
+                break;
+        }
+
+        if(along <= 0) continue;
+
+        uint32_t dist = (uint32_t)along + 2 * (uint32_t)LV_MATH_ABS(across);
+        if(dist < best_dist) {
+            best_dist = dist;
+            best = cand;
+        }
+    }
+
+    item->neighbor[d] = best;
+    return best;
+}
+
+/**
+ * Get the deepest common parent of the objects of an index
+ * @param index pointer to a valid index
+ * @return the common parent or NULL if the objects are on different screens
+ */
+static lv_obj_t * index_get_root(const lv_group_index_t * index)
+{
+    lv_obj_t * root = NULL;
+    bool first = true;
+    uint32_t i;
+    for(i = 0; i < index->item_cnt; i++) {
+        if(index->items[i].node == NULL) continue;
+
+        lv_obj_t * obj = *index->items[i].node;
+        if(first) {
+            root = obj;
+            first = false;
+        }
+
+        while(root && index_is_parent(root, obj) == false) root = root->parent;
+        if(root == NULL) return NULL;
+    }
+
+    return root;
+}
+
+/**
+ * Tell whether an object is a parent (or grandparent and so on) of an other or they are the same object
+ * @param par pointer to the possible parent
+ * @param obj pointer to an object
+ * @return true: `obj` is `par` or it's on `par`
+ */
+static bool index_is_parent(const lv_obj_t * par, const lv_obj_t * obj)
+{
+    while(obj) {
+        if(obj == par) return true;
+        obj = obj->parent;
+    }
+
+    return false;
+}
+#endif
+
 #endif /*LV_USE_GROUP != 0*/
@@ -47,6 +47,30 @@ struct _lv_group_t;
 typedef void (*lv_group_style_mod_cb_t)(struct _lv_group_t *, lv_style_t *);
 typedef void (*lv_group_focus_cb_t)(struct _lv_group_t *);
 
+#if LV_USE_GROUP_INDEX
+/** An object of a group in the navigation index*/
+typedef struct {
+    lv_obj_t ** node;       /**< Node of the object in `obj_ll`. NULL if the object was removed*/
+    lv_point_t center;      /**< Center of the object when the geometry was read*/
+    uint16_t neighbor[4];   /**< Cached nearest focusable item up, down, right and left*/
+} lv_group_index_item_t;
+
+/** Index of the objects of a group to move the focus without walking `obj_ll`*/
+typedef struct {
+    lv_group_index_item_t * items;  /**< The objects in the order of `obj_ll`*/
+    uint16_t * focusable;           /**< Index of the visible and enabled items in increasing order*/
+    uint16_t * map;                 /**< Hash table to find the index of an object in `items`*/
+    uint32_t map_size;              /**< Number of slots in `map` (power of 2)*/
+    lv_obj_t * root;                /**< Common parent of the objects when the centers were read*/
+    uint16_t item_cnt;              /**< Number of used items (including the removed objects)*/
+    uint16_t item_size;             /**< Number of allocated items*/
+    uint16_t removed_cnt;           /**< Number of removed objects in `items`*/
+    uint16_t focusable_cnt;         /**< Number of elements in `focusable`*/
+    uint8_t valid : 1;              /**< 0: rebuild the index before using it*/
+    uint8_t geometry_valid : 1;     /**< 0: read the centers and search the neighbors again*/
+} lv_group_index_t;
+#endif
+
 /**
  * Groups can be used to logically hold objects so that they can be individually focused.
  * They are NOT for laying out objects on a screen (try `lv_cont` for that).
@@ -56,6 +80,9 @@ typedef struct _lv_group_t {
     lv_obj_t ** obj_focus; /**< The object in focus*/
 
     lv_group_focus_cb_t focus_cb;              /**< A function to call when a new object is focused (optional)*/
+#if LV_USE_GROUP_INDEX
+    lv_group_index_t index;     /**< Index of the objects for fast focus changes*/
+#endif
 #if LV_USE_USER_DATA
     lv_group_user_data_t user_data;
 #endif
@@ -132,6 +159,16 @@ void lv_group_focus_next(lv_group_t * group);
  */
 void lv_group_focus_prev(lv_group_t * group);
 
+#if LV_USE_GROUP_INDEX
+/**
+ * Focus the nearest visible and enabled object of a group in a direction from the focused object.
+ * The distance is measured between the centers of the objects.
+ * @param group pointer to a group
+ * @param dir `LV_KEY_UP`, `LV_KEY_DOWN`, `LV_KEY_RIGHT` or `LV_KEY_LEFT`
+ */
+void lv_group_focus_dir(lv_group_t * group, lv_key_t dir);
+#endif
+
 /**
  * Do not let to change the focus from the current object
  * @param group pointer to a group
@@ -228,6 +265,23 @@ bool lv_group_get_click_focus(const lv_group_t * group);
  */
 bool lv_group_get_wrap(lv_group_t * group);
 
+#if LV_USE_GROUP_INDEX
+/**
+ * Update the navigation index of an object's group after the object was hidden, shown, disabled or enabled.
+ * @param obj pointer to an object
+ * @remarks Internal function, do not call directly.
+ */
+void _lv_group_index_update_obj(lv_obj_t * obj);
+
+/**
+ * Mark the geometry of the navigation indexes affected by an object outdated. Called when an object is moved or
+ * resized. The centers are read again on the next `lv_group_focus_dir`.
+ * @param obj pointer to the moved or resized object
+ * @remarks Internal function, do not call directly.
+ */
+void _lv_group_index_invalidate_geometry(lv_obj_t * obj);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -15,6 +15,7 @@
 #include "../lv_core/lv_refr.h"
 #include "../lv_misc/lv_task.h"
 #include "../lv_misc/lv_math.h"
+#include "../lv_misc/lv_gc.h"
 
 /*********************
  *      DEFINES
@@ -24,9 +25,32 @@
     #warning "LV_INDEV_DRAG_THROW must be greater than 0"
 #endif
 
+#if LV_USE_HIT_INDEX
+#define HIT_INDEX_GRID      8   /*Number of cells of the grids in both directions*/
+#define HIT_INDEX_MAX_CNT   3   /*Number of grids to keep. Enough for the system and top layer and the active screen*/
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_USE_HIT_INDEX
+/*An object which can be found by `lv_indev_search_obj`*/
+typedef struct {
+    lv_obj_t * obj;
+    lv_area_t area;             /*The point has to be here to pass the hit test of the object and its parents*/
+    uint8_t adv_hittest : 1;    /*The object or a parent uses advanced hit test which needs to be called too*/
+} hit_cand_t;
+
+/*Grid of the clickable objects of a screen or layer*/
+typedef struct {
+    lv_obj_t * root;            /*The object used as the start of the search*/
+    uint8_t outdated : 1;       /*An object of `root` or a parent of `root` was changed since the grid was built*/
+    lv_area_t area;             /*The area covered by the grid: the coordinates of `root`*/
+    hit_cand_t * cands;         /*The clickable objects in the order of the search*/
+    uint16_t * cell_cands;      /*Index of the candidates in `cands` for each cell*/
+    uint32_t cell_start[HIT_INDEX_GRID * HIT_INDEX_GRID + 1];  /*Index of the first candidate of the cells in `cell_cands`*/
+} hit_index_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -45,6 +69,18 @@ static void indev_drag_throw(lv_indev_proc_t * proc);
 static lv_obj_t * get_dragged_obj(lv_obj_t * obj);
 static void indev_gesture(lv_indev_proc_t * proc);
 static bool indev_reset_check(lv_indev_proc_t * proc);
+static lv_obj_t * search_obj_core(lv_obj_t * obj, lv_point_t * point);
+#if LV_USE_HIT_INDEX
+static hit_index_t * hit_index_get(lv_obj_t * root);
+static bool hit_index_build(hit_index_t * index);
+static uint32_t hit_index_collect(lv_obj_t * obj, const lv_area_t * par_area, bool adv_hittest, hit_cand_t * cands,
+                                  uint32_t cnt);
+static void hit_index_free(hit_index_t * index);
+static bool hit_index_is_parent(const lv_obj_t * par, const lv_obj_t * obj);
+static lv_obj_t * hit_index_search(hit_index_t * index, lv_point_t * point);
+static bool hit_index_get_cells(const hit_index_t * index, const lv_area_t * area, lv_area_t * cells);
+static lv_coord_t hit_index_get_cell_pos(lv_coord_t v, lv_coord_t start, lv_coord_t len);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -65,6 +101,10 @@ static lv_obj_t * indev_obj_act = NULL;
  */
 void _lv_indev_init(void)
 {
+#if LV_USE_HIT_INDEX
+    _lv_ll_init(&LV_GC_ROOT(_lv_hit_index_ll), sizeof(hit_index_t));
+#endif
+
     lv_indev_reset(NULL, NULL); /*Reset all input devices*/
 }
 
@@ -87,6 +127,12 @@ void _lv_indev_read_task(lv_task_t * task)
     indev_proc_reset_query_handler(indev_act);
 
     if(indev_act->proc.disabled) return;
+
+#if LV_USE_LAYOUT_DEFER
+    /*Search the objects on their final coordinates*/
+    lv_obj_update_layout();
+#endif
+
     bool more_to_read;
     do {
         /*Read the data*/
@@ -129,6 +175,27 @@ void _lv_indev_read_task(lv_task_t * task)
     LV_LOG_TRACE("indev read task finished");
 }
 
+#if LV_USE_HIT_INDEX
+/**
+ * Mark the hit-test grids affected by an object outdated. Called when an object is moved, resized, created,
+ * deleted, hidden, disabled or its clickability changed. The grids are rebuilt on the next search.
+ * @param obj pointer to the changed object
+ * @note only the grids whose root contains `obj` (or which are in `obj`) are marked so changing a layer
+ * doesn't rebuild the grid of the screen. In return all parents of `obj` are visited for each of
+ * the `HIT_INDEX_MAX_CNT` grids instead of just counting the changes.
+ */
+void _lv_indev_hit_index_invalidate(lv_obj_t * obj)
+{
+    hit_index_t * index;
+    _LV_LL_READ(LV_GC_ROOT(_lv_hit_index_ll), index) {
+        if(index->outdated || index->root == NULL) continue;
+
+        /*The parents of the root matter too as hidden parents hide the whole grid*/
+        if(hit_index_is_parent(index->root, obj) || hit_index_is_parent(obj, index->root)) index->outdated = 1;
+    }
+}
+#endif
+
 /**
  * Get the currently processed input device. Can be used in action functions too.
  * @return pointer to the currently processed input device or NULL if no input device processing
@@ -358,7 +425,7 @@ lv_res_t lv_indev_finish_drag(lv_indev_t * indev)
     if(drag_obj == NULL) return LV_RES_OK;
 
     lv_res_t res;
-    res = drag_obj->signal_cb(drag_obj, LV_SIGNAL_DRAG_END, NULL);
+    res = _LV_OBJ_SIGNAL_CB(drag_obj)(drag_obj, LV_SIGNAL_DRAG_END, NULL);
     if(res != LV_RES_OK) return res;
 
     res = lv_event_send(drag_obj, LV_EVENT_DRAG_END, NULL);
@@ -488,7 +555,7 @@ static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data)
             /*Send the ENTER as a normal KEY*/
             lv_group_send_data(g, LV_KEY_ENTER);
 
-            indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_PRESSED, NULL);
+            _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_PRESSED, NULL);
             if(indev_reset_check(&i->proc)) return;
             lv_event_send(indev_obj_act, LV_EVENT_PRESSED, NULL);
             if(indev_reset_check(&i->proc)) return;
@@ -521,7 +588,7 @@ static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data)
     else if(data->state == LV_INDEV_STATE_PR && prev_state == LV_INDEV_STATE_PR) {
 
         if(data->key == LV_KEY_ENTER) {
-            indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_PRESSING, NULL);
+            _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_PRESSING, NULL);
             if(indev_reset_check(&i->proc)) return;
             lv_event_send(indev_obj_act, LV_EVENT_PRESSING, NULL);
             if(indev_reset_check(&i->proc)) return;
@@ -532,7 +599,7 @@ static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data)
             i->proc.long_pr_sent = 1;
             if(data->key == LV_KEY_ENTER) {
                 i->proc.longpr_rep_timestamp = lv_tick_get();
-                indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_LONG_PRESS, NULL);
+                _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_LONG_PRESS, NULL);
                 if(indev_reset_check(&i->proc)) return;
                 lv_event_send(indev_obj_act, LV_EVENT_LONG_PRESSED, NULL);
                 if(indev_reset_check(&i->proc)) return;
@@ -546,7 +613,7 @@ static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data)
 
             /*Send LONG_PRESS_REP on ENTER*/
             if(data->key == LV_KEY_ENTER) {
-                indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_LONG_PRESS_REP, NULL);
+                _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_LONG_PRESS_REP, NULL);
                 if(indev_reset_check(&i->proc)) return;
                 lv_event_send(indev_obj_act, LV_EVENT_LONG_PRESSED_REPEAT, NULL);
                 if(indev_reset_check(&i->proc)) return;
@@ -576,7 +643,7 @@ static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data)
         data->key = prev_key;
         if(data->key == LV_KEY_ENTER) {
 
-            indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_RELEASED, NULL);
+            _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_RELEASED, NULL);
             if(indev_reset_check(&i->proc)) return;
 
             if(i->proc.long_pr_sent == 0) {
@@ -646,10 +713,10 @@ static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data)
 
         if(data->key == LV_KEY_ENTER) {
             bool editable = false;
-            indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_GET_EDITABLE, &editable);
+            _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_GET_EDITABLE, &editable);
 
             if(lv_group_get_editing(g) == true || editable == false) {
-                indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_PRESSED, NULL);
+                _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_PRESSED, NULL);
                 if(indev_reset_check(&i->proc)) return;
 
                 lv_event_send(indev_obj_act, LV_EVENT_PRESSED, NULL);
@@ -686,7 +753,7 @@ static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data)
 
             if(data->key == LV_KEY_ENTER) {
                 bool editable = false;
-                indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_GET_EDITABLE, &editable);
+                _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_GET_EDITABLE, &editable);
 
                 /*On enter long press toggle edit mode.*/
                 if(editable) {
@@ -697,7 +764,7 @@ static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data)
                 }
                 /*If not editable then just send a long press signal*/
                 else {
-                    indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_LONG_PRESS, NULL);
+                    _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_LONG_PRESS, NULL);
                     if(indev_reset_check(&i->proc)) return;
                     lv_event_send(indev_obj_act, LV_EVENT_LONG_PRESSED, NULL);
                     if(indev_reset_check(&i->proc)) return;
@@ -712,7 +779,7 @@ static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data)
             i->proc.longpr_rep_timestamp = lv_tick_get();
 
             if(data->key == LV_KEY_ENTER) {
-                indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_LONG_PRESS_REP, NULL);
+                _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_LONG_PRESS_REP, NULL);
                 if(indev_reset_check(&i->proc)) return;
                 lv_event_send(indev_obj_act, LV_EVENT_LONG_PRESSED_REPEAT, NULL);
                 if(indev_reset_check(&i->proc)) return;
@@ -738,11 +805,11 @@ static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data)
 
         if(data->key == LV_KEY_ENTER) {
             bool editable = false;
-            indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_GET_EDITABLE, &editable);
+            _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_GET_EDITABLE, &editable);
 
             /*The button was released on a non-editable object. Just send enter*/
             if(editable == false) {
-                indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_RELEASED, NULL);
+                _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_RELEASED, NULL);
                 if(indev_reset_check(&i->proc)) return;
 
                 if(i->proc.long_pr_sent == 0) lv_event_send(indev_obj_act, LV_EVENT_SHORT_CLICKED, NULL);
@@ -758,7 +825,7 @@ static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data)
             else if(g->editing) {
                 /*Ignore long pressed enter release because it comes from mode switch*/
                 if(!i->proc.long_pr_sent || _lv_ll_get_len(&g->obj_ll) <= 1) {
-                    indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_RELEASED, NULL);
+                    _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_RELEASED, NULL);
                     if(indev_reset_check(&i->proc)) return;
 
                     lv_event_send(indev_obj_act, LV_EVENT_SHORT_CLICKED, NULL);
@@ -909,7 +976,7 @@ static void indev_proc_press(lv_indev_proc_t * proc)
             /*Save the obj because in special cases `act_obj` can change in the signal function*/
             lv_obj_t * last_obj = proc->types.pointer.act_obj;
 
-            last_obj->signal_cb(last_obj, LV_SIGNAL_PRESS_LOST, indev_act);
+            _LV_OBJ_SIGNAL_CB(last_obj)(last_obj, LV_SIGNAL_PRESS_LOST, indev_act);
             if(indev_reset_check(proc)) return;
             lv_event_send(last_obj, LV_EVENT_PRESS_LOST, NULL);
             if(indev_reset_check(proc)) return;
@@ -948,7 +1015,7 @@ static void indev_proc_press(lv_indev_proc_t * proc)
             }
 
             /*Send a signal about the press*/
-            indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_PRESSED, indev_act);
+            _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_PRESSED, indev_act);
             if(indev_reset_check(proc)) return;
 
             lv_event_send(indev_obj_act, LV_EVENT_PRESSED, NULL);
@@ -985,7 +1052,7 @@ static void indev_proc_press(lv_indev_proc_t * proc)
 
     /*If there is active object and it can be dragged run the drag*/
     if(indev_obj_act != NULL) {
-        indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_PRESSING, indev_act);
+        _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_PRESSING, indev_act);
         if(indev_reset_check(proc)) return;
         lv_event_send(indev_obj_act, LV_EVENT_PRESSING, NULL);
         if(indev_reset_check(proc)) return;
@@ -999,7 +1066,7 @@ static void indev_proc_press(lv_indev_proc_t * proc)
         if(proc->types.pointer.drag_in_prog == 0 && proc->long_pr_sent == 0) {
             /*Send a signal about the long press if enough time elapsed*/
             if(lv_tick_elaps(proc->pr_timestamp) > indev_act->driver.long_press_time) {
-                indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_LONG_PRESS, indev_act);
+                _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_LONG_PRESS, indev_act);
                 if(indev_reset_check(proc)) return;
                 lv_event_send(indev_obj_act, LV_EVENT_LONG_PRESSED, NULL);
                 if(indev_reset_check(proc)) return;
@@ -1015,7 +1082,7 @@ static void indev_proc_press(lv_indev_proc_t * proc)
         if(proc->types.pointer.drag_in_prog == 0 && proc->long_pr_sent == 1) {
             /*Send a signal about the long press repeat if enough time elapsed*/
             if(lv_tick_elaps(proc->longpr_rep_timestamp) > indev_act->driver.long_press_rep_time) {
-                indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_LONG_PRESS_REP, indev_act);
+                _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_LONG_PRESS_REP, indev_act);
                 if(indev_reset_check(proc)) return;
                 lv_event_send(indev_obj_act, LV_EVENT_LONG_PRESSED_REPEAT, NULL);
                 if(indev_reset_check(proc)) return;
@@ -1048,7 +1115,7 @@ static void indev_proc_release(lv_indev_proc_t * proc)
          * In this case send the `LV_SIGNAL_RELEASED/CLICKED` instead of `LV_SIGNAL_PRESS_LOST` if
          * the indev is ON the `types.pointer.act_obj` */
         if(lv_obj_is_protected(indev_obj_act, LV_PROTECT_PRESS_LOST)) {
-            indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_RELEASED, indev_act);
+            _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_RELEASED, indev_act);
             if(indev_reset_check(proc)) return;
 
             if(proc->types.pointer.drag_in_prog == 0) {
@@ -1067,7 +1134,7 @@ static void indev_proc_release(lv_indev_proc_t * proc)
         /* The simple case: `act_obj` was not protected against press lost.
          * If it is already not pressed then `indev_proc_press` would set `indev_obj_act = NULL`*/
         else {
-            indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_RELEASED, indev_act);
+            _LV_OBJ_SIGNAL_CB(indev_obj_act)(indev_obj_act, LV_SIGNAL_RELEASED, indev_act);
             if(indev_reset_check(proc)) return;
 
             if(proc->long_pr_sent == 0 && proc->types.pointer.drag_in_prog == 0) {
@@ -1089,7 +1156,7 @@ static void indev_proc_release(lv_indev_proc_t * proc)
         lv_obj_t * drag_obj = get_dragged_obj(indev_obj_act);
         if(drag_obj) {
             if(lv_obj_get_drag_throw(drag_obj) && proc->types.pointer.drag_in_prog) {
-                if(drag_obj->signal_cb) drag_obj->signal_cb(drag_obj, LV_SIGNAL_DRAG_THROW_BEGIN, NULL);
+                if(_LV_OBJ_SIGNAL_CB(drag_obj)) _LV_OBJ_SIGNAL_CB(drag_obj)(drag_obj, LV_SIGNAL_DRAG_THROW_BEGIN, NULL);
                 if(indev_reset_check(proc)) return;
 
                 lv_event_send(drag_obj, LV_EVENT_DRAG_THROW_BEGIN, NULL);
@@ -1146,40 +1213,13 @@ static void indev_proc_reset_query_handler(lv_indev_t * indev)
  */
 lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
 {
-    lv_obj_t * found_p = NULL;
-
-    /*If the point is on this object check its children too*/
-    if(lv_obj_hittest(obj, point)) {
-        lv_obj_t * i;
-
-        _LV_LL_READ(obj->child_ll, i) {
-            found_p = lv_indev_search_obj(i, point);
-
-            /*If a child was found then break*/
-            if(found_p != NULL) {
-                break;
-            }
-        }
-
-        /*If then the children was not ok, and this obj is clickable
-         * and it or its parent is not hidden then save this object*/
-        if(found_p == NULL && lv_obj_get_click(obj) != false) {
-            lv_obj_t * hidden_i = obj;
-            while(hidden_i != NULL) {
-                if(lv_obj_get_hidden(hidden_i) == true) break;
-                hidden_i = lv_obj_get_parent(hidden_i);
-            }
-            /*No parent found with hidden == true*/
-            if(lv_obj_is_protected(obj, LV_PROTECT_EVENT_TO_DISABLED) == false) {
-                if(hidden_i == NULL && (lv_obj_get_state(obj, LV_OBJ_PART_MAIN) & LV_STATE_DISABLED) == false) found_p = obj;
-            }
-            else {
-                if(hidden_i == NULL) found_p = obj;
-            }
-        }
-    }
+#if LV_USE_HIT_INDEX
+    /*Use the grid if the point is on it. Else (e.g. on the extended click area of the root) visit all objects*/
+    hit_index_t * index = hit_index_get(obj);
+    if(index && _lv_area_is_point_on(&index->area, point, 0)) return hit_index_search(index, point);
+#endif
 
-    return found_p;
+    return search_obj_core(obj, point);
 }
 
 /**
@@ -1411,7 +1451,7 @@ static void indev_drag(lv_indev_proc_t * proc)
             /*Set the drag in progress flag*/
             /*Send the drag begin signal on first move*/
             if(drag_just_started) {
-                drag_obj->signal_cb(drag_obj, LV_SIGNAL_DRAG_BEGIN, indev_act);
+                _LV_OBJ_SIGNAL_CB(drag_obj)(drag_obj, LV_SIGNAL_DRAG_BEGIN, indev_act);
                 if(indev_reset_check(proc)) return;
 
                 lv_event_send(drag_obj, LV_EVENT_DRAG_BEGIN, NULL);
@@ -1437,7 +1477,7 @@ static void indev_drag_throw(lv_indev_proc_t * proc)
     /*Return if the drag throw is not enabled*/
     if(lv_obj_get_drag_throw(drag_obj) == false) {
         proc->types.pointer.drag_in_prog = 0;
-        drag_obj->signal_cb(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
+        _LV_OBJ_SIGNAL_CB(drag_obj)(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
         if(indev_reset_check(proc)) return;
 
         lv_event_send(drag_obj, LV_EVENT_DRAG_END, NULL);
@@ -1477,7 +1517,7 @@ static void indev_drag_throw(lv_indev_proc_t * proc)
             proc->types.pointer.vect.y            = 0;
             proc->types.pointer.drag_throw_vect.x = 0;
             proc->types.pointer.drag_throw_vect.y = 0;
-            drag_obj->signal_cb(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
+            _LV_OBJ_SIGNAL_CB(drag_obj)(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
             if(indev_reset_check(proc)) return;
 
             lv_event_send(drag_obj, LV_EVENT_DRAG_END, NULL);
@@ -1488,7 +1528,7 @@ static void indev_drag_throw(lv_indev_proc_t * proc)
        signal*/
     else {
         proc->types.pointer.drag_in_prog = 0;
-        drag_obj->signal_cb(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
+        _LV_OBJ_SIGNAL_CB(drag_obj)(drag_obj, LV_SIGNAL_DRAG_END, indev_act);
         if(indev_reset_check(proc)) return;
         lv_event_send(drag_obj, LV_EVENT_DRAG_END, NULL);
         if(indev_reset_check(proc)) return;
@@ -1557,7 +1597,7 @@ static void indev_gesture(lv_indev_proc_t * proc)
                 proc->types.pointer.gesture_dir = LV_GESTURE_DIR_TOP;
         }
 
-        gesture_obj->signal_cb(gesture_obj, LV_SIGNAL_GESTURE, indev_act);
+        _LV_OBJ_SIGNAL_CB(gesture_obj)(gesture_obj, LV_SIGNAL_GESTURE, indev_act);
         if(indev_reset_check(proc)) return;
         lv_event_send(gesture_obj, LV_EVENT_GESTURE, NULL);
         if(indev_reset_check(proc)) return;
@@ -1577,3 +1617,315 @@ static bool indev_reset_check(lv_indev_proc_t * proc)
 
     return proc->reset_query ? true : false;
 }
+
+/**
+ * Search the most top, clickable object by a point by visiting all the children
+ * @param obj pointer to a start object, typically the screen
+ * @param point pointer to a point for searching the most top child
+ * @return pointer to the found object or NULL if there was no suitable object
+ */
+static lv_obj_t * search_obj_core(lv_obj_t * obj, lv_point_t * point)
+{
+    lv_obj_t * found_p = NULL;
+
+    /*If the point is on this object check its children too*/
+    if(lv_obj_hittest(obj, point)) {
+        lv_obj_t * i;
+
+        _LV_LL_READ(obj->child_ll, i) {
+            found_p = search_obj_core(i, point);
+
+            /*If a child was found then break*/
+            if(found_p != NULL) {
+                break;
+            }
+        }
+
+        /*If then the children was not ok, and this obj is clickable
+         * and it or its parent is not hidden then save this object*/
+        if(found_p == NULL && lv_obj_get_click(obj) != false) {
+            lv_obj_t * hidden_i = obj;
+            while(hidden_i != NULL) {
+                if(lv_obj_get_hidden(hidden_i) == true) break;
+                hidden_i = lv_obj_get_parent(hidden_i);
+            }
+            /*No parent found with hidden == true*/
+            if(lv_obj_is_protected(obj, LV_PROTECT_EVENT_TO_DISABLED) == false) {
+                if(hidden_i == NULL && (lv_obj_get_state(obj, LV_OBJ_PART_MAIN) & LV_STATE_DISABLED) == false) found_p = obj;
+            }
+            else {
+                if(hidden_i == NULL) found_p = obj;
+            }
+        }
+    }
+
+    return found_p;
+}
+
+#if LV_USE_HIT_INDEX
+/**
+ * Get the grid of an object. Build it if it doesn't exist yet or it's outdated.
+ * @param root the object where the search starts
+ * @return the up-to-date grid or NULL if it couldn't be built
+ */
+static hit_index_t * hit_index_get(lv_obj_t * root)
+{
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_hit_index_ll);
+    hit_index_t * index;
+    uint32_t cnt = 0;
+    _LV_LL_READ(*ll, index) {
+        if(index->root == root) break;
+        cnt++;
+    }
+
+    if(index == NULL) {
+        /*Reuse the least recently used grid if there are enough*/
+        if(cnt >= HIT_INDEX_MAX_CNT) {
+            index = _lv_ll_get_tail(ll);
+        }
+        else {
+            index = _lv_ll_ins_head(ll);
+            LV_ASSERT_MEM(index);
+            if(index == NULL) return NULL;
+            _lv_memset_00(index, sizeof(hit_index_t));
+        }
+    }
+
+    /*Keep the recently used grids at the beginning*/
+    _lv_ll_move_before(ll, index, _lv_ll_get_head(ll));
+
+    if(index->root == root && index->outdated == 0) return index;
+
+    hit_index_free(index);
+    index->root = root;
+    if(hit_index_build(index) == false) {
+        LV_LOG_WARN("hit_index_get: couldn't build the grid");
+        hit_index_free(index);
+        return NULL;
+    }
+
+    return index;
+}
+
+/**
+ * Collect the clickable objects of `index->root` and sort them into the cells of the grid
+ * @param index pointer to a grid whose `root` is set
+ * @return true: the grid is built; false: out of memory
+ */
+static bool hit_index_build(hit_index_t * index)
+{
+    lv_obj_t * root = index->root;
+    lv_area_copy(&index->area, &root->coords);
+    _lv_memset_00(index->cell_start, sizeof(index->cell_start));
+
+    /*Nothing can be found if a parent of the root is hidden*/
+    bool par_hidden = false;
+    lv_obj_t * par;
+    for(par = lv_obj_get_parent(root); par != NULL; par = lv_obj_get_parent(par)) {
+        if(lv_obj_get_hidden(par)) {
+            par_hidden = true;
+            break;
+        }
+    }
+
+    lv_area_t all;
+    lv_area_set(&all, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MAX, LV_COORD_MAX);
+    uint32_t cnt = par_hidden ? 0 : hit_index_collect(root, &all, false, NULL, 0);
+    if(cnt > UINT16_MAX) return false;
+
+    index->outdated = 0;
+    if(cnt == 0) return true;
+
+    index->cands = lv_mem_alloc(cnt * sizeof(hit_cand_t));
+    LV_ASSERT_MEM(index->cands);
+    if(index->cands == NULL) return false;
+    hit_index_collect(root, &all, false, index->cands, 0);
+
+    /*Count the candidates of the cells. Count the n. cell's candidates in `cell_start[n + 1]`*/
+    uint32_t i;
+    lv_coord_t x;
+    lv_coord_t y;
+    for(i = 0; i < cnt; i++) {
+        lv_area_t cells;
+        if(hit_index_get_cells(index, &index->cands[i].area, &cells) == false) continue;
+
+        for(y = cells.y1; y <= cells.y2; y++) {
+            for(x = cells.x1; x <= cells.x2; x++) {
+                index->cell_start[y * HIT_INDEX_GRID + x + 1]++;
+            }
+        }
+    }
+
+    for(i = 0; i < HIT_INDEX_GRID * HIT_INDEX_GRID; i++) {
+        index->cell_start[i + 1] += index->cell_start[i];
+    }
+
+    index->cell_cands = lv_mem_alloc(index->cell_start[HIT_INDEX_GRID * HIT_INDEX_GRID] * sizeof(uint16_t));
+    LV_ASSERT_MEM(index->cell_cands);
+    if(index->cell_cands == NULL) return false;
+
+    /*Add the candidates to the cells in the order of the search*/
+    uint32_t cell_end[HIT_INDEX_GRID * HIT_INDEX_GRID];
+    _lv_memcpy(cell_end, index->cell_start, sizeof(cell_end));
+    for(i = 0; i < cnt; i++) {
+        lv_area_t cells;
+        if(hit_index_get_cells(index, &index->cands[i].area, &cells) == false) continue;
+
+        for(y = cells.y1; y <= cells.y2; y++) {
+            for(x = cells.x1; x <= cells.x2; x++) {
+                index->cell_cands[cell_end[y * HIT_INDEX_GRID + x]++] = i;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Collect the objects which can be found by `lv_indev_search_obj` in the order of the search:
+ * first the children (from the top to the bottom) then the object itself.
+ * @param obj the object to collect from
+ * @param par_area the point has to be here to pass the hit test of the parents
+ * @param adv_hittest true: a parent uses advanced hit test
+ * @param cands store the candidates here. NULL: only count them
+ * @param cnt number of candidates collected so far
+ * @return number of candidates collected including the ones of `obj`
+ */
+static uint32_t hit_index_collect(lv_obj_t * obj, const lv_area_t * par_area, bool adv_hittest, hit_cand_t * cands,
+                                  uint32_t cnt)
+{
+    /*Nothing can be found on hidden objects and on their children*/
+    if(lv_obj_get_hidden(obj)) return cnt;
+
+    lv_area_t area;
+    if(obj->adv_hittest) {
+        /*The result of the hit test is unknown so it will be called during the search*/
+        lv_area_copy(&area, par_area);
+        adv_hittest = true;
+    }
+    else {
+        /*If the point can't be on the object and on the parents then it can't be on the children either*/
+        lv_obj_get_click_area(obj, &area);
+        if(_lv_area_intersect(&area, &area, par_area) == false) return cnt;
+    }
+
+    lv_obj_t * child;
+    _LV_LL_READ(obj->child_ll, child) {
+        cnt = hit_index_collect(child, &area, adv_hittest, cands, cnt);
+    }
+
+    if(lv_obj_get_click(obj) == false) return cnt;
+    if(lv_obj_is_protected(obj, LV_PROTECT_EVENT_TO_DISABLED) == false &&
+       (lv_obj_get_state(obj, LV_OBJ_PART_MAIN) & LV_STATE_DISABLED)) {
+        return cnt;
+    }
+
+    if(cands) {
+        cands[cnt].obj = obj;
+        lv_area_copy(&cands[cnt].area, &area);
+        cands[cnt].adv_hittest = adv_hittest ? 1 : 0;
+    }
+
+    return cnt + 1;
+}
+
+/**
+ * Free the arrays of a grid and mark it unused
+ * @param index pointer to a grid
+ */
+static void hit_index_free(hit_index_t * index)
+{
+    lv_mem_free(index->cands);
+    lv_mem_free(index->cell_cands);
+    index->cands = NULL;
+    index->cell_cands = NULL;
+    index->root = NULL;
+    index->outdated = 1;
+}
+
+/**
+ * Tell whether an object is a parent (or grandparent and so on) of an other or they are the same object
+ * @param par pointer to the possible parent
+ * @param obj pointer to an object
+ * @return true: `obj` is `par` or it's on `par`
+ */
+static bool hit_index_is_parent(const lv_obj_t * par, const lv_obj_t * obj)
+{
+    /*Read `parent` directly as the object might be being deleted and already removed from its parent*/
+    while(obj) {
+        if(obj == par) return true;
+        obj = obj->parent;
+    }
+
+    return false;
+}
+
+/**
+ * Search the most top, clickable object by a point in a grid
+ * @param index pointer to an up-to-date grid
+ * @param point pointer to a point on `index->area`
+ * @return pointer to the found object or NULL if there was no suitable object
+ */
+static lv_obj_t * hit_index_search(hit_index_t * index, lv_point_t * point)
+{
+    lv_coord_t x = hit_index_get_cell_pos(point->x, index->area.x1, lv_area_get_width(&index->area));
+    lv_coord_t y = hit_index_get_cell_pos(point->y, index->area.y1, lv_area_get_height(&index->area));
+    uint32_t cell = y * HIT_INDEX_GRID + x;
+
+    uint32_t i;
+    for(i = index->cell_start[cell]; i < index->cell_start[cell + 1]; i++) {
+        hit_cand_t * cand = &index->cands[index->cell_cands[i]];
+        if(_lv_area_is_point_on(&cand->area, point, 0) == false) continue;
+
+        /*Call the advanced hit tests of the object and its parents*/
+        if(cand->adv_hittest) {
+            bool hit = true;
+            lv_obj_t * obj = cand->obj;
+            while(hit) {
+                if(obj->adv_hittest) hit = lv_obj_hittest(obj, point);
+                if(obj == index->root) break;
+                obj = lv_obj_get_parent(obj);
+            }
+            if(hit == false) continue;
+        }
+
+        return cand->obj;
+    }
+
+    return NULL;
+}
+
+/**
+ * Get the cells of a grid covered by an area
+ * @param index pointer to a grid
+ * @param area an area in screen coordinates
+ * @param cells store the first and last column and row here
+ * @return false: the area is out of the grid
+ */
+static bool hit_index_get_cells(const hit_index_t * index, const lv_area_t * area, lv_area_t * cells)
+{
+    lv_area_t a;
+    if(_lv_area_intersect(&a, area, &index->area) == false) return false;
+
+    lv_coord_t w = lv_area_get_width(&index->area);
+    lv_coord_t h = lv_area_get_height(&index->area);
+    cells->x1 = hit_index_get_cell_pos(a.x1, index->area.x1, w);
+    cells->y1 = hit_index_get_cell_pos(a.y1, index->area.y1, h);
+    cells->x2 = hit_index_get_cell_pos(a.x2, index->area.x1, w);
+    cells->y2 = hit_index_get_cell_pos(a.y2, index->area.y1, h);
+
+    return true;
+}
+
+/**
+ * Get the column or row of the cell containing a coordinate
+ * @param v an x or y coordinate on the grid
+ * @param start the first x or y coordinate of the grid
+ * @param len the width or height of the grid
+ * @return the column or row (0..HIT_INDEX_GRID - 1)
+ */
+static lv_coord_t hit_index_get_cell_pos(lv_coord_t v, lv_coord_t start, lv_coord_t len)
+{
+    return (lv_coord_t)(((int32_t)(v - start) * HIT_INDEX_GRID) / len);
+}
+#endif
@@ -40,6 +40,15 @@ void _lv_indev_init(void);
  */
 void _lv_indev_read_task(lv_task_t * task);
 
+#if LV_USE_HIT_INDEX
+/**
+ * Mark the hit-test grids affected by an object outdated. Called when an object is moved, resized, created,
+ * deleted, hidden, disabled or its clickability changed. The grids are rebuilt on the next search.
+ * @param obj pointer to the changed object
+ */
+void _lv_indev_hit_index_invalidate(lv_obj_t * obj);
+#endif
+
 /**
  * Get the currently processed input device. Can be used in action functions too.
  * @return pointer to the currently processed input device or NULL if no input device processing
@@ -21,6 +21,7 @@
 #include "../lv_misc/lv_gc.h"
 #include "../lv_misc/lv_math.h"
 #include "../lv_misc/lv_log.h"
+#include "../lv_misc/lv_prof.h"
 #include "../lv_hal/lv_hal.h"
 #include <stdint.h>
 #include <string.h>
@@ -47,6 +48,22 @@
 #define LV_OBJ_DEF_WIDTH    (LV_DPX(100))
 #define LV_OBJ_DEF_HEIGHT   (LV_DPX(50))
 
+/*Max. number of layout refreshes per dirty object in one `lv_obj_update_layout()`*/
+#define LV_OBJ_LAYOUT_MAX_REFR  8
+
+/*Initial number of entries of the heap of the dirty layouts*/
+#define LAYOUT_HEAP_MIN_SIZE    16
+
+/*True if the layout item `a` should be refreshed before `b`*/
+#define LAYOUT_ITEM_BEFORE(a, b) ((a)->level > (b)->level || ((a)->level == (b)->level && (a)->order < (b)->order))
+
+/*Initial number of entries of the side tables*/
+#define SIDE_TABLE_MIN_SIZE     8
+
+/*Get an entry of a side table and the object it belongs to*/
+#define SIDE_TABLE_ENTRY(t, i)  ((void *)((uint8_t *)*(t)->entries + (uint32_t)(i) * (t)->entry_size))
+#define SIDE_TABLE_OBJ(t, i)    (*(const lv_obj_t **)SIDE_TABLE_ENTRY(t, i))
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -104,6 +121,43 @@ typedef struct {
     uint32_t border_post : 1;
 } style_snapshot_t;
 
+#if LV_USE_OBJ_COMPACT
+/**
+ * Hash table (open addressing, linear probing) to store rarely used properties of the objects.
+ * Only the objects using the property have an entry and it's found in constant time.
+ */
+typedef struct {
+    void ** entries;        /*Pointer to the GC root of the array of entries. NULL if not allocated*/
+    uint32_t size;          /*Number of entries, power of 2 (or 0)*/
+    uint32_t cnt;           /*Number of used entries. The table is kept at most half full*/
+    uint32_t entry_size;    /*Size of an entry in bytes*/
+} side_table_t;
+
+/*The entries of the side tables. All start with the object they belong to (NULL: free entry).*/
+#if LV_USE_OBJ_REALIGN
+typedef struct {
+    const lv_obj_t * obj;
+    lv_realign_t realign;
+} realign_entry_t;
+#endif
+
+#if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
+typedef struct {
+    const lv_obj_t * obj;
+    lv_area_t pad;
+} click_pad_entry_t;
+#endif
+#endif
+
+#if LV_USE_LAYOUT_DEFER
+/*An object in the heap of the dirty layouts. The deepest object is on the top.*/
+typedef struct {
+    lv_obj_t * obj;
+    uint32_t level;     /*Number of ancestors, calculated once when the object gets into the heap*/
+    uint32_t order;     /*Objects on the same level are refreshed in the order of marking*/
+} layout_item_t;
+#endif
+
 typedef enum {
     STYLE_COMPARE_SAME,
     STYLE_COMPARE_VISUAL_DIFF,
@@ -116,6 +170,9 @@ typedef enum {
 static lv_design_res_t lv_obj_design(lv_obj_t * obj, const lv_area_t * clip_area, lv_design_mode_t mode);
 static lv_res_t lv_obj_signal(lv_obj_t * obj, lv_signal_t sign, void * param);
 static void refresh_children_position(lv_obj_t * obj, lv_coord_t x_diff, lv_coord_t y_diff);
+#if LV_USE_SUBTREE_BOUNDS
+static void subtree_bounds_inv_par(lv_obj_t * obj);
+#endif
 static void report_style_mod_core(void * style_p, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static void base_dir_refr_children(lv_obj_t * obj);
@@ -142,6 +199,40 @@ static void update_style_cache_children(lv_obj_t * obj);
 static void invalidate_style_cache(lv_obj_t * obj, uint8_t part, lv_style_property_t prop);
 static void style_snapshot(lv_obj_t * obj, uint8_t part, style_snapshot_t * shot);
 static style_snapshot_res_t style_snapshot_compare(style_snapshot_t * shot1, style_snapshot_t * shot2);
+#if LV_USE_LAYOUT_DEFER
+static void layout_update_if_dirty(const lv_obj_t * obj, bool ancestors);
+static void layout_remove(lv_obj_t * obj);
+static bool layout_heap_fill(void);
+static lv_obj_t * layout_heap_pop(void);
+static void layout_heap_remove(uint32_t i);
+static void layout_heap_sift_up(uint32_t i);
+static void layout_heap_sift_down(uint32_t i);
+static void layout_heap_clear(void);
+#endif
+#if LV_USE_OBJ_COMPACT
+static lv_obj_class_t * class_get(lv_signal_cb_t signal_cb, lv_design_cb_t design_cb);
+static void class_release(lv_obj_class_t * obj_class);
+static void side_table_init(side_table_t * t, void ** entries, uint32_t entry_size);
+static void * side_table_get(const side_table_t * t, const lv_obj_t * obj);
+static void * side_table_add(side_table_t * t, const lv_obj_t * obj);
+static void side_table_remove(side_table_t * t, const lv_obj_t * obj);
+static bool side_table_resize(side_table_t * t, uint32_t new_size);
+static uint32_t side_table_hash(const side_table_t * t, const lv_obj_t * obj);
+static void side_table_remove_obj(lv_obj_t * obj);
+#endif
+#if LV_USE_OBJ_REALIGN
+static const lv_realign_t * realign_get(const lv_obj_t * obj);
+static lv_realign_t * realign_get_alloc(lv_obj_t * obj);
+#endif
+#if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
+static const lv_area_t * click_pad_get(const lv_obj_t * obj);
+static lv_area_t * click_pad_get_alloc(lv_obj_t * obj);
+#endif
+#if LV_USE_FAST_SCROLL
+static bool fast_scroll_get_area(const lv_obj_t * obj, lv_area_t * area, lv_coord_t * pad);
+static bool fast_scroll_is_covered(const lv_obj_t * obj, const lv_area_t * area);
+static void fast_scroll_inv_pad(lv_obj_t * par, lv_coord_t pad);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -149,6 +240,25 @@ static style_snapshot_res_t style_snapshot_compare(style_snapshot_t * shot1, sty
 static bool lv_initialized = false;
 static lv_event_temp_data_t * event_temp_data_head;
 static const void * event_act_data;
+#if LV_USE_LAYOUT_DEFER
+    static bool layout_updating;
+    static uint32_t layout_heap_cnt;
+    static uint32_t layout_heap_size;
+    static uint32_t layout_order;
+#endif
+#if LV_USE_OBJ_COMPACT
+    static lv_obj_class_t obj_class_base = {lv_obj_signal, lv_obj_design, 0};
+#if LV_USE_OBJ_REALIGN
+    static side_table_t realign_table;
+    /*The align parameters of the last aligned object without auto realign.
+     *Only the objects with auto realign are stored in `realign_table` but the parameters
+     *have to be remembered if auto realign is enabled or `lv_obj_realign` is called after aligning.*/
+    static realign_entry_t realign_last;
+#endif
+#if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
+    static side_table_t click_pad_table;
+#endif
+#endif
 
 /**********************
  *      MACROS
@@ -200,6 +310,20 @@ void lv_init(void)
 #endif
 
     _lv_ll_init(&LV_GC_ROOT(_lv_obj_style_trans_ll), sizeof(lv_style_trans_t));
+    _lv_ll_init(&LV_GC_ROOT(_lv_obj_layout_ll), sizeof(lv_obj_t *));
+#if LV_USE_LAYOUT_DEFER
+    LV_GC_ROOT(_lv_obj_layout_heap) = NULL;
+#endif
+#if LV_USE_OBJ_COMPACT
+    _lv_ll_init(&LV_GC_ROOT(_lv_obj_class_ll), sizeof(lv_obj_class_t));
+#if LV_USE_OBJ_REALIGN
+    side_table_init(&realign_table, &LV_GC_ROOT(_lv_obj_realign_table), sizeof(realign_entry_t));
+    realign_last.obj = NULL;
+#endif
+#if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
+    side_table_init(&click_pad_table, &LV_GC_ROOT(_lv_obj_click_pad_table), sizeof(click_pad_entry_t));
+#endif
+#endif
 
     _lv_ll_init(&LV_GC_ROOT(_lv_disp_ll), sizeof(lv_disp_t));
     _lv_ll_init(&LV_GC_ROOT(_lv_indev_ll), sizeof(lv_indev_t));
@@ -218,6 +342,9 @@ void lv_init(void)
     _lv_img_decoder_init();
 #if LV_IMG_CACHE_DEF_SIZE
     lv_img_cache_set_size(LV_IMG_CACHE_DEF_SIZE);
+#endif
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+    _lv_ll_init(&LV_GC_ROOT(_lv_img_transform_cache_ll), sizeof(lv_img_transform_cache_entry_t));
 #endif
     /*Test if the IDE has UTF-8 encoding*/
     char * txt = "Á";
@@ -290,8 +417,12 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const lv_obj_t * copy)
 #endif
 
         /*Set the callbacks*/
+#if LV_USE_OBJ_COMPACT
+        new_obj->class_p = &obj_class_base;
+#else
         new_obj->signal_cb = lv_obj_signal;
         new_obj->design_cb = lv_obj_design;
+#endif
         new_obj->event_cb = NULL;
 
         /*Set coordinates to full screen size*/
@@ -320,8 +451,12 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const lv_obj_t * copy)
 #endif
 
         /*Set the callbacks (signal:cb is required in `lv_obj_get_base_dir` if `LV_USE_ASSERT_OBJ` is enabled)*/
+#if LV_USE_OBJ_COMPACT
+        new_obj->class_p = &obj_class_base;
+#else
         new_obj->signal_cb = lv_obj_signal;
         new_obj->design_cb = lv_obj_design;
+#endif
         new_obj->event_cb = NULL;
 
         new_obj->coords.y1    = parent->coords.y1;
@@ -340,7 +475,7 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const lv_obj_t * copy)
 
     new_obj->ext_draw_pad = 0;
 
-#if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
+#if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL && LV_USE_OBJ_COMPACT == 0
     _lv_memset_00(&new_obj->ext_click_pad, sizeof(new_obj->ext_click_pad));
 #elif LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_TINY
     new_obj->ext_click_pad_hor = 0;
@@ -348,7 +483,7 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const lv_obj_t * copy)
 #endif
 
     /*Init realign*/
-#if LV_USE_OBJ_REALIGN
+#if LV_USE_OBJ_REALIGN && LV_USE_OBJ_COMPACT == 0
     new_obj->realign.align        = LV_ALIGN_CENTER;
     new_obj->realign.xofs         = 0;
     new_obj->realign.yofs         = 0;
@@ -378,11 +513,21 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const lv_obj_t * copy)
     new_obj->parent_event = 0;
     new_obj->gesture_parent = parent ? 1 : 0;
     new_obj->focus_parent  = 0;
+#if LV_USE_FAST_SCROLL
+    new_obj->fast_scroll   = 0;
+#endif
+#if LV_USE_LAYOUT_DEFER
+    new_obj->layout_dirty  = 0;
+#endif
+#if LV_USE_SUBTREE_BOUNDS
+    new_obj->subtree_bounds_valid = 0;
+#endif
     new_obj->state = LV_STATE_DEFAULT;
 
     new_obj->ext_attr = NULL;
 
     lv_style_list_init(&new_obj->style_list);
+    _lv_style_list_set_owner(&new_obj->style_list, new_obj, LV_OBJ_PART_MAIN);
     if(copy == NULL) {
         if(parent != NULL) lv_theme_apply(new_obj, LV_THEME_OBJ);
         else lv_theme_apply(new_obj, LV_THEME_SCR);
@@ -396,7 +541,14 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const lv_obj_t * copy)
         new_obj->ext_draw_pad = copy->ext_draw_pad;
 
 #if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
+#if LV_USE_OBJ_COMPACT
+        if(copy->has_click_pad) {
+            lv_area_t * pad = click_pad_get_alloc(new_obj);
+            if(pad) lv_area_copy(pad, click_pad_get(copy));
+        }
+#else
         lv_area_copy(&new_obj->ext_click_pad, &copy->ext_click_pad);
+#endif
 #elif LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_TINY
         new_obj->ext_click_pad_hor = copy->ext_click_pad_hor;
         new_obj->ext_click_pad_ver = copy->ext_click_pad_ver;
@@ -411,11 +563,21 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const lv_obj_t * copy)
 
         /*Copy realign*/
 #if LV_USE_OBJ_REALIGN
+#if LV_USE_OBJ_COMPACT
+        if(copy->has_realign) {
+            realign_entry_t * entry = side_table_add(&realign_table, new_obj);
+            if(entry) {
+                entry->realign = *realign_get(copy);
+                new_obj->has_realign = 1;
+            }
+        }
+#else
         new_obj->realign.align        = copy->realign.align;
         new_obj->realign.xofs         = copy->realign.xofs;
         new_obj->realign.yofs         = copy->realign.yofs;
         new_obj->realign.base         = copy->realign.base;
         new_obj->realign.auto_realign = copy->realign.auto_realign;
+#endif
 #endif
 
         /*Only copy the `event_cb`. `signal_cb` and `design_cb` will be copied in the derived
@@ -436,6 +598,9 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const lv_obj_t * copy)
         new_obj->protect      = copy->protect;
         new_obj->gesture_parent = copy->gesture_parent;
         new_obj->focus_parent = copy->focus_parent;
+#if LV_USE_FAST_SCROLL
+        new_obj->fast_scroll  = copy->fast_scroll;
+#endif
 
 #if LV_USE_GROUP
         /*Add to the same group*/
@@ -450,9 +615,16 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const lv_obj_t * copy)
         }
     }
 
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(new_obj);
+#endif
+#if LV_USE_SUBTREE_BOUNDS
+    subtree_bounds_inv_par(new_obj);
+#endif
+
     /*Send a signal to the parent to notify it about the new child*/
     if(parent != NULL) {
-        parent->signal_cb(parent, LV_SIGNAL_CHILD_CHG, new_obj);
+        _LV_OBJ_SIGNAL_CB(parent)(parent, LV_SIGNAL_CHILD_CHG, new_obj);
 
         /*Invalidate the area if not screen created*/
         lv_obj_invalidate(new_obj);
@@ -486,7 +658,7 @@ lv_res_t lv_obj_del(lv_obj_t * obj)
 
     /*Send a signal to the parent to notify it about the child delete*/
     if(par) {
-        par->signal_cb(par, LV_SIGNAL_CHILD_CHG, NULL);
+        _LV_OBJ_SIGNAL_CB(par)(par, LV_SIGNAL_CHILD_CHG, NULL);
     }
 
     /*Handle if the active screen was deleted*/
@@ -544,6 +716,13 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
+#if LV_USE_SCR_SNAPSHOT
+    _lv_scr_snapshot_inv(obj, area);
+#endif
+#if LV_USE_DRAW_BACKEND
+    _lv_refr_native_retry(obj);
+#endif
+
     lv_area_t area_tmp;
     lv_area_copy(&area_tmp, area);
     bool visible = lv_obj_area_is_visible(obj, &area_tmp);
@@ -682,8 +861,25 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
         old_pos.x = old_par->coords.x2 - obj->coords.x2;
     }
 
+#if LV_USE_SUBTREE_BOUNDS
+    subtree_bounds_inv_par(obj);
+#endif
+#if LV_USE_HIT_INDEX
+    /*Both the old and the new parent's grids are affected*/
+    _lv_indev_hit_index_invalidate(obj);
+#endif
+#if LV_USE_GROUP && LV_USE_GROUP_INDEX
+    /*The objects of a group might leave the common parent of the group*/
+    _lv_group_index_invalidate_geometry(obj);
+#endif
     _lv_ll_chg_list(&obj->parent->child_ll, &parent->child_ll, obj, true);
     obj->parent = parent;
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(obj);
+#endif
+#if LV_USE_SUBTREE_BOUNDS
+    subtree_bounds_inv_par(obj);
+#endif
 
     if(new_base_dir != LV_BIDI_DIR_RTL) {
         lv_obj_set_pos(obj, old_pos.x, old_pos.y);
@@ -695,10 +891,10 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     }
 
     /*Notify the original parent because one of its children is lost*/
-    old_par->signal_cb(old_par, LV_SIGNAL_CHILD_CHG, NULL);
+    _LV_OBJ_SIGNAL_CB(old_par)(old_par, LV_SIGNAL_CHILD_CHG, NULL);
 
     /*Notify the new parent about the child*/
-    parent->signal_cb(parent, LV_SIGNAL_CHILD_CHG, obj);
+    _LV_OBJ_SIGNAL_CB(parent)(parent, LV_SIGNAL_CHILD_CHG, obj);
 
     lv_obj_invalidate(obj);
 }
@@ -719,9 +915,12 @@ void lv_obj_move_foreground(lv_obj_t * obj)
     lv_obj_invalidate(parent);
 
     _lv_ll_chg_list(&parent->child_ll, &parent->child_ll, obj, true);
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(obj);
+#endif
 
     /*Notify the new parent about the child*/
-    parent->signal_cb(parent, LV_SIGNAL_CHILD_CHG, obj);
+    _LV_OBJ_SIGNAL_CB(parent)(parent, LV_SIGNAL_CHILD_CHG, obj);
 
     lv_obj_invalidate(parent);
 }
@@ -742,9 +941,12 @@ void lv_obj_move_background(lv_obj_t * obj)
     lv_obj_invalidate(parent);
 
     _lv_ll_chg_list(&parent->child_ll, &parent->child_ll, obj, false);
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(obj);
+#endif
 
     /*Notify the new parent about the child*/
-    parent->signal_cb(parent, LV_SIGNAL_CHILD_CHG, obj);
+    _LV_OBJ_SIGNAL_CB(parent)(parent, LV_SIGNAL_CHILD_CHG, obj);
 
     lv_obj_invalidate(parent);
 }
@@ -781,12 +983,22 @@ void lv_obj_set_pos(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
      * occur without position change*/
     if(diff.x == 0 && diff.y == 0) return;
 
+#if LV_USE_FAST_SCROLL
+    /*Move the content of the parent instead of redrawing the original and the new area*/
+    lv_area_t scroll_area;
+    lv_coord_t scroll_pad = 0;
+    bool scroll = obj->fast_scroll && fast_scroll_get_area(obj, &scroll_area, &scroll_pad);
+
+    /*Invalidate the original area*/
+    if(scroll == false) lv_obj_invalidate(obj);
+#else
     /*Invalidate the original area*/
     lv_obj_invalidate(obj);
+#endif
 
     /*Save the original coordinates*/
     lv_area_t ori;
-    lv_obj_get_coords(obj, &ori);
+    lv_area_copy(&ori, &obj->coords);
 
     obj->coords.x1 += diff.x;
     obj->coords.y1 += diff.y;
@@ -794,12 +1006,31 @@ void lv_obj_set_pos(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
     obj->coords.y2 += diff.y;
 
     refresh_children_position(obj, diff.x, diff.y);
+    _lv_obj_coords_changed(obj, true);
 
     /*Inform the object about its new coordinates*/
-    obj->signal_cb(obj, LV_SIGNAL_COORD_CHG, &ori);
+    _LV_OBJ_SIGNAL_CB(obj)(obj, LV_SIGNAL_COORD_CHG, &ori);
 
     /*Send a signal to the parent too*/
-    if(par) par->signal_cb(par, LV_SIGNAL_CHILD_CHG, obj);
+    if(par) _LV_OBJ_SIGNAL_CB(par)(par, LV_SIGNAL_CHILD_CHG, obj);
+
+#if LV_USE_FAST_SCROLL
+    /* Move the content only now so that the areas invalidated by the signals (e.g. the old and new scrollbars)
+     * are invalidated at the moved position too*/
+    if(scroll) {
+        if(_lv_inv_scroll(lv_obj_get_disp(obj), &scroll_area, diff.x, diff.y)) {
+            fast_scroll_inv_pad(par, scroll_pad);
+#if LV_USE_SCR_SNAPSHOT
+            /*The moved area is not invalidated but it has changed*/
+            _lv_scr_snapshot_inv(par, &scroll_area);
+#endif
+        }
+        else {
+            lv_obj_invalidate_area(par, &par->coords);
+        }
+        return;
+    }
+#endif
 
     /*Invalidate the new area*/
     lv_obj_invalidate(obj);
@@ -814,7 +1045,8 @@ void lv_obj_set_x(lv_obj_t * obj, lv_coord_t x)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
-    lv_obj_set_pos(obj, x, lv_obj_get_y(obj));
+    lv_coord_t y = obj->parent ? obj->coords.y1 - obj->parent->coords.y1 : obj->coords.y1;
+    lv_obj_set_pos(obj, x, y);
 }
 
 /**
@@ -826,7 +1058,8 @@ void lv_obj_set_y(lv_obj_t * obj, lv_coord_t y)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
-    lv_obj_set_pos(obj, lv_obj_get_x(obj), y);
+    lv_coord_t x = obj->parent ? obj->coords.x1 - obj->parent->coords.x1 : obj->coords.x1;
+    lv_obj_set_pos(obj, x, y);
 }
 
 /**
@@ -842,7 +1075,7 @@ void lv_obj_set_size(lv_obj_t * obj, lv_coord_t w, lv_coord_t h)
     /* Do nothing if the size is not changed */
     /* It is very important else recursive resizing can
      * occur without size change*/
-    if(lv_obj_get_width(obj) == w && lv_obj_get_height(obj) == h) {
+    if(lv_area_get_width(&obj->coords) == w && lv_area_get_height(&obj->coords) == h) {
         return;
     }
 
@@ -851,7 +1084,7 @@ void lv_obj_set_size(lv_obj_t * obj, lv_coord_t w, lv_coord_t h)
 
     /*Save the original coordinates*/
     lv_area_t ori;
-    lv_obj_get_coords(obj, &ori);
+    lv_area_copy(&ori, &obj->coords);
 
     /*Set the length and height*/
     obj->coords.y2 = obj->coords.y1 + h - 1;
@@ -862,17 +1095,20 @@ void lv_obj_set_size(lv_obj_t * obj, lv_coord_t w, lv_coord_t h)
         obj->coords.x2 = obj->coords.x1 + w - 1;
     }
 
+    /*With RTL base direction `x1` moves but the children don't*/
+    _lv_obj_coords_changed(obj, false);
+
     /*Send a signal to the object with its new coordinates*/
-    obj->signal_cb(obj, LV_SIGNAL_COORD_CHG, &ori);
+    _LV_OBJ_SIGNAL_CB(obj)(obj, LV_SIGNAL_COORD_CHG, &ori);
 
     /*Send a signal to the parent too*/
     lv_obj_t * par = lv_obj_get_parent(obj);
-    if(par != NULL) par->signal_cb(par, LV_SIGNAL_CHILD_CHG, obj);
+    if(par != NULL) _LV_OBJ_SIGNAL_CB(par)(par, LV_SIGNAL_CHILD_CHG, obj);
 
     /*Tell the children the parent's size has changed*/
     lv_obj_t * i;
     _LV_LL_READ(obj->child_ll, i) {
-        i->signal_cb(i, LV_SIGNAL_PARENT_SIZE_CHG,  &ori);
+        _LV_OBJ_SIGNAL_CB(i)(i, LV_SIGNAL_PARENT_SIZE_CHG,  &ori);
     }
 
     /*Invalidate the new area*/
@@ -880,7 +1116,31 @@ void lv_obj_set_size(lv_obj_t * obj, lv_coord_t w, lv_coord_t h)
 
     /*Automatically realign the object if required*/
 #if LV_USE_OBJ_REALIGN
-    if(obj->realign.auto_realign) lv_obj_realign(obj);
+    if(realign_get(obj)->auto_realign) lv_obj_realign(obj);
+#endif
+}
+
+/**
+ * Mark the data cached from an object's coordinates outdated after the coordinates were written.
+ * Call it after changing `obj->coords` directly and before sending `LV_SIGNAL_COORD_CHG`.
+ * @param obj pointer to an object
+ * @param children_moved true: the children were moved together with the object (only its position changed)
+ */
+void _lv_obj_coords_changed(lv_obj_t * obj, bool children_moved)
+{
+    LV_UNUSED(obj);
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(obj);
+#endif
+#if LV_USE_GROUP && LV_USE_GROUP_INDEX
+    _lv_group_index_invalidate_geometry(obj);
+#endif
+#if LV_USE_SUBTREE_BOUNDS
+    /*The bounds are relative to the object so they remain valid only if the children moved with it*/
+    if(children_moved == false) obj->subtree_bounds_valid = 0;
+    subtree_bounds_inv_par(obj);
+#else
+    LV_UNUSED(children_moved);
 #endif
 }
 
@@ -893,7 +1153,7 @@ void lv_obj_set_width(lv_obj_t * obj, lv_coord_t w)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
-    lv_obj_set_size(obj, w, lv_obj_get_height(obj));
+    lv_obj_set_size(obj, w, lv_area_get_height(&obj->coords));
 }
 
 /**
@@ -905,7 +1165,7 @@ void lv_obj_set_height(lv_obj_t * obj, lv_coord_t h)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
-    lv_obj_set_size(obj, lv_obj_get_width(obj), h);
+    lv_obj_set_size(obj, lv_area_get_width(&obj->coords), h);
 }
 
 /**
@@ -982,11 +1242,13 @@ void lv_obj_align(lv_obj_t * obj, const lv_obj_t * base, lv_align_t align, lv_co
 
 #if LV_USE_OBJ_REALIGN
     /*Save the last align parameters to use them in `lv_obj_realign`*/
-    obj->realign.align       = align;
-    obj->realign.xofs        = x_ofs;
-    obj->realign.yofs        = y_ofs;
-    obj->realign.base        = base;
-    obj->realign.mid_align = 0;
+    lv_realign_t * realign = realign_get_alloc(obj);
+    if(realign == NULL) return;
+    realign->align       = align;
+    realign->xofs        = x_ofs;
+    realign->yofs        = y_ofs;
+    realign->base        = base;
+    realign->mid_align = 0;
 #endif
 }
 
@@ -1048,11 +1310,13 @@ void lv_obj_align_mid(lv_obj_t * obj, const lv_obj_t * base, lv_align_t align, l
 
 #if LV_USE_OBJ_REALIGN
     /*Save the last align parameters to use them in `lv_obj_realign`*/
-    obj->realign.align       = align;
-    obj->realign.xofs        = x_ofs;
-    obj->realign.yofs        = y_ofs;
-    obj->realign.base        = base;
-    obj->realign.mid_align = 1;
+    lv_realign_t * realign = realign_get_alloc(obj);
+    if(realign == NULL) return;
+    realign->align       = align;
+    realign->xofs        = x_ofs;
+    realign->yofs        = y_ofs;
+    realign->base        = base;
+    realign->mid_align = 1;
 #endif
 }
 
@@ -1105,10 +1369,12 @@ void lv_obj_realign(lv_obj_t * obj)
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
 #if LV_USE_OBJ_REALIGN
-    if(obj->realign.mid_align)
-        lv_obj_align_mid(obj, obj->realign.base, obj->realign.align, obj->realign.xofs, obj->realign.yofs);
+    /*Copy the parameters as aligning updates them*/
+    lv_realign_t realign = *realign_get(obj);
+    if(realign.mid_align)
+        lv_obj_align_mid(obj, realign.base, realign.align, realign.xofs, realign.yofs);
     else
-        lv_obj_align(obj, obj->realign.base, obj->realign.align, obj->realign.xofs, obj->realign.yofs);
+        lv_obj_align(obj, realign.base, realign.align, realign.xofs, realign.yofs);
 #else
     (void)obj;
     LV_LOG_WARN("lv_obj_realign: no effect because LV_USE_OBJ_REALIGN = 0");
@@ -1126,7 +1392,29 @@ void lv_obj_set_auto_realign(lv_obj_t * obj, bool en)
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
 #if LV_USE_OBJ_REALIGN
+    if(realign_get(obj)->auto_realign == en) return;
+#if LV_USE_OBJ_COMPACT
+    /*Only the objects with auto realign have an entry in the side table*/
+    if(en) {
+        lv_realign_t realign = *realign_get(obj);
+        realign_entry_t * entry = side_table_add(&realign_table, obj);
+        if(entry == NULL) return;
+        entry->realign = realign;
+        entry->realign.auto_realign = 1;
+        obj->has_realign = 1;
+        if(realign_last.obj == obj) realign_last.obj = NULL;
+    }
+    else {
+        /*Keep the parameters for `lv_obj_realign`*/
+        realign_entry_t * entry = side_table_get(&realign_table, obj);
+        realign_last = *entry;
+        realign_last.realign.auto_realign = 0;
+        side_table_remove(&realign_table, obj);
+        obj->has_realign = 0;
+    }
+#else
     obj->realign.auto_realign = en ? 1 : 0;
+#endif
 #else
     (void)obj;
     (void)en;
@@ -1149,10 +1437,22 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, lv_coord_t left, lv_coord_t right
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
 #if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
-    obj->ext_click_pad.x1 = left;
-    obj->ext_click_pad.x2 = right;
-    obj->ext_click_pad.y1 = top;
-    obj->ext_click_pad.y2 = bottom;
+#if LV_USE_OBJ_COMPACT
+    /*Don't store the default zero paddings*/
+    if(left == 0 && right == 0 && top == 0 && bottom == 0) {
+        if(obj->has_click_pad) {
+            side_table_remove(&click_pad_table, obj);
+            obj->has_click_pad = 0;
+        }
+        return;
+    }
+#endif
+    lv_area_t * pad = click_pad_get_alloc(obj);
+    if(pad == NULL) return;
+    pad->x1 = left;
+    pad->x2 = right;
+    pad->y1 = top;
+    pad->y2 = bottom;
 #elif LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_TINY
     obj->ext_click_pad_hor = LV_MATH_MAX(left, right);
     obj->ext_click_pad_ver = LV_MATH_MAX(top, bottom);
@@ -1163,6 +1463,10 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, lv_coord_t left, lv_coord_t right
     (void)top;    /*Unused*/
     (void)bottom; /*Unused*/
 #endif
+
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(obj);
+#endif
 }
 
 /*---------------------
@@ -1420,7 +1724,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, uint8_t part, lv_style_property_t prop
 
     if(real_refr) {
         lv_obj_invalidate(obj);
-        obj->signal_cb(obj, LV_SIGNAL_STYLE_CHG, NULL);
+        _LV_OBJ_SIGNAL_CB(obj)(obj, LV_SIGNAL_STYLE_CHG, NULL);
 
         switch(prop) {
             case LV_STYLE_PROP_ALL:
@@ -1428,7 +1732,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, uint8_t part, lv_style_property_t prop
             case LV_STYLE_MARGIN_BOTTOM:
             case LV_STYLE_MARGIN_LEFT:
             case LV_STYLE_MARGIN_RIGHT:
-                if(obj->parent) obj->parent->signal_cb(obj->parent, LV_SIGNAL_CHILD_CHG, NULL);
+                if(obj->parent) _LV_OBJ_SIGNAL_CB(obj->parent)(obj->parent, LV_SIGNAL_CHILD_CHG, NULL);
                 break;
         }
 
@@ -1446,9 +1750,25 @@ void lv_obj_refresh_style(lv_obj_t * obj, uint8_t part, lv_style_property_t prop
  * Notify all object if a style is modified
  * @param style pointer to a style. Only the objects with this style will be notified
  *               (NULL to notify all objects)
+ * @note with `LV_USE_STYLE_INDEX` only the users of `style` are visited instead of all objects
  */
 void lv_obj_report_style_mod(lv_style_t * style)
 {
+#if LV_USE_STYLE_INDEX
+    /*Refresh only the users of the style.
+     *The users of a reset style are unlinked so find and link them again by visiting all objects.*/
+    if(style && !style->refs_lost) {
+        lv_style_ref_t * ref = style->refs;
+        while(ref) {
+            /*Step first as refreshing might relink the current reference*/
+            lv_style_ref_t * ref_next = ref->next;
+            if(ref->obj) lv_obj_refresh_style(ref->obj, ref->part, LV_STYLE_PROP_ALL);
+            ref = ref_next;
+        }
+        return;
+    }
+#endif
+
     lv_disp_t * d = lv_disp_get_next(NULL);
 
     while(d) {
@@ -1458,6 +1778,10 @@ void lv_obj_report_style_mod(lv_style_t * style)
         }
         d = lv_disp_get_next(d);
     }
+
+#if LV_USE_STYLE_INDEX
+    if(style) style->refs_lost = 0;
+#endif
 }
 
 /**
@@ -1496,11 +1820,21 @@ void lv_obj_set_hidden(lv_obj_t * obj, bool en)
     if(!obj->hidden) lv_obj_invalidate(obj); /*Invalidate when not hidden (hidden objects are ignored) */
 
     obj->hidden = en == false ? 0 : 1;
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(obj);
+#endif
+#if LV_USE_GROUP && LV_USE_GROUP_INDEX
+    /*Hidden objects can't be focused*/
+    if(obj->group_p) _lv_group_index_update_obj(obj);
+#endif
+#if LV_USE_SUBTREE_BOUNDS
+    subtree_bounds_inv_par(obj);
+#endif
 
     if(!obj->hidden) lv_obj_invalidate(obj); /*Invalidate when not hidden (hidden objects are ignored) */
 
     lv_obj_t * par = lv_obj_get_parent(obj);
-    if(par) par->signal_cb(par, LV_SIGNAL_CHILD_CHG, obj);
+    if(par) _LV_OBJ_SIGNAL_CB(par)(par, LV_SIGNAL_CHILD_CHG, obj);
 }
 
 /**
@@ -1513,6 +1847,10 @@ void lv_obj_set_adv_hittest(lv_obj_t * obj, bool en)
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
     obj->adv_hittest = en == false ? 0 : 1;
+
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(obj);
+#endif
 }
 
 /**
@@ -1525,6 +1863,10 @@ void lv_obj_set_click(lv_obj_t * obj, bool en)
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
     obj->click = (en == true ? 1 : 0);
+
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(obj);
+#endif
 }
 
 /**
@@ -1628,6 +1970,23 @@ void lv_obj_set_focus_parent(lv_obj_t * obj, bool en)
     }
 }
 
+#if LV_USE_FAST_SCROLL
+/**
+ * Move the content of the parent instead of redrawing it when the object is moved (e.g. the scrollable of a page).
+ * Only the newly exposed band of the parent is redrawn, see `_lv_inv_scroll()`.
+ * It's used only if the object is the only child of the parent, the parent's background is
+ * opaque and looks the same everywhere and no other object is drawn on the parent.
+ * @param obj pointer to an object
+ * @param en true: enable moving the parent's content
+ */
+void lv_obj_set_fast_scroll(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
+
+    obj->fast_scroll = (en == true ? 1 : 0);
+}
+#endif
+
 /**
  * Propagate the events to the parent too
  * @param obj pointer to an object
@@ -1673,6 +2032,10 @@ void lv_obj_add_protect(lv_obj_t * obj, uint8_t prot)
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
     obj->protect |= prot;
+
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(obj);
+#endif
 }
 
 /**
@@ -1686,6 +2049,10 @@ void lv_obj_clear_protect(lv_obj_t * obj, uint8_t prot)
 
     prot = (~prot) & 0xFF;
     obj->protect &= prot;
+
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(obj);
+#endif
 }
 
 /**
@@ -1711,6 +2078,7 @@ void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
         style_snapshot_t shot_pre;
         style_snapshot(obj, part, &shot_pre);
         obj->state = new_state;
+
         style_snapshot_t shot_post;
         style_snapshot(obj, part, &shot_post);
 
@@ -1726,6 +2094,16 @@ void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
 
     obj->state = new_state;
 
+#if LV_USE_GROUP && LV_USE_GROUP_INDEX
+    /*Disabled objects can't be focused*/
+    if(obj->group_p && ((prev_state ^ new_state) & LV_STATE_DISABLED)) _lv_group_index_update_obj(obj);
+#endif
+
+#if LV_USE_HIT_INDEX
+    /*Disabled objects can't be pressed*/
+    if((prev_state ^ new_state) & LV_STATE_DISABLED) _lv_indev_hit_index_invalidate(obj);
+#endif
+
     if(cmp_res == STYLE_COMPARE_SAME) {
         return;
     }
@@ -2008,7 +2386,14 @@ void lv_obj_set_signal_cb(lv_obj_t * obj, lv_signal_cb_t signal_cb)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
+#if LV_USE_OBJ_COMPACT
+    lv_obj_class_t * obj_class = class_get(signal_cb, obj->class_p->design_cb);
+    if(obj_class == NULL) return;
+    class_release(obj->class_p);
+    obj->class_p = obj_class;
+#else
     obj->signal_cb = signal_cb;
+#endif
 }
 
 /**
@@ -2022,7 +2407,7 @@ lv_res_t lv_signal_send(lv_obj_t * obj, lv_signal_t signal, void * param)
     if(obj == NULL) return LV_RES_OK;
 
     lv_res_t res = LV_RES_OK;
-    if(obj->signal_cb) res = obj->signal_cb(obj, signal, param);
+    if(_LV_OBJ_SIGNAL_CB(obj)) res = _LV_OBJ_SIGNAL_CB(obj)(obj, signal, param);
 
     return res;
 }
@@ -2036,7 +2421,37 @@ void lv_obj_set_design_cb(lv_obj_t * obj, lv_design_cb_t design_cb)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
+#if LV_USE_OBJ_COMPACT
+    lv_obj_class_t * obj_class = class_get(obj->class_p->signal_cb, design_cb);
+    if(obj_class == NULL) return;
+    class_release(obj->class_p);
+    obj->class_p = obj_class;
+#else
     obj->design_cb = design_cb;
+#endif
+}
+
+/**
+ * Set the signal and the design function of an object at once. Used internally by the library.
+ * With `LV_USE_OBJ_COMPACT` it looks up the shared class only once.
+ * Always call the previous signal function in the new.
+ * @param obj pointer to an object
+ * @param signal_cb the new signal function
+ * @param design_cb the new design function
+ */
+void lv_obj_set_signal_design_cb(lv_obj_t * obj, lv_signal_cb_t signal_cb, lv_design_cb_t design_cb)
+{
+    LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
+
+#if LV_USE_OBJ_COMPACT
+    lv_obj_class_t * obj_class = class_get(signal_cb, design_cb);
+    if(obj_class == NULL) return;
+    class_release(obj->class_p);
+    obj->class_p = obj_class;
+#else
+    obj->signal_cb = signal_cb;
+    obj->design_cb = design_cb;
+#endif
 }
 
 /*----------------
@@ -2071,9 +2486,96 @@ void lv_obj_refresh_ext_draw_pad(lv_obj_t * obj)
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
     obj->ext_draw_pad = 0;
-    obj->signal_cb(obj, LV_SIGNAL_REFR_EXT_DRAW_PAD, NULL);
+    _LV_OBJ_SIGNAL_CB(obj)(obj, LV_SIGNAL_REFR_EXT_DRAW_PAD, NULL);
+#if LV_USE_SUBTREE_BOUNDS
+    subtree_bounds_inv_par(obj);
+#endif
+
+}
+
+#if LV_USE_LAYOUT_DEFER
+/**
+ * Mark the layout of an object to be refreshed later. The object will get a `LV_SIGNAL_REFR_LAYOUT`
+ * in `lv_obj_update_layout()`, i.e. before the next refresh or when a coordinate is read.
+ * Marking the same object several times refreshes its layout only once.
+ * @param obj pointer to an object
+ */
+void lv_obj_mark_layout_dirty(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
+
+    if(obj->layout_dirty) return;
+
+    lv_obj_t ** node = _lv_ll_ins_tail(&LV_GC_ROOT(_lv_obj_layout_ll));
+    LV_ASSERT_MEM(node);
+    if(node == NULL) return;
+
+    *node = obj;
+    obj->layout_dirty = 1;
+}
+
+/**
+ * Refresh the layout of all objects marked by `lv_obj_mark_layout_dirty()`.
+ * The deepest objects are refreshed first as their size might be required by their parent's layout.
+ * The marked objects are sorted by their level in a heap so the deepest one is found in O(log n).
+ * The areas invalidated meanwhile are merged where they overlap or touch.
+ * Called automatically before refreshing a display and by the coordinate getters and `lv_obj_align()`.
+ */
+void lv_obj_update_layout(void)
+{
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_obj_layout_ll);
+
+    /*The layout refresh reads the coordinates too. Don't start it again from there.*/
+    if(layout_updating) return;
+    if(_lv_ll_get_head(ll) == NULL) return;
+
+    layout_updating = true;
+    layout_order = 0;
+    _lv_inv_merge_start();
+
+    /*A layout might mark other objects (e.g. the parent on size change) so limit the number of refreshes*/
+    uint32_t refr_max = _lv_ll_get_len(ll) * LV_OBJ_LAYOUT_MAX_REFR;
+    uint32_t refr_cnt = 0;
+
+    while(1) {
+        lv_obj_t * obj;
+        if(layout_heap_fill()) {
+            if(layout_heap_cnt == 0) break;
+            obj = NULL;
+        }
+        else {
+            /*Out of memory: refresh the objects not fitting into the heap in the order of marking*/
+            lv_obj_t ** node = _lv_ll_get_head(ll);
+            obj = *node;
+            _lv_ll_remove(ll, node);
+            lv_mem_free(node);
+        }
+
+        if(refr_cnt >= refr_max) {
+            LV_LOG_WARN("lv_obj_update_layout: the layouts don't converge, stop refreshing them");
+            if(obj) obj->layout_dirty = 0;
+            lv_obj_t ** node = _lv_ll_get_head(ll);
+            while(node) {
+                (*node)->layout_dirty = 0;
+                node = _lv_ll_get_next(ll, node);
+            }
+            _lv_ll_clear(ll);
+            while(layout_heap_cnt) layout_heap_pop()->layout_dirty = 0;
+            break;
+        }
+
+        if(obj == NULL) obj = layout_heap_pop();
+        obj->layout_dirty = 0;
+
+        _LV_OBJ_SIGNAL_CB(obj)(obj, LV_SIGNAL_REFR_LAYOUT, NULL);
+        refr_cnt++;
+    }
 
+    layout_heap_clear();
+    _lv_inv_merge_end();
+    layout_updating = false;
 }
+#endif
 
 /*=======================
  * Getter functions
@@ -2238,6 +2740,10 @@ void lv_obj_get_coords(const lv_obj_t * obj, lv_area_t * cords_p)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
+#if LV_USE_LAYOUT_DEFER
+    layout_update_if_dirty(obj, true);
+#endif
+
     lv_area_copy(cords_p, &obj->coords);
 }
 
@@ -2271,6 +2777,10 @@ lv_coord_t lv_obj_get_x(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
+#if LV_USE_LAYOUT_DEFER
+    layout_update_if_dirty(obj, true);
+#endif
+
     lv_coord_t rel_x;
     lv_obj_t * parent = lv_obj_get_parent(obj);
     if(parent) {
@@ -2291,6 +2801,10 @@ lv_coord_t lv_obj_get_y(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
+#if LV_USE_LAYOUT_DEFER
+    layout_update_if_dirty(obj, true);
+#endif
+
     lv_coord_t rel_y;
     lv_obj_t * parent = lv_obj_get_parent(obj);
     if(parent) {
@@ -2311,6 +2825,11 @@ lv_coord_t lv_obj_get_width(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
+#if LV_USE_LAYOUT_DEFER
+    /*Only the own layout (e.g. auto fit) changes the size*/
+    layout_update_if_dirty(obj, false);
+#endif
+
     return lv_area_get_width(&obj->coords);
 }
 
@@ -2323,6 +2842,11 @@ lv_coord_t lv_obj_get_height(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
+#if LV_USE_LAYOUT_DEFER
+    /*Only the own layout (e.g. auto fit) changes the size*/
+    layout_update_if_dirty(obj, false);
+#endif
+
     return lv_area_get_height(&obj->coords);
 }
 
@@ -2436,7 +2960,7 @@ bool lv_obj_get_auto_realign(const lv_obj_t * obj)
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
 #if LV_USE_OBJ_REALIGN
-    return obj->realign.auto_realign ? true : false;
+    return realign_get(obj)->auto_realign ? true : false;
 #else
     (void)obj;
     return false;
@@ -2455,7 +2979,7 @@ lv_coord_t lv_obj_get_ext_click_pad_left(const lv_obj_t * obj)
 #if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_TINY
     return obj->ext_click_pad_hor;
 #elif LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
-    return obj->ext_click_pad.x1;
+    return click_pad_get(obj)->x1;
 #else
     (void)obj;    /*Unused*/
     return 0;
@@ -2474,7 +2998,7 @@ lv_coord_t lv_obj_get_ext_click_pad_right(const lv_obj_t * obj)
 #if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_TINY
     return obj->ext_click_pad_hor;
 #elif LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
-    return obj->ext_click_pad.x2;
+    return click_pad_get(obj)->x2;
 #else
     (void)obj; /*Unused*/
     return 0;
@@ -2493,7 +3017,7 @@ lv_coord_t lv_obj_get_ext_click_pad_top(const lv_obj_t * obj)
 #if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_TINY
     return obj->ext_click_pad_ver;
 #elif LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
-    return obj->ext_click_pad.y1;
+    return click_pad_get(obj)->y1;
 #else
     (void)obj; /*Unused*/
     return 0;
@@ -2512,7 +3036,7 @@ lv_coord_t lv_obj_get_ext_click_pad_bottom(const lv_obj_t * obj)
 #if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_TINY
     return obj->ext_click_pad_ver;
 #elif LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
-    return obj->ext_click_pad.y2;
+    return click_pad_get(obj)->y2;
 #else
     (void)obj; /*Unused*/
     return 0;
@@ -2567,6 +3091,8 @@ lv_style_list_t * lv_obj_get_style_list(const lv_obj_t * obj, uint8_t part)
  */
 lv_style_int_t _lv_obj_get_style_int(const lv_obj_t * obj, uint8_t part, lv_style_property_t prop)
 {
+    _LV_PROF_COUNT(LV_PROF_CNT_STYLE_GET, 1);
+
     lv_style_property_t prop_ori = prop;
 
     lv_style_attr_t attr;
@@ -2698,6 +3224,8 @@ lv_style_int_t _lv_obj_get_style_int(const lv_obj_t * obj, uint8_t part, lv_styl
  */
 lv_color_t _lv_obj_get_style_color(const lv_obj_t * obj, uint8_t part, lv_style_property_t prop)
 {
+    _LV_PROF_COUNT(LV_PROF_CNT_STYLE_GET, 1);
+
     lv_style_property_t prop_ori = prop;
 
     lv_style_attr_t attr;
@@ -2754,6 +3282,8 @@ lv_color_t _lv_obj_get_style_color(const lv_obj_t * obj, uint8_t part, lv_style_
  */
 lv_opa_t _lv_obj_get_style_opa(const lv_obj_t * obj, uint8_t part, lv_style_property_t prop)
 {
+    _LV_PROF_COUNT(LV_PROF_CNT_STYLE_GET, 1);
+
     lv_style_property_t prop_ori = prop;
 
     lv_style_attr_t attr;
@@ -2832,6 +3362,8 @@ lv_opa_t _lv_obj_get_style_opa(const lv_obj_t * obj, uint8_t part, lv_style_prop
  */
 const void * _lv_obj_get_style_ptr(const lv_obj_t * obj, uint8_t part, lv_style_property_t prop)
 {
+    _LV_PROF_COUNT(LV_PROF_CNT_STYLE_GET, 1);
+
     lv_style_property_t prop_ori = prop;
 
     lv_style_attr_t attr;
@@ -3028,6 +3560,20 @@ bool lv_obj_get_focus_parent(const lv_obj_t * obj)
     return obj->focus_parent == 0 ? false : true;
 }
 
+#if LV_USE_FAST_SCROLL
+/**
+ * Get whether the content of the parent is moved instead of redrawn when the object is moved
+ * @param obj pointer to an object
+ * @return true: the parent's content is moved
+ */
+bool lv_obj_get_fast_scroll(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
+
+    return obj->fast_scroll == 0 ? false : true;
+}
+#endif
+
 /**
  * Get the drag parent attribute of an object
  * @param obj pointer to an object
@@ -3112,7 +3658,7 @@ lv_signal_cb_t lv_obj_get_signal_cb(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
-    return obj->signal_cb;
+    return _LV_OBJ_SIGNAL_CB(obj);
 }
 
 /**
@@ -3124,7 +3670,7 @@ lv_design_cb_t lv_obj_get_design_cb(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
-    return obj->design_cb;
+    return _LV_OBJ_DESIGN_CB(obj);
 }
 
 /**
@@ -3172,7 +3718,7 @@ void lv_obj_get_type(const lv_obj_t * obj, lv_obj_type_t * buf)
     _lv_memset_00(buf, sizeof(lv_obj_type_t));
     _lv_memset_00(&tmp, sizeof(lv_obj_type_t));
 
-    obj->signal_cb((lv_obj_t *)obj, LV_SIGNAL_GET_TYPE, &tmp);
+    _LV_OBJ_SIGNAL_CB(obj)((lv_obj_t *)obj, LV_SIGNAL_GET_TYPE, &tmp);
 
     uint8_t cnt;
     for(cnt = 0; cnt < LV_MAX_ANCESTOR_NUM; cnt++) {
@@ -3266,6 +3812,81 @@ bool lv_obj_is_focused(const lv_obj_t * obj)
  * OTHER FUNCTIONS
  *------------------*/
 
+/**
+ * Get the area where an object can be clicked: its coordinates extended with the extra click area
+ * @param obj pointer to an object
+ * @param area store the click area here
+ */
+void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
+{
+    lv_area_copy(area, &obj->coords);
+#if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_TINY
+    area->x1 -= obj->ext_click_pad_hor;
+    area->x2 += obj->ext_click_pad_hor;
+    area->y1 -= obj->ext_click_pad_ver;
+    area->y2 += obj->ext_click_pad_ver;
+#elif LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
+    const lv_area_t * pad = click_pad_get(obj);
+    area->x1 -= pad->x1;
+    area->x2 += pad->x2;
+    area->y1 -= pad->y1;
+    area->y2 += pad->y2;
+#endif
+}
+
+#if LV_USE_SUBTREE_BOUNDS
+/**
+ * Get the area where the children of an object (and their children) can draw.
+ * It's the union of the visible children's coordinates extended with their `ext_draw_pad`.
+ * @param obj pointer to an object
+ * @param bounds store the area here (absolute coordinates)
+ * @return true: `bounds` is set; false: the object has no visible children
+ */
+bool _lv_obj_get_subtree_bounds(lv_obj_t * obj, lv_area_t * bounds)
+{
+    /*The children draw only on their parent so the grandchildren are in the children's area*/
+    if(obj->subtree_bounds_valid == 0) {
+        bool found = false;
+        lv_area_t b;
+        lv_obj_t * child;
+        _LV_LL_READ(obj->child_ll, child) {
+            if(child->hidden) continue;
+
+            lv_area_t a;
+            lv_area_copy(&a, &child->coords);
+            a.x1 -= child->ext_draw_pad;
+            a.y1 -= child->ext_draw_pad;
+            a.x2 += child->ext_draw_pad;
+            a.y2 += child->ext_draw_pad;
+
+            if(found) _lv_area_join(&b, &b, &a);
+            else lv_area_copy(&b, &a);
+            found = true;
+        }
+
+        /*Store it relative to the object to remain valid when the object moves*/
+        if(found) {
+            obj->subtree_bounds.x1 = b.x1 - obj->coords.x1;
+            obj->subtree_bounds.y1 = b.y1 - obj->coords.y1;
+            obj->subtree_bounds.x2 = b.x2 - obj->coords.x1;
+            obj->subtree_bounds.y2 = b.y2 - obj->coords.y1;
+        }
+        else {
+            lv_area_set(&obj->subtree_bounds, 0, 0, -1, -1);
+        }
+        obj->subtree_bounds_valid = 1;
+    }
+
+    if(obj->subtree_bounds.x2 < obj->subtree_bounds.x1) return false;
+
+    bounds->x1 = obj->subtree_bounds.x1 + obj->coords.x1;
+    bounds->y1 = obj->subtree_bounds.y1 + obj->coords.y1;
+    bounds->x2 = obj->subtree_bounds.x2 + obj->coords.x1;
+    bounds->y2 = obj->subtree_bounds.y2 + obj->coords.y1;
+    return true;
+}
+#endif
+
 /**
  * Check if a given screen-space point is on an object's coordinates.
  *
@@ -3276,28 +3897,10 @@ bool lv_obj_is_focused(const lv_obj_t * obj)
  */
 bool lv_obj_is_point_on_coords(lv_obj_t * obj, const lv_point_t * point)
 {
-#if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_TINY
-    lv_area_t ext_area;
-    ext_area.x1 = obj->coords.x1 - obj->ext_click_pad_hor;
-    ext_area.x2 = obj->coords.x2 + obj->ext_click_pad_hor;
-    ext_area.y1 = obj->coords.y1 - obj->ext_click_pad_ver;
-    ext_area.y2 = obj->coords.y2 + obj->ext_click_pad_ver;
+    lv_area_t click_area;
+    lv_obj_get_click_area(obj, &click_area);
 
-    if(!_lv_area_is_point_on(&ext_area, point, 0)) {
-#elif LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
-    lv_area_t ext_area;
-    ext_area.x1 = obj->coords.x1 - obj->ext_click_pad.x1;
-    ext_area.x2 = obj->coords.x2 + obj->ext_click_pad.x2;
-    ext_area.y1 = obj->coords.y1 - obj->ext_click_pad.y1;
-    ext_area.y2 = obj->coords.y2 + obj->ext_click_pad.y2;
-
-    if(!_lv_area_is_point_on(&ext_area, point, 0)) {
-#else
-    if(!_lv_area_is_point_on(&obj->coords, point, 0)) {
-#endif
-        return false;
-    }
-    return true;
+    return _lv_area_is_point_on(&click_area, point, 0);
 }
 
 /**
@@ -3312,7 +3915,7 @@ bool lv_obj_hittest(lv_obj_t * obj, lv_point_t * point)
         lv_hit_test_info_t hit_info;
         hit_info.point = point;
         hit_info.result = true;
-        obj->signal_cb(obj, LV_SIGNAL_HIT_TEST, &hit_info);
+        _LV_OBJ_SIGNAL_CB(obj)(obj, LV_SIGNAL_HIT_TEST, &hit_info);
         return hit_info.result;
     }
     else
@@ -3810,23 +4413,651 @@ static void obj_del_core(lv_obj_t * obj)
 
     /* All children deleted.
      * Now clean up the object specific data*/
-    obj->signal_cb(obj, LV_SIGNAL_CLEANUP, NULL);
+    _LV_OBJ_SIGNAL_CB(obj)(obj, LV_SIGNAL_CLEANUP, NULL);
+
+#if LV_USE_LAYOUT_DEFER
+    if(obj->layout_dirty) layout_remove(obj);
+#endif
+
+#if LV_USE_OBJ_COMPACT
+    side_table_remove_obj(obj);
+#endif
 
     /*Remove the object from parent's children list*/
     lv_obj_t * par = lv_obj_get_parent(obj);
     if(par == NULL) { /*It is a screen*/
+#if LV_USE_SCR_SNAPSHOT
+        lv_scr_snapshot_disable(obj);
+#endif
         lv_disp_t * d = lv_obj_get_disp(obj);
         _lv_ll_remove(&d->scr_ll, obj);
     }
     else {
         _lv_ll_remove(&(par->child_ll), obj);
+#if LV_USE_SUBTREE_BOUNDS
+        par->subtree_bounds_valid = 0;
+#endif
     }
+#if LV_USE_HIT_INDEX
+    _lv_indev_hit_index_invalidate(obj);
+#endif
 
     /*Delete the base objects*/
     if(obj->ext_attr != NULL) lv_mem_free(obj->ext_attr);
+#if LV_USE_OBJ_COMPACT
+    class_release(obj->class_p);
+#endif
     lv_mem_free(obj); /*Free the object itself*/
 }
 
+#if LV_USE_LAYOUT_DEFER
+/**
+ * Refresh the deferred layouts if the coordinates of an object might be outdated
+ * @param obj pointer to an object
+ * @param ancestors true: check the parents too as their layout might move `obj`;
+ *                  false: check only `obj`, e.g. if only its size is required
+ */
+static void layout_update_if_dirty(const lv_obj_t * obj, bool ancestors)
+{
+    if(_lv_ll_get_head(&LV_GC_ROOT(_lv_obj_layout_ll)) == NULL) return;
+
+    while(obj) {
+        if(obj->layout_dirty) {
+            lv_obj_update_layout();
+            return;
+        }
+        if(!ancestors) return;
+        obj = obj->parent;
+    }
+}
+
+/**
+ * Remove a deleted object from the list of the deferred layouts
+ * @param obj pointer to an object marked by `lv_obj_mark_layout_dirty()`
+ */
+static void layout_remove(lv_obj_t * obj)
+{
+    obj->layout_dirty = 0;
+
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_obj_layout_ll);
+    lv_obj_t ** node;
+    _LV_LL_READ(*ll, node) {
+        if(*node == obj) {
+            _lv_ll_remove(ll, node);
+            lv_mem_free(node);
+            return;
+        }
+    }
+
+    /*Deleted while the layouts are refreshed*/
+    layout_item_t * heap = LV_GC_ROOT(_lv_obj_layout_heap);
+    uint32_t i;
+    for(i = 0; i < layout_heap_cnt; i++) {
+        if(heap[i].obj == obj) {
+            layout_heap_remove(i);
+            return;
+        }
+    }
+}
+
+/**
+ * Move the newly marked objects from the list of the dirty layouts to the heap.
+ * The level of the objects is calculated only here, once per marking.
+ * @return false: the heap couldn't be enlarged and some objects remained in the list
+ */
+static bool layout_heap_fill(void)
+{
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_obj_layout_ll);
+    lv_obj_t ** node = _lv_ll_get_head(ll);
+    while(node) {
+        if(layout_heap_cnt == layout_heap_size) {
+            uint32_t new_size = layout_heap_size ? layout_heap_size * 2 : LAYOUT_HEAP_MIN_SIZE;
+            layout_item_t * heap = lv_mem_realloc(LV_GC_ROOT(_lv_obj_layout_heap), new_size * sizeof(layout_item_t));
+            LV_ASSERT_MEM(heap);
+            if(heap == NULL) return false;
+            LV_GC_ROOT(_lv_obj_layout_heap) = heap;
+            layout_heap_size = new_size;
+        }
+
+        layout_item_t * item = &((layout_item_t *)LV_GC_ROOT(_lv_obj_layout_heap))[layout_heap_cnt];
+        item->obj = *node;
+        item->level = 0;
+        item->order = layout_order++;
+        const lv_obj_t * par = item->obj->parent;
+        while(par) {
+            item->level++;
+            par = par->parent;
+        }
+
+        layout_heap_cnt++;
+        layout_heap_sift_up(layout_heap_cnt - 1);
+
+        _lv_ll_remove(ll, node);
+        lv_mem_free(node);
+        node = _lv_ll_get_head(ll);
+    }
+
+    return true;
+}
+
+/**
+ * Remove the deepest object from the heap of the dirty layouts
+ * @return the removed object
+ */
+static lv_obj_t * layout_heap_pop(void)
+{
+    layout_item_t * heap = LV_GC_ROOT(_lv_obj_layout_heap);
+    lv_obj_t * obj = heap[0].obj;
+    layout_heap_remove(0);
+    return obj;
+}
+
+/**
+ * Remove an item from the heap of the dirty layouts
+ * @param i index of the item
+ */
+static void layout_heap_remove(uint32_t i)
+{
+    layout_item_t * heap = LV_GC_ROOT(_lv_obj_layout_heap);
+    layout_heap_cnt--;
+    if(i == layout_heap_cnt) return;
+
+    heap[i] = heap[layout_heap_cnt];
+    layout_heap_sift_up(i);
+    layout_heap_sift_down(i);
+}
+
+/**
+ * Move an item of the heap of the dirty layouts towards the top until it's in order
+ * @param i index of the item
+ */
+static void layout_heap_sift_up(uint32_t i)
+{
+    layout_item_t * heap = LV_GC_ROOT(_lv_obj_layout_heap);
+    while(i > 0) {
+        uint32_t p = (i - 1) / 2;
+        if(!LAYOUT_ITEM_BEFORE(&heap[i], &heap[p])) break;
+
+        layout_item_t tmp = heap[p];
+        heap[p] = heap[i];
+        heap[i] = tmp;
+        i = p;
+    }
+}
+
+/**
+ * Move an item of the heap of the dirty layouts towards the bottom until it's in order
+ * @param i index of the item
+ */
+static void layout_heap_sift_down(uint32_t i)
+{
+    layout_item_t * heap = LV_GC_ROOT(_lv_obj_layout_heap);
+    while(1) {
+        uint32_t first = i;
+        uint32_t c = 2 * i + 1;
+        if(c < layout_heap_cnt && LAYOUT_ITEM_BEFORE(&heap[c], &heap[first])) first = c;
+        c++;
+        if(c < layout_heap_cnt && LAYOUT_ITEM_BEFORE(&heap[c], &heap[first])) first = c;
+        if(first == i) break;
+
+        layout_item_t tmp = heap[first];
+        heap[first] = heap[i];
+        heap[i] = tmp;
+        i = first;
+    }
+}
+
+/**
+ * Free the heap of the dirty layouts. It's used only while the layouts are refreshed.
+ */
+static void layout_heap_clear(void)
+{
+    lv_mem_free(LV_GC_ROOT(_lv_obj_layout_heap));
+    LV_GC_ROOT(_lv_obj_layout_heap) = NULL;
+    layout_heap_cnt = 0;
+    layout_heap_size = 0;
+}
+#endif
+
+#if LV_USE_OBJ_COMPACT
+/**
+ * Get the shared class of the given signal and design function and increment its reference count.
+ * Create the class if it doesn't exist yet.
+ * @param signal_cb a signal function
+ * @param design_cb a design function
+ * @return pointer to the class or NULL if it couldn't be allocated
+ */
+static lv_obj_class_t * class_get(lv_signal_cb_t signal_cb, lv_design_cb_t design_cb)
+{
+    if(signal_cb == obj_class_base.signal_cb && design_cb == obj_class_base.design_cb) return &obj_class_base;
+
+    lv_obj_class_t * obj_class;
+    _LV_LL_READ(LV_GC_ROOT(_lv_obj_class_ll), obj_class) {
+        if(obj_class->signal_cb == signal_cb && obj_class->design_cb == design_cb) {
+            obj_class->ref_cnt++;
+            return obj_class;
+        }
+    }
+
+    obj_class = _lv_ll_ins_head(&LV_GC_ROOT(_lv_obj_class_ll));
+    LV_ASSERT_MEM(obj_class);
+    if(obj_class == NULL) return NULL;
+
+    obj_class->signal_cb = signal_cb;
+    obj_class->design_cb = design_cb;
+    obj_class->ref_cnt = 1;
+    return obj_class;
+}
+
+/**
+ * Decrement the reference count of a class and free it if it's not used anymore
+ * @param obj_class pointer to a class returned by `class_get()`
+ */
+static void class_release(lv_obj_class_t * obj_class)
+{
+    /*The class of the base objects is not allocated*/
+    if(obj_class == &obj_class_base) return;
+
+    obj_class->ref_cnt--;
+    if(obj_class->ref_cnt == 0) {
+        _lv_ll_remove(&LV_GC_ROOT(_lv_obj_class_ll), obj_class);
+        lv_mem_free(obj_class);
+    }
+}
+
+/**
+ * Initialize an empty side table
+ * @param t pointer to a side table
+ * @param entries pointer to the GC root to store the array of entries
+ * @param entry_size size of an entry. It has to start with the object it belongs to.
+ */
+static void side_table_init(side_table_t * t, void ** entries, uint32_t entry_size)
+{
+    *entries = NULL;
+    t->entries = entries;
+    t->size = 0;
+    t->cnt = 0;
+    t->entry_size = entry_size;
+}
+
+/**
+ * Find the entry of an object in a side table
+ * @param t pointer to a side table
+ * @param obj pointer to an object
+ * @return the entry of `obj` or NULL if not found
+ */
+static void * side_table_get(const side_table_t * t, const lv_obj_t * obj)
+{
+    if(t->size == 0) return NULL;
+
+    uint32_t mask = t->size - 1;
+    uint32_t i = side_table_hash(t, obj);
+    while(SIDE_TABLE_OBJ(t, i) != NULL) {
+        if(SIDE_TABLE_OBJ(t, i) == obj) return SIDE_TABLE_ENTRY(t, i);
+        i = (i + 1) & mask;
+    }
+
+    return NULL;
+}
+
+/**
+ * Add a zeroed entry for an object to a side table. The object shouldn't have an entry yet.
+ * The table might be reallocated so the pointers to the other entries become invalid.
+ * @param t pointer to a side table
+ * @param obj pointer to an object
+ * @return the new entry or NULL if out of memory
+ */
+static void * side_table_add(side_table_t * t, const lv_obj_t * obj)
+{
+    if((t->cnt + 1) * 2 > t->size) {
+        if(side_table_resize(t, t->size ? t->size * 2 : SIDE_TABLE_MIN_SIZE) == false) return NULL;
+    }
+
+    uint32_t mask = t->size - 1;
+    uint32_t i = side_table_hash(t, obj);
+    while(SIDE_TABLE_OBJ(t, i) != NULL) i = (i + 1) & mask;
+
+    void * entry = SIDE_TABLE_ENTRY(t, i);
+    _lv_memset_00(entry, t->entry_size);
+    *(const lv_obj_t **)entry = obj;
+    t->cnt++;
+
+    return entry;
+}
+
+/**
+ * Remove the entry of an object from a side table. The object should have an entry.
+ * @param t pointer to a side table
+ * @param obj pointer to an object
+ */
+static void side_table_remove(side_table_t * t, const lv_obj_t * obj)
+{
+    uint32_t mask = t->size - 1;
+    uint32_t i = side_table_hash(t, obj);
+    while(SIDE_TABLE_OBJ(t, i) != obj) i = (i + 1) & mask;
+
+    /*Move back the following entries of the probe sequence to fill the gap*/
+    SIDE_TABLE_OBJ(t, i) = NULL;
+    uint32_t j = i;
+    while(1) {
+        j = (j + 1) & mask;
+        const lv_obj_t * obj_j = SIDE_TABLE_OBJ(t, j);
+        if(obj_j == NULL) break;
+
+        uint32_t home = side_table_hash(t, obj_j);
+        bool stays = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+        if(stays) continue;
+
+        _lv_memcpy(SIDE_TABLE_ENTRY(t, i), SIDE_TABLE_ENTRY(t, j), t->entry_size);
+        SIDE_TABLE_OBJ(t, j) = NULL;
+        i = j;
+    }
+
+    t->cnt--;
+
+    /*Free or shrink the table if most of it is unused, e.g. after deleting a screen*/
+    if(t->cnt == 0) {
+        lv_mem_free(*t->entries);
+        *t->entries = NULL;
+        t->size = 0;
+    }
+    else if(t->size > SIDE_TABLE_MIN_SIZE && t->cnt * 8 < t->size) {
+        side_table_resize(t, t->size / 2);
+    }
+}
+
+/**
+ * Reallocate a side table and rehash its entries
+ * @param t pointer to a side table
+ * @param new_size the new number of entries (power of 2, at least twice the number of used entries)
+ * @return true: success; false: out of memory, the table is unchanged
+ */
+static bool side_table_resize(side_table_t * t, uint32_t new_size)
+{
+    uint8_t * new_entries = lv_mem_alloc(new_size * t->entry_size);
+    LV_ASSERT_MEM(new_entries);
+    if(new_entries == NULL) return false;
+    _lv_memset_00(new_entries, new_size * t->entry_size);
+
+    uint8_t * old_entries = *t->entries;
+    uint32_t old_size = t->size;
+    *t->entries = new_entries;
+    t->size = new_size;
+
+    uint32_t mask = new_size - 1;
+    uint32_t k;
+    for(k = 0; k < old_size; k++) {
+        uint8_t * entry = old_entries + k * t->entry_size;
+        const lv_obj_t * obj = *(const lv_obj_t **)entry;
+        if(obj == NULL) continue;
+
+        uint32_t i = side_table_hash(t, obj);
+        while(SIDE_TABLE_OBJ(t, i) != NULL) i = (i + 1) & mask;
+        _lv_memcpy(SIDE_TABLE_ENTRY(t, i), entry, t->entry_size);
+    }
+
+    if(old_entries) lv_mem_free(old_entries);
+
+    return true;
+}
+
+/**
+ * Get the home position of an object in a side table
+ * @param t pointer to a side table
+ * @param obj pointer to an object
+ * @return index of an entry
+ */
+static uint32_t side_table_hash(const side_table_t * t, const lv_obj_t * obj)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)obj >> 3);
+    h *= 2654435761u;   /*Knuth's multiplicative hash*/
+    return (h >> 8) & (t->size - 1);
+}
+
+/**
+ * Remove the entries of a deleted object from the side tables
+ * @param obj pointer to an object
+ */
+static void side_table_remove_obj(lv_obj_t * obj)
+{
+#if LV_USE_OBJ_REALIGN
+    if(obj->has_realign) {
+        side_table_remove(&realign_table, obj);
+        obj->has_realign = 0;
+    }
+    if(realign_last.obj == obj) realign_last.obj = NULL;
+#endif
+
+#if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
+    if(obj->has_click_pad) {
+        side_table_remove(&click_pad_table, obj);
+        obj->has_click_pad = 0;
+    }
+#endif
+}
+#endif /*LV_USE_OBJ_COMPACT*/
+
+#if LV_USE_OBJ_REALIGN
+/**
+ * Get the realign parameters of an object
+ * @param obj pointer to an object
+ * @return the realign parameters. The default values if the object has never been aligned.
+ */
+static const lv_realign_t * realign_get(const lv_obj_t * obj)
+{
+#if LV_USE_OBJ_COMPACT
+    static const lv_realign_t realign_def = {NULL, 0, 0, LV_ALIGN_CENTER, 0, 0};
+    if(obj->has_realign) {
+        realign_entry_t * entry = side_table_get(&realign_table, obj);
+        return &entry->realign;
+    }
+
+    if(realign_last.obj == obj) return &realign_last.realign;
+
+    return &realign_def;
+#else
+    return &obj->realign;
+#endif
+}
+
+/**
+ * Get the realign parameters of an object to modify them.
+ * With `LV_USE_OBJ_COMPACT` the parameters of the objects without auto realign
+ * are stored in a single slot, so only the ones of the last aligned such object are kept.
+ * @param obj pointer to an object
+ * @return the realign parameters
+ */
+static lv_realign_t * realign_get_alloc(lv_obj_t * obj)
+{
+#if LV_USE_OBJ_COMPACT
+    if(obj->has_realign) {
+        realign_entry_t * entry = side_table_get(&realign_table, obj);
+        return &entry->realign;
+    }
+
+    if(realign_last.obj != obj) {
+        _lv_memset_00(&realign_last, sizeof(realign_last));
+        realign_last.obj = obj;
+        realign_last.realign.align = LV_ALIGN_CENTER;
+    }
+
+    return &realign_last.realign;
+#else
+    return &obj->realign;
+#endif
+}
+#endif /*LV_USE_OBJ_REALIGN*/
+
+#if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
+/**
+ * Get the extra click paddings of an object
+ * @param obj pointer to an object
+ * @return the paddings. All zero if they have never been set.
+ */
+static const lv_area_t * click_pad_get(const lv_obj_t * obj)
+{
+#if LV_USE_OBJ_COMPACT
+    static const lv_area_t pad_def = {0, 0, 0, 0};
+    if(obj->has_click_pad == 0) return &pad_def;
+
+    click_pad_entry_t * entry = side_table_get(&click_pad_table, obj);
+    return &entry->pad;
+#else
+    return &obj->ext_click_pad;
+#endif
+}
+
+/**
+ * Get the extra click paddings of an object to modify them
+ * @param obj pointer to an object
+ * @return the paddings or NULL if they couldn't be allocated
+ */
+static lv_area_t * click_pad_get_alloc(lv_obj_t * obj)
+{
+#if LV_USE_OBJ_COMPACT
+    if(obj->has_click_pad) {
+        click_pad_entry_t * entry = side_table_get(&click_pad_table, obj);
+        return &entry->pad;
+    }
+
+    click_pad_entry_t * entry = side_table_add(&click_pad_table, obj);
+    if(entry == NULL) return NULL;
+
+    obj->has_click_pad = 1;
+    return &entry->pad;
+#else
+    return &obj->ext_click_pad;
+#endif
+}
+#endif /*LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL*/
+
+#if LV_USE_FAST_SCROLL
+/**
+ * Get the area of the parent which shows only the content of a moving object,
+ * i.e. which can be moved together with the object instead of being redrawn.
+ * @param obj pointer to the moving object
+ * @param area store the area here. It's clipped to the ancestors.
+ * @param pad store here the distance of the area from the parent's edges (border or radius)
+ * @return false: the parent's content can't be simply moved
+ */
+static bool fast_scroll_get_area(const lv_obj_t * obj, lv_area_t * area, lv_coord_t * pad)
+{
+    lv_obj_t * par = obj->parent;
+    if(par == NULL) return false;
+
+    /*Everything else drawn on the parent would move too*/
+    if(_lv_ll_get_head(&par->child_ll) != obj || _lv_ll_get_tail(&par->child_ll) != obj) return false;
+
+    /*The background should look the same everywhere and hide what is behind it*/
+    if(lv_obj_get_style_bg_opa(par, LV_OBJ_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_opa_scale(par, LV_OBJ_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_bg_blend_mode(par, LV_OBJ_PART_MAIN) != LV_BLEND_MODE_NORMAL) return false;
+    if(lv_obj_get_style_bg_grad_dir(par, LV_OBJ_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_pattern_image(par, LV_OBJ_PART_MAIN) != NULL) return false;
+    if(lv_obj_get_style_value_str(par, LV_OBJ_PART_MAIN) != NULL) return false;
+
+    /*Leave out the border and the rounded corners*/
+    lv_coord_t w = lv_obj_get_width(par);
+    lv_coord_t h = lv_obj_get_height(par);
+    lv_coord_t r = lv_obj_get_style_radius(par, LV_OBJ_PART_MAIN);
+    lv_coord_t r_max = LV_MATH_MIN(w, h) / 2;
+    if(r > r_max) r = r_max;
+    *pad = LV_MATH_MAX(r, lv_obj_get_style_border_width(par, LV_OBJ_PART_MAIN));
+
+    lv_area_copy(area, &par->coords);
+    area->x1 += *pad;
+    area->y1 += *pad;
+    area->x2 -= *pad;
+    area->y2 -= *pad;
+
+    /* The ancestors clip the area and their younger siblings (and their children) are drawn on it.
+     * Nothing else can be drawn there as it's not moved with the content.*/
+    const lv_obj_t * cur = obj;
+    lv_obj_t * sib;
+    while(cur->parent) {
+        if(cur->hidden) return false;
+        if(_lv_area_intersect(area, area, &cur->parent->coords) == false) return false;
+
+        sib = _lv_ll_get_prev(&cur->parent->child_ll, cur);
+        while(sib) {
+            if(fast_scroll_is_covered(sib, area)) return false;
+            sib = _lv_ll_get_prev(&cur->parent->child_ll, sib);
+        }
+        cur = cur->parent;
+    }
+    if(cur->hidden) return false;
+
+    /*The objects on the layers above the screen are drawn on the area too*/
+    lv_disp_t * disp = lv_obj_get_disp(cur);
+    lv_obj_t * layers[2] = {NULL, NULL};
+    if(disp->prev_scr) return false;    /*Screen load animation*/
+    else if(cur == disp->act_scr) {
+        layers[0] = disp->top_layer;
+        layers[1] = disp->sys_layer;
+    }
+    else if(cur == disp->top_layer) layers[0] = disp->sys_layer;
+    else if(cur != disp->sys_layer) return false;
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        if(layers[i] == NULL) continue;
+        _LV_LL_READ(layers[i]->child_ll, sib) {
+            if(fast_scroll_is_covered(sib, area)) return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Tell whether an object is drawn on an area
+ * @param obj pointer to an object
+ * @param area an area
+ * @return true: the object is visible on the area
+ */
+static bool fast_scroll_is_covered(const lv_obj_t * obj, const lv_area_t * area)
+{
+    if(obj->hidden) return false;
+
+    lv_area_t obj_area;
+    lv_area_copy(&obj_area, &obj->coords);
+    obj_area.x1 -= obj->ext_draw_pad;
+    obj_area.y1 -= obj->ext_draw_pad;
+    obj_area.x2 += obj->ext_draw_pad;
+    obj_area.y2 += obj->ext_draw_pad;
+
+    return _lv_area_is_on(&obj_area, area);
+}
+
+/**
+ * Invalidate the edges of a parent which are left out from its moved content by `fast_scroll_get_area()`
+ * but show the content too.
+ * @param par pointer to the parent
+ * @param pad width of the edges
+ */
+static void fast_scroll_inv_pad(lv_obj_t * par, lv_coord_t pad)
+{
+    if(pad <= 0) return;
+
+    lv_area_t edge;
+    lv_area_copy(&edge, &par->coords);
+    edge.y2 = edge.y1 + pad - 1;
+    lv_obj_invalidate_area(par, &edge);
+
+    lv_area_copy(&edge, &par->coords);
+    edge.y1 = edge.y2 - pad + 1;
+    lv_obj_invalidate_area(par, &edge);
+
+    lv_area_copy(&edge, &par->coords);
+    edge.x2 = edge.x1 + pad - 1;
+    lv_obj_invalidate_area(par, &edge);
+
+    lv_area_copy(&edge, &par->coords);
+    edge.x1 = edge.x2 - pad + 1;
+    lv_obj_invalidate_area(par, &edge);
+}
+#endif /*LV_USE_FAST_SCROLL*/
+
 /**
  * Handle the drawing related tasks of the base objects.
  * @param obj pointer to an object
@@ -3983,7 +5214,7 @@ static lv_res_t lv_obj_signal(lv_obj_t * obj, lv_signal_t sign, void * param)
     }
 #if LV_USE_OBJ_REALIGN
     else if(sign == LV_SIGNAL_PARENT_SIZE_CHG) {
-        if(obj->realign.auto_realign) {
+        if(realign_get(obj)->auto_realign) {
             lv_obj_realign(obj);
         }
     }
@@ -4053,6 +5284,19 @@ static void refresh_children_position(lv_obj_t * obj, lv_coord_t x_diff, lv_coor
     }
 }
 
+#if LV_USE_SUBTREE_BOUNDS
+/**
+ * Mark the subtree bounds of an object's parent outdated after the object was created, moved,
+ * resized, hidden or shown, or its `ext_draw_pad` changed
+ * @param obj pointer to an object
+ */
+static void subtree_bounds_inv_par(lv_obj_t * obj)
+{
+    lv_obj_t * par = lv_obj_get_parent(obj);
+    if(par) par->subtree_bounds_valid = 0;
+}
+#endif
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this style_list.
@@ -4070,6 +5314,9 @@ static void report_style_mod_core(void * style, lv_obj_t * obj)
             /* changed class to _class to allow compilation as c++ */
             lv_style_t * _class = lv_style_list_get_style(list, ci);
             if(_class == style || style == NULL) {
+#if LV_USE_STYLE_INDEX
+                if(style) _lv_style_list_relink(list);
+#endif
                 lv_obj_refresh_style(obj, part, LV_STYLE_PROP_ALL);
                 break;
             }
@@ -4094,7 +5341,7 @@ static void refresh_children_style(lv_obj_t * obj)
     lv_obj_t * child = lv_obj_get_child(obj, NULL);
     while(child != NULL) {
         lv_obj_invalidate(child);
-        child->signal_cb(child, LV_SIGNAL_STYLE_CHG, NULL);
+        _LV_OBJ_SIGNAL_CB(child)(child, LV_SIGNAL_STYLE_CHG, NULL);
         lv_obj_invalidate(child);
 
         refresh_children_style(child); /*Check children too*/
@@ -4120,6 +5367,12 @@ static void base_dir_refr_children(lv_obj_t * obj)
 static void obj_align_core(lv_obj_t * obj, const lv_obj_t * base, lv_align_t align, bool x_set, bool y_set,
                            lv_coord_t x_ofs, lv_coord_t y_ofs)
 {
+#if LV_USE_LAYOUT_DEFER
+    /*The coordinates of `base` and the size of `obj` have to be up to date*/
+    layout_update_if_dirty(base, true);
+    layout_update_if_dirty(obj, false);
+#endif
+
     lv_point_t new_pos;
     _lv_area_align(&base->coords, &obj->coords, align, &new_pos);
 
@@ -4140,6 +5393,12 @@ static void obj_align_core(lv_obj_t * obj, const lv_obj_t * base, lv_align_t ali
 static void obj_align_mid_core(lv_obj_t * obj, const lv_obj_t * base, lv_align_t align,  bool x_set, bool y_set,
                                lv_coord_t x_ofs, lv_coord_t y_ofs)
 {
+#if LV_USE_LAYOUT_DEFER
+    /*The coordinates of `base` and the size of `obj` have to be up to date*/
+    layout_update_if_dirty(base, true);
+    layout_update_if_dirty(obj, false);
+#endif
+
     lv_coord_t new_x = lv_obj_get_x(obj);
     lv_coord_t new_y = lv_obj_get_y(obj);
 
@@ -129,6 +129,7 @@ enum {
     LV_SIGNAL_GET_TYPE, /**< LVGL needs to retrieve the object's type */
     LV_SIGNAL_GET_STYLE, /**<Get the style of an object*/
     LV_SIGNAL_GET_STATE_DSC, /**<Get the state of the object*/
+    LV_SIGNAL_REFR_LAYOUT, /**< Refresh the layout marked by `lv_obj_mark_layout_dirty()`*/
 
     /*Input device related*/
     LV_SIGNAL_HIT_TEST,          /**< Advanced hit-testing */
@@ -166,6 +167,15 @@ typedef struct {
 } lv_realign_t;
 #endif
 
+#if LV_USE_OBJ_COMPACT
+/** The type specific functions of an object. Shared by all the objects using the same functions.*/
+typedef struct {
+    lv_signal_cb_t signal_cb; /**< Object type specific signal function*/
+    lv_design_cb_t design_cb; /**< Object type specific design function*/
+    uint32_t ref_cnt;         /**< Number of objects using the class*/
+} lv_obj_class_t;
+#endif
+
 /*Protect some attributes (max. 8 bit)*/
 enum {
     LV_PROTECT_NONE      = 0x00,
@@ -200,8 +210,12 @@ typedef struct _lv_obj_t {
     lv_area_t coords; /**< Coordinates of the object (x1, y1, x2, y2)*/
 
     lv_event_cb_t event_cb; /**< Event callback function */
+#if LV_USE_OBJ_COMPACT
+    lv_obj_class_t * class_p; /**< Object type specific signal and design functions*/
+#else
     lv_signal_cb_t signal_cb; /**< Object type specific signal function*/
     lv_design_cb_t design_cb; /**< Object type specific design function*/
+#endif
 
     void * ext_attr;            /**< Object type specific extended data*/
     lv_style_list_t style_list;
@@ -209,12 +223,16 @@ typedef struct _lv_obj_t {
 #if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_TINY
     uint8_t ext_click_pad_hor; /**< Extra click padding in horizontal direction */
     uint8_t ext_click_pad_ver; /**< Extra click padding in vertical direction */
-#elif LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
+#elif LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL && LV_USE_OBJ_COMPACT == 0
     lv_area_t ext_click_pad;   /**< Extra click padding area. */
 #endif
 
     lv_coord_t ext_draw_pad; /**< EXTend the size in every direction for drawing. */
 
+#if LV_USE_SUBTREE_BOUNDS
+    lv_area_t subtree_bounds; /**< Where the children (and so their children too) can draw, relative to `coords`*/
+#endif
+
     /*Attributes and states*/
     uint8_t click           : 1; /**< 1: Can be pressed by an input device*/
     uint8_t drag            : 1; /**< 1: Enable the dragging*/
@@ -229,6 +247,19 @@ typedef struct _lv_obj_t {
 
     lv_drag_dir_t drag_dir  : 3; /**<  Which directions the object can be dragged in */
     lv_bidi_dir_t base_dir  : 2; /**< Base direction of texts related to this object */
+#if LV_USE_LAYOUT_DEFER
+    uint8_t layout_dirty    : 1; /**< 1: The layout of the object will be refreshed by `lv_obj_update_layout()`*/
+#endif
+#if LV_USE_FAST_SCROLL
+    uint8_t fast_scroll     : 1; /**< 1: Move the content of the parent instead of redrawing it when the object moves*/
+#endif
+#if LV_USE_SUBTREE_BOUNDS
+    uint8_t subtree_bounds_valid : 1; /**< 0: `subtree_bounds` has to be calculated again*/
+#endif
+#if LV_USE_OBJ_COMPACT
+    uint8_t has_realign     : 1; /**< 1: Auto realign is enabled and the realign parameters are stored in a side table*/
+    uint8_t has_click_pad   : 1; /**< 1: The `LV_EXT_CLICK_AREA_FULL` paddings are stored in a side table*/
+#endif
 
 #if LV_USE_GROUP != 0
     void * group_p;
@@ -238,7 +269,7 @@ typedef struct _lv_obj_t {
                                      'OR'ed values from `lv_protect_t`*/
     lv_state_t state;
 
-#if LV_USE_OBJ_REALIGN
+#if LV_USE_OBJ_REALIGN && LV_USE_OBJ_COMPACT == 0
     lv_realign_t realign;       /**< Information about the last call to ::lv_obj_align. */
 #endif
 
@@ -427,6 +458,15 @@ void lv_obj_set_y(lv_obj_t * obj, lv_coord_t y);
  */
 void lv_obj_set_size(lv_obj_t * obj, lv_coord_t w, lv_coord_t h);
 
+/**
+ * Mark the data cached from an object's coordinates outdated after the coordinates were written.
+ * Call it after changing `obj->coords` directly and before sending `LV_SIGNAL_COORD_CHG`.
+ * @param obj pointer to an object
+ * @param children_moved true: the children were moved together with the object (only its position changed)
+ * @remarks Internal function, do not call directly.
+ */
+void _lv_obj_coords_changed(lv_obj_t * obj, bool children_moved);
+
 /**
  * Set the width of an object
  * @param obj pointer to an object
@@ -604,6 +644,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, uint8_t part, lv_style_property_t prop
  * Notify all object if a style is modified
  * @param style pointer to a style. Only the objects with this style will be notified
  *               (NULL to notify all objects)
+ * @note with `LV_USE_STYLE_INDEX` only the users of `style` are visited instead of all objects
  */
 void lv_obj_report_style_mod(lv_style_t * style);
 
@@ -761,6 +802,18 @@ void lv_obj_set_focus_parent(lv_obj_t * obj, bool en);
 */
 void lv_obj_set_gesture_parent(lv_obj_t * obj, bool en);
 
+#if LV_USE_FAST_SCROLL
+/**
+ * Move the content of the parent instead of redrawing it when the object is moved (e.g. the scrollable of a page).
+ * Only the newly exposed band of the parent is redrawn, see `_lv_inv_scroll()`.
+ * It's used only if the object is the only child of the parent, the parent's background is
+ * opaque and looks the same everywhere and no other object is drawn on the parent.
+ * @param obj pointer to an object
+ * @param en true: enable moving the parent's content
+ */
+void lv_obj_set_fast_scroll(lv_obj_t * obj, bool en);
+#endif
+
 /**
  * Propagate the events to the parent too
  * @param obj pointer to an object
@@ -897,6 +950,16 @@ lv_res_t lv_signal_send(lv_obj_t * obj, lv_signal_t signal, void * param);
  */
 void lv_obj_set_design_cb(lv_obj_t * obj, lv_design_cb_t design_cb);
 
+/**
+ * Set the signal and the design function of an object at once. Used internally by the library.
+ * With `LV_USE_OBJ_COMPACT` it looks up the shared class only once.
+ * Always call the previous signal function in the new.
+ * @param obj pointer to an object
+ * @param signal_cb the new signal function
+ * @param design_cb the new design function
+ */
+void lv_obj_set_signal_design_cb(lv_obj_t * obj, lv_signal_cb_t signal_cb, lv_design_cb_t design_cb);
+
 /*----------------
  * Other set
  *--------------*/
@@ -916,6 +979,25 @@ void * lv_obj_allocate_ext_attr(lv_obj_t * obj, uint16_t ext_size);
  */
 void lv_obj_refresh_ext_draw_pad(lv_obj_t * obj);
 
+#if LV_USE_LAYOUT_DEFER
+/**
+ * Mark the layout of an object to be refreshed later. The object will get a `LV_SIGNAL_REFR_LAYOUT`
+ * in `lv_obj_update_layout()`, i.e. before the next refresh or when a coordinate is read.
+ * Marking the same object several times refreshes its layout only once.
+ * @param obj pointer to an object
+ */
+void lv_obj_mark_layout_dirty(lv_obj_t * obj);
+
+/**
+ * Refresh the layout of all objects marked by `lv_obj_mark_layout_dirty()`.
+ * The deepest objects are refreshed first as their size might be required by their parent's layout.
+ * The marked objects are sorted by their level in a heap so the deepest one is found in O(log n).
+ * The areas invalidated meanwhile are merged where they overlap or touch.
+ * Called automatically before refreshing a display and by the coordinate getters and `lv_obj_align()`.
+ */
+void lv_obj_update_layout(void);
+#endif
+
 /*=======================
  * Getter functions
  *======================*/
@@ -1274,6 +1356,15 @@ bool lv_obj_get_drag_parent(const lv_obj_t * obj);
 */
 bool lv_obj_get_focus_parent(const lv_obj_t * obj);
 
+#if LV_USE_FAST_SCROLL
+/**
+ * Get whether the content of the parent is moved instead of redrawn when the object is moved
+ * @param obj pointer to an object
+ * @return true: the parent's content is moved
+ */
+bool lv_obj_get_fast_scroll(const lv_obj_t * obj);
+#endif
+
 /**
  * Get the drag parent attribute of an object
  * @param obj pointer to an object
@@ -1332,6 +1423,24 @@ lv_event_cb_t lv_obj_get_event_cb(const lv_obj_t * obj);
  * Other get
  *-----------------*/
 
+/**
+ * Get the area where an object can be clicked: its coordinates extended with the extra click area
+ * @param obj pointer to an object
+ * @param area store the click area here
+ */
+void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area);
+
+#if LV_USE_SUBTREE_BOUNDS
+/**
+ * Get the area where the children of an object (and their children) can draw.
+ * It's the union of the visible children's coordinates extended with their `ext_draw_pad`.
+ * @param obj pointer to an object
+ * @param bounds store the area here (absolute coordinates)
+ * @return true: `bounds` is set; false: the object has no visible children
+ */
+bool _lv_obj_get_subtree_bounds(lv_obj_t * obj, lv_area_t * bounds);
+#endif
+
 /**
  * Check if a given screen-space point is on an object's coordinates.
  *
@@ -1498,6 +1607,18 @@ bool lv_debug_check_obj_valid(const lv_obj_t * obj);
  */
 #define LV_EVENT_CB_DECLARE(name) static void name(lv_obj_t * obj, lv_event_t e)
 
+/**
+ * Get the signal and design function of an object without any checks. Used internally by the library.
+ * E.g. `_LV_OBJ_SIGNAL_CB(obj)(obj, LV_SIGNAL_CHILD_CHG, NULL);`
+ */
+#if LV_USE_OBJ_COMPACT
+#define _LV_OBJ_SIGNAL_CB(obj) ((obj)->class_p->signal_cb)
+#define _LV_OBJ_DESIGN_CB(obj) ((obj)->class_p->design_cb)
+#else
+#define _LV_OBJ_SIGNAL_CB(obj) ((obj)->signal_cb)
+#define _LV_OBJ_DESIGN_CB(obj) ((obj)->design_cb)
+#endif
+
 #if LV_USE_DEBUG
 
 # ifndef LV_DEBUG_IS_OBJ
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include <stddef.h>
+#include <string.h>
 #include "lv_refr.h"
 #include "lv_disp.h"
 #include "../lv_hal/lv_hal_tick.h"
@@ -15,6 +16,7 @@
 #include "../lv_misc/lv_mem.h"
 #include "../lv_misc/lv_math.h"
 #include "../lv_misc/lv_gc.h"
+#include "../lv_misc/lv_prof.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_font/lv_font_fmt_txt.h"
 #include "../lv_gpu/lv_gpu_stm32_dma2d.h"
@@ -29,6 +31,10 @@
 /* Draw translucent random colored areas on the invalidated (redrawn) areas*/
 #define MASK_AREA_DEBUG 0
 
+/* Size of the tiles in which the buffer is rotated by 90/270 degrees.
+ * A tile's source rows and destination rows fit into the data cache together.*/
+#define LV_REFR_ROT_TILE 8
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -40,16 +46,31 @@ static void lv_refr_join_area(void);
 static void lv_refr_areas(void);
 static void lv_refr_area(const lv_area_t * area_p);
 static void lv_refr_area_part(const lv_area_t * area_p);
+static void lv_refr_draw(const lv_area_t * clip_p);
+static void lv_refr_draw_bg(const lv_area_t * clip_p);
+#if LV_USE_DRAW_BACKEND
+    static bool lv_refr_native(void);
+#endif
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p);
 static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p);
 static void lv_refr_vdb_flush(void);
+#if LV_USE_FAST_SCROLL
+    static void lv_refr_scroll(void);
+    static bool lv_refr_can_scroll_buf(lv_disp_t * disp);
+#endif
+#if LV_USE_SCR_SNAPSHOT
+    static void lv_refr_snapshot_show(void);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
+#if LV_USE_LAYOUT_DEFER
+    static bool inv_merge;
+#endif
 #if LV_USE_PERF_MONITOR
     static uint32_t fps_sum_cnt;
     static uint32_t fps_sum_all;
@@ -111,6 +132,9 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+#if LV_USE_FAST_SCROLL
+        disp->scroll_pending = 0;
+#endif
         return;
     }
 
@@ -127,6 +151,14 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
 
     /*The area is truncated to the screen*/
     if(suc != false) {
+#if LV_USE_LAYOUT_DEFER
+        /*Only collect the area now. It will be saved by `_lv_inv_merge_end()`*/
+        if(inv_merge) {
+            _lv_area_list_add(disp->inv_merged, &disp->inv_merged_cnt, LV_INV_MERGE_BUF_SIZE, &com_area);
+            return;
+        }
+#endif
+
         if(disp->driver.rounder_cb) disp->driver.rounder_cb(&disp->driver, &com_area);
 
         /*Save only if this area is not in one of the saved areas*/
@@ -135,6 +167,8 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
             if(_lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
         }
 
+        _LV_PROF_COUNT(LV_PROF_CNT_INV_PX, lv_area_get_size(&com_area));
+
         /*Save the area*/
         if(disp->inv_p < LV_INV_BUF_SIZE) {
             lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
@@ -148,6 +182,123 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     }
 }
 
+#if LV_USE_LAYOUT_DEFER
+/**
+ * Collect the areas invalidated from now on and join the overlapping and touching ones
+ * instead of saving them one by one. Used while the deferred layouts are refreshed.
+ */
+void _lv_inv_merge_start(void)
+{
+    inv_merge = true;
+}
+
+/**
+ * Invalidate the areas collected since `_lv_inv_merge_start()`.
+ */
+void _lv_inv_merge_end(void)
+{
+    inv_merge = false;
+
+    lv_disp_t * d;
+    _LV_LL_READ(LV_GC_ROOT(_lv_disp_ll), d) {
+        uint32_t i;
+        for(i = 0; i < d->inv_merged_cnt; i++) {
+            _lv_inv_area(d, &d->inv_merged[i]);
+        }
+        d->inv_merged_cnt = 0;
+    }
+}
+#endif
+
+#if LV_USE_FAST_SCROLL
+/**
+ * Invalidate only the newly exposed band of an area whose content moves, instead of the whole area.
+ * The content is moved before the next refresh by the display driver's `scroll_cb`
+ * or in the frame buffer if 2 screen sized buffers are used.
+ * The areas invalidated earlier are invalidated at their moved position too.
+ * @param disp pointer to display where the area moves (NULL: the default display)
+ * @param area_p the area whose whole content moves together. Nothing else can be drawn on it.
+ * @param dx horizontal movement of the content
+ * @param dy vertical movement of the content
+ * @return true: the movement is saved; false: the content can't be moved, invalidate the area as usual
+ */
+bool _lv_inv_scroll(lv_disp_t * disp, const lv_area_t * area_p, lv_coord_t dx, lv_coord_t dy)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return false;
+
+#if LV_USE_LAYOUT_DEFER
+    if(inv_merge) return false;
+#endif
+
+#if LV_USE_DRAW_BACKEND
+    if(disp->driver.draw_backend) return false;
+#endif
+
+    if(disp->driver.rotated != LV_DISP_ROT_NONE && disp->driver.sw_rotate) return false;
+    if(disp->driver.scroll_cb == NULL && lv_refr_can_scroll_buf(disp) == false) return false;
+
+    lv_area_t scr_area;
+    scr_area.x1 = 0;
+    scr_area.y1 = 0;
+    scr_area.x2 = lv_disp_get_hor_res(disp) - 1;
+    scr_area.y2 = lv_disp_get_ver_res(disp) - 1;
+
+    lv_area_t area;
+    if(_lv_area_intersect(&area, area_p, &scr_area) == false) return false;
+
+    /*Only one area can be moved per refresh. The movements of the same area add up*/
+    lv_point_t ofs = {dx, dy};
+    if(disp->scroll_pending) {
+        if(disp->scroll_area.x1 != area.x1 || disp->scroll_area.y1 != area.y1 ||
+           disp->scroll_area.x2 != area.x2 || disp->scroll_area.y2 != area.y2) return false;
+        ofs.x += disp->scroll_ofs.x;
+        ofs.y += disp->scroll_ofs.y;
+    }
+
+    /*Nothing would remain from the current content*/
+    lv_coord_t w = lv_area_get_width(&area);
+    lv_coord_t h = lv_area_get_height(&area);
+    if(LV_MATH_ABS(dx) >= w || LV_MATH_ABS(dy) >= h) return false;
+    if(LV_MATH_ABS(ofs.x) >= w || LV_MATH_ABS(ofs.y) >= h) return false;
+
+    /* The areas invalidated so far are dirty in the current content. Their part on the area moves
+     * with the content so invalidate them at the new position too.*/
+    uint32_t inv_cnt = disp->inv_p;
+    uint32_t i;
+    for(i = 0; i < inv_cnt; i++) {
+        lv_area_t moved;
+        if(_lv_area_intersect(&moved, &disp->inv_areas[i], &area) == false) continue;
+        _lv_area_set_pos(&moved, moved.x1 + dx, moved.y1 + dy);
+        if(_lv_area_intersect(&moved, &moved, &area)) _lv_inv_area(disp, &moved);
+    }
+
+    lv_area_copy(&disp->scroll_area, &area);
+    disp->scroll_ofs = ofs;
+    disp->scroll_pending = 1;
+
+    /*Invalidate the newly exposed bands*/
+    lv_area_t band;
+    if(dy != 0) {
+        lv_area_copy(&band, &area);
+        if(dy > 0) band.y2 = area.y1 + dy - 1;
+        else band.y1 = area.y2 + dy + 1;
+        _lv_inv_area(disp, &band);
+    }
+
+    if(dx != 0) {
+        lv_area_copy(&band, &area);
+        if(dx > 0) band.x2 = area.x1 + dx - 1;
+        else band.x1 = area.x2 + dx + 1;
+        _lv_inv_area(disp, &band);
+    }
+
+    lv_task_set_prio(disp->refr_task, LV_REFR_TASK_PRIO);
+
+    return true;
+}
+#endif
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -168,6 +319,66 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp)
     disp_refr = disp;
 }
 
+#if LV_USE_DRAW_BACKEND
+/**
+ * Let the draw backend try to draw the screen again if it failed on an object or on its children.
+ * Called when an object is invalidated.
+ * @param obj pointer to the invalidated object
+ */
+void _lv_refr_native_retry(const lv_obj_t * obj)
+{
+    /*Check the displays directly as finding the display of the object would be slower*/
+    lv_disp_t * disp;
+    _LV_LL_READ(LV_GC_ROOT(_lv_disp_ll), disp) {
+        if(disp->native_failed == 0 || disp->native_fail_obj == NULL) continue;
+
+        const lv_obj_t * i;
+        for(i = disp->native_fail_obj; i; i = i->parent) {
+            if(i == obj) {
+                disp->native_failed = 0;
+                disp->native_fail_obj = NULL;
+                return;
+            }
+        }
+    }
+}
+#endif
+
+#if LV_USE_SCR_SNAPSHOT
+/**
+ * Render a screen into a buffer without flushing it, e.g. to create a snapshot of a not loaded screen.
+ * The layers and the other screens are not drawn.
+ * @param disp pointer to the display of the screen
+ * @param scr pointer to a screen
+ * @param area the area of the screen to render
+ * @param buf a buffer with `lv_area_get_size(area)` pixels
+ */
+void _lv_refr_render_scr(lv_disp_t * disp, lv_obj_t * scr, const lv_area_t * area, lv_color_t * buf)
+{
+    /*Draw into `buf` as if it were the display buffer. The buffer being flushed is not touched.*/
+    lv_disp_t * disp_refr_ori = disp_refr;
+    disp_refr = disp;
+
+    lv_disp_buf_t * vdb = lv_disp_get_buf(disp);
+    lv_color_t * buf_act_ori = vdb->buf_act;
+    lv_area_t vdb_area_ori;
+    lv_area_copy(&vdb_area_ori, &vdb->area);
+    vdb->buf_act = buf;
+    lv_area_copy(&vdb->area, area);
+
+    lv_obj_t * top_p = lv_refr_get_top_obj(area, scr);
+    if(top_p == NULL) {
+        lv_refr_draw_bg(area);
+        top_p = scr;
+    }
+    lv_refr_obj_and_children(top_p, area);
+
+    vdb->buf_act = buf_act_ori;
+    lv_area_copy(&vdb->area, &vdb_area_ori);
+    disp_refr = disp_refr_ori;
+}
+#endif
+
 /**
  * Called periodically to handle the refreshing
  * @param task pointer to the task itself
@@ -181,6 +392,11 @@ void _lv_disp_refr_task(lv_task_t * task)
 
     disp_refr = task->user_data;
 
+#if LV_USE_LAYOUT_DEFER
+    /*Refresh the deferred layouts first as they invalidate the areas to redraw now*/
+    lv_obj_update_layout();
+#endif
+
 #if LV_USE_PERF_MONITOR == 0
     /* Ensure the task does not run again automatically.
      * This is done before refreshing in case refreshing invalidates something else.
@@ -191,20 +407,44 @@ void _lv_disp_refr_task(lv_task_t * task)
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+#if LV_USE_FAST_SCROLL
+        disp_refr->scroll_pending = 0;
+#endif
         return;
     }
 
+#if LV_USE_SCR_SNAPSHOT
+    /*Flush the snapshot of the loaded screen and draw only what has changed since*/
+    if(disp_refr->snapshot_show) lv_refr_snapshot_show();
+#endif
+
+#if LV_USE_FAST_SCROLL
+    /*Move the content before drawing the newly exposed bands*/
+    if(disp_refr->scroll_pending) lv_refr_scroll();
+#endif
+
+#if LV_USE_PROFILER
+    _lv_prof_frame_start();
+#endif
+
+    _LV_PROF_START(join);
     lv_refr_join_area();
+    _LV_PROF_END(join, LV_PROF_PHASE_JOIN);
 
-    lv_refr_areas();
+    bool native = false;
+#if LV_USE_DRAW_BACKEND
+    native = lv_refr_native();
+#endif
+    if(native == false) lv_refr_areas();
 
     /*If refresh happened ...*/
     if(disp_refr->inv_p != 0) {
         /* In true double buffered mode copy the refreshed areas to the new VDB to keep it up to date.
-         * With set_px_cb we don't know anything about the buffer (even it's size) so skip copying.*/
-        if(lv_disp_is_true_double_buf(disp_refr)) {
-            if(disp_refr->driver.set_px_cb) {
-                LV_LOG_WARN("Can't handle 2 screen sized buffers with set_px_cb. Display is not refreshed.");
+         * With set_px_cb we don't know anything about the buffer (even it's size) so skip copying.
+         * A natively drawn frame hasn't touched the buffers.*/
+        if(lv_disp_is_true_double_buf(disp_refr) && native == false) {
+            if(disp_refr->driver.set_px_cb || disp_refr->driver.mono_page) {
+                LV_LOG_WARN("Can't handle 2 screen sized buffers with set_px_cb or mono_page. Display is not refreshed.");
             }
             else {
                 lv_disp_buf_t * vdb = lv_disp_get_buf(disp_refr);
@@ -254,6 +494,21 @@ void _lv_disp_refr_task(lv_task_t * task)
                     }
                 }
 
+#if LV_USE_FAST_SCROLL
+                /*The moved area has changed too*/
+                if(disp_refr->scroll_synced) {
+                    disp_refr->scroll_synced = 0;
+                    lv_area_t * sa = &disp_refr->scroll_area;
+                    uint32_t start_offs = (hres * sa->y1 + sa->x1) * sizeof(lv_color_t);
+                    uint32_t line_length = lv_area_get_width(sa) * sizeof(lv_color_t);
+                    lv_coord_t y;
+                    for(y = sa->y1; y <= sa->y2; y++) {
+                        _lv_memcpy(buf_act + start_offs, buf_ina + start_offs, line_length);
+                        start_offs += hres * sizeof(lv_color_t);
+                    }
+                }
+#endif
+
                 if(copy_buf) _lv_mem_buf_release(copy_buf);
             }
         } /*End of true double buffer handling*/
@@ -264,6 +519,12 @@ void _lv_disp_refr_task(lv_task_t * task)
         disp_refr->inv_p = 0;
 
         elaps = lv_tick_elaps(start);
+
+#if LV_USE_PROFILER
+        _LV_PROF_COUNT(LV_PROF_CNT_REFR_PX, px_num);
+        _lv_prof_frame_end();
+#endif
+
         /*Call monitor cb if present*/
         if(disp_refr->driver.monitor_cb) {
             disp_refr->driver.monitor_cb(&disp_refr->driver, elaps, px_num);
@@ -313,7 +574,23 @@ void _lv_disp_refr_task(lv_task_t * task)
         fps_sum_all += fps;
         fps_sum_cnt ++;
         uint32_t cpu = 100 - lv_task_get_idle();
+#if LV_USE_PROFILER
+        /*Show where the time of the last frame went*/
+        const lv_prof_frame_t * f = lv_prof_get_frame(0);
+        if(f) {
+            lv_label_set_text_fmt(perf_label, "%d FPS\n%d%% CPU\ncover %d us\ndraw %d us\nblend %d us\nflush %d us",
+                                  fps, cpu,
+                                  (int)f->phase_time[LV_PROF_PHASE_COVER_CHK],
+                                  (int)f->phase_time[LV_PROF_PHASE_DRAW],
+                                  (int)f->phase_time[LV_PROF_PHASE_BLEND],
+                                  (int)f->phase_time[LV_PROF_PHASE_FLUSH]);
+        }
+        else {
+            lv_label_set_text_fmt(perf_label, "%d FPS\n%d%% CPU", fps, cpu);
+        }
+#else
         lv_label_set_text_fmt(perf_label, "%d FPS\n%d%% CPU", fps, cpu);
+#endif
         lv_obj_align(perf_label, NULL, LV_ALIGN_IN_BOTTOM_RIGHT, 0, 0);
     }
 #endif
@@ -500,54 +777,54 @@ static void lv_refr_area_part(const lv_area_t * area_p)
 {
     lv_disp_buf_t * vdb = lv_disp_get_buf(disp_refr);
 
+    _LV_PROF_COUNT(LV_PROF_CNT_STRIP, 1);
+
     /*In non double buffered mode, before rendering the next part wait until the previous image is
      * flushed*/
     if(lv_disp_is_double_buf(disp_refr) == false) {
+        _LV_PROF_START(flush_wait);
         while(vdb->flushing) {
             if(disp_refr->driver.wait_cb) disp_refr->driver.wait_cb(&disp_refr->driver);
         }
+        _LV_PROF_END(flush_wait, LV_PROF_PHASE_FLUSH);
     }
 
-    lv_obj_t * top_act_scr = NULL;
-    lv_obj_t * top_prev_scr = NULL;
-
     /*Get the new mask from the original area and the act. VDB
      It will be a part of 'area_p'*/
     lv_area_t start_mask;
     _lv_area_intersect(&start_mask, area_p, &vdb->area);
 
+    lv_refr_draw(&start_mask);
+
+    /* In true double buffered mode flush only once when all areas were rendered.
+     * In normal mode flush after every area */
+    if(lv_disp_is_true_double_buf(disp_refr) == false) {
+        lv_refr_vdb_flush();
+    }
+}
+
+/**
+ * Draw the screens and the layers of the display being refreshed on an area
+ * @param clip_p pointer to an area, the objects will be drawn only here
+ */
+static void lv_refr_draw(const lv_area_t * clip_p)
+{
+    lv_obj_t * top_act_scr = NULL;
+    lv_obj_t * top_prev_scr = NULL;
+
     /*Get the most top object which is not covered by others*/
-    top_act_scr = lv_refr_get_top_obj(&start_mask, lv_disp_get_scr_act(disp_refr));
+    _LV_PROF_START(cover_chk);
+    top_act_scr = lv_refr_get_top_obj(clip_p, lv_disp_get_scr_act(disp_refr));
     if(disp_refr->prev_scr) {
-        top_prev_scr = lv_refr_get_top_obj(&start_mask, disp_refr->prev_scr);
+        top_prev_scr = lv_refr_get_top_obj(clip_p, disp_refr->prev_scr);
     }
+    _LV_PROF_END(cover_chk, LV_PROF_PHASE_COVER_CHK);
+
+    _LV_PROF_START(draw);
 
     /*Draw a display background if there is no top object*/
     if(top_act_scr == NULL && top_prev_scr == NULL) {
-        if(disp_refr->bg_img) {
-            lv_draw_img_dsc_t dsc;
-            lv_draw_img_dsc_init(&dsc);
-            dsc.opa = disp_refr->bg_opa;
-            lv_img_header_t header;
-            lv_res_t res;
-            res = lv_img_decoder_get_info(disp_refr->bg_img, &header);
-            if(res == LV_RES_OK) {
-                lv_area_t a;
-                lv_area_set(&a, 0, 0, header.w - 1, header.h - 1);
-                lv_draw_img(&a, &start_mask, disp_refr->bg_img, &dsc);
-            }
-            else {
-                LV_LOG_WARN("Can't draw the background image")
-            }
-        }
-        else {
-            lv_draw_rect_dsc_t dsc;
-            lv_draw_rect_dsc_init(&dsc);
-            dsc.bg_color = disp_refr->bg_color;
-            dsc.bg_opa = disp_refr->bg_opa;
-            lv_draw_rect(&start_mask, &start_mask, &dsc);
-
-        }
+        lv_refr_draw_bg(clip_p);
     }
     /*Refresh the previous screen if any*/
     if(disp_refr->prev_scr) {
@@ -556,7 +833,7 @@ static void lv_refr_area_part(const lv_area_t * area_p)
             top_prev_scr = disp_refr->prev_scr;
         }
         /*Do the refreshing from the top object*/
-        lv_refr_obj_and_children(top_prev_scr, &start_mask);
+        lv_refr_obj_and_children(top_prev_scr, clip_p);
 
     }
 
@@ -564,19 +841,111 @@ static void lv_refr_area_part(const lv_area_t * area_p)
         top_act_scr = disp_refr->act_scr;
     }
     /*Do the refreshing from the top object*/
-    lv_refr_obj_and_children(top_act_scr, &start_mask);
+    lv_refr_obj_and_children(top_act_scr, clip_p);
 
     /*Also refresh top and sys layer unconditionally*/
-    lv_refr_obj_and_children(lv_disp_get_layer_top(disp_refr), &start_mask);
-    lv_refr_obj_and_children(lv_disp_get_layer_sys(disp_refr), &start_mask);
+    lv_refr_obj_and_children(lv_disp_get_layer_top(disp_refr), clip_p);
+    lv_refr_obj_and_children(lv_disp_get_layer_sys(disp_refr), clip_p);
+
+    _LV_PROF_END(draw, LV_PROF_PHASE_DRAW);
+}
+
+/**
+ * Draw the background color or image of the display being refreshed
+ * @param clip_p pointer to an area, the background will be drawn only here
+ */
+static void lv_refr_draw_bg(const lv_area_t * clip_p)
+{
+    if(disp_refr->bg_img) {
+        lv_draw_img_dsc_t dsc;
+        lv_draw_img_dsc_init(&dsc);
+        dsc.opa = disp_refr->bg_opa;
+        lv_img_header_t header;
+        lv_res_t res;
+        res = lv_img_decoder_get_info(disp_refr->bg_img, &header);
+        if(res == LV_RES_OK) {
+            lv_area_t a;
+            lv_area_set(&a, 0, 0, header.w - 1, header.h - 1);
+            lv_draw_img(&a, clip_p, disp_refr->bg_img, &dsc);
+        }
+        else {
+            LV_LOG_WARN("Can't draw the background image")
+        }
+    }
+    else {
+        lv_draw_rect_dsc_t dsc;
+        lv_draw_rect_dsc_init(&dsc);
+        dsc.bg_color = disp_refr->bg_color;
+        dsc.bg_opa = disp_refr->bg_opa;
+        lv_draw_rect(clip_p, clip_p, &dsc);
 
-    /* In true double buffered mode flush only once when all areas were rendered.
-     * In normal mode flush after every area */
-    if(lv_disp_is_true_double_buf(disp_refr) == false) {
-        lv_refr_vdb_flush();
     }
 }
 
+#if LV_USE_DRAW_BACKEND
+/**
+ * Draw the whole screen with the draw backend of the display being refreshed.
+ * If the backend can't draw something the frame is aborted and
+ * the invalidated areas should be rendered by software.
+ * @return true: the screen was drawn natively
+ */
+static bool lv_refr_native(void)
+{
+    lv_disp_drv_t * drv = &disp_refr->driver;
+    const lv_draw_backend_t * backend = drv->draw_backend;
+    if(backend == NULL || disp_refr->inv_p == 0) return false;
+
+    /*Don't try again until the screen or the object which couldn't be drawn is changed
+     *(see `_lv_refr_native_retry()`) as the frame would be rendered by software anyway*/
+    if(disp_refr->native_failed) {
+        if(disp_refr->native_fail_scr == disp_refr->act_scr) return false;
+        disp_refr->native_failed = 0;
+    }
+    disp_refr->native_fail_obj = NULL;
+
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_disp_get_hor_res(disp_refr) - 1, lv_disp_get_ver_res(disp_refr) - 1);
+
+    /*With software rotation the buffer is rotated before flushing, the backend can't do it*/
+    bool ok = drv->rotated == LV_DISP_ROT_NONE || drv->sw_rotate == 0;
+    if(ok && backend->frame_start_cb) ok = backend->frame_start_cb(drv);
+
+    if(ok) {
+        _lv_draw_backend_begin(drv);
+        lv_refr_draw(&scr_area);
+        ok = _lv_draw_backend_end();
+        if(ok) {
+            _LV_PROF_START(native_flush);
+            ok = backend->frame_finish_cb(drv);
+            _LV_PROF_END(native_flush, LV_PROF_PHASE_FLUSH);
+        }
+        if(!ok && backend->frame_abort_cb) backend->frame_abort_cb(drv);
+    }
+
+    if(ok) {
+        px_num = lv_area_get_size(&scr_area);
+        disp_refr->draw_native = 1;
+        return true;
+    }
+
+    /*Remember the failure. If it's not known which object couldn't be drawn (e.g. the display list is full)
+     *only a new screen is tried natively.*/
+    disp_refr->native_failed = 1;
+    disp_refr->native_fail_scr = disp_refr->act_scr;
+
+    /*The display shows a native frame, not the content of the software rendered areas.
+     *So render the whole screen by software once.*/
+    if(disp_refr->draw_native) {
+        disp_refr->inv_areas[0] = scr_area;
+        disp_refr->inv_area_joined[0] = 0;
+        disp_refr->inv_p = 1;
+        disp_refr->draw_native = 0;
+    }
+
+    return false;
+}
+#endif
+
 /**
  * Search the most top object which fully covers an area
  * @param area_p pointer to an area
@@ -589,7 +958,7 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
 
     /*If this object is fully cover the draw area check the children too */
     if(_lv_area_is_in(area_p, &obj->coords, 0) && obj->hidden == 0) {
-        lv_design_res_t design_res = obj->design_cb(obj, area_p, LV_DESIGN_COVER_CHK);
+        lv_design_res_t design_res = _LV_OBJ_DESIGN_CB(obj)(obj, area_p, LV_DESIGN_COVER_CHK);
         if(design_res == LV_DESIGN_RES_MASKED) return NULL;
 
 #if LV_USE_OPA_SCALE
@@ -598,13 +967,23 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
         }
 #endif
 
-        lv_obj_t * i;
-        _LV_LL_READ(obj->child_ll, i) {
-            found_p = lv_refr_get_top_obj(area_p, i);
+        bool check_children = true;
+#if LV_USE_SUBTREE_BOUNDS
+        /*A child can cover the area only if the area is in the bounds of the children*/
+        lv_area_t subtree_bounds;
+        check_children = _lv_obj_get_subtree_bounds(obj, &subtree_bounds) &&
+                         _lv_area_is_in(area_p, &subtree_bounds, 0);
+#endif
+
+        if(check_children) {
+            lv_obj_t * i;
+            _LV_LL_READ(obj->child_ll, i) {
+                found_p = lv_refr_get_top_obj(area_p, i);
 
-            /*If a children is ok then break*/
-            if(found_p != NULL) {
-                break;
+                /*If a children is ok then break*/
+                if(found_p != NULL) {
+                    break;
+                }
             }
         }
 
@@ -653,7 +1032,7 @@ static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p)
         }
 
         /*Call the post draw design function of the parents of the to object*/
-        if(par->design_cb) par->design_cb(par, mask_p, LV_DESIGN_DRAW_POST);
+        if(_LV_OBJ_DESIGN_CB(par)) _LV_OBJ_DESIGN_CB(par)(par, mask_p, LV_DESIGN_DRAW_POST);
 
         /*The new border will be there last parents,
          *so the 'younger' brothers of parent will be refreshed*/
@@ -673,6 +1052,11 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
     /*Do not refresh hidden objects*/
     if(obj->hidden != 0) return;
 
+#if LV_USE_DRAW_BACKEND
+    /*The native frame will be rendered by software so don't draw the rest*/
+    if(_lv_draw_backend_failed()) return;
+#endif
+
     bool union_ok; /* Store the return value of area_union */
     /* Truncate the original mask to the coordinates of the parent
      * because the parent and its children are visible only here */
@@ -691,7 +1075,17 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
     if(union_ok != false) {
 
         /* Redraw the object */
-        if(obj->design_cb) obj->design_cb(obj, &obj_ext_mask, LV_DESIGN_DRAW_MAIN);
+        _LV_PROF_START(draw_main);
+        if(_LV_OBJ_DESIGN_CB(obj)) _LV_OBJ_DESIGN_CB(obj)(obj, &obj_ext_mask, LV_DESIGN_DRAW_MAIN);
+        _LV_PROF_END_OBJ(draw_main, obj);
+
+#if LV_USE_DRAW_BACKEND
+        /*Remember which object couldn't be drawn natively to try again when it changes*/
+        if(_lv_draw_backend_failed()) {
+            disp_refr->native_fail_obj = obj;
+            return;
+        }
+#endif
 
 #if MASK_AREA_DEBUG
         static lv_color_t debug_color = LV_COLOR_RED;
@@ -713,6 +1107,14 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
         /*Create a new 'obj_mask' without 'ext_size' because the children can't be visible there*/
         lv_obj_get_coords(obj, &obj_area);
         union_ok = _lv_area_intersect(&obj_mask, mask_ori_p, &obj_area);
+#if LV_USE_SUBTREE_BOUNDS
+        /*Skip the children at once if none of them is on the mask*/
+        if(union_ok != false) {
+            lv_area_t subtree_bounds;
+            union_ok = _lv_obj_get_subtree_bounds(obj, &subtree_bounds) &&
+                       _lv_area_is_on(&obj_mask, &subtree_bounds);
+        }
+#endif
         if(union_ok != false) {
             lv_area_t mask_child; /*Mask from obj and its child*/
             lv_obj_t * child_p;
@@ -737,7 +1139,9 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
         }
 
         /* If all the children are redrawn make 'post draw' design */
-        if(obj->design_cb) obj->design_cb(obj, &obj_ext_mask, LV_DESIGN_DRAW_POST);
+        _LV_PROF_START(draw_post);
+        if(_LV_OBJ_DESIGN_CB(obj)) _LV_OBJ_DESIGN_CB(obj)(obj, &obj_ext_mask, LV_DESIGN_DRAW_POST);
+        _LV_PROF_END_OBJ(draw_post, obj);
     }
 }
 
@@ -764,20 +1168,33 @@ static void lv_refr_vdb_rotate_180(lv_disp_drv_t *drv, lv_area_t *area, lv_color
     area->x1 = drv->hor_res - tmp_coord - 1;
 }
 
+/**
+ * Rotate an image 90/270 degrees into an other buffer.
+ * The image is processed in tiles so the strided reads and writes stay in the cache.
+ */
 static LV_ATTRIBUTE_FAST_MEM void lv_refr_vdb_rotate_90(bool invert_i, lv_coord_t area_w, lv_coord_t area_h, lv_color_t *orig_color_p, lv_color_t *rot_buf) {
-    
-    uint32_t invert = (area_w * area_h) - 1;
-    uint32_t initial_i = ((area_w - 1) * area_h);
-    for(lv_coord_t y = 0; y < area_h; y++) {
-        uint32_t i = initial_i + y;
-        if(invert_i)
-            i = invert - i;
-        for(lv_coord_t x = 0; x < area_w; x++) {
-            rot_buf[i] = *(orig_color_p++);
-            if(invert_i)
-                i += area_h;
-            else
-                i -= area_h;
+    for(lv_coord_t ty = 0; ty < area_h; ty += LV_REFR_ROT_TILE) {
+        lv_coord_t ty_end = LV_MATH_MIN(ty + LV_REFR_ROT_TILE, area_h);
+        for(lv_coord_t tx = 0; tx < area_w; tx += LV_REFR_ROT_TILE) {
+            lv_coord_t tx_end = LV_MATH_MIN(tx + LV_REFR_ROT_TILE, area_w);
+            /*A column of the tile becomes a row in the destination*/
+            for(lv_coord_t x = tx; x < tx_end; x++) {
+                const lv_color_t * src = &orig_color_p[ty * area_w + x];
+                lv_coord_t y;
+                if(invert_i) {
+                    lv_color_t * dest = &rot_buf[x * area_h + (area_h - 1)];
+                    for(y = ty; y < ty_end; y++) {
+                        *(dest - y) = *src;
+                        src += area_w;
+                    }
+                } else {
+                    lv_color_t * dest = &rot_buf[(area_w - 1 - x) * area_h];
+                    for(y = ty; y < ty_end; y++) {
+                        dest[y] = *src;
+                        src += area_w;
+                    }
+                }
+            }
         }
     }
 }
@@ -841,8 +1258,15 @@ static void lv_refr_vdb_rotate(lv_area_t *area, lv_color_t *color_p) {
         lv_disp_buf_t * vdb = lv_disp_get_buf(disp_refr);
         lv_coord_t area_w = lv_area_get_width(area);
         lv_coord_t area_h = lv_area_get_height(area);
+        /*Use the halves of the buffer in turns to rotate a chunk while the previous one is being flushed.
+         *If a row doesn't fit into a half, rotate and flush serially in the whole buffer.*/
+        uint32_t rot_buf_px = LV_DISP_ROT_MAX_BUF / sizeof(lv_color_t);
+        uint32_t chunk_px = rot_buf_px / 2;
+        bool ping_pong = chunk_px >= (uint32_t)area_w;
+        if(!ping_pong) chunk_px = rot_buf_px;
+        uint32_t chunk_id = 0;
         /*Determine the maximum number of rows that can be rotated at a time*/
-        lv_coord_t max_row = LV_MATH_MIN((lv_coord_t)((LV_DISP_ROT_MAX_BUF/sizeof(lv_color_t)) / area_w), area_h);
+        lv_coord_t max_row = LV_MATH_MIN((lv_coord_t)(chunk_px / area_w), area_h);
         lv_coord_t init_y_off;
         init_y_off = area->y1;
         if(drv->rotated == LV_DISP_ROT_90) {
@@ -852,16 +1276,18 @@ static void lv_refr_vdb_rotate(lv_area_t *area, lv_color_t *color_p) {
             area->y1 = area->x1;
             area->y2 = area->y1 + area_w - 1;
         }
+        bool last = vdb->flushing_last;
         vdb->flushing = 0;
         /*Rotate the screen in chunks, flushing after each one*/
         lv_coord_t row = 0;
         while(row < area_h) {
             lv_coord_t height = LV_MATH_MIN(max_row, area_h-row);
-            vdb->flushing = 1;
+            lv_color_t * flush_p;
             if((row == 0) && (area_h >= area_w)) {
                 /*Rotate the initial area as a square*/
                 height = area_w;
                 lv_refr_vdb_rotate_90_sqr(drv->rotated == LV_DISP_ROT_270, area_w, color_p);
+                flush_p = color_p;
                 if(drv->rotated == LV_DISP_ROT_90) {
                     area->x1 = init_y_off;
                     area->x2 = init_y_off+area_w-1;
@@ -873,8 +1299,15 @@ static void lv_refr_vdb_rotate(lv_area_t *area, lv_color_t *color_p) {
                 /*Rotate other areas using a maximum buffer size*/
                 if(rot_buf == NULL)
                     rot_buf = _lv_mem_buf_get(LV_DISP_ROT_MAX_BUF);
-                lv_refr_vdb_rotate_90(drv->rotated == LV_DISP_ROT_270, area_w, height, color_p, rot_buf);
-                
+                flush_p = ping_pong ? rot_buf + (chunk_id & 1) * chunk_px : rot_buf;
+                chunk_id++;
+                lv_refr_vdb_rotate_90(drv->rotated == LV_DISP_ROT_270, area_w, height, color_p, flush_p);
+            }
+            /*The previous chunk needs to be flushed before the next flush_cb call*/
+            while(vdb->flushing) {
+                if(drv->wait_cb) drv->wait_cb(drv);
+            }
+            if(flush_p != color_p) {
                 if(drv->rotated == LV_DISP_ROT_90) {
                     area->x1 = init_y_off+row;
                     area->x2 = init_y_off+row+height-1;
@@ -884,19 +1317,171 @@ static void lv_refr_vdb_rotate(lv_area_t *area, lv_color_t *color_p) {
                 }
             }
             /*Flush the completed area to the display*/
-            drv->flush_cb(drv, area, rot_buf == NULL ? color_p : rot_buf);
-            /*FIXME: Rotation forces legacy behavior where rendering and flushing are done serially*/
-            while(vdb->flushing) {
-                if(drv->wait_cb) drv->wait_cb(drv);
+            vdb->flushing = 1;
+            vdb->flushing_last = last && row + height >= area_h ? 1 : 0;
+            drv->flush_cb(drv, area, flush_p);
+            /*Without a free half the buffer can be rotated again only when it's flushed*/
+            if(!ping_pong) {
+                while(vdb->flushing) {
+                    if(drv->wait_cb) drv->wait_cb(drv);
+                }
             }
             color_p += area_w * height;
             row += height;
         }
-        /*Free the allocated buffer at the end if necessary*/
-        if(rot_buf != NULL)
+        /*Free the allocated buffer at the end if necessary.
+         *The last chunk can be flushed from it so wait for the flushing first*/
+        if(rot_buf != NULL) {
+            while(vdb->flushing) {
+                if(drv->wait_cb) drv->wait_cb(drv);
+            }
             _lv_mem_buf_release(rot_buf);
+        }
+    }
+}
+
+#if LV_USE_FAST_SCROLL
+/**
+ * Tell whether a moved area can be handled in the frame buffer of a display
+ * @param disp pointer to a display
+ * @return true: 2 screen sized buffers in a true color format are used
+ */
+static bool lv_refr_can_scroll_buf(lv_disp_t * disp)
+{
+    return lv_disp_is_true_double_buf(disp) && disp->driver.set_px_cb == NULL && disp->driver.mono_page == 0;
+}
+
+/**
+ * Move the content of the scrolled area of the display being refreshed
+ * in the frame buffer or with the driver's `scroll_cb`. Redraw the area if neither is possible.
+ */
+static void lv_refr_scroll(void)
+{
+    lv_area_t * area = &disp_refr->scroll_area;
+    lv_coord_t dx = disp_refr->scroll_ofs.x;
+    lv_coord_t dy = disp_refr->scroll_ofs.y;
+    disp_refr->scroll_pending = 0;
+
+    if(dx == 0 && dy == 0) return;
+
+    lv_disp_buf_t * vdb = lv_disp_get_buf(disp_refr);
+
+    /*The buffer which will be drawn holds the current content of the screen.
+     *Move the lines in a direction which doesn't overwrite the lines still to move*/
+    if(lv_refr_can_scroll_buf(disp_refr)) {
+        lv_coord_t hres = disp_refr->driver.hor_res;
+        lv_color_t * buf = vdb->buf_act;
+        lv_coord_t x1 = LV_MATH_MAX(area->x1, area->x1 + dx);
+        lv_coord_t x2 = LV_MATH_MIN(area->x2, area->x2 + dx);
+        uint32_t line_length = (x2 - x1 + 1) * sizeof(lv_color_t);
+        lv_coord_t y;
+        if(dy > 0) {
+            for(y = area->y2; y >= area->y1 + dy; y--) {
+                memmove(&buf[hres * y + x1], &buf[hres * (y - dy) + x1 - dx], line_length);
+            }
+        }
+        else {
+            for(y = area->y1; y <= area->y2 + dy; y++) {
+                memmove(&buf[hres * y + x1], &buf[hres * (y - dy) + x1 - dx], line_length);
+            }
+        }
+
+        disp_refr->scroll_synced = 1;
+        return;
+    }
+
+    /*The display still shows the last flushed area which should be moved too*/
+    while(vdb->flushing) {
+        if(disp_refr->driver.wait_cb) disp_refr->driver.wait_cb(&disp_refr->driver);
+    }
+
+    if(disp_refr->driver.scroll_cb(&disp_refr->driver, area, dx, dy) == false) {
+        _lv_inv_area(disp_refr, area);
+    }
+}
+#endif
+
+#if LV_USE_SCR_SNAPSHOT
+/**
+ * Flush the snapshot of the loaded screen instead of drawing the screen.
+ * The parts changed since the snapshot and the objects of the layers are invalidated to draw them as usual.
+ */
+static void lv_refr_snapshot_show(void)
+{
+    lv_scr_snapshot_t * snapshot = disp_refr->snapshot_show;
+    disp_refr->snapshot_show = NULL;
+
+    if(snapshot->scr != disp_refr->act_scr || snapshot->data == NULL || disp_refr->prev_scr) return;
+    if(_lv_scr_snapshot_is_supported(disp_refr) == false) return;
+
+    lv_coord_t hres = lv_disp_get_hor_res(disp_refr);
+    lv_coord_t vres = lv_disp_get_ver_res(disp_refr);
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, hres - 1, vres - 1);
+
+    /*Nothing to gain if the whole screen has changed*/
+    uint32_t i;
+    for(i = 0; i < snapshot->dirty_cnt; i++) {
+        if(_lv_area_is_in(&scr_area, &snapshot->dirty[i], 0)) return;
+    }
+
+    /*The snapshot covers everything invalidated so far on the screen*/
+    _lv_inv_area(disp_refr, NULL);
+    for(i = 0; i < snapshot->dirty_cnt; i++) {
+        _lv_inv_area(disp_refr, &snapshot->dirty[i]);
+    }
+
+    lv_obj_t * layers[2] = {disp_refr->top_layer, disp_refr->sys_layer};
+    for(i = 0; i < 2; i++) {
+        lv_obj_t * child;
+        _LV_LL_READ(layers[i]->child_ll, child) {
+            lv_obj_invalidate(child);
+        }
+    }
+
+    lv_disp_buf_t * vdb = lv_disp_get_buf(disp_refr);
+    lv_scr_snapshot_dec_t dec;
+    _lv_scr_snapshot_dec_init(&dec, snapshot);
+    bool last_area = disp_refr->inv_p == 0;
+
+    if(lv_disp_is_true_double_buf(disp_refr)) {
+        lv_area_copy(&vdb->area, &scr_area);
+        _lv_scr_snapshot_decode(&dec, vdb->buf_act, (uint32_t)hres * vres);
+        vdb->last_area = last_area;
+        vdb->last_part = 1;
+        lv_refr_vdb_flush();
+
+        /*Wait until the buffers are switched and write the snapshot into the new active buffer too*/
+        while(vdb->flushing) {
+            if(disp_refr->driver.wait_cb) disp_refr->driver.wait_cb(&disp_refr->driver);
+        }
+        _lv_scr_snapshot_dec_init(&dec, snapshot);
+        _lv_scr_snapshot_decode(&dec, vdb->buf_act, (uint32_t)hres * vres);
+        return;
+    }
+
+    /*Flush the snapshot in buffer sized bands*/
+    lv_coord_t max_row = LV_MATH_MIN((lv_coord_t)(vdb->size / hres), vres);
+    lv_coord_t y;
+    for(y = 0; y < vres; y += max_row) {
+        if(lv_disp_is_double_buf(disp_refr) == false) {
+            while(vdb->flushing) {
+                if(disp_refr->driver.wait_cb) disp_refr->driver.wait_cb(&disp_refr->driver);
+            }
+        }
+
+        vdb->area.x1 = 0;
+        vdb->area.x2 = hres - 1;
+        vdb->area.y1 = y;
+        vdb->area.y2 = LV_MATH_MIN(y + max_row, vres) - 1;
+        _lv_scr_snapshot_decode(&dec, vdb->buf_act, lv_area_get_size(&vdb->area));
+
+        vdb->last_part = vdb->area.y2 == vres - 1;
+        vdb->last_area = last_area && vdb->last_part;
+        lv_refr_vdb_flush();
     }
 }
+#endif
 
 /**
  * Flush the content of the VDB
@@ -906,6 +1491,8 @@ static void lv_refr_vdb_flush(void)
     lv_disp_buf_t * vdb = lv_disp_get_buf(disp_refr);
     lv_color_t * color_p = vdb->buf_act;
 
+    _LV_PROF_START(flush);
+
     /*In double buffered mode wait until the other buffer is flushed before flushing the current
      * one*/
     if(lv_disp_is_double_buf(disp_refr)) {
@@ -931,6 +1518,9 @@ static void lv_refr_vdb_flush(void)
             disp->driver.flush_cb(&disp->driver, &vdb->area, color_p);
         }
     }
+
+    _LV_PROF_END(flush, LV_PROF_PHASE_FLUSH);
+
     if(vdb->buf1 && vdb->buf2) {
         if(vdb->buf_act == vdb->buf1)
             vdb->buf_act = vdb->buf2;
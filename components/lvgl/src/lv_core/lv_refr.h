@@ -64,6 +64,34 @@ void lv_refr_now(lv_disp_t * disp);
  */
 void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p);
 
+#if LV_USE_LAYOUT_DEFER
+/**
+ * Collect the areas invalidated from now on and join the overlapping and touching ones
+ * instead of saving them one by one. Used while the deferred layouts are refreshed.
+ */
+void _lv_inv_merge_start(void);
+
+/**
+ * Invalidate the areas collected since `_lv_inv_merge_start()`.
+ */
+void _lv_inv_merge_end(void);
+#endif
+
+#if LV_USE_FAST_SCROLL
+/**
+ * Invalidate only the newly exposed band of an area whose content moves, instead of the whole area.
+ * The content is moved before the next refresh by the display driver's `scroll_cb`
+ * or in the frame buffer if 2 screen sized buffers are used.
+ * The areas invalidated earlier are invalidated at their moved position too.
+ * @param disp pointer to display where the area moves (NULL: the default display)
+ * @param area_p the area whose whole content moves together. Nothing else can be drawn on it.
+ * @param dx horizontal movement of the content
+ * @param dy vertical movement of the content
+ * @return true: the movement is saved; false: the content can't be moved, invalidate the area as usual
+ */
+bool _lv_inv_scroll(lv_disp_t * disp, const lv_area_t * area_p, lv_coord_t dx, lv_coord_t dy);
+#endif
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -78,6 +106,27 @@ lv_disp_t * _lv_refr_get_disp_refreshing(void);
  */
 void _lv_refr_set_disp_refreshing(lv_disp_t * disp);
 
+#if LV_USE_DRAW_BACKEND
+/**
+ * Let the draw backend try to draw the screen again if it failed on an object or on its children.
+ * Called when an object is invalidated.
+ * @param obj pointer to the invalidated object
+ */
+void _lv_refr_native_retry(const lv_obj_t * obj);
+#endif
+
+#if LV_USE_SCR_SNAPSHOT
+/**
+ * Render a screen into a buffer without flushing it, e.g. to create a snapshot of a not loaded screen.
+ * The layers and the other screens are not drawn.
+ * @param disp pointer to the display of the screen
+ * @param scr pointer to a screen
+ * @param area the area of the screen to render
+ * @param buf a buffer with `lv_area_get_size(area)` pixels
+ */
+void _lv_refr_render_scr(lv_disp_t * disp, lv_obj_t * scr, const lv_area_t * area, lv_color_t * buf);
+#endif
+
 #if LV_USE_PERF_MONITOR
 /**
  * Get the average FPS since start up
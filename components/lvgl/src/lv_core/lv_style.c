@@ -28,6 +28,9 @@ static inline uint8_t get_style_prop_id(const lv_style_t * style, size_t idx);
 static inline uint8_t get_style_prop_attr(const lv_style_t * style, size_t idx);
 static inline size_t get_prop_size(uint8_t prop_id);
 static inline size_t get_next_prop_index(uint8_t prop_id, size_t id);
+#if LV_USE_STYLE_INDEX
+static void refs_update(lv_style_list_t * list);
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -48,6 +51,7 @@ static inline size_t get_next_prop_index(uint8_t prop_id, size_t id);
 /**
  * Initialize a style
  * @param style pointer to a style to initialize
+ * @note use `lv_style_reset()` to clear a style which is already used
  */
 void lv_style_init(lv_style_t * style)
 {
@@ -174,6 +178,10 @@ void lv_style_list_copy(lv_style_list_t * list_dest, const lv_style_list_t * lis
         if (local_style)
             lv_style_copy(local_style, get_alloc_local_style((lv_style_list_t *)list_src));
     }
+
+#if LV_USE_STYLE_INDEX
+    refs_update(list_dest);
+#endif
 }
 
 /**
@@ -214,6 +222,10 @@ void _lv_style_list_add_style(lv_style_list_t * list, lv_style_t * style)
     new_styles[first_style] = style;
     list->style_cnt++;
     list->style_list = new_styles;
+
+#if LV_USE_STYLE_INDEX
+    refs_update(list);
+#endif
 }
 
 /**
@@ -244,6 +256,9 @@ void _lv_style_list_remove_style(lv_style_list_t * list, lv_style_t * style)
         list->style_list = NULL;
         list->style_cnt = 0;
         list->has_local = 0;
+#if LV_USE_STYLE_INDEX
+        refs_update(list);
+#endif
         return;
     }
 
@@ -263,6 +278,10 @@ void _lv_style_list_remove_style(lv_style_list_t * list, lv_style_t * style)
 
     list->style_cnt--;
     list->style_list = new_styles;
+
+#if LV_USE_STYLE_INDEX
+    refs_update(list);
+#endif
 }
 
 /**
@@ -299,18 +318,75 @@ void _lv_style_list_reset(lv_style_list_t * list)
     list->has_trans = 0;
     list->skip_trans = 0;
 
+#if LV_USE_STYLE_INDEX
+    refs_update(list);
+#endif
+
     /* Intentionally leave `ignore_trans` as it is,
      * because it's independent from the styles in the list*/
 }
 
+#if LV_USE_STYLE_INDEX
+/**
+ * Set the object and part using a style list. The users of the styles in the list will point to this object.
+ * @param list pointer to a style list
+ * @param obj pointer to the object using the list
+ * @param part the part of `obj` using the list
+ */
+void _lv_style_list_set_owner(lv_style_list_t * list, void * obj, uint8_t part)
+{
+    LV_ASSERT_STYLE_LIST(list);
+
+    list->owner = obj;
+    list->owner_part = part;
+
+    uint8_t i;
+    for(i = 0; i < list->ref_cnt; i++) {
+        list->refs[i].obj = obj;
+        list->refs[i].part = part;
+    }
+}
+
+/**
+ * Link a style list to its styles again, e.g. after one of them was reset.
+ * @param list pointer to a style list
+ * @remarks Internal function, do not call directly.
+ */
+void _lv_style_list_relink(lv_style_list_t * list)
+{
+    LV_ASSERT_STYLE_LIST(list);
+
+    refs_update(list);
+}
+#endif
+
 /**
  * Clear all properties from a style and all allocated memories.
  * @param style pointer to a style
+ * @note the style lists still using the style are unlinked from it.
+ * The next `lv_obj_report_style_mod()` with this style visits all objects and links them again.
  */
 void lv_style_reset(lv_style_t * style)
 {
+#if LV_USE_STYLE_INDEX
+    /*Nothing may point into the style after it's reset as it might be freed.
+     *Leave the links of the users pointing to themselves so they can be unlinked again safely.*/
+    bool had_users = style->refs != NULL || style->refs_lost;
+    lv_style_ref_t * ref = style->refs;
+    while(ref) {
+        lv_style_ref_t * ref_next = ref->next;
+        ref->next = NULL;
+        ref->prev_next = &ref->next;
+        ref = ref_next;
+    }
+#endif
+
     lv_mem_free(style->map);
     lv_style_init(style);
+
+#if LV_USE_STYLE_INDEX
+    style->refs_lost = had_users ? 1 : 0;
+#endif
 }
 
 /**
@@ -669,6 +745,10 @@ lv_style_t * _lv_style_list_add_trans_style(lv_style_list_t * list)
         list->style_list[0] = list->style_list[1];
         list->style_list[1] = tmp;
     }
+
+#if LV_USE_STYLE_INDEX
+    refs_update(list);
+#endif
     return trans_style;
 }
 
@@ -1055,9 +1135,60 @@ static lv_style_t * get_alloc_local_style(lv_style_list_t * list)
     _lv_style_list_add_style(list, local_style);
     list->has_local = 1;
 
+#if LV_USE_STYLE_INDEX
+    refs_update(list);
+#endif
+
     return local_style;
 }
 
+#if LV_USE_STYLE_INDEX
+/**
+ * Link the shared styles of a style list to the list again after the styles of the list were changed.
+ * The local and transition styles are not linked.
+ * @param list pointer to a style list
+ */
+static void refs_update(lv_style_list_t * list)
+{
+    /*Unlink the old references*/
+    uint8_t i;
+    for(i = 0; i < list->ref_cnt; i++) {
+        lv_style_ref_t * ref = &list->refs[i];
+        *ref->prev_next = ref->next;
+        if(ref->next) ref->next->prev_next = ref->prev_next;
+    }
+
+    uint8_t first_style = list->has_trans + list->has_local;
+    uint8_t ref_cnt = list->style_cnt > first_style ? list->style_cnt - first_style : 0;
+    if(ref_cnt != list->ref_cnt) {
+        lv_mem_free(list->refs);
+        list->refs = NULL;
+        list->ref_cnt = 0;
+        if(ref_cnt == 0) return;
+
+        list->refs = lv_mem_alloc(ref_cnt * sizeof(lv_style_ref_t));
+        LV_ASSERT_MEM(list->refs);
+        if(list->refs == NULL) {
+            LV_LOG_WARN("refs_update: couldn't allocate the style references");
+            return;
+        }
+        list->ref_cnt = ref_cnt;
+    }
+
+    /*Add the list to the front of the users of each style*/
+    for(i = 0; i < ref_cnt; i++) {
+        lv_style_t * style = list->style_list[first_style + i];
+        lv_style_ref_t * ref = &list->refs[i];
+        ref->obj = list->owner;
+        ref->part = list->owner_part;
+        ref->next = style->refs;
+        ref->prev_next = &style->refs;
+        if(style->refs) style->refs->prev_next = &ref->next;
+        style->refs = ref;
+    }
+}
+#endif
+
 /**
  * Resizes a style map. Useful entry point for debugging.
  * @param style pointer to the style to be resized.
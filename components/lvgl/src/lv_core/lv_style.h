@@ -208,8 +208,25 @@ typedef uint16_t lv_style_property_t;
 
 typedef uint16_t lv_style_state_t;
 
+#if LV_USE_STYLE_INDEX
+/**
+ * Link of a style list in the list of users of a style.
+ * Allocated by the style list, one for each of its styles (except the local and transition styles)
+ */
+typedef struct _lv_style_ref_t {
+    struct _lv_style_ref_t * next;
+    struct _lv_style_ref_t ** prev_next;    /*The `next` of the previous link or the `refs` of the style*/
+    void * obj;                             /*The object using the style or `NULL` if not used by an object*/
+    uint8_t part;                           /*The part of the object using the style*/
+} lv_style_ref_t;
+#endif
+
 typedef struct {
     uint8_t * map;
+#if LV_USE_STYLE_INDEX
+    lv_style_ref_t * refs;  /*The style lists using this style*/
+    uint8_t refs_lost;      /*Set by `lv_style_reset()` if style lists using this style were unlinked*/
+#endif
 #if LV_USE_ASSERT_STYLE
     uint32_t sentinel;
 #endif
@@ -221,6 +238,12 @@ typedef struct {
     lv_style_t ** style_list;
 #if LV_USE_ASSERT_STYLE
     uint32_t sentinel;
+#endif
+#if LV_USE_STYLE_INDEX
+    lv_style_ref_t * refs;  /*Links to the styles of `style_list` (without the local and transition style)*/
+    void * owner;           /*The object using this list or `NULL` if not used by an object*/
+    uint8_t owner_part;     /*The part of `owner` using this list*/
+    uint8_t ref_cnt;        /*Number of items in `refs`*/
 #endif
     uint32_t style_cnt     : 6;
     uint32_t has_local     : 1;
@@ -262,6 +285,7 @@ typedef struct {
 /**
  * Initialize a style
  * @param style pointer to a style to initialize
+ * @note use `lv_style_reset()` to clear a style which is already used
  */
 void lv_style_init(lv_style_t * style);
 
@@ -308,6 +332,25 @@ void _lv_style_list_remove_style(lv_style_list_t * list, lv_style_t * style);
  */
 void _lv_style_list_reset(lv_style_list_t * style_list);
 
+#if LV_USE_STYLE_INDEX
+/**
+ * Set the object and part using a style list. The users of the styles in the list will point to this object.
+ * @param list pointer to a style list
+ * @param obj pointer to the object using the list
+ * @param part the part of `obj` using the list
+ */
+void _lv_style_list_set_owner(lv_style_list_t * list, void * obj, uint8_t part);
+
+/**
+ * Link a style list to its styles again, e.g. after one of them was reset.
+ * @param list pointer to a style list
+ * @remarks Internal function, do not call directly.
+ */
+void _lv_style_list_relink(lv_style_list_t * list);
+#else
+#define _lv_style_list_set_owner(list, obj, part) do {} while(0)
+#endif
+
 static inline lv_style_t * lv_style_list_get_style(lv_style_list_t * list, uint8_t id)
 {
     if(list->has_trans && list->skip_trans) id++;
@@ -318,6 +361,8 @@ static inline lv_style_t * lv_style_list_get_style(lv_style_list_t * list, uint8
 /**
  * Clear all properties from a style and all allocated memories.
  * @param style pointer to a style
+ * @note the style lists still using the style are unlinked from it.
+ * The next `lv_obj_report_style_mod()` with this style visits all objects and links them again.
  */
 void lv_style_reset(lv_style_t * style);
 
@@ -0,0 +1,172 @@
+/**
+ * @file lv_draw_backend.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_backend.h"
+
+#if LV_USE_DRAW_BACKEND
+#include "lv_draw_mask.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool can_draw(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_disp_drv_t * act_drv;     /*Driver of the native frame being drawn or NULL*/
+static bool failed;                 /*true: something couldn't be drawn by the backend*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Route the draw functions to the draw backend of a display
+ * @param disp_drv pointer to the display driver whose `draw_backend` should be used
+ */
+void _lv_draw_backend_begin(lv_disp_drv_t * disp_drv)
+{
+    act_drv = disp_drv;
+    failed = false;
+}
+
+/**
+ * Stop routing the draw functions to the draw backend
+ * @return true: everything was drawn by the backend; false: the frame should be rendered by software
+ */
+bool _lv_draw_backend_end(void)
+{
+    act_drv = NULL;
+    return !failed;
+}
+
+/**
+ * Tell whether the native frame being drawn has already failed
+ * @return true: the frame will be rendered by software so the rest of the screen needn't be drawn
+ */
+bool _lv_draw_backend_failed(void)
+{
+    return act_drv != NULL && failed;
+}
+
+/**
+ * Pass a rectangle to the draw backend
+ * @return true: a native frame is being drawn so the rectangle shouldn't be drawn by software
+ */
+bool _lv_draw_backend_rect(const lv_area_t * coords, const lv_area_t * clip, const lv_draw_rect_dsc_t * dsc)
+{
+    if(act_drv == NULL) return false;
+
+    if(can_draw()) {
+        const lv_draw_backend_t * backend = act_drv->draw_backend;
+        if(backend->rect_cb == NULL || backend->rect_cb(act_drv, coords, clip, dsc) == false) failed = true;
+    }
+
+    return true;
+}
+
+/**
+ * Pass a line to the draw backend
+ * @return true: a native frame is being drawn so the line shouldn't be drawn by software
+ */
+bool _lv_draw_backend_line(const lv_point_t * point1, const lv_point_t * point2, const lv_area_t * clip,
+                           const lv_draw_line_dsc_t * dsc)
+{
+    if(act_drv == NULL) return false;
+
+    if(can_draw()) {
+        const lv_draw_backend_t * backend = act_drv->draw_backend;
+        if(backend->line_cb == NULL || backend->line_cb(act_drv, point1, point2, clip, dsc) == false) failed = true;
+    }
+
+    return true;
+}
+
+/**
+ * Pass a letter to the draw backend
+ * @return true: a native frame is being drawn so the letter shouldn't be drawn by software
+ */
+bool _lv_draw_backend_letter(const lv_point_t * pos, const lv_area_t * clip, const lv_font_t * font,
+                             uint32_t letter, lv_color_t color, lv_opa_t opa)
+{
+    if(act_drv == NULL) return false;
+
+    if(can_draw()) {
+        const lv_draw_backend_t * backend = act_drv->draw_backend;
+        if(backend->letter_cb == NULL || backend->letter_cb(act_drv, pos, clip, font, letter, color, opa) == false) {
+            failed = true;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Pass an image to the draw backend
+ * @return true: a native frame is being drawn so the image shouldn't be drawn by software
+ */
+bool _lv_draw_backend_img(const lv_area_t * coords, const lv_area_t * clip, const void * src,
+                          const lv_draw_img_dsc_t * dsc)
+{
+    if(act_drv == NULL) return false;
+
+    if(can_draw()) {
+        const lv_draw_backend_t * backend = act_drv->draw_backend;
+        if(backend->img_cb == NULL || backend->img_cb(act_drv, coords, clip, src, dsc) == false) failed = true;
+    }
+
+    return true;
+}
+
+/**
+ * Called by the blending functions. Anything reaching them can't be drawn natively.
+ * @return true: a native frame is being drawn so nothing should be blended
+ */
+bool _lv_draw_backend_blend(void)
+{
+    if(act_drv == NULL) return false;
+
+    failed = true;
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Check whether the next item can be passed to the backend
+ * @return true: can be passed; false: the frame has already failed or a mask is active
+ */
+static bool can_draw(void)
+{
+    if(failed) return false;
+
+    /*The backends can't apply LVGL's masks (rounded clip corners, arcs, object masks, ...)*/
+    if(lv_draw_mask_get_cnt() > 0) {
+        failed = true;
+        return false;
+    }
+
+    return true;
+}
+
+#endif /*LV_USE_DRAW_BACKEND*/
@@ -0,0 +1,134 @@
+/**
+ * @file lv_draw_backend.h
+ * Interface to draw the frames natively with the display controller (e.g. as a display list)
+ * instead of rendering them into the display buffer.
+ */
+
+#ifndef LV_DRAW_BACKEND_H
+#define LV_DRAW_BACKEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_DRAW_BACKEND
+#include "../lv_hal/lv_hal_disp.h"
+#include "../lv_font/lv_font.h"
+#include "lv_draw_rect.h"
+#include "lv_draw_line.h"
+#include "lv_draw_img.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Draw backend of a display. Set it in `lv_disp_drv_t.draw_backend`.
+ *
+ * If the backend is set, the screen is drawn as a whole (without strips and `buffer`) and every
+ * rectangle, line, letter and image is passed to the callbacks.
+ * A draw callback returns `false` if it can't draw the given item (e.g. a gradient or an unknown font).
+ * Draws which would need the software renderer (masks, arcs, custom blending) fail too.
+ * In these cases the frame is aborted and the invalidated areas are rendered by software
+ * and sent to `flush_cb` as usual. The screen is drawn natively again only when the screen is changed
+ * or the object which couldn't be drawn (or one of its parents) is invalidated.
+ * All callbacks are optional except `frame_finish_cb`.
+ */
+typedef struct _lv_draw_backend_t {
+    /** Start a new frame. Return `false` to render this frame by software*/
+    bool (*frame_start_cb)(struct _disp_drv_t * disp_drv);
+
+    /** Show the frame. Return `false` to render it by software (e.g. the display list is full)*/
+    bool (*frame_finish_cb)(struct _disp_drv_t * disp_drv);
+
+    /** Drop the frame being built because it will be rendered by software*/
+    void (*frame_abort_cb)(struct _disp_drv_t * disp_drv);
+
+    /** Draw a rectangle (background, border, outline, ...)*/
+    bool (*rect_cb)(struct _disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                    const lv_draw_rect_dsc_t * dsc);
+
+    /** Draw a line*/
+    bool (*line_cb)(struct _disp_drv_t * disp_drv, const lv_point_t * point1, const lv_point_t * point2,
+                    const lv_area_t * clip, const lv_draw_line_dsc_t * dsc);
+
+    /** Draw a letter. `pos` is the top left corner of the letter's line (as in `lv_draw_label`)*/
+    bool (*letter_cb)(struct _disp_drv_t * disp_drv, const lv_point_t * pos, const lv_area_t * clip,
+                      const lv_font_t * font, uint32_t letter, lv_color_t color, lv_opa_t opa);
+
+    /** Draw an image*/
+    bool (*img_cb)(struct _disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                   const void * src, const lv_draw_img_dsc_t * dsc);
+} lv_draw_backend_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Route the draw functions to the draw backend of a display
+ * @param disp_drv pointer to the display driver whose `draw_backend` should be used
+ */
+void _lv_draw_backend_begin(struct _disp_drv_t * disp_drv);
+
+/**
+ * Stop routing the draw functions to the draw backend
+ * @return true: everything was drawn by the backend; false: the frame should be rendered by software
+ */
+bool _lv_draw_backend_end(void);
+
+/**
+ * Tell whether the native frame being drawn has already failed
+ * @return true: the frame will be rendered by software so the rest of the screen needn't be drawn
+ */
+bool _lv_draw_backend_failed(void);
+
+/**
+ * Pass a rectangle to the draw backend
+ * @return true: a native frame is being drawn so the rectangle shouldn't be drawn by software
+ */
+bool _lv_draw_backend_rect(const lv_area_t * coords, const lv_area_t * clip, const lv_draw_rect_dsc_t * dsc);
+
+/**
+ * Pass a line to the draw backend
+ * @return true: a native frame is being drawn so the line shouldn't be drawn by software
+ */
+bool _lv_draw_backend_line(const lv_point_t * point1, const lv_point_t * point2, const lv_area_t * clip,
+                           const lv_draw_line_dsc_t * dsc);
+
+/**
+ * Pass a letter to the draw backend
+ * @return true: a native frame is being drawn so the letter shouldn't be drawn by software
+ */
+bool _lv_draw_backend_letter(const lv_point_t * pos, const lv_area_t * clip, const lv_font_t * font,
+                             uint32_t letter, lv_color_t color, lv_opa_t opa);
+
+/**
+ * Pass an image to the draw backend
+ * @return true: a native frame is being drawn so the image shouldn't be drawn by software
+ */
+bool _lv_draw_backend_img(const lv_area_t * coords, const lv_area_t * clip, const void * src,
+                          const lv_draw_img_dsc_t * dsc);
+
+/**
+ * Called by the blending functions. Anything reaching them can't be drawn natively.
+ * @return true: a native frame is being drawn so nothing should be blended
+ */
+bool _lv_draw_backend_blend(void);
+
+#endif /*LV_USE_DRAW_BACKEND*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_DRAW_BACKEND_H*/
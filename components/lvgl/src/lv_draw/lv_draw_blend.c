@@ -11,6 +11,8 @@
 #include "../lv_misc/lv_math.h"
 #include "../lv_hal/lv_hal_disp.h"
 #include "../lv_core/lv_refr.h"
+#include "../lv_misc/lv_prof.h"
+#include "lv_draw_backend.h"
 
 #if LV_USE_GPU_NXP_PXP
     #include "../lv_gpu/lv_gpu_nxp_pxp.h"
@@ -23,7 +25,6 @@
 /*********************
  *      DEFINES
  *********************/
-#define GPU_SIZE_LIMIT      240
 
 /**********************
  *      TYPEDEFS
@@ -37,6 +38,11 @@ static void fill_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  con
                         lv_color_t color, lv_opa_t opa,
                         const lv_opa_t * mask, lv_draw_mask_res_t mask_res);
 
+LV_ATTRIBUTE_FAST_MEM static void fill_mono_page(const lv_area_t * disp_area, uint8_t * disp_buf,
+                                                 const lv_area_t * draw_area,
+                                                 lv_color_t color, lv_opa_t opa,
+                                                 const lv_opa_t * mask, lv_draw_mask_res_t mask_res);
+
 LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_color_t * disp_buf,
                                               const lv_area_t * draw_area,
                                               lv_color_t color, lv_opa_t opa,
@@ -52,6 +58,11 @@ static void map_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  cons
                        const lv_area_t * map_area, const lv_color_t * map_buf, lv_opa_t opa,
                        const lv_opa_t * mask, lv_draw_mask_res_t mask_res);
 
+LV_ATTRIBUTE_FAST_MEM static void map_mono_page(const lv_area_t * disp_area, uint8_t * disp_buf,
+                                                const lv_area_t * draw_area,
+                                                const lv_area_t * map_area, const lv_color_t * map_buf, lv_opa_t opa,
+                                                const lv_opa_t * mask, lv_draw_mask_res_t mask_res);
+
 LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_color_t * disp_buf,
                                              const lv_area_t * draw_area,
                                              const lv_area_t * map_area, const lv_color_t * map_buf, lv_opa_t opa,
@@ -135,6 +146,11 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill(const lv_area_t * clip_area, const lv_
     if(opa < LV_OPA_MIN) return;
     if(mask_res == LV_DRAW_MASK_RES_TRANSP) return;
 
+#if LV_USE_DRAW_BACKEND
+    /*Nothing should be blended while a native frame is drawn*/
+    if(_lv_draw_backend_blend()) return;
+#endif
+
     lv_disp_t * disp = _lv_refr_get_disp_refreshing();
     lv_disp_buf_t * vdb = lv_disp_get_buf(disp);
     const lv_area_t * disp_area = &vdb->area;
@@ -156,6 +172,8 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill(const lv_area_t * clip_area, const lv_
     draw_area.x2 -= disp_area->x1;
     draw_area.y2 -= disp_area->y1;
 
+    _LV_PROF_START(blend);
+
     /*Round the values in the mask if anti-aliasing is disabled*/
 #if LV_ANTIALIAS
     if(mask && disp->driver.antialiasing == 0)
@@ -168,7 +186,10 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill(const lv_area_t * clip_area, const lv_
         for(i = 0; i < mask_w; i++)  mask[i] = mask[i] > 128 ? LV_OPA_COVER : LV_OPA_TRANSP;
     }
 
-    if(disp->driver.set_px_cb) {
+    if(disp->driver.mono_page) {
+        fill_mono_page(disp_area, (uint8_t *)disp_buf, &draw_area, color, opa, mask, mask_res);
+    }
+    else if(disp->driver.set_px_cb) {
         fill_set_px(disp_area, disp_buf, &draw_area, color, opa, mask, mask_res);
     }
     else if(mode == LV_BLEND_MODE_NORMAL) {
@@ -179,6 +200,8 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill(const lv_area_t * clip_area, const lv_
         fill_blended(disp_area, disp_buf, &draw_area, color, opa, mask, mask_res, mode);
     }
 #endif
+
+    _LV_PROF_END(blend, LV_PROF_PHASE_BLEND);
 }
 
 /**
@@ -203,6 +226,10 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_a
     if(opa < LV_OPA_MIN) return;
     if(mask_res == LV_DRAW_MASK_RES_TRANSP) return;
 
+#if LV_USE_DRAW_BACKEND
+    if(_lv_draw_backend_blend()) return;
+#endif
+
     /* Get clipped fill area which is the real draw area.
      * It is always the same or inside `fill_area` */
     lv_area_t draw_area;
@@ -224,6 +251,8 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_a
     draw_area.x2 -= disp_area->x1;
     draw_area.y2 -= disp_area->y1;
 
+    _LV_PROF_START(blend);
+
     /*Round the values in the mask if anti-aliasing is disabled*/
 #if LV_ANTIALIAS
     if(mask && disp->driver.antialiasing == 0)
@@ -235,7 +264,10 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_a
         int32_t i;
         for(i = 0; i < mask_w; i++)  mask[i] = mask[i] > 128 ? LV_OPA_COVER : LV_OPA_TRANSP;
     }
-    if(disp->driver.set_px_cb) {
+    if(disp->driver.mono_page) {
+        map_mono_page(disp_area, (uint8_t *)disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res);
+    }
+    else if(disp->driver.set_px_cb) {
         map_set_px(disp_area, disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res);
     }
     else if(mode == LV_BLEND_MODE_NORMAL) {
@@ -246,6 +278,8 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_a
         map_blended(disp_area, disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res, mode);
     }
 #endif
+
+    _LV_PROF_END(blend, LV_PROF_PHASE_BLEND);
 }
 
 /**********************
@@ -293,6 +327,81 @@ static void fill_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  con
     }
 }
 
+/**
+ * Fill an area of a page packed monochrome buffer (see `lv_disp_drv_t.mono_page`)
+ * @param disp_area the current display area (destination area)
+ * @param disp_buf destination buffer
+ * @param draw_area fill this area (relative to `disp_area`)
+ * @param color fill color
+ * @param opa overall opacity in 0x00..0xff range. Pixels below `LV_OPA_50` are skipped.
+ * @param mask a mask to apply on every pixel (uint8_t array with 0x00..0xff values).
+ *                It fits into draw_area.
+ * @param mask_res LV_MASK_RES_COVER: the mask has only 0xff values (no mask),
+ *                 LV_MASK_RES_TRANSP: the mask has only 0x00 values (full transparent),
+ *                 LV_MASK_RES_CHANGED: the mask has mixed values
+ */
+LV_ATTRIBUTE_FAST_MEM static void fill_mono_page(const lv_area_t * disp_area, uint8_t * disp_buf,
+                                                 const lv_area_t * draw_area,
+                                                 lv_color_t color, lv_opa_t opa,
+                                                 const lv_opa_t * mask, lv_draw_mask_res_t mask_res)
+{
+    /*Get the width of the `disp_area` it will be used to go to the next page*/
+    int32_t disp_w = lv_area_get_width(disp_area);
+    int32_t draw_area_w = lv_area_get_width(draw_area);
+    bool dark = lv_color_to1(color) == 0;
+
+    int32_t page;
+    int32_t page_first = draw_area->y1 >> 3;
+    int32_t page_last = draw_area->y2 >> 3;
+    int32_t x;
+    int32_t y;
+
+    if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
+        if(opa < LV_OPA_50) return;
+
+        for(page = page_first; page <= page_last; page++) {
+            int32_t y_first = LV_MATH_MAX(draw_area->y1, page << 3);
+            int32_t y_last = LV_MATH_MIN(draw_area->y2, (page << 3) + 7);
+            uint8_t bits = (uint8_t)((0xFF << (y_first & 0x7)) & (0xFF >> (7 - (y_last & 0x7))));
+            uint8_t * buf_tmp = disp_buf + page * disp_w + draw_area->x1;
+
+            /*The whole page is covered: handle 8 rows with one byte write*/
+            if(bits == 0xFF) {
+                if(dark) _lv_memset_ff(buf_tmp, draw_area_w);
+                else _lv_memset_00(buf_tmp, draw_area_w);
+            }
+            else if(dark) {
+                for(x = 0; x < draw_area_w; x++) buf_tmp[x] |= bits;
+            }
+            else {
+                bits = ~bits;
+                for(x = 0; x < draw_area_w; x++) buf_tmp[x] &= bits;
+            }
+        }
+    }
+    else {
+        /*Collect the covered pixels of a column of a page into one byte and apply them at once*/
+        for(page = page_first; page <= page_last; page++) {
+            int32_t y_first = LV_MATH_MAX(draw_area->y1, page << 3);
+            int32_t y_last = LV_MATH_MIN(draw_area->y2, (page << 3) + 7);
+            uint8_t * buf_tmp = disp_buf + page * disp_w + draw_area->x1;
+            const lv_opa_t * mask_page = mask + (y_first - draw_area->y1) * draw_area_w;
+
+            for(x = 0; x < draw_area_w; x++) {
+                uint8_t bits = 0;
+                const lv_opa_t * mask_tmp = mask_page + x;
+                for(y = y_first; y <= y_last; y++) {
+                    if(*mask_tmp && (((uint32_t)opa * *mask_tmp) >> 8) >= LV_OPA_50) bits |= 1 << (y & 0x7);
+                    mask_tmp += draw_area_w;
+                }
+
+                if(dark) buf_tmp[x] |= bits;
+                else buf_tmp[x] &= ~bits;
+            }
+        }
+    }
+}
+
 /**
  * Fill an area with a color
  * @param disp_area the current display area (destination area)
@@ -349,7 +458,7 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
                 return;
             }
 #elif LV_USE_GPU
-            if(disp->driver.gpu_fill_cb && lv_area_get_size(draw_area) > GPU_SIZE_LIMIT) {
+            if(disp->driver.gpu_fill_cb && lv_area_get_size(draw_area) > LV_GPU_SIZE_LIMIT) {
                 disp->driver.gpu_fill_cb(&disp->driver, disp_buf, disp_w, draw_area, color);
                 return;
             }
@@ -376,7 +485,7 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
                 /* Fall down to SW render in case of error */
             }
 #elif LV_USE_GPU
-            if(disp->driver.gpu_blend_cb && lv_area_get_size(draw_area) > GPU_SIZE_LIMIT) {
+            if(disp->driver.gpu_blend_cb && lv_area_get_size(draw_area) > LV_GPU_SIZE_LIMIT) {
                 for(x = 0; x < draw_area_w ; x++) blend_buf[x].full = color.full;
 
                 for(y = draw_area->y1; y <= draw_area->y2; y++) {
@@ -692,6 +801,75 @@ static void map_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  cons
     }
 }
 
+/**
+ * Copy an image to an area of a page packed monochrome buffer (see `lv_disp_drv_t.mono_page`)
+ * @param disp_area the current display area (destination area)
+ * @param disp_buf destination buffer
+ * @param draw_area fill this area (relative to `disp_area`)
+ * @param map_area coordinates of the map (image) to copy. (absolute coordinates)
+ * @param map_buf the pixel of the image
+ * @param opa overall opacity in 0x00..0xff range. Pixels below `LV_OPA_50` are skipped.
+ * @param mask a mask to apply on every pixel (uint8_t array with 0x00..0xff values).
+ *                It fits into draw_area.
+ * @param mask_res LV_MASK_RES_COVER: the mask has only 0xff values (no mask),
+ *                 LV_MASK_RES_TRANSP: the mask has only 0x00 values (full transparent),
+ *                 LV_MASK_RES_CHANGED: the mask has mixed values
+ */
+LV_ATTRIBUTE_FAST_MEM static void map_mono_page(const lv_area_t * disp_area, uint8_t * disp_buf,
+                                                const lv_area_t * draw_area,
+                                                const lv_area_t * map_area, const lv_color_t * map_buf, lv_opa_t opa,
+                                                const lv_opa_t * mask, lv_draw_mask_res_t mask_res)
+{
+    /*Get the width of the `disp_area` it will be used to go to the next page*/
+    int32_t disp_w = lv_area_get_width(disp_area);
+    int32_t draw_area_w = lv_area_get_width(draw_area);
+    int32_t map_w = lv_area_get_width(map_area);
+
+    /*`map_buf` pointing to the pixel of the map at the top left corner of `draw_area`*/
+    map_buf += map_w * (draw_area->y1 - (map_area->y1 - disp_area->y1));
+    map_buf += draw_area->x1 - (map_area->x1 - disp_area->x1);
+
+    if(mask_res == LV_DRAW_MASK_RES_FULL_COVER && opa < LV_OPA_50) return;
+
+    int32_t page;
+    int32_t page_first = draw_area->y1 >> 3;
+    int32_t page_last = draw_area->y2 >> 3;
+    int32_t x;
+    int32_t y;
+
+    for(page = page_first; page <= page_last; page++) {
+        int32_t y_first = LV_MATH_MAX(draw_area->y1, page << 3);
+        int32_t y_last = LV_MATH_MIN(draw_area->y2, (page << 3) + 7);
+        uint8_t * buf_tmp = disp_buf + page * disp_w + draw_area->x1;
+        const lv_color_t * map_page = map_buf + (y_first - draw_area->y1) * map_w;
+        const lv_opa_t * mask_page = NULL;
+        if(mask_res != LV_DRAW_MASK_RES_FULL_COVER) mask_page = mask + (y_first - draw_area->y1) * draw_area_w;
+
+        for(x = 0; x < draw_area_w; x++) {
+            /*Collect the pixels of a column of a page to set and clear them at once*/
+            uint8_t set = 0;
+            uint8_t clr = 0;
+            const lv_color_t * map_tmp = map_page + x;
+            const lv_opa_t * mask_tmp = mask_page ? mask_page + x : NULL;
+            for(y = y_first; y <= y_last; y++) {
+                bool cover = true;
+                if(mask_tmp) {
+                    cover = *mask_tmp && (((uint32_t)opa * *mask_tmp) >> 8) >= LV_OPA_50;
+                    mask_tmp += draw_area_w;
+                }
+
+                if(cover) {
+                    if(lv_color_to1(*map_tmp) == 0) set |= 1 << (y & 0x7);
+                    else clr |= 1 << (y & 0x7);
+                }
+                map_tmp += map_w;
+            }
+
+            buf_tmp[x] = (buf_tmp[x] & ~clr) | set;
+        }
+    }
+}
+
 /**
  * Copy an image to an area
  * @param disp_area the current display area (destination area)
@@ -737,7 +915,7 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
     /*Simple fill (maybe with opacity), no masking*/
     if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
 #if LV_USE_GPU
-        if(disp->driver.gpu_blend_cb && (lv_area_get_size(draw_area) > GPU_SIZE_LIMIT)) {
+        if(disp->driver.gpu_blend_cb && (lv_area_get_size(draw_area) > LV_GPU_SIZE_LIMIT)) {
             for(y = draw_area->y1; y <= draw_area->y2; y++) {
                 disp->driver.gpu_blend_cb(&disp->driver, disp_buf_first, map_buf_first, draw_area_w, opa);
                 disp_buf_first += disp_w;
@@ -20,6 +20,8 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+/*Use `gpu_fill_cb` and `gpu_blend_cb` only for areas larger than this (in pixels)*/
+#define LV_GPU_SIZE_LIMIT   240
 
 /**********************
  *      TYPEDEFS
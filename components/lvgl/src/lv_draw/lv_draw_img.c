@@ -8,6 +8,8 @@
  *********************/
 #include "lv_draw_img.h"
 #include "lv_img_cache.h"
+#include "lv_draw_backend.h"
+#include "lv_draw_blend.h"
 #include "../lv_hal/lv_hal_disp.h"
 #include "../lv_misc/lv_log.h"
 #include "../lv_core/lv_refr.h"
@@ -22,6 +24,12 @@
 /*********************
  *      DEFINES
  *********************/
+/*The hardware blitters are hooked into `map_normal` so let them handle the plain copies*/
+#if LV_USE_GPU_NXP_PXP || LV_USE_GPU_NXP_VG_LITE || LV_USE_GPU_STM32_DMA2D
+    #define LV_IMG_BLIT_DIRECT  0
+#else
+    #define LV_IMG_BLIT_DIRECT  1
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -39,6 +47,19 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
                                               const lv_draw_img_dsc_t * draw_dsc,
                                               bool chroma_key, bool alpha_byte);
 
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+static lv_res_t lv_draw_map_cached(const lv_area_t * coords, const lv_area_t * clip_area, lv_img_cache_entry_t * cdsc,
+                                   const lv_draw_img_dsc_t * draw_dsc);
+#endif
+LV_ATTRIBUTE_FAST_MEM static bool lv_img_can_blit(const lv_img_decoder_dsc_t * dec_dsc,
+                                                  const lv_draw_img_dsc_t * draw_dsc);
+#if LV_IMG_BLIT_DIRECT
+LV_ATTRIBUTE_FAST_MEM static void lv_draw_map_blit(const lv_area_t * map_area, const lv_area_t * clip_area,
+                                                   const uint8_t * map_p);
+#endif
+LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_draw_lines_blit(lv_img_decoder_dsc_t * dec_dsc, const lv_area_t * coords,
+                                                         const lv_area_t * clip_area);
+
 static void show_error(const lv_area_t * coords, const lv_area_t * clip_area, const char * msg);
 static void draw_cleanup(lv_img_cache_entry_t * cache);
 
@@ -81,6 +102,10 @@ void lv_draw_img(const lv_area_t * coords, const lv_area_t * mask, const void *
 
     if(dsc->opa <= LV_OPA_MIN) return;
 
+#if LV_USE_DRAW_BACKEND
+    if(_lv_draw_backend_img(coords, mask, src, dsc)) return;
+#endif
+
     lv_res_t res;
     res = lv_img_draw_core(coords, mask, src, dsc);
 
@@ -251,6 +276,15 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
     /* The decoder could open the image and gave the entire uncompressed image.
      * Just draw it!*/
     else if(cdsc->dec_dsc.img_data) {
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+        /*Draw the already transformed image from the cache if possible*/
+        if(draw_dsc->angle || draw_dsc->zoom != LV_IMG_ZOOM_NONE) {
+            if(lv_draw_map_cached(coords, clip_area, cdsc, draw_dsc) == LV_RES_OK) {
+                draw_cleanup(cdsc);
+                return LV_RES_OK;
+            }
+        }
+#endif
         lv_area_t map_area_rot;
         lv_area_copy(&map_area_rot, coords);
         if(draw_dsc->angle || draw_dsc->zoom != LV_IMG_ZOOM_NONE) {
@@ -274,7 +308,26 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
             return LV_RES_OK;
         }
 
-        lv_draw_map(coords, &mask_com, cdsc->dec_dsc.img_data, draw_dsc, chroma_keyed, alpha_byte);
+#if LV_IMG_BLIT_DIRECT
+        if(lv_img_can_blit(&cdsc->dec_dsc, draw_dsc)) {
+            lv_draw_map_blit(coords, &mask_com, cdsc->dec_dsc.img_data);
+        }
+        else
+#endif
+        {
+            lv_draw_map(coords, &mask_com, cdsc->dec_dsc.img_data, draw_dsc, chroma_keyed, alpha_byte);
+        }
+    }
+    /* Opaque true color image from the built-in decoder: read the lines directly into the display buffer*/
+    else if(lv_img_can_blit(&cdsc->dec_dsc, draw_dsc) &&
+            cdsc->dec_dsc.decoder->read_line_cb == lv_img_decoder_built_in_read_line) {
+        lv_res_t res = lv_draw_lines_blit(&cdsc->dec_dsc, coords, clip_area);
+        if(res != LV_RES_OK) {
+            lv_img_decoder_close(&cdsc->dec_dsc);
+            LV_LOG_WARN("Image draw can't read the line");
+            draw_cleanup(cdsc);
+            return LV_RES_INV;
+        }
     }
     /* The whole uncompressed image is not available. Try to read it line-by-line*/
     else {
@@ -639,6 +692,160 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
     }
 }
 
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+/**
+ * Draw a rotated/zoomed image using the transformation cache
+ * @param coords the coordinates of the image
+ * @param clip_area the image will be drawn only on this area
+ * @param cdsc the opened image
+ * @param draw_dsc pointer to an initialized `lv_draw_img_dsc_t` variable
+ * @return LV_RES_OK: the image is drawn; LV_RES_INV: the image couldn't be cached, draw it in the normal way
+ */
+static lv_res_t lv_draw_map_cached(const lv_area_t * coords, const lv_area_t * clip_area, lv_img_cache_entry_t * cdsc,
+                                   const lv_draw_img_dsc_t * draw_dsc)
+{
+    int16_t angle = _lv_img_cache_round_angle(draw_dsc->angle);
+
+    lv_area_t map_area;
+    const uint8_t * map_p = _lv_img_cache_get_transformed(cdsc, lv_area_get_width(coords), lv_area_get_height(coords),
+                                                          angle, draw_dsc->zoom, &draw_dsc->pivot, draw_dsc->antialias,
+                                                          &map_area);
+    if(map_p == NULL) return LV_RES_INV;
+
+    map_area.x1 += coords->x1;
+    map_area.y1 += coords->y1;
+    map_area.x2 += coords->x1;
+    map_area.y2 += coords->y1;
+
+    lv_area_t mask_com;
+    if(_lv_area_intersect(&mask_com, clip_area, &map_area)) {
+        /*The cached pixels are already transformed so draw them as a plain ARGB image*/
+        lv_draw_img_dsc_t map_dsc;
+        _lv_memcpy_small(&map_dsc, draw_dsc, sizeof(lv_draw_img_dsc_t));
+        map_dsc.angle = 0;
+        map_dsc.zoom = LV_IMG_ZOOM_NONE;
+        lv_draw_map(&map_area, &mask_com, map_p, &map_dsc, false, true);
+    }
+
+    return LV_RES_OK;
+}
+#endif
+
+/**
+ * Tell whether an image can be copied into the display buffer without any per pixel processing.
+ * It requires an opaque, not transformed true color image, no masks and no special pixel setter.
+ * @param dec_dsc the decoder descriptor of the opened image
+ * @param draw_dsc pointer to an initialized `lv_draw_img_dsc_t` variable
+ * @return true: the pixels can be simply copied
+ */
+LV_ATTRIBUTE_FAST_MEM static bool lv_img_can_blit(const lv_img_decoder_dsc_t * dec_dsc,
+                                                  const lv_draw_img_dsc_t * draw_dsc)
+{
+    if(dec_dsc->header.cf != LV_IMG_CF_TRUE_COLOR) return false;
+    if(draw_dsc->angle != 0 || draw_dsc->zoom != LV_IMG_ZOOM_NONE) return false;
+    if(draw_dsc->opa < LV_OPA_MAX || draw_dsc->recolor_opa != LV_OPA_TRANSP) return false;
+    if(draw_dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+    if(lv_draw_mask_get_cnt() != 0) return false;
+
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp->driver.set_px_cb || disp->driver.mono_page) return false;
+
+    return true;
+}
+
+#if LV_IMG_BLIT_DIRECT
+/**
+ * Copy the rows of an opaque true color map straight into the display buffer
+ * @param map_area coordinates of the map
+ * @param clip_area the map will drawn only on this area (already clipped to the map)
+ * @param map_p pointer to a lv_color_t array
+ */
+LV_ATTRIBUTE_FAST_MEM static void lv_draw_map_blit(const lv_area_t * map_area, const lv_area_t * clip_area,
+                                                   const uint8_t * map_p)
+{
+    lv_disp_t * disp    = _lv_refr_get_disp_refreshing();
+    lv_disp_buf_t * vdb = lv_disp_get_buf(disp);
+    const lv_area_t * disp_area = &vdb->area;
+
+    lv_area_t draw_area;
+    if(_lv_area_intersect(&draw_area, clip_area, disp_area) == false) return;
+
+    if(disp->driver.gpu_wait_cb) disp->driver.gpu_wait_cb(&disp->driver);
+
+    int32_t disp_w = lv_area_get_width(disp_area);
+    int32_t map_w = lv_area_get_width(map_area);
+    int32_t draw_area_w = lv_area_get_width(&draw_area);
+    int32_t draw_area_h = lv_area_get_height(&draw_area);
+
+    lv_color_t * disp_buf_first = vdb->buf_act;
+    disp_buf_first += disp_w * (draw_area.y1 - disp_area->y1) + (draw_area.x1 - disp_area->x1);
+
+    const lv_color_t * map_buf_first = (const lv_color_t *)map_p;
+    map_buf_first += map_w * (draw_area.y1 - map_area->y1) + (draw_area.x1 - map_area->x1);
+
+    int32_t y;
+#if LV_USE_GPU
+    if(disp->driver.gpu_blend_cb && lv_area_get_size(&draw_area) > LV_GPU_SIZE_LIMIT) {
+        for(y = 0; y < draw_area_h; y++) {
+            disp->driver.gpu_blend_cb(&disp->driver, disp_buf_first, map_buf_first, draw_area_w, LV_OPA_COVER);
+            disp_buf_first += disp_w;
+            map_buf_first += map_w;
+        }
+        return;
+    }
+#endif
+
+    /*The whole rows are continuous if both the map and the display buffer are fully covered*/
+    if(draw_area_w == disp_w && draw_area_w == map_w) {
+        _lv_memcpy(disp_buf_first, map_buf_first, draw_area_w * draw_area_h * sizeof(lv_color_t));
+        return;
+    }
+
+    for(y = 0; y < draw_area_h; y++) {
+        _lv_memcpy(disp_buf_first, map_buf_first, draw_area_w * sizeof(lv_color_t));
+        disp_buf_first += disp_w;
+        map_buf_first += map_w;
+    }
+}
+#endif
+
+/**
+ * Read the lines of an opaque true color image directly into the display buffer.
+ * No temporary line buffer and no blending is required.
+ * @param dec_dsc the decoder descriptor of the opened image
+ * @param coords the coordinates of the image
+ * @param clip_area the image will be drawn only on this area
+ * @return LV_RES_OK: the image is drawn; LV_RES_INV: a line couldn't be read
+ */
+LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_draw_lines_blit(lv_img_decoder_dsc_t * dec_dsc, const lv_area_t * coords,
+                                                         const lv_area_t * clip_area)
+{
+    lv_disp_t * disp    = _lv_refr_get_disp_refreshing();
+    lv_disp_buf_t * vdb = lv_disp_get_buf(disp);
+    const lv_area_t * disp_area = &vdb->area;
+
+    lv_area_t draw_area;
+    if(_lv_area_intersect(&draw_area, clip_area, coords) == false) return LV_RES_OK;
+    if(_lv_area_intersect(&draw_area, &draw_area, disp_area) == false) return LV_RES_OK;
+
+    if(disp->driver.gpu_wait_cb) disp->driver.gpu_wait_cb(&disp->driver);
+
+    int32_t disp_w = lv_area_get_width(disp_area);
+    lv_coord_t width = lv_area_get_width(&draw_area);
+    lv_color_t * disp_buf_first = vdb->buf_act;
+    disp_buf_first += disp_w * (draw_area.y1 - disp_area->y1) + (draw_area.x1 - disp_area->x1);
+
+    lv_coord_t x = draw_area.x1 - coords->x1;
+    lv_coord_t y;
+    for(y = draw_area.y1 - coords->y1; y <= draw_area.y2 - coords->y1; y++) {
+        lv_res_t res = lv_img_decoder_read_line(dec_dsc, x, y, width, (uint8_t *)disp_buf_first);
+        if(res != LV_RES_OK) return res;
+        disp_buf_first += disp_w;
+    }
+
+    return LV_RES_OK;
+}
+
 static void show_error(const lv_area_t * coords, const lv_area_t * clip_area, const char * msg)
 {
     lv_draw_rect_dsc_t rect_dsc;
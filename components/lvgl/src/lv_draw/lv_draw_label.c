@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_label.h"
+#include "lv_draw_backend.h"
 #include "../lv_misc/lv_math.h"
 #include "../lv_hal/lv_hal_disp.h"
 #include "../lv_core/lv_refr.h"
@@ -408,6 +409,16 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_letter(const lv_point_t * pos_p, const
         return;
     }
 
+#if LV_USE_DRAW_BACKEND
+    /*The letters of a native frame are drawn by the backend. Other blend modes need the software renderer.*/
+    if(blend_mode == LV_BLEND_MODE_NORMAL) {
+        if(_lv_draw_backend_letter(pos_p, clip_area, font_p, letter, color, opa)) return;
+    }
+    else if(_lv_draw_backend_blend()) {
+        return;
+    }
+#endif
+
     lv_font_glyph_dsc_t g;
     bool g_ret = lv_font_get_glyph_dsc(font_p, &g, letter, '\0');
     if(g_ret == false)  {
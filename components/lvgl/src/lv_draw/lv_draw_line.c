@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #include "lv_draw_mask.h"
 #include "lv_draw_blend.h"
+#include "lv_draw_backend.h"
 #include "../lv_core/lv_refr.h"
 #include "../lv_misc/lv_math.h"
 
@@ -69,6 +70,10 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_line(const lv_point_t * point1, const lv_poin
 
     if(point1->x == point2->x && point1->y == point2->y) return;
 
+#if LV_USE_DRAW_BACKEND
+    if(_lv_draw_backend_line(point1, point2, clip, dsc)) return;
+#endif
+
     lv_area_t clip_line;
     clip_line.x1 = LV_MATH_MIN(point1->x, point2->x) - dsc->width / 2;
     clip_line.x2 = LV_MATH_MAX(point1->x, point2->x) + dsc->width / 2;
@@ -9,6 +9,7 @@
 #include "lv_draw_rect.h"
 #include "lv_draw_blend.h"
 #include "lv_draw_mask.h"
+#include "lv_draw_backend.h"
 #include "../lv_misc/lv_math.h"
 #include "../lv_misc/lv_txt_ap.h"
 #include "../lv_core/lv_refr.h"
@@ -103,6 +104,9 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_rect_dsc_init(lv_draw_rect_dsc_t * dsc)
 void lv_draw_rect(const lv_area_t * coords, const lv_area_t * clip, const lv_draw_rect_dsc_t * dsc)
 {
     if(lv_area_get_height(coords) < 1 || lv_area_get_width(coords) < 1) return;
+#if LV_USE_DRAW_BACKEND
+    if(_lv_draw_backend_rect(coords, clip, dsc)) return;
+#endif
 #if LV_USE_SHADOW
     draw_shadow(coords, clip, dsc);
 #endif
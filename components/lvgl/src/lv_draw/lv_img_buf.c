@@ -10,6 +10,7 @@
 #include <string.h>
 #include "lv_img_buf.h"
 #include "lv_draw_img.h"
+#include "lv_img_cache.h"
 #include "../lv_misc/lv_math.h"
 #include "../lv_misc/lv_log.h"
 #include "../lv_misc/lv_mem.h"
@@ -25,6 +26,8 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void get_transformed_area(lv_area_t * res, lv_coord_t w, lv_coord_t h, int16_t angle, uint16_t zoom,
+                                 const lv_point_t * pivot);
 
 /**********************
  *  STATIC VARIABLES
@@ -474,86 +477,20 @@ void _lv_img_buf_transform_init(lv_img_transform_dsc_t * dsc)
 void _lv_img_buf_get_transformed_area(lv_area_t * res, lv_coord_t w, lv_coord_t h, int16_t angle, uint16_t zoom,
                                       const lv_point_t * pivot)
 {
-#if LV_USE_IMG_TRANSFORM
-    if(angle == 0 && zoom == LV_IMG_ZOOM_NONE) {
-        res->x1 = 0;
-        res->y1 = 0;
-        res->x2 = w - 1;
-        res->y2 = h - 1;
-        return;
-    }
-
-    res->x1 = (((-pivot->x) * zoom) >> 8) - 1;
-    res->y1 = (((-pivot->y) * zoom) >> 8) - 1;
-    res->x2 = (((w - pivot->x) * zoom) >> 8) + 2;
-    res->y2 = (((h - pivot->y) * zoom) >> 8) + 2;
-
-    if(angle == 0) {
-        res->x1 += pivot->x;
-        res->y1 += pivot->y;
-        res->x2 += pivot->x;
-        res->y2 += pivot->y;
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE && LV_IMG_TRANSFORM_CACHE_ANGLE_STEP > 1
+    /*The image is drawn with the rounded angle from the transformation cache,
+     *or with the exact angle if it can't be cached. Include both.*/
+    int16_t angle_round = _lv_img_cache_round_angle(angle);
+    if(angle_round != angle) {
+        lv_area_t res_round;
+        get_transformed_area(&res_round, w, h, angle_round, zoom, pivot);
+        get_transformed_area(res, w, h, angle, zoom, pivot);
+        _lv_area_join(res, res, &res_round);
         return;
     }
-
-    int32_t angle_low = angle / 10;
-    int32_t angle_high = angle_low + 1;
-    int32_t angle_rem = angle  - (angle_low * 10);
-
-    int32_t s1 = _lv_trigo_sin(angle_low);
-    int32_t s2 = _lv_trigo_sin(angle_high);
-
-    int32_t c1 = _lv_trigo_sin(angle_low + 90);
-    int32_t c2 = _lv_trigo_sin(angle_high + 90);
-
-    int32_t sinma = (s1 * (10 - angle_rem) + s2 * angle_rem) / 10;
-    int32_t cosma = (c1 * (10 - angle_rem) + c2 * angle_rem) / 10;
-
-    /*Use smaller value to avoid overflow*/
-    sinma = sinma >> (LV_TRIGO_SHIFT - _LV_TRANSFORM_TRIGO_SHIFT);
-    cosma = cosma >> (LV_TRIGO_SHIFT - _LV_TRANSFORM_TRIGO_SHIFT);
-
-    lv_point_t lt;
-    lv_point_t rt;
-    lv_point_t lb;
-    lv_point_t rb;
-
-    lv_coord_t xt;
-    lv_coord_t yt;
-
-    xt = res->x1;
-    yt = res->y1;
-    lt.x = ((cosma * xt - sinma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->x;
-    lt.y = ((sinma * xt + cosma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->y;
-
-    xt = res->x2;
-    yt = res->y1;
-    rt.x = ((cosma * xt - sinma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->x;
-    rt.y = ((sinma * xt + cosma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->y;
-
-    xt = res->x1;
-    yt = res->y2;
-    lb.x = ((cosma * xt - sinma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->x;
-    lb.y = ((sinma * xt + cosma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->y;
-
-    xt = res->x2;
-    yt = res->y2;
-    rb.x = ((cosma * xt - sinma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->x;
-    rb.y = ((sinma * xt + cosma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->y;
-
-    res->x1 = LV_MATH_MIN4(lb.x, lt.x, rb.x, rt.x);
-    res->x2 = LV_MATH_MAX4(lb.x, lt.x, rb.x, rt.x);
-    res->y1 = LV_MATH_MIN4(lb.y, lt.y, rb.y, rt.y);
-    res->y2 = LV_MATH_MAX4(lb.y, lt.y, rb.y, rt.y);
-#else
-    LV_UNUSED(angle);
-    LV_UNUSED(zoom);
-    LV_UNUSED(pivot);
-    res->x1 = 0;
-    res->y1 = 0;
-    res->x2 = w - 1;
-    res->y2 = h - 1;
 #endif
+
+    get_transformed_area(res, w, h, angle, zoom, pivot);
 }
 
 #if LV_USE_IMG_TRANSFORM
@@ -680,3 +617,97 @@ bool _lv_img_buf_transform_anti_alias(lv_img_transform_dsc_t * dsc)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Get the area of a rectangle if its rotated and scaled with the exact angle
+ * @param res store the coordinates here
+ * @param w width of the rectangle to transform
+ * @param h height of the rectangle to transform
+ * @param angle angle of rotation
+ * @param zoom zoom, (256 no zoom)
+ * @param pivot x,y pivot coordinates of rotation
+ */
+static void get_transformed_area(lv_area_t * res, lv_coord_t w, lv_coord_t h, int16_t angle, uint16_t zoom,
+                                 const lv_point_t * pivot)
+{
+#if LV_USE_IMG_TRANSFORM
+    if(angle == 0 && zoom == LV_IMG_ZOOM_NONE) {
+        res->x1 = 0;
+        res->y1 = 0;
+        res->x2 = w - 1;
+        res->y2 = h - 1;
+        return;
+    }
+
+    res->x1 = (((-pivot->x) * zoom) >> 8) - 1;
+    res->y1 = (((-pivot->y) * zoom) >> 8) - 1;
+    res->x2 = (((w - pivot->x) * zoom) >> 8) + 2;
+    res->y2 = (((h - pivot->y) * zoom) >> 8) + 2;
+
+    if(angle == 0) {
+        res->x1 += pivot->x;
+        res->y1 += pivot->y;
+        res->x2 += pivot->x;
+        res->y2 += pivot->y;
+        return;
+    }
+
+    int32_t angle_low = angle / 10;
+    int32_t angle_high = angle_low + 1;
+    int32_t angle_rem = angle  - (angle_low * 10);
+
+    int32_t s1 = _lv_trigo_sin(angle_low);
+    int32_t s2 = _lv_trigo_sin(angle_high);
+
+    int32_t c1 = _lv_trigo_sin(angle_low + 90);
+    int32_t c2 = _lv_trigo_sin(angle_high + 90);
+
+    int32_t sinma = (s1 * (10 - angle_rem) + s2 * angle_rem) / 10;
+    int32_t cosma = (c1 * (10 - angle_rem) + c2 * angle_rem) / 10;
+
+    /*Use smaller value to avoid overflow*/
+    sinma = sinma >> (LV_TRIGO_SHIFT - _LV_TRANSFORM_TRIGO_SHIFT);
+    cosma = cosma >> (LV_TRIGO_SHIFT - _LV_TRANSFORM_TRIGO_SHIFT);
+
+    lv_point_t lt;
+    lv_point_t rt;
+    lv_point_t lb;
+    lv_point_t rb;
+
+    lv_coord_t xt;
+    lv_coord_t yt;
+
+    xt = res->x1;
+    yt = res->y1;
+    lt.x = ((cosma * xt - sinma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->x;
+    lt.y = ((sinma * xt + cosma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->y;
+
+    xt = res->x2;
+    yt = res->y1;
+    rt.x = ((cosma * xt - sinma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->x;
+    rt.y = ((sinma * xt + cosma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->y;
+
+    xt = res->x1;
+    yt = res->y2;
+    lb.x = ((cosma * xt - sinma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->x;
+    lb.y = ((sinma * xt + cosma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->y;
+
+    xt = res->x2;
+    yt = res->y2;
+    rb.x = ((cosma * xt - sinma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->x;
+    rb.y = ((sinma * xt + cosma * yt) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->y;
+
+    res->x1 = LV_MATH_MIN4(lb.x, lt.x, rb.x, rt.x);
+    res->x2 = LV_MATH_MAX4(lb.x, lt.x, rb.x, rt.x);
+    res->y1 = LV_MATH_MIN4(lb.y, lt.y, rb.y, rt.y);
+    res->y2 = LV_MATH_MAX4(lb.y, lt.y, rb.y, rt.y);
+#else
+    LV_UNUSED(angle);
+    LV_UNUSED(zoom);
+    LV_UNUSED(pivot);
+    res->x1 = 0;
+    res->y1 = 0;
+    res->x2 = w - 1;
+    res->y2 = h - 1;
+#endif
+}
@@ -12,6 +12,7 @@
 #include "lv_draw_img.h"
 #include "../lv_hal/lv_hal_tick.h"
 #include "../lv_misc/lv_gc.h"
+#include "../lv_misc/lv_prof.h"
 
 /*********************
  *      DEFINES
@@ -33,10 +34,16 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-#if LV_IMG_CACHE_DEF_SIZE
+#if LV_IMG_CACHE_DEF_SIZE || (LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE)
 static bool lv_img_cache_match(const void * src1, const void * src2);
 #endif
 
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+static void lv_img_transform_cache_drop(lv_img_transform_cache_entry_t * entry);
+static void lv_img_transform_cache_render(lv_img_transform_cache_entry_t * entry, const uint8_t * src_data,
+                                          lv_img_cf_t src_cf);
+#endif
+
 #if LV_IMG_CACHE_DEF_SIZE == 0
     static lv_img_cache_entry_t cache_temp;
 #endif
@@ -48,6 +55,10 @@ static bool lv_img_cache_match(const void * src1, const void * src2);
     static uint16_t entry_cnt;
 #endif
 
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+    static uint32_t transform_cache_used;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -100,7 +111,12 @@ lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color)
     }
 
     /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
+    if(cached_src) {
+        _LV_PROF_COUNT(LV_PROF_CNT_IMG_CACHE_HIT, 1);
+        return cached_src;
+    }
+
+    _LV_PROF_COUNT(LV_PROF_CNT_IMG_CACHE_MISS, 1);
 
     /*Find an entry to reuse. Select the entry with the least life*/
     cached_src = &cache[0];
@@ -178,6 +194,9 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
+ * The cached transformed versions of the image are dropped too.
+ * Variable images are found by the address of their descriptor so it needs to be called
+ * if their pixels are modified in place (canvases do it automatically).
  * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
  */
 void lv_img_cache_invalidate_src(const void * src)
@@ -196,6 +215,141 @@ void lv_img_cache_invalidate_src(const void * src)
         }
     }
 #endif
+
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+    lv_img_transform_cache_entry_t * t_entry = _lv_ll_get_head(&LV_GC_ROOT(_lv_img_transform_cache_ll));
+    while(t_entry) {
+        lv_img_transform_cache_entry_t * t_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_img_transform_cache_ll), t_entry);
+        if(src == NULL || lv_img_cache_match(src, t_entry->src)) {
+            lv_img_transform_cache_drop(t_entry);
+        }
+        t_entry = t_next;
+    }
+#endif
+}
+
+/**
+ * Get the rotated and/or zoomed version of an opened image from the transformation cache.
+ * If it's not cached yet the image is transformed and the result is cached.
+ * The least recently used entries are dropped to keep the cache under `LV_IMG_TRANSFORM_CACHE_SIZE` bytes.
+ * @param entry an image opened with `_lv_img_cache_open`. Its entire decoded data (`img_data`) should be available.
+ * @param w width of the image
+ * @param h height of the image
+ * @param angle rotation angle [0.1 degree]
+ * @param zoom zoom (256: no zoom)
+ * @param pivot pivot of the transformation
+ * @param antialias true: anti-alias the transformation
+ * @param area store the transformed area here (relative to the top left corner of the original image)
+ * @return the transformed pixels in `LV_IMG_CF_TRUE_COLOR_ALPHA` format or NULL if the image can't be cached
+ */
+const uint8_t * _lv_img_cache_get_transformed(lv_img_cache_entry_t * entry, lv_coord_t w, lv_coord_t h,
+                                              int16_t angle, uint16_t zoom, const lv_point_t * pivot, bool antialias,
+                                              lv_area_t * area)
+{
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+    const lv_img_decoder_dsc_t * dec_dsc = &entry->dec_dsc;
+    if(dec_dsc->img_data == NULL) return NULL;
+
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_img_transform_cache_ll);
+    lv_img_transform_cache_entry_t * t_entry;
+    _LV_LL_READ(*ll, t_entry) {
+        if(t_entry->angle == angle && t_entry->zoom == zoom &&
+           t_entry->pivot.x == pivot->x && t_entry->pivot.y == pivot->y &&
+           t_entry->antialias == (antialias ? 1 : 0) &&
+           t_entry->w == w && t_entry->h == h &&
+           t_entry->color.full == dec_dsc->color.full &&
+           lv_img_cache_match(dec_dsc->src, t_entry->src)) {
+            /*Keep the most recently used entries at the head*/
+            _lv_ll_move_before(ll, t_entry, _lv_ll_get_head(ll));
+            lv_area_copy(area, &t_entry->area);
+            return t_entry->buf;
+        }
+    }
+
+    lv_area_t t_area;
+    _lv_img_buf_get_transformed_area(&t_area, w, h, angle, zoom, pivot);
+    uint32_t buf_size = lv_area_get_size(&t_area) * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    if(buf_size > LV_IMG_TRANSFORM_CACHE_SIZE) return NULL;
+
+    /*Drop the least recently used entries to make room for the new one*/
+    while(transform_cache_used + buf_size > LV_IMG_TRANSFORM_CACHE_SIZE) {
+        lv_img_transform_cache_entry_t * t_tail = _lv_ll_get_tail(ll);
+        if(t_tail == NULL) break;
+        lv_img_transform_cache_drop(t_tail);
+    }
+
+    t_entry = _lv_ll_ins_head(ll);
+    LV_ASSERT_MEM(t_entry);
+    if(t_entry == NULL) return NULL;
+    _lv_memset_00(t_entry, sizeof(lv_img_transform_cache_entry_t));
+
+    t_entry->buf = lv_mem_alloc(buf_size);
+    if(t_entry->buf == NULL) {
+        LV_LOG_WARN("_lv_img_cache_get_transformed: out of memory");
+        _lv_ll_remove(ll, t_entry);
+        lv_mem_free(t_entry);
+        return NULL;
+    }
+
+    /*Save the file path because the source might be freed in the meantime*/
+    if(lv_img_src_get_type(dec_dsc->src) == LV_IMG_SRC_FILE) {
+        size_t fn_len = strlen(dec_dsc->src);
+        char * fn = lv_mem_alloc(fn_len + 1);
+        LV_ASSERT_MEM(fn);
+        if(fn == NULL) {
+            lv_mem_free(t_entry->buf);
+            _lv_ll_remove(ll, t_entry);
+            lv_mem_free(t_entry);
+            return NULL;
+        }
+        strcpy(fn, dec_dsc->src);
+        t_entry->src = fn;
+    }
+    else {
+        t_entry->src = dec_dsc->src;
+    }
+
+    t_entry->color = dec_dsc->color;
+    t_entry->w = w;
+    t_entry->h = h;
+    t_entry->pivot = *pivot;
+    t_entry->angle = angle;
+    t_entry->zoom = zoom;
+    t_entry->antialias = antialias ? 1 : 0;
+    t_entry->area = t_area;
+    t_entry->buf_size = buf_size;
+    transform_cache_used += buf_size;
+
+    lv_img_transform_cache_render(t_entry, dec_dsc->img_data, dec_dsc->header.cf);
+
+    lv_area_copy(area, &t_entry->area);
+    return t_entry->buf;
+#else
+    LV_UNUSED(entry);
+    LV_UNUSED(w);
+    LV_UNUSED(h);
+    LV_UNUSED(angle);
+    LV_UNUSED(zoom);
+    LV_UNUSED(pivot);
+    LV_UNUSED(antialias);
+    LV_UNUSED(area);
+    return NULL;
+#endif
+}
+
+/**
+ * Round an angle to `LV_IMG_TRANSFORM_CACHE_ANGLE_STEP` as the transformation cache stores it.
+ * @param angle rotation angle [0.1 degree]
+ * @return the rounded angle [0.1 degree]
+ */
+int16_t _lv_img_cache_round_angle(int16_t angle)
+{
+#if LV_IMG_TRANSFORM_CACHE_ANGLE_STEP > 1
+    angle = ((angle + LV_IMG_TRANSFORM_CACHE_ANGLE_STEP / 2) / LV_IMG_TRANSFORM_CACHE_ANGLE_STEP) *
+            LV_IMG_TRANSFORM_CACHE_ANGLE_STEP;
+    if(angle >= 3600) angle -= 3600;
+#endif
+    return angle;
 }
 
 /**********************
@@ -215,3 +369,78 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
     return strcmp(src1, src2) == 0;
 }
 #endif
+
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+/**
+ * Remove an entry from the transformation cache and free its memory
+ * @param entry pointer to an entry in the transformation cache
+ */
+static void lv_img_transform_cache_drop(lv_img_transform_cache_entry_t * entry)
+{
+    if(lv_img_src_get_type(entry->src) == LV_IMG_SRC_FILE) lv_mem_free(entry->src);
+    lv_mem_free(entry->buf);
+    transform_cache_used -= entry->buf_size;
+
+    _lv_ll_remove(&LV_GC_ROOT(_lv_img_transform_cache_ll), entry);
+    lv_mem_free(entry);
+}
+
+/**
+ * Transform an image into the buffer of a transformation cache entry
+ * @param entry pointer to an entry whose parameters are already set
+ * @param src_data the decoded pixels of the original image
+ * @param src_cf color format of the original image
+ */
+static void lv_img_transform_cache_render(lv_img_transform_cache_entry_t * entry, const uint8_t * src_data,
+                                          lv_img_cf_t src_cf)
+{
+    lv_img_cf_t cf = LV_IMG_CF_TRUE_COLOR;
+    if(lv_img_cf_has_alpha(src_cf)) cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    else if(lv_img_cf_is_chroma_keyed(src_cf)) cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+
+    lv_img_transform_dsc_t trans_dsc;
+    _lv_memset_00(&trans_dsc, sizeof(lv_img_transform_dsc_t));
+    trans_dsc.cfg.angle = entry->angle;
+    trans_dsc.cfg.zoom = entry->zoom;
+    trans_dsc.cfg.src = src_data;
+    trans_dsc.cfg.src_w = entry->w;
+    trans_dsc.cfg.src_h = entry->h;
+    trans_dsc.cfg.cf = cf;
+    trans_dsc.cfg.pivot_x = entry->pivot.x;
+    trans_dsc.cfg.pivot_y = entry->pivot.y;
+    trans_dsc.cfg.color = entry->color;
+    trans_dsc.cfg.antialias = entry->antialias;
+    _lv_img_buf_transform_init(&trans_dsc);
+
+    uint8_t * px = entry->buf;
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = entry->area.y1; y <= entry->area.y2; y++) {
+        for(x = entry->area.x1; x <= entry->area.x2; x++) {
+            lv_color_t c;
+            lv_opa_t opa;
+            if(_lv_img_buf_transform(&trans_dsc, x, y)) {
+                c = trans_dsc.res.color;
+                opa = trans_dsc.res.opa;
+            }
+            else {
+                c.full = 0;
+                opa = LV_OPA_TRANSP;
+            }
+
+#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
+            px[0] = c.full;
+#elif LV_COLOR_DEPTH == 16
+            px[0] = c.full & 0xFF;
+            px[1] = c.full >> 8;
+#elif LV_COLOR_DEPTH == 32
+            px[0] = c.ch.blue;
+            px[1] = c.ch.green;
+            px[2] = c.ch.red;
+#endif
+            px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = opa;
+            px += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+    }
+}
+#endif
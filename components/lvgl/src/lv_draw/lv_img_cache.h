@@ -37,6 +37,23 @@ typedef struct {
     int32_t life;
 } lv_img_cache_entry_t;
 
+/**
+ * A rotated and/or zoomed image stored in the transformation cache.
+ */
+typedef struct {
+    const void * src;       /**< Pointer to the `lv_img_dsc_t` variable or a copy of the file path*/
+    lv_color_t color;       /**< The color the image was opened with*/
+    lv_coord_t w;           /**< Width of the original image*/
+    lv_coord_t h;           /**< Height of the original image*/
+    lv_point_t pivot;       /**< Pivot of the transformation*/
+    int16_t angle;          /**< Rotation angle [0.1 degree]*/
+    uint16_t zoom;          /**< Zoom (256: no zoom)*/
+    uint8_t antialias : 1;  /**< The transformation was anti-aliased*/
+    lv_area_t area;         /**< The transformed area relative to the top left corner of the original image*/
+    uint8_t * buf;          /**< The transformed pixels in `LV_IMG_CF_TRUE_COLOR_ALPHA` format*/
+    uint32_t buf_size;      /**< Size of `buf` in bytes*/
+} lv_img_transform_cache_entry_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -62,10 +79,38 @@ void lv_img_cache_set_size(uint16_t new_slot_num);
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
+ * The cached transformed versions of the image are dropped too.
+ * Variable images are found by the address of their descriptor so it needs to be called
+ * if their pixels are modified in place (canvases do it automatically).
  * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
  */
 void lv_img_cache_invalidate_src(const void * src);
 
+/**
+ * Get the rotated and/or zoomed version of an opened image from the transformation cache.
+ * If it's not cached yet the image is transformed and the result is cached.
+ * The least recently used entries are dropped to keep the cache under `LV_IMG_TRANSFORM_CACHE_SIZE` bytes.
+ * @param entry an image opened with `_lv_img_cache_open`. Its entire decoded data (`img_data`) should be available.
+ * @param w width of the image
+ * @param h height of the image
+ * @param angle rotation angle [0.1 degree]
+ * @param zoom zoom (256: no zoom)
+ * @param pivot pivot of the transformation
+ * @param antialias true: anti-alias the transformation
+ * @param area store the transformed area here (relative to the top left corner of the original image)
+ * @return the transformed pixels in `LV_IMG_CF_TRUE_COLOR_ALPHA` format or NULL if the image can't be cached
+ */
+const uint8_t * _lv_img_cache_get_transformed(lv_img_cache_entry_t * entry, lv_coord_t w, lv_coord_t h,
+                                              int16_t angle, uint16_t zoom, const lv_point_t * pivot, bool antialias,
+                                              lv_area_t * area);
+
+/**
+ * Round an angle to `LV_IMG_TRANSFORM_CACHE_ANGLE_STEP` as the transformation cache stores it.
+ * @param angle rotation angle [0.1 degree]
+ * @return the rounded angle [0.1 degree]
+ */
+int16_t _lv_img_cache_round_angle(int16_t angle);
+
 /**********************
  *      MACROS
  **********************/
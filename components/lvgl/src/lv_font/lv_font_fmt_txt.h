@@ -190,6 +190,11 @@ typedef struct {
     uint32_t last_letter;
     uint32_t last_glyph_id;
 
+    /* Get the bitmap of a glyph on demand instead of reading it from `glyph_bitmap`
+     * (e.g. for fonts whose bitmaps stay in a file). The bitmap has the same format as in `glyph_bitmap`
+     * and needs to be valid only until the next call. NULL if not used.*/
+    const uint8_t * (*get_glyph_bitmap_cb)(const struct _lv_font_struct * font, uint32_t glyph_id);
+
 } lv_font_fmt_txt_dsc_t;
 
 /**********************
@@ -16,15 +16,49 @@
 
 #if LV_USE_FILESYSTEM
 
+/*********************
+ *      DEFINES
+ *********************/
+
 /**********************
  *      TYPEDEFS
  **********************/
+
+/*Reads the file in blocks and serves the small reads from memory*/
 typedef struct {
     lv_fs_file_t * fp;
-    int8_t bit_pos;
+    uint8_t * buf;
+    uint32_t buf_start;     /*File position of `buf[0]`*/
+    uint32_t buf_len;       /*Number of valid bytes in `buf`*/
+    uint32_t pos;           /*Position of the next read*/
+    uint32_t file_pos;      /*Real position of `fp`*/
+} font_reader_t;
+
+typedef struct {
+    font_reader_t * reader;
+    int8_t bits_left;
     uint8_t byte_value;
 } bit_iterator_t;
 
+typedef struct {
+    uint32_t glyph_id;      /*0: the entry is empty*/
+    uint32_t last_use;
+} font_page_entry_t;
+
+/*Descriptor of fonts loaded with `lv_font_load_paged`*/
+typedef struct {
+    lv_font_fmt_txt_dsc_t dsc;      /*Must be the first member*/
+    lv_fs_file_t file;
+    uint32_t glyf_start;            /*Position of the glyph table in the file*/
+    uint32_t * glyph_offset;        /*Offset of the glyphs in the glyph table, +1 element for the table's end*/
+    uint8_t header_bits;            /*Bits of the glyph descriptor before the bitmap*/
+    uint32_t entry_size;            /*Size of the largest glyph with its descriptor*/
+    uint16_t entry_cnt;
+    uint32_t use_cnt;
+    font_page_entry_t * entries;
+    uint8_t * cache_buf;            /*`entry_cnt` * `entry_size` bytes*/
+} font_paged_t;
+
 typedef struct font_header_bin {
     uint32_t version;
     uint16_t tables_count;
@@ -65,9 +99,13 @@ typedef struct cmap_table_bin {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
-int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
+static lv_fs_res_t reader_read(font_reader_t * r, void * buf, uint32_t btr);
+static void reader_seek(font_reader_t * r, uint32_t pos);
+static bit_iterator_t init_bit_iterator(font_reader_t * r);
+static lv_font_t * font_load(const char * font_name, bool paged, uint32_t cache_size);
+static bool lvgl_load_font(font_reader_t * r, lv_font_t * font, bool paged);
+static const uint8_t * paged_get_bitmap(const lv_font_t * font, uint32_t glyph_id);
+static int32_t load_kern(font_reader_t * r, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
 static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
@@ -87,37 +125,26 @@ static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res
  */
 lv_font_t * lv_font_load(const char * font_name)
 {
-    bool success = false;
-
-    lv_font_t * font = lv_mem_alloc(sizeof(lv_font_t));
-    memset(font, 0, sizeof(lv_font_t));
-
-    lv_fs_file_t file;
-    lv_fs_res_t res = lv_fs_open(&file, font_name, LV_FS_MODE_RD);
-
-    if(res == LV_FS_RES_OK) {
-        success = lvgl_load_font(&file, font);
-
-        if(!success) {
-            LV_LOG_WARN("Error loading font file: %s\n", font_name);
-            /*
-            * When `lvgl_load_font` fails it can leak some pointers.
-            * All non-null pointers can be assumed as allocated and
-            * `lv_font_free` should free them correctly.
-            */
-            lv_font_free(font);
-            font = NULL;
-        }
-
-        lv_fs_close(&file);
-    }
+    return font_load(font_name, false, 0);
+}
 
-    return font;
+/**
+ * Loads a `lv_font_t` object from a binary font file but keeps the glyph bitmaps in the file.
+ * Only the glyph descriptors, cmaps and kerning are loaded into the memory.
+ * The bitmaps are read on their first use into a cache and the least recently used ones are dropped
+ * when the cache is full. The file remains open until `lv_font_free`.
+ * @param font_name filename where the font file is located
+ * @param cache_size size of the bitmap cache in bytes. At least one glyph is always cached.
+ * @return a pointer to the font or NULL in case of error
+ */
+lv_font_t * lv_font_load_paged(const char * font_name, uint32_t cache_size)
+{
+    return font_load(font_name, true, cache_size);
 }
 
 /**
- * Frees the memory allocated by the `lv_font_load()` function
- * @param font lv_font_t object created by the lv_font_load function
+ * Frees the memory allocated by the `lv_font_load()` or `lv_font_load_paged()` function
+ * @param font lv_font_t object created by the lv_font_load or lv_font_load_paged function
  */
 void lv_font_free(lv_font_t * font)
 {
@@ -126,6 +153,14 @@ void lv_font_free(lv_font_t * font)
 
         if(NULL != dsc) {
 
+            if(dsc->get_glyph_bitmap_cb == paged_get_bitmap) {
+                font_paged_t * paged = (font_paged_t *) dsc;
+                if(paged->file.file_d) lv_fs_close(&paged->file);
+                if(paged->glyph_offset) lv_mem_free(paged->glyph_offset);
+                if(paged->entries) lv_mem_free(paged->entries);
+                if(paged->cache_buf) lv_mem_free(paged->cache_buf);
+            }
+
             if(dsc->kern_classes == 0) {
                 lv_font_fmt_txt_kern_pair_t * kern_dsc =
                     (lv_font_fmt_txt_kern_pair_t *) dsc->kern_dsc;
@@ -187,11 +222,190 @@ void lv_font_free(lv_font_t * font)
  *   STATIC FUNCTIONS
  **********************/
 
-static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp)
+static lv_font_t * font_load(const char * font_name, bool paged, uint32_t cache_size)
+{
+    bool success = false;
+
+    lv_font_t * font = lv_mem_alloc(sizeof(lv_font_t));
+    memset(font, 0, sizeof(lv_font_t));
+
+    lv_fs_file_t file;
+    lv_fs_res_t res = lv_fs_open(&file, font_name, LV_FS_MODE_RD);
+
+    if(res == LV_FS_RES_OK) {
+        font_reader_t reader;
+        memset(&reader, 0, sizeof(reader));
+        reader.fp = &file;
+        reader.buf = lv_mem_alloc(LV_FONT_LOADER_BUF_SIZE);
+        LV_ASSERT_MEM(reader.buf);
+
+        success = reader.buf ? lvgl_load_font(&reader, font, paged) : false;
+        lv_mem_free(reader.buf);
+
+        if(success && paged) {
+            font_paged_t * paged_dsc = (font_paged_t *) font->dsc;
+
+            uint32_t entry_cnt = paged_dsc->entry_size ? cache_size / paged_dsc->entry_size : 1;
+            paged_dsc->entry_cnt = LV_MATH_MAX(1, LV_MATH_MIN(entry_cnt, UINT16_MAX));
+            paged_dsc->entries = lv_mem_alloc(sizeof(font_page_entry_t) * paged_dsc->entry_cnt);
+            paged_dsc->cache_buf = lv_mem_alloc(LV_MATH_MAX(paged_dsc->entry_size, 1) * paged_dsc->entry_cnt);
+            LV_ASSERT_MEM(paged_dsc->entries);
+            LV_ASSERT_MEM(paged_dsc->cache_buf);
+
+            if(paged_dsc->entries && paged_dsc->cache_buf) {
+                _lv_memset_00(paged_dsc->entries, sizeof(font_page_entry_t) * paged_dsc->entry_cnt);
+                /*Keep the file open to read the bitmaps later*/
+                paged_dsc->file = file;
+            }
+            else {
+                success = false;
+            }
+        }
+
+        if(!success) {
+            LV_LOG_WARN("Error loading font file: %s\n", font_name);
+            /*
+            * When `lvgl_load_font` fails it can leak some pointers.
+            * All non-null pointers can be assumed as allocated and
+            * `lv_font_free` should free them correctly.
+            */
+            lv_font_free(font);
+            font = NULL;
+        }
+
+        if(!success || !paged) lv_fs_close(&file);
+    }
+
+    return font;
+}
+
+/**
+ * Used as `get_glyph_bitmap_cb` of paged fonts. Returns the bitmap from the cache or loads it from the file.
+ * @param font pointer to a font loaded with `lv_font_load_paged`
+ * @param glyph_id id of the glyph
+ * @return the bitmap in the same format as `lvgl_load_font` would store it, or NULL on error
+ */
+static const uint8_t * paged_get_bitmap(const lv_font_t * font, uint32_t glyph_id)
+{
+    font_paged_t * paged = (font_paged_t *) font->dsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &paged->dsc.glyph_dsc[glyph_id];
+    if(gdsc->box_w * gdsc->box_h == 0) return NULL;
+
+    paged->use_cnt++;
+
+    /*Look for the glyph and the least recently used entry at the same time*/
+    uint16_t lru = 0;
+    for(uint16_t i = 0; i < paged->entry_cnt; i++) {
+        if(paged->entries[i].glyph_id == glyph_id) {
+            paged->entries[i].last_use = paged->use_cnt;
+            return &paged->cache_buf[i * paged->entry_size];
+        }
+        if(paged->entries[i].last_use < paged->entries[lru].last_use) lru = i;
+    }
+
+    font_page_entry_t * entry = &paged->entries[lru];
+    uint8_t * buf = &paged->cache_buf[lru * paged->entry_size];
+    entry->glyph_id = 0;
+
+    uint32_t ofs = paged->glyph_offset[glyph_id];
+    uint32_t len = paged->glyph_offset[glyph_id + 1] - ofs;
+    uint32_t br = 0;
+    if(lv_fs_seek(&paged->file, paged->glyf_start + ofs) != LV_FS_RES_OK ||
+       lv_fs_read(&paged->file, buf, len, &br) != LV_FS_RES_OK || br != len) {
+        LV_LOG_WARN("Couldn't read the bitmap of glyph %d", glyph_id);
+        return NULL;
+    }
+
+    /*Drop the descriptor and align the bitmap to byte boundary the same way as `load_glyph` does*/
+    uint32_t hdr = paged->header_bits / 8;
+    uint8_t shift = paged->header_bits % 8;
+    uint32_t bmp_size = len - hdr;
+    uint32_t k;
+    if(shift == 0) {
+        for(k = 0; k < bmp_size; k++) buf[k] = buf[hdr + k];
+    }
+    else {
+        /*The bits after the end of the glyph are 0 like in the padding of the byte aligned bitmaps*/
+        for(k = 0; k + 1 < bmp_size; k++) {
+            buf[k] = (uint8_t)((buf[hdr + k] << shift) | (buf[hdr + k + 1] >> (8 - shift)));
+        }
+        buf[bmp_size - 1] = (uint8_t)(buf[hdr + bmp_size - 1] << shift);
+    }
+
+    entry->glyph_id = glyph_id;
+    entry->last_use = paged->use_cnt;
+
+    return buf;
+}
+
+/**
+ * Read `btr` bytes from the current position.
+ * Small reads are served from the buffer which is refilled with one large read when needed.
+ * Reads larger than the buffer go directly to the destination.
+ * @param r pointer to a reader
+ * @param buf store the data here
+ * @param btr number of bytes to read
+ * @return LV_FS_RES_OK: if all bytes were read, or an error code
+ */
+static lv_fs_res_t reader_read(font_reader_t * r, void * buf, uint32_t btr)
+{
+    uint8_t * dst = buf;
+
+    while(btr > 0) {
+        /*Copy what is already in the buffer*/
+        if(r->pos >= r->buf_start && r->pos < r->buf_start + r->buf_len) {
+            uint32_t ofs = r->pos - r->buf_start;
+            uint32_t n = LV_MATH_MIN(btr, r->buf_len - ofs);
+            _lv_memcpy(dst, &r->buf[ofs], n);
+            dst += n;
+            r->pos += n;
+            btr -= n;
+            continue;
+        }
+
+        lv_fs_res_t res;
+        if(r->file_pos != r->pos) {
+            res = lv_fs_seek(r->fp, r->pos);
+            if(res != LV_FS_RES_OK) return res;
+            r->file_pos = r->pos;
+        }
+
+        uint32_t br = 0;
+        if(btr >= LV_FONT_LOADER_BUF_SIZE) {
+            res = lv_fs_read(r->fp, dst, btr, &br);
+            r->file_pos += br;
+            r->pos += br;
+            if(res != LV_FS_RES_OK) return res;
+            if(br != btr) return LV_FS_RES_UNKNOWN;
+            return LV_FS_RES_OK;
+        }
+
+        res = lv_fs_read(r->fp, r->buf, LV_FONT_LOADER_BUF_SIZE, &br);
+        r->buf_start = r->pos;
+        r->buf_len = br;
+        r->file_pos += br;
+        if(res != LV_FS_RES_OK) return res;
+        if(br == 0) return LV_FS_RES_UNKNOWN;   /*End of file*/
+    }
+
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Set the position of the next read. The file is seeked only when the buffer needs to be refilled.
+ * @param r pointer to a reader
+ * @param pos the new position
+ */
+static void reader_seek(font_reader_t * r, uint32_t pos)
+{
+    r->pos = pos;
+}
+
+static bit_iterator_t init_bit_iterator(font_reader_t * r)
 {
     bit_iterator_t it;
-    it.fp = fp;
-    it.bit_pos = -1;
+    it.reader = r;
+    it.bits_left = 0;
     it.byte_value = 0;
     return it;
 }
@@ -199,20 +413,20 @@ static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp)
 static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res)
 {
     unsigned int value = 0;
-    while(n_bits--) {
-        it->byte_value = it->byte_value << 1;
-        it->bit_pos--;
-
-        if(it->bit_pos < 0) {
-            it->bit_pos = 7;
-            *res = lv_fs_read(it->fp, &(it->byte_value), 1, NULL);
+    while(n_bits > 0) {
+        if(it->bits_left == 0) {
+            *res = reader_read(it->reader, &(it->byte_value), 1);
             if(*res != LV_FS_RES_OK) {
                 return 0;
             }
+            it->bits_left = 8;
         }
-        int8_t bit = (it->byte_value & 0x80) ? 1 : 0;
 
-        value |= (bit << n_bits);
+        /*Take as many bits as possible from the current byte*/
+        int n = LV_MATH_MIN(n_bits, it->bits_left);
+        it->bits_left -= n;
+        n_bits -= n;
+        value = (value << n) | ((it->byte_value >> it->bits_left) & ((1 << n) - 1));
     }
     *res = LV_FS_RES_OK;
     return value;
@@ -227,15 +441,15 @@ static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res)
     return value;
 }
 
-static int read_label(lv_fs_file_t * fp, int start, const char * label)
+static int read_label(font_reader_t * r, int start, const char * label)
 {
-    lv_fs_seek(fp, start);
+    reader_seek(r, start);
 
     uint32_t length;
     char buf[4];
 
-    if(lv_fs_read(fp, &length, 4, NULL) != LV_FS_RES_OK
-       || lv_fs_read(fp, buf, 4, NULL) != LV_FS_RES_OK
+    if(reader_read(r, &length, 4) != LV_FS_RES_OK
+       || reader_read(r, buf, 4) != LV_FS_RES_OK
        || memcmp(label, buf, 4) != 0) {
         LV_LOG_WARN("Error reading '%s' label.", label);
         return -1;
@@ -244,18 +458,15 @@ static int read_label(lv_fs_file_t * fp, int start, const char * label)
     return length;
 }
 
-static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
+static bool load_cmaps_tables(font_reader_t * r, lv_font_fmt_txt_dsc_t * font_dsc,
                               uint32_t cmaps_start, cmap_table_bin_t * cmap_table)
 {
-    if(lv_fs_read(fp, cmap_table, font_dsc->cmap_num * sizeof(cmap_table_bin_t), NULL) != LV_FS_RES_OK) {
+    if(reader_read(r, cmap_table, font_dsc->cmap_num * sizeof(cmap_table_bin_t)) != LV_FS_RES_OK) {
         return false;
     }
 
     for(unsigned int i = 0; i < font_dsc->cmap_num; ++i) {
-        lv_fs_res_t res = lv_fs_seek(fp, cmaps_start + cmap_table[i].data_offset);
-        if(res != LV_FS_RES_OK) {
-            return false;
-        }
+        reader_seek(r, cmaps_start + cmap_table[i].data_offset);
 
         lv_font_fmt_txt_cmap_t * cmap = (lv_font_fmt_txt_cmap_t *) & (font_dsc->cmaps[i]);
 
@@ -271,7 +482,7 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
 
                     cmap->glyph_id_ofs_list = glyph_id_ofs_list;
 
-                    if(lv_fs_read(fp, glyph_id_ofs_list, ids_size, NULL) != LV_FS_RES_OK) {
+                    if(reader_read(r, glyph_id_ofs_list, ids_size) != LV_FS_RES_OK) {
                         return false;
                     }
 
@@ -288,7 +499,7 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
                     cmap->unicode_list = unicode_list;
                     cmap->list_length = cmap_table[i].data_entries_count;
 
-                    if(lv_fs_read(fp, unicode_list, list_size, NULL) != LV_FS_RES_OK) {
+                    if(reader_read(r, unicode_list, list_size) != LV_FS_RES_OK) {
                         return false;
                     }
 
@@ -297,7 +508,7 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
 
                         cmap->glyph_id_ofs_list = buf;
 
-                        if(lv_fs_read(fp, buf, sizeof(uint16_t) * cmap->list_length, NULL) != LV_FS_RES_OK) {
+                        if(reader_read(r, buf, sizeof(uint16_t) * cmap->list_length) != LV_FS_RES_OK) {
                             return false;
                         }
                     }
@@ -311,15 +522,15 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
     return true;
 }
 
-static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint32_t cmaps_start)
+static int32_t load_cmaps(font_reader_t * r, lv_font_fmt_txt_dsc_t * font_dsc, uint32_t cmaps_start)
 {
-    int32_t cmaps_length = read_label(fp, cmaps_start, "cmap");
+    int32_t cmaps_length = read_label(r, cmaps_start, "cmap");
     if(cmaps_length < 0) {
         return -1;
     }
 
     uint32_t cmaps_subtables_count;
-    if(lv_fs_read(fp, &cmaps_subtables_count, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+    if(reader_read(r, &cmaps_subtables_count, sizeof(uint32_t)) != LV_FS_RES_OK) {
         return -1;
     }
 
@@ -333,17 +544,18 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
 
     cmap_table_bin_t * cmaps_tables = lv_mem_alloc(sizeof(cmap_table_bin_t) * font_dsc->cmap_num);
 
-    bool success = load_cmaps_tables(fp, font_dsc, cmaps_start, cmaps_tables);
+    bool success = load_cmaps_tables(r, font_dsc, cmaps_start, cmaps_tables);
 
     lv_mem_free(cmaps_tables);
 
     return success ? cmaps_length : -1;
 }
 
-static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
-                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
+static int32_t load_glyph(font_reader_t * r, lv_font_fmt_txt_dsc_t * font_dsc,
+                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header,
+                          font_paged_t * paged)
 {
-    int32_t glyph_length = read_label(fp, start, "glyf");
+    int32_t glyph_length = read_label(r, start, "glyf");
     if(glyph_length < 0) {
         return -1;
     }
@@ -355,17 +567,33 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
 
     font_dsc->glyph_dsc = glyph_dsc;
 
+    int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+
+    /* The bitmaps can't be larger than the table so allocate that much,
+     * read the descriptors and the bitmaps in one sequential pass and shrink the buffer at the end.
+     * Paged fonts read only the descriptors.*/
+    uint8_t * glyph_bmp = NULL;
+    if(paged) {
+        paged->glyf_start = start;
+        paged->header_bits = nbits;
+    }
+    else {
+        glyph_bmp = (uint8_t *) lv_mem_alloc(sizeof(uint8_t) * glyph_length);
+        if(glyph_bmp == NULL) {
+            return -1;
+        }
+
+        font_dsc->glyph_bitmap = glyph_bmp;
+    }
     int cur_bmp_size = 0;
 
     for(unsigned int i = 0; i < loca_count; ++i) {
         lv_font_fmt_txt_glyph_dsc_t * gdsc = &glyph_dsc[i];
+        lv_fs_res_t res = LV_FS_RES_OK;
 
-        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i]);
-        if(res != LV_FS_RES_OK) {
-            return -1;
-        }
+        reader_seek(r, start + glyph_offset[i]);
 
-        bit_iterator_t bit_it = init_bit_iterator(fp);
+        bit_iterator_t bit_it = init_bit_iterator(r);
 
         if(header->advance_width_bits == 0) {
             gdsc->adv_w = header->default_advance_width;
@@ -401,7 +629,6 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
             return -1;
         }
 
-        int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
         int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : (uint32_t)glyph_length;
         int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
 
@@ -414,40 +641,19 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
         }
 
         gdsc->bitmap_index = cur_bmp_size;
-        if(gdsc->box_w * gdsc->box_h != 0) {
-            cur_bmp_size += bmp_size;
-        }
-    }
 
-    uint8_t * glyph_bmp = (uint8_t *) lv_mem_alloc(sizeof(uint8_t) * cur_bmp_size);
-
-    font_dsc->glyph_bitmap = glyph_bmp;
-
-    cur_bmp_size = 0;
-
-    for(unsigned int i = 1; i < loca_count; ++i) {
-        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i]);
-        if(res != LV_FS_RES_OK) {
-            return -1;
-        }
-        bit_iterator_t bit_it = init_bit_iterator(fp);
-
-        int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
-
-        read_bits(&bit_it, nbits, &res);
-        if(res != LV_FS_RES_OK) {
-            return -1;
+        if(gdsc->box_w * gdsc->box_h == 0) {
+            continue;
         }
 
-        if(glyph_dsc[i].box_w * glyph_dsc[i].box_h == 0) {
+        if(paged) {
+            uint32_t entry_size = next_offset - glyph_offset[i];
+            if(entry_size > paged->entry_size) paged->entry_size = entry_size;
             continue;
         }
 
-        int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : (uint32_t)glyph_length;
-        int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
-
         if(nbits % 8 == 0) {  /* Fast path */
-            if(lv_fs_read(fp, &glyph_bmp[cur_bmp_size], bmp_size, NULL) != LV_FS_RES_OK) {
+            if(reader_read(r, &glyph_bmp[cur_bmp_size], bmp_size) != LV_FS_RES_OK) {
                 return -1;
             }
         }
@@ -466,11 +672,17 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
 
         cur_bmp_size += bmp_size;
     }
+
+    if(glyph_bmp && cur_bmp_size > 0 && cur_bmp_size < glyph_length) {
+        glyph_bmp = lv_mem_realloc(glyph_bmp, cur_bmp_size);
+        if(glyph_bmp) font_dsc->glyph_bitmap = glyph_bmp;
+    }
+
     return glyph_length;
 }
 
 /*
- * Loads a `lv_font_t` from a binary file, given a `lv_fs_file_t`.
+ * Loads a `lv_font_t` from a binary file, given a `font_reader_t` opened on it.
  *
  * Memory allocations on `lvgl_load_font` should be immediately zeroed and
  * the pointer should be set on the `lv_font_t` data before any possible return.
@@ -481,23 +693,29 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
  * `lv_font_free` will assume that all non-null pointers are allocated and
  * should be freed.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(font_reader_t * r, lv_font_t * font, bool paged)
 {
-    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
-                                       lv_mem_alloc(sizeof(lv_font_fmt_txt_dsc_t));
+    uint32_t dsc_size = paged ? sizeof(font_paged_t) : sizeof(lv_font_fmt_txt_dsc_t);
+    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *) lv_mem_alloc(dsc_size);
 
-    memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+    memset(font_dsc, 0, dsc_size);
 
     font->dsc = font_dsc;
 
+    font_paged_t * font_paged = NULL;
+    if(paged) {
+        font_paged = (font_paged_t *) font_dsc;
+        font_dsc->get_glyph_bitmap_cb = paged_get_bitmap;
+    }
+
     /* header */
-    int32_t header_length = read_label(fp, 0, "head");
+    int32_t header_length = read_label(r, 0, "head");
     if(header_length < 0) {
         return false;
     }
 
     font_header_bin_t font_header;
-    if(lv_fs_read(fp, &font_header, sizeof(font_header_bin_t), NULL) != LV_FS_RES_OK) {
+    if(reader_read(r, &font_header, sizeof(font_header_bin_t)) != LV_FS_RES_OK) {
         return false;
     }
 
@@ -515,20 +733,20 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     /* cmaps */
     uint32_t cmaps_start = header_length;
-    int32_t cmaps_length = load_cmaps(fp, font_dsc, cmaps_start);
+    int32_t cmaps_length = load_cmaps(r, font_dsc, cmaps_start);
     if(cmaps_length < 0) {
         return false;
     }
 
     /* loca */
     uint32_t loca_start = cmaps_start + cmaps_length;
-    int32_t loca_length = read_label(fp, loca_start, "loca");
+    int32_t loca_length = read_label(r, loca_start, "loca");
     if(loca_length < 0) {
         return false;
     }
 
     uint32_t loca_count;
-    if(lv_fs_read(fp, &loca_count, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+    if(reader_read(r, &loca_count, sizeof(uint32_t)) != LV_FS_RES_OK) {
         return false;
     }
 
@@ -536,17 +754,20 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     uint32_t * glyph_offset = lv_mem_alloc(sizeof(uint32_t) * (loca_count + 1));
 
     if(font_header.index_to_loc_format == 0) {
-        for(unsigned int i = 0; i < loca_count; ++i) {
-            uint16_t offset;
-            if(lv_fs_read(fp, &offset, sizeof(uint16_t), NULL) != LV_FS_RES_OK) {
-                failed = true;
-                break;
+        /*Read the 16 bit offsets at once and widen them in place from the end*/
+        if(reader_read(r, glyph_offset, loca_count * sizeof(uint16_t)) != LV_FS_RES_OK) {
+            failed = true;
+        }
+        else {
+            for(int32_t i = loca_count - 1; i >= 0; --i) {
+                uint16_t offset;
+                _lv_memcpy_small(&offset, (uint8_t *)glyph_offset + i * sizeof(uint16_t), sizeof(uint16_t));
+                glyph_offset[i] = offset;
             }
-            glyph_offset[i] = offset;
         }
     }
     else if(font_header.index_to_loc_format == 1) {
-        if(lv_fs_read(fp, glyph_offset, loca_count * sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+        if(reader_read(r, glyph_offset, loca_count * sizeof(uint32_t)) != LV_FS_RES_OK) {
             failed = true;
         }
     }
@@ -563,9 +784,16 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     /* glyph */
     uint32_t glyph_start = loca_start + loca_length;
     int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+                               r, font_dsc, glyph_start, glyph_offset, loca_count, &font_header, font_paged);
 
-    lv_mem_free(glyph_offset);
+    if(font_paged) {
+        /*Keep the offsets to find the bitmaps in the file*/
+        font_paged->glyph_offset = glyph_offset;
+        if(glyph_length >= 0) glyph_offset[loca_count] = glyph_length;
+    }
+    else {
+        lv_mem_free(glyph_offset);
+    }
 
     if(glyph_length < 0) {
         return false;
@@ -580,22 +808,22 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     uint32_t kern_start = glyph_start + glyph_length;
 
-    int32_t kern_length = load_kern(fp, font_dsc, font_header.glyph_id_format, kern_start);
+    int32_t kern_length = load_kern(r, font_dsc, font_header.glyph_id_format, kern_start);
 
     return kern_length >= 0;
 }
 
-int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start)
+static int32_t load_kern(font_reader_t * r, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start)
 {
-    int32_t kern_length = read_label(fp, start, "kern");
+    int32_t kern_length = read_label(r, start, "kern");
     if(kern_length < 0) {
         return -1;
     }
 
     uint8_t kern_format_type;
     int32_t padding;
-    if(lv_fs_read(fp, &kern_format_type, sizeof(uint8_t), NULL) != LV_FS_RES_OK ||
-       lv_fs_read(fp, &padding, 3 * sizeof(uint8_t), NULL) != LV_FS_RES_OK) {
+    if(reader_read(r, &kern_format_type, sizeof(uint8_t)) != LV_FS_RES_OK ||
+       reader_read(r, &padding, 3 * sizeof(uint8_t)) != LV_FS_RES_OK) {
         return -1;
     }
 
@@ -608,7 +836,7 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         font_dsc->kern_classes = 0;
 
         uint32_t glyph_entries;
-        if(lv_fs_read(fp, &glyph_entries, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+        if(reader_read(r, &glyph_entries, sizeof(uint32_t)) != LV_FS_RES_OK) {
             return -1;
         }
 
@@ -628,11 +856,11 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         kern_pair->glyph_ids = glyph_ids;
         kern_pair->values = values;
 
-        if(lv_fs_read(fp, glyph_ids, ids_size, NULL) != LV_FS_RES_OK) {
+        if(reader_read(r, glyph_ids, ids_size) != LV_FS_RES_OK) {
             return -1;
         }
 
-        if(lv_fs_read(fp, values, glyph_entries, NULL) != LV_FS_RES_OK) {
+        if(reader_read(r, values, glyph_entries) != LV_FS_RES_OK) {
             return -1;
         }
     }
@@ -649,9 +877,9 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         uint8_t kern_table_rows;
         uint8_t kern_table_cols;
 
-        if(lv_fs_read(fp, &kern_class_mapping_length, sizeof(uint16_t), NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, &kern_table_rows, sizeof(uint8_t), NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, &kern_table_cols, sizeof(uint8_t), NULL) != LV_FS_RES_OK) {
+        if(reader_read(r, &kern_class_mapping_length, sizeof(uint16_t)) != LV_FS_RES_OK ||
+           reader_read(r, &kern_table_rows, sizeof(uint8_t)) != LV_FS_RES_OK ||
+           reader_read(r, &kern_table_cols, sizeof(uint8_t)) != LV_FS_RES_OK) {
             return -1;
         }
 
@@ -667,9 +895,9 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         kern_classes->right_class_cnt = kern_table_cols;
         kern_classes->class_pair_values = kern_values;
 
-        if(lv_fs_read(fp, kern_left, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, kern_right, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, kern_values, kern_values_length, NULL) != LV_FS_RES_OK) {
+        if(reader_read(r, kern_left, kern_class_mapping_length) != LV_FS_RES_OK ||
+           reader_read(r, kern_right, kern_class_mapping_length) != LV_FS_RES_OK ||
+           reader_read(r, kern_values, kern_values_length) != LV_FS_RES_OK) {
             return -1;
         }
     }
@@ -17,6 +17,7 @@
 #include "../lv_misc/lv_debug.h"
 #include "../lv_core/lv_obj.h"
 #include "../lv_core/lv_refr.h"
+#include "../lv_core/lv_disp.h"
 #include "../lv_themes/lv_theme.h"
 
 /*********************
@@ -60,6 +61,7 @@ void lv_disp_drv_init(lv_disp_drv_t * driver)
     driver->buffer           = NULL;
     driver->rotated          = LV_DISP_ROT_NONE;
     driver->sw_rotate        = 0;
+    driver->mono_page        = 0;
     driver->color_chroma_key = LV_COLOR_TRANSP;
     driver->dpi = LV_DPI;
 
@@ -76,6 +78,14 @@ void lv_disp_drv_init(lv_disp_drv_t * driver)
     driver->gpu_fill_cb  = NULL;
 #endif
 
+#if LV_USE_DRAW_BACKEND
+    driver->draw_backend = NULL;
+#endif
+
+#if LV_USE_FAST_SCROLL
+    driver->scroll_cb = NULL;
+#endif
+
 #if LV_USE_USER_DATA
     driver->user_data = NULL;
 #endif
@@ -126,6 +136,9 @@ lv_disp_t * lv_disp_drv_register(lv_disp_drv_t * driver)
     _lv_memcpy(&disp->driver, driver, sizeof(lv_disp_drv_t));
 
     _lv_ll_init(&disp->scr_ll, sizeof(lv_obj_t));
+#if LV_USE_SCR_SNAPSHOT
+    _lv_ll_init(&disp->snapshot_ll, sizeof(lv_scr_snapshot_t));
+#endif
     disp->last_activity_time = 0;
 
     if(disp_def == NULL) disp_def = disp;
@@ -165,8 +178,8 @@ lv_disp_t * lv_disp_drv_register(lv_disp_drv_t * driver)
     lv_task_ready(disp->refr_task); /*Be sure the screen will be refreshed immediately on start up*/
 
     /*Can't handle this case later so add an error*/
-    if(lv_disp_is_true_double_buf(disp) && disp->driver.set_px_cb) {
-        LV_LOG_ERROR("Can't handle 2 screen sized buffers with set_px_cb. Display will not be refreshed.");
+    if(lv_disp_is_true_double_buf(disp) && (disp->driver.set_px_cb || disp->driver.mono_page)) {
+        LV_LOG_ERROR("Can't handle 2 screen sized buffers with set_px_cb or mono_page. Display will not be refreshed.");
     }
 
     return disp;
@@ -196,6 +209,13 @@ void lv_disp_drv_update(lv_disp_t * disp, lv_disp_drv_t * new_drv)
     _lv_memset_00(disp->inv_areas, sizeof(disp->inv_areas));
     _lv_memset_00(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
+#if LV_USE_FAST_SCROLL
+    disp->scroll_pending = 0;
+#endif
+#if LV_USE_SCR_SNAPSHOT
+    /*The snapshots were rendered with the old resolution*/
+    _lv_scr_snapshot_clean(disp);
+#endif
     if(disp->act_scr != NULL)
         lv_obj_invalidate(disp->act_scr);
 }
@@ -219,6 +239,12 @@ void lv_disp_remove(lv_disp_t * disp)
         indev = lv_indev_get_next(indev);
     }
 
+#if LV_USE_SCR_SNAPSHOT
+    _lv_scr_snapshot_clean(disp);
+    _lv_ll_clear(&disp->snapshot_ll);
+    if(disp->snapshot_task) lv_task_del(disp->snapshot_task);
+#endif
+
     _lv_ll_remove(&LV_GC_ROOT(_lv_disp_ll), disp);
     lv_mem_free(disp);
 
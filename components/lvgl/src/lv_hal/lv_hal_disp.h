@@ -30,6 +30,14 @@ extern "C" {
 #define LV_INV_BUF_SIZE 32 /*Buffer size for invalid areas */
 #endif
 
+#ifndef LV_INV_MERGE_BUF_SIZE
+#define LV_INV_MERGE_BUF_SIZE 8 /*Buffer size for the areas merged while the deferred layouts are refreshed*/
+#endif
+
+#ifndef LV_SCR_SNAPSHOT_DIRTY_CNT
+#define LV_SCR_SNAPSHOT_DIRTY_CNT 4 /*Number of separate changed areas kept per screen snapshot*/
+#endif
+
 #ifndef LV_ATTRIBUTE_FLUSH_READY
 #define LV_ATTRIBUTE_FLUSH_READY
 #endif
@@ -40,6 +48,7 @@ extern "C" {
 
 struct _disp_t;
 struct _disp_drv_t;
+struct _lv_draw_backend_t;
 
 /**
  * Structure for holding display buffer information.
@@ -86,6 +95,14 @@ typedef struct _disp_drv_t {
     uint32_t rotated : 2;
     uint32_t sw_rotate : 1; /**< 1: use software rotation (slower) */
 
+    /** 1: the buffer is packed 1 bit per pixel in pages as in the GDDRAM of SSD1306/SH1107 like
+     * monochrome controllers: a byte holds 8 vertical pixels (LSB on top) and the bytes of a page
+     * (8 rows) follow each other. The bit of dark pixels (`lv_color_to1(color) == 0`) is set.
+     * LVGL blends directly into this format so `set_px_cb` is not required.
+     * The `size` of `lv_disp_buf_t` is still in pixels, i.e. 8 times the buffer's size in bytes.
+     * Can't be used with software rotation, `screen_transp` and 2 screen sized buffers.*/
+    uint32_t mono_page : 1;
+
 #if LV_COLOR_SCREEN_TRANSP
     /**Handle if the screen doesn't have a solid (opa == LV_OPA_COVER) background.
      * Use only if required because it's slower.*/
@@ -137,6 +154,19 @@ typedef struct _disp_drv_t {
                         const lv_area_t * fill_area, lv_color_t color);
 #endif
 
+#if LV_USE_DRAW_BACKEND
+    /** OPTIONAL: Draw the frames natively with the display controller instead of rendering
+     * into `buffer` (see `lv_draw_backend.h`). `flush_cb` is still used if the backend can't draw a frame*/
+    const struct _lv_draw_backend_t * draw_backend;
+#endif
+
+#if LV_USE_FAST_SCROLL
+    /** OPTIONAL: Move the content of `area` on the display by `dx` and `dy` (e.g. with the controller's
+     * hardware scrolling). Called before the newly exposed band is redrawn.
+     * Return `false` if the display can't move this area, then the whole area is redrawn.*/
+    bool (*scroll_cb)(struct _disp_drv_t * disp_drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy);
+#endif
+
     /** On CHROMA_KEYED images this color will be transparent.
      * `LV_COLOR_TRANSP` by default. (lv_conf.h)*/
     lv_color_t color_chroma_key;
@@ -149,6 +179,31 @@ typedef struct _disp_drv_t {
 
 struct _lv_obj_t;
 
+#if LV_USE_SCR_SNAPSHOT
+/**
+ * State of a snapshot being rendered strip by strip
+ */
+typedef struct {
+    uint8_t * data;             /**< The pixels encoded so far. NULL if the rendering is not started*/
+    uint32_t size;              /**< Number of used bytes in `data`*/
+    uint32_t capacity;          /**< Number of allocated bytes in `data`*/
+    lv_coord_t y;               /**< The next row to render*/
+} lv_scr_snapshot_enc_t;
+
+/**
+ * A screen rendered off-screen (see `lv_scr_snapshot_enable()`)
+ */
+typedef struct _lv_scr_snapshot_t {
+    struct _lv_obj_t * scr;     /**< The screen of the snapshot*/
+    uint8_t * data;             /**< The run length encoded pixels. NULL if not rendered yet*/
+    uint32_t data_size;         /**< Size of `data` in bytes*/
+    lv_scr_snapshot_enc_t enc;  /**< The new pixels being rendered*/
+    lv_area_t dirty[LV_SCR_SNAPSHOT_DIRTY_CNT]; /**< Areas of the screen changed since it was rendered.
+                                                 *   The overlapping and touching areas are joined.*/
+    uint8_t dirty_cnt;          /**< Number of areas in `dirty`*/
+} lv_scr_snapshot_t;
+#endif
+
 /**
  * Display structure.
  * @note `lv_disp_drv_t` should be the first member of the structure.
@@ -169,6 +224,15 @@ typedef struct _disp_t {
 #endif
     struct _lv_obj_t * top_layer; /**< @see lv_disp_get_layer_top */
     struct _lv_obj_t * sys_layer; /**< @see lv_disp_get_layer_sys */
+#if LV_USE_SCR_SNAPSHOT
+    lv_ll_t snapshot_ll;                /**< Snapshots of the screens (`lv_scr_snapshot_t`)*/
+    lv_task_t * snapshot_task;          /**< Renders the outdated snapshots when the display is idle*/
+    lv_scr_snapshot_t * snapshot_show;  /**< Flush this snapshot instead of drawing the loaded screen*/
+#endif
+#if LV_USE_DRAW_BACKEND
+    struct _lv_obj_t * native_fail_scr; /**< The active screen when the draw backend failed*/
+    struct _lv_obj_t * native_fail_obj; /**< The object the draw backend couldn't draw or `NULL` if not known*/
+#endif
 
 uint8_t del_prev  :
     1;        /**< 1: Automatically delete the previous screen when the screen load animation is ready */
@@ -180,7 +244,24 @@ uint8_t del_prev  :
     /** Invalidated (marked to redraw) areas*/
     lv_area_t inv_areas[LV_INV_BUF_SIZE];
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+#if LV_USE_LAYOUT_DEFER
+    lv_area_t inv_merged[LV_INV_MERGE_BUF_SIZE]; /**< Areas invalidated while refreshing the deferred layouts.
+                                                      *   The overlapping and touching areas are joined.*/
+    uint8_t inv_merged_cnt;     /**< Number of areas in `inv_merged`*/
+#endif
+#if LV_USE_FAST_SCROLL
+    lv_area_t scroll_area;      /**< Area whose content will be moved before the next refresh*/
+    lv_point_t scroll_ofs;      /**< Movement of the content of `scroll_area`*/
+#endif
     uint32_t inv_p : 10;
+#if LV_USE_DRAW_BACKEND
+    uint32_t draw_native : 1;   /**< 1: the last frame was drawn by the draw backend*/
+    uint32_t native_failed : 1; /**< 1: the backend couldn't draw the screen, don't try again until it changes*/
+#endif
+#if LV_USE_FAST_SCROLL
+    uint32_t scroll_pending : 1;   /**< 1: the content of `scroll_area` will be moved*/
+    uint32_t scroll_synced : 1;    /**< 1: `scroll_area` was moved in the frame buffer and should be synchronized*/
+#endif
 
     /*Miscellaneous data*/
     uint32_t last_activity_time; /**< Last time there was activity on this display */
@@ -24,6 +24,7 @@
  **********************/
 
 static bool lv_point_within_circle(const lv_area_t * area, const lv_point_t * p);
+static bool area_is_touching(const lv_area_t * a1_p, const lv_area_t * a2_p);
 
 /**********************
  *  STATIC VARIABLES
@@ -264,6 +265,61 @@ bool _lv_area_is_in(const lv_area_t * ain_p, const lv_area_t * aholder_p, lv_coo
     return true;
 }
 
+/**
+ * Add an area to a list of areas. The area is joined with the areas it overlaps or touches
+ * so separate areas remain separate. If the list is full the area is joined with the one
+ * whose size grows the least.
+ * Used for the areas invalidated by the deferred layouts (`lv_refr.c`) and the changed areas of the
+ * screen snapshots (`lv_disp.c`).
+ * @param areas pointer to an array of areas
+ * @param cnt pointer to the number of used areas in `areas`. Updated by the function.
+ * @param max size of the `areas` array
+ * @param area_p the area to add
+ */
+void _lv_area_list_add(lv_area_t * areas, uint8_t * cnt, uint8_t max, const lv_area_t * area_p)
+{
+    lv_area_t area;
+    lv_area_copy(&area, area_p);
+
+    while(1) {
+        /*The joined area might reach other areas too so check all of them again*/
+        uint32_t i = 0;
+        while(i < *cnt) {
+            if(area_is_touching(&area, &areas[i])) {
+                _lv_area_join(&area, &area, &areas[i]);
+                (*cnt)--;
+                lv_area_copy(&areas[i], &areas[*cnt]);
+                i = 0;
+            }
+            else {
+                i++;
+            }
+        }
+
+        if(*cnt < max) {
+            lv_area_copy(&areas[*cnt], &area);
+            (*cnt)++;
+            return;
+        }
+
+        uint32_t best = 0;
+        uint32_t best_grow = 0;
+        for(i = 0; i < *cnt; i++) {
+            lv_area_t joined;
+            _lv_area_join(&joined, &area, &areas[i]);
+            uint32_t grow = lv_area_get_size(&joined) - lv_area_get_size(&areas[i]);
+            if(i == 0 || grow < best_grow) {
+                best = i;
+                best_grow = grow;
+            }
+        }
+
+        _lv_area_join(&area, &area, &areas[best]);
+        (*cnt)--;
+        lv_area_copy(&areas[best], &areas[*cnt]);
+    }
+}
+
 /**
  * Align an area to an other
  * @param base an are where the other will be aligned
@@ -407,3 +463,15 @@ static bool lv_point_within_circle(const lv_area_t * area, const lv_point_t * p)
     else
         return false;
 }
+
+/**
+ * Check if two areas overlap or touch each other
+ * @param a1_p pointer to an area
+ * @param a2_p pointer to an other area
+ * @return true: there is no gap between the areas
+ */
+static bool area_is_touching(const lv_area_t * a1_p, const lv_area_t * a2_p)
+{
+    return a1_p->x1 <= a2_p->x2 + 1 && a1_p->x2 + 1 >= a2_p->x1 &&
+           a1_p->y1 <= a2_p->y2 + 1 && a1_p->y2 + 1 >= a2_p->y1;
+}
@@ -191,6 +191,19 @@ bool _lv_area_is_on(const lv_area_t * a1_p, const lv_area_t * a2_p);
  */
 bool _lv_area_is_in(const lv_area_t * ain_p, const lv_area_t * aholder_p, lv_coord_t radius);
 
+/**
+ * Add an area to a list of areas. The area is joined with the areas it overlaps or touches
+ * so separate areas remain separate. If the list is full the area is joined with the one
+ * whose size grows the least.
+ * Used for the areas invalidated by the deferred layouts (`lv_refr.c`) and the changed areas of the
+ * screen snapshots (`lv_disp.c`).
+ * @param areas pointer to an array of areas
+ * @param cnt pointer to the number of used areas in `areas`. Updated by the function.
+ * @param max size of the `areas` array
+ * @param area_p the area to add
+ */
+void _lv_area_list_add(lv_area_t * areas, uint8_t * cnt, uint8_t max, const lv_area_t * area_p);
+
 /**
  * Align an area to an other
  * @param base an are where the other will be aligned
@@ -34,10 +34,17 @@
  *  STATIC PROTOTYPES
  **********************/
 static const char * lv_fs_get_real_path(const char * path);
+#if LV_FS_CACHE_SIZE
+static void cache_init(lv_fs_file_t * file_p);
+static lv_fs_res_t cache_read(lv_fs_file_t * file_p, uint8_t * buf, uint32_t btr, uint32_t * br);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_FS_CACHE_SIZE
+static lv_fs_cache_stat_t cache_stat;
+#endif
 
 /**********************
  *      MACROS
@@ -83,6 +90,9 @@ lv_fs_res_t lv_fs_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mo
 {
     file_p->drv    = NULL;
     file_p->file_d = NULL;
+#if LV_FS_CACHE_SIZE
+    file_p->cache  = NULL;
+#endif
 
     if(path == NULL) return LV_FS_RES_INV_PARAM;
 
@@ -110,7 +120,11 @@ lv_fs_res_t lv_fs_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mo
 
     if(file_p->drv->file_size == 0) {  /*Is file_d zero size?*/
         /*Pass file_d's address to open_cb, so the implementor can allocate memory byself*/
-        return file_p->drv->open_cb(file_p->drv, &file_p->file_d, real_path, mode);
+        lv_fs_res_t res = file_p->drv->open_cb(file_p->drv, &file_p->file_d, real_path, mode);
+#if LV_FS_CACHE_SIZE
+        if(res == LV_FS_RES_OK && mode == LV_FS_MODE_RD) cache_init(file_p);
+#endif
+        return res;
     }
 
     file_p->file_d = lv_mem_alloc(file_p->drv->file_size);
@@ -127,6 +141,11 @@ lv_fs_res_t lv_fs_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mo
         file_p->file_d = NULL;
         file_p->drv    = NULL;
     }
+#if LV_FS_CACHE_SIZE
+    else if(mode == LV_FS_MODE_RD) {
+        cache_init(file_p);
+    }
+#endif
 
     return res;
 }
@@ -152,6 +171,13 @@ lv_fs_res_t lv_fs_close(lv_fs_file_t * file_p)
     file_p->file_d = NULL;
     file_p->drv    = NULL;
 
+#if LV_FS_CACHE_SIZE
+    if(file_p->cache) {
+        lv_mem_free(file_p->cache);
+        file_p->cache = NULL;
+    }
+#endif
+
     return res;
 }
 
@@ -195,7 +221,13 @@ lv_fs_res_t lv_fs_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t
     if(file_p->drv->read_cb == NULL) return LV_FS_RES_NOT_IMP;
 
     uint32_t br_tmp = 0;
-    lv_fs_res_t res = file_p->drv->read_cb(file_p->drv, file_p->file_d, buf, btr, &br_tmp);
+    lv_fs_res_t res;
+#if LV_FS_CACHE_SIZE
+    if(file_p->cache) res = cache_read(file_p, buf, btr, &br_tmp);
+    else res = file_p->drv->read_cb(file_p->drv, file_p->file_d, buf, btr, &br_tmp);
+#else
+    res = file_p->drv->read_cb(file_p->drv, file_p->file_d, buf, btr, &br_tmp);
+#endif
     if(br != NULL) *br = br_tmp;
 
     return res;
@@ -244,6 +276,14 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos)
         return LV_FS_RES_NOT_IMP;
     }
 
+#if LV_FS_CACHE_SIZE
+    /*Only move the user's read pointer. The driver is seeked when it needs to read.*/
+    if(file_p->cache) {
+        file_p->cache->pos = pos;
+        return LV_FS_RES_OK;
+    }
+#endif
+
     lv_fs_res_t res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos);
 
     return res;
@@ -262,6 +302,13 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
         return LV_FS_RES_INV_PARAM;
     }
 
+#if LV_FS_CACHE_SIZE
+    if(file_p->cache) {
+        *pos = file_p->cache->pos;
+        return LV_FS_RES_OK;
+    }
+#endif
+
     if(file_p->drv->tell_cb == NULL) {
         *pos = 0;
         return LV_FS_RES_NOT_IMP;
@@ -313,6 +360,25 @@ lv_fs_res_t lv_fs_size(lv_fs_file_t * file_p, uint32_t * size)
     return res;
 }
 
+#if LV_FS_CACHE_SIZE
+/**
+ * Get the statistics of the file read caches since the start or the last reset
+ * @param stat pointer to a variable to store the statistics
+ */
+void lv_fs_cache_get_stat(lv_fs_cache_stat_t * stat)
+{
+    _lv_memcpy_small(stat, &cache_stat, sizeof(lv_fs_cache_stat_t));
+}
+
+/**
+ * Reset the statistics of the file read caches
+ */
+void lv_fs_cache_reset_stat(void)
+{
+    _lv_memset_00(&cache_stat, sizeof(lv_fs_cache_stat_t));
+}
+#endif
+
 /**
  * Rename a file
  * @param oldname path to the file
@@ -661,4 +727,101 @@ static const char * lv_fs_get_real_path(const char * path)
     return path;
 }
 
+#if LV_FS_CACHE_SIZE
+/**
+ * Allocate the read cache of a file. Without memory the file is simply used without cache.
+ * @param file_p pointer to a just opened lv_fs_file_t variable
+ */
+static void cache_init(lv_fs_file_t * file_p)
+{
+    /*Allocate the descriptor and the buffer together*/
+    lv_fs_file_cache_t * cache = lv_mem_alloc(sizeof(lv_fs_file_cache_t) + LV_FS_CACHE_SIZE);
+    if(cache == NULL) {
+        LV_LOG_WARN("lv_fs_open: couldn't allocate the read cache, the file is used without it");
+        return;
+    }
+
+    cache->buf = (uint8_t *)(cache + 1);
+    cache->start = 0;
+    cache->end = 0;
+    cache->pos = 0;
+    cache->drv_pos = 0;
+
+    file_p->cache = cache;
+}
+
+/**
+ * Read from a cached file. The bytes are copied from the cache if possible.
+ * Otherwise the cache is refilled with the next `LV_FS_CACHE_SIZE` bytes (read-ahead)
+ * or large reads go directly to `buf`.
+ * @param file_p pointer to a lv_fs_file_t variable with cache
+ * @param buf pointer to a buffer where the read bytes are stored
+ * @param btr Bytes To Read
+ * @param br store the number of real read bytes here
+ * @return LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t cache_read(lv_fs_file_t * file_p, uint8_t * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_file_cache_t * cache = file_p->cache;
+    lv_fs_drv_t * drv = file_p->drv;
+    lv_fs_res_t res = LV_FS_RES_OK;
+    bool drv_used = false;
+    bool eof = false;
+
+    *br = 0;
+    while(*br < btr) {
+        /*Copy the bytes which are already in the cache*/
+        if(cache->pos >= cache->start && cache->pos < cache->end) {
+            uint32_t n = LV_MATH_MIN(btr - *br, cache->end - cache->pos);
+            _lv_memcpy(buf + *br, &cache->buf[cache->pos - cache->start], n);
+            *br += n;
+            cache->pos += n;
+            continue;
+        }
+
+        /*A short read of the driver means the end of the file. Don't read again, some drivers report it as an error.*/
+        if(eof) break;
+
+        drv_used = true;
+
+        /*The read pointer was moved by `lv_fs_seek`*/
+        if(cache->drv_pos != cache->pos) {
+            if(drv->seek_cb == NULL) return LV_FS_RES_NOT_IMP;
+            res = drv->seek_cb(drv, file_p->file_d, cache->pos);
+            if(res != LV_FS_RES_OK) break;
+            cache->drv_pos = cache->pos;
+        }
+
+        uint32_t rest = btr - *br;
+        uint32_t req;
+        uint32_t n = 0;
+        if(rest >= LV_FS_CACHE_SIZE) {
+            /*Buffering wouldn't help so read directly. The cache remains valid.*/
+            req = rest;
+            res = drv->read_cb(drv, file_p->file_d, buf + *br, req, &n);
+            *br += n;
+            cache->pos += n;
+        }
+        else {
+            req = LV_FS_CACHE_SIZE;
+            res = drv->read_cb(drv, file_p->file_d, cache->buf, req, &n);
+            cache->start = cache->pos;
+            cache->end = res == LV_FS_RES_OK ? cache->pos + n : cache->pos;
+        }
+        cache->drv_pos += n;
+
+        cache_stat.drv_read_cnt++;
+        cache_stat.drv_read_size += n;
+
+        if(res != LV_FS_RES_OK || n == 0) break;
+        if(n < req) eof = true;
+    }
+
+    if(drv_used) cache_stat.miss++;
+    else cache_stat.hit++;
+
+    return res;
+}
+#endif
+
 #endif /*LV_USE_FILESYSTEM*/
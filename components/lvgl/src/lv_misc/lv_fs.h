@@ -87,9 +87,35 @@ typedef struct _lv_fs_drv_t {
 #endif
 } lv_fs_drv_t;
 
+#if LV_FS_CACHE_SIZE
+/**
+ * Read cache of a file. `buf` holds the bytes of the file in the `[start, end)` range.
+ */
+typedef struct {
+    uint8_t * buf;
+    uint32_t start;     /*File position of `buf[0]`*/
+    uint32_t end;       /*File position after the last valid byte of `buf`*/
+    uint32_t pos;       /*Position of the read pointer seen by the user*/
+    uint32_t drv_pos;   /*Position of the read pointer in the driver*/
+} lv_fs_file_cache_t;
+
+/**
+ * Statistics of the file read caches
+ */
+typedef struct {
+    uint32_t hit;           /*Number of reads served from the cache only*/
+    uint32_t miss;          /*Number of reads that needed the driver*/
+    uint32_t drv_read_cnt;  /*Number of driver read calls*/
+    uint32_t drv_read_size; /*Bytes read by the driver*/
+} lv_fs_cache_stat_t;
+#endif
+
 typedef struct {
     void * file_d;
     lv_fs_drv_t * drv;
+#if LV_FS_CACHE_SIZE
+    lv_fs_file_cache_t * cache; /*NULL if the file is not cached*/
+#endif
 } lv_fs_file_t;
 
 typedef struct {
@@ -211,6 +237,19 @@ lv_fs_res_t lv_fs_trunc(lv_fs_file_t * file_p);
  */
 lv_fs_res_t lv_fs_size(lv_fs_file_t * file_p, uint32_t * size);
 
+#if LV_FS_CACHE_SIZE
+/**
+ * Get the statistics of the file read caches since the start or the last reset
+ * @param stat pointer to a variable to store the statistics
+ */
+void lv_fs_cache_get_stat(lv_fs_cache_stat_t * stat);
+
+/**
+ * Reset the statistics of the file read caches
+ */
+void lv_fs_cache_reset_stat(void);
+#endif
+
 /**
  * Rename a file
  * @param oldname path to the file
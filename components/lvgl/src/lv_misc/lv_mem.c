@@ -11,6 +11,8 @@
 #include "lv_math.h"
 #include "lv_gc.h"
 #include "lv_debug.h"
+#include "lv_prof.h"
+#include "lv_printf.h"
 #include <string.h>
 
 #if LV_MEM_CUSTOM != 0
@@ -35,6 +37,35 @@
     #define MEM_UNIT uint32_t
 #endif
 
+/*The slab lists need a flag in the block headers so they are used only with the built-in allocator*/
+#if LV_MEM_CUSTOM == 0
+    #define MEM_SLAB (LV_MEM_SLAB_MAX_SIZE > 0)
+#else
+    #define MEM_SLAB 0
+#endif
+
+#if LV_MEM_TELEMETRY
+    #if LV_ENABLE_GC
+        #error "LV_MEM_TELEMETRY requires the block headers which are not used with LV_ENABLE_GC"
+    #endif
+    #if LV_MEM_TELEMETRY_TAG_CNT > 128
+        #error "LV_MEM_TELEMETRY_TAG_CNT can be at most 128"
+    #endif
+
+    /*The tag index is stored in the header so the size is limited*/
+    #define MEM_D_SIZE_BITS (24 - MEM_SLAB)
+    #define MEM_BLOCK_SIZE_MAX ((1UL << MEM_D_SIZE_BITS) - 1)
+    #if LV_MEM_CUSTOM == 0 && LV_MEM_SIZE > MEM_BLOCK_SIZE_MAX
+        #error "LV_MEM_SIZE can be at most 16 MB (8 MB with LV_MEM_SLAB_MAX_SIZE) with LV_MEM_TELEMETRY"
+    #endif
+
+    #if LV_MEM_TELEMETRY_CALLER
+        #define MEM_CALLER_ADDR() __builtin_return_address(0)
+    #else
+        #define MEM_CALLER_ADDR() NULL
+    #endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -45,7 +76,15 @@
 typedef union {
     struct {
         MEM_UNIT used : 1;    /* 1: if the entry is used*/
-        MEM_UNIT d_size : 31; /* Size of the data*/
+#if MEM_SLAB
+        MEM_UNIT cached : 1;  /* 1: freed but kept in a slab list (`used` remains 1)*/
+#endif
+#if LV_MEM_TELEMETRY
+        MEM_UNIT tag : 7;     /* Index of the tag in `tags`*/
+        MEM_UNIT d_size : MEM_D_SIZE_BITS; /* Size of the data*/
+#else
+        MEM_UNIT d_size : 31 - MEM_SLAB; /* Size of the data*/
+#endif
     } s;
     MEM_UNIT header; /* The header (used + d_size)*/
 } lv_mem_header_t;
@@ -65,6 +104,12 @@ typedef struct {
 
 #define MEM_BUF_SMALL_SIZE 16
 
+#if MEM_SLAB
+    /*One list for every size up to `LV_MEM_SLAB_MAX_SIZE` (the sizes are rounded to ALIGN_MASK)*/
+    #define MEM_SLAB_CNT (LV_MEM_SLAB_MAX_SIZE / (ALIGN_MASK + 1))
+    #define MEM_SLAB_NEXT(e) (*((lv_mem_ent_t **)&(e)->first_data))
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -72,6 +117,14 @@ typedef struct {
     static lv_mem_ent_t * ent_get_next(lv_mem_ent_t * act_e);
     static void * ent_alloc(lv_mem_ent_t * e, size_t size);
     static void ent_trunc(lv_mem_ent_t * e, size_t size);
+    static void * heap_alloc(size_t size);
+#endif
+
+#if LV_MEM_TELEMETRY
+    static uint8_t tag_get(const void * caller);
+    static void tag_add_block(uint8_t tag, uint32_t size);
+    static void tag_remove_block(uint8_t tag, uint32_t size);
+    static uint32_t hist_get_idx(uint32_t size);
 #endif
 
 /**********************
@@ -87,6 +140,12 @@ static uint32_t zero_mem; /*Give the address of this variable if 0 byte should b
     static uint32_t mem_max_size; /*Tracks the maximum total size of memory ever used from the internal heap*/
 #endif
 
+#if MEM_SLAB
+    static lv_mem_ent_t * slab_head[MEM_SLAB_CNT];  /*Freed blocks of `(i + 1) * (ALIGN_MASK + 1)` size*/
+    static uint32_t slab_cnt;                       /*Number of blocks in the slab lists*/
+    static uint32_t slab_size;                      /*Total data size of the blocks in the slab lists*/
+#endif
+
 static uint8_t mem_buf1_32[MEM_BUF_SMALL_SIZE];
 static uint8_t mem_buf2_32[MEM_BUF_SMALL_SIZE];
 
@@ -94,6 +153,14 @@ static lv_mem_buf_t mem_buf_small[] = {{.p = mem_buf1_32, .size = MEM_BUF_SMALL_
     {.p = mem_buf2_32, .size = MEM_BUF_SMALL_SIZE, .used = 0}
 };
 
+#if LV_MEM_TELEMETRY
+    static lv_mem_tag_stat_t tags[LV_MEM_TELEMETRY_TAG_CNT];   /*tags[0]: untagged and the ones not fitting*/
+    static uint32_t tag_cnt = 1;
+    static uint32_t hist[LV_MEM_HIST_CNT];
+    static const char * tag_act;
+    static int16_t tag_realloc = -1;    /*>= 0: tag of the block being allocated by `lv_mem_realloc`*/
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -141,6 +208,19 @@ void _lv_mem_deinit(void)
     full->header.s.used = 0;
     /*The total mem size reduced by the first header and the close patterns */
     full->header.s.d_size = LV_MEM_SIZE - sizeof(lv_mem_header_t);
+
+#if MEM_SLAB
+    _lv_memset_00(slab_head, sizeof(slab_head));
+    slab_cnt = 0;
+    slab_size = 0;
+#endif
+
+#if LV_MEM_TELEMETRY
+    /*All the blocks are freed*/
+    _lv_memset_00(tags, sizeof(tags));
+    _lv_memset_00(hist, sizeof(hist));
+    tag_cnt = 1;
+#endif
 #endif
 }
 
@@ -151,6 +231,8 @@ void _lv_mem_deinit(void)
  */
 void * lv_mem_alloc(size_t size)
 {
+    _LV_PROF_COUNT(LV_PROF_CNT_ALLOC, 1);
+
     if(size == 0) {
         return &zero_mem;
     }
@@ -159,21 +241,39 @@ void * lv_mem_alloc(size_t size)
     size = (size + ALIGN_MASK) & (~ALIGN_MASK);
     void * alloc = NULL;
 
+#if LV_MEM_TELEMETRY
+    if(size > MEM_BLOCK_SIZE_MAX) {
+        LV_LOG_WARN("lv_mem_alloc: the block is too large for LV_MEM_TELEMETRY");
+        return NULL;
+    }
+#endif
+
 #if LV_MEM_CUSTOM == 0
     /*Use the built-in allocators*/
-    lv_mem_ent_t * e = NULL;
-
-    /* Search for a appropriate entry*/
-    do {
-        /* Get the next entry*/
-        e = ent_get_next(e);
-
-        /*If there is next entry then try to allocate there*/
+#if MEM_SLAB
+    /*Reuse a freed block of the same size if there is any*/
+    if(size <= MEM_SLAB_CNT * (ALIGN_MASK + 1)) {
+        uint32_t slab_i = size / (ALIGN_MASK + 1) - 1;
+        lv_mem_ent_t * e = slab_head[slab_i];
         if(e != NULL) {
-            alloc = ent_alloc(e, size);
+            slab_head[slab_i] = MEM_SLAB_NEXT(e);
+            slab_cnt--;
+            slab_size -= e->header.s.d_size;
+            e->header.s.cached = 0;
+            alloc = &e->first_data;
         }
-        /* End if there is not next entry OR the alloc. is successful*/
-    } while(e != NULL && alloc == NULL);
+    }
+
+    if(alloc == NULL) alloc = heap_alloc(size);
+
+    /*Give the kept blocks back to the heap and try again*/
+    if(alloc == NULL && slab_cnt != 0) {
+        lv_mem_slab_flush();
+        alloc = heap_alloc(size);
+    }
+#else
+    alloc = heap_alloc(size);
+#endif
 
 #else
     /*Use custom, user defined malloc function*/
@@ -199,6 +299,12 @@ void * lv_mem_alloc(size_t size)
         LV_LOG_WARN("Couldn't allocate memory");
     }
     else {
+#if LV_MEM_TELEMETRY
+        lv_mem_ent_t * e_tag = (lv_mem_ent_t *)((uint8_t *)alloc - sizeof(lv_mem_header_t));
+        e_tag->header.s.tag = tag_realloc >= 0 ? (uint8_t)tag_realloc : tag_get(MEM_CALLER_ADDR());
+        tag_add_block(e_tag->header.s.tag, e_tag->header.s.d_size);
+#endif
+
 #if LV_MEM_CUSTOM == 0
         /* just a safety check, should always be true */
         if((uintptr_t) alloc > (uintptr_t) work_mem) {
@@ -221,13 +327,34 @@ void lv_mem_free(const void * data)
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
+#if LV_ENABLE_GC == 0
+    /*e points to the header*/
+    lv_mem_ent_t * e = (lv_mem_ent_t *)((uint8_t *)data - sizeof(lv_mem_header_t));
+#if MEM_SLAB
+    if(e->header.s.cached) return;  /*Already freed. Don't add junk as the data holds the next block of the list.*/
+#endif
+#endif
+
 #if LV_MEM_ADD_JUNK
     _lv_memset((void *)data, 0xbb, _lv_mem_get_size(data));
 #endif
 
 #if LV_ENABLE_GC == 0
-    /*e points to the header*/
-    lv_mem_ent_t * e = (lv_mem_ent_t *)((uint8_t *)data - sizeof(lv_mem_header_t));
+#if LV_MEM_TELEMETRY
+    tag_remove_block(e->header.s.tag, e->header.s.d_size);
+#endif
+#if MEM_SLAB
+    /*Keep the small blocks in the list of their size. They remain "used" for the heap.*/
+    if(e->header.s.d_size <= MEM_SLAB_CNT * (ALIGN_MASK + 1)) {
+        uint32_t slab_i = e->header.s.d_size / (ALIGN_MASK + 1) - 1;
+        e->header.s.cached = 1;
+        MEM_SLAB_NEXT(e) = slab_head[slab_i];
+        slab_head[slab_i] = e;
+        slab_cnt++;
+        slab_size += e->header.s.d_size;
+        return;
+    }
+#endif
     e->header.s.used = 0;
 #endif
 
@@ -286,6 +413,11 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
         if(e->header.s.used == 0) {
             data_p = NULL;
         }
+#if MEM_SLAB
+        else if(e->header.s.cached) {
+            data_p = NULL;
+        }
+#endif
     }
 
     uint32_t old_size = _lv_mem_get_size(data_p);
@@ -295,13 +427,35 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
     /* Truncate the memory if the new size is smaller. */
     if(new_size < old_size) {
         lv_mem_ent_t * e = (lv_mem_ent_t *)((uint8_t *)data_p - sizeof(lv_mem_header_t));
+#if LV_MEM_TELEMETRY
+        tag_remove_block(e->header.s.tag, e->header.s.d_size);
         ent_trunc(e, new_size);
+        tag_add_block(e->header.s.tag, e->header.s.d_size);
+        tags[e->header.s.tag].alloc_cnt--;  /*Not a new allocation*/
+#else
+        ent_trunc(e, new_size);
+#endif
         return &e->first_data;
     }
 #endif
 
+#if LV_MEM_TELEMETRY
+    /*`lv_mem_alloc` would see this function as caller. Keep the tag of the original block
+     *or use the tag of the caller of `lv_mem_realloc` for a new block.*/
+    uint8_t tag;
+    if(data_p != NULL) tag = ((lv_mem_ent_t *)((uint8_t *)data_p - sizeof(lv_mem_header_t)))->header.s.tag;
+    else tag = tag_get(MEM_CALLER_ADDR());
+    tag_realloc = tag;
+#endif
+
     void * new_p;
     new_p = lv_mem_alloc(new_size);
+
+#if LV_MEM_TELEMETRY
+    tag_realloc = -1;
+    if(new_p != NULL && new_p != &zero_mem && data_p != NULL) tags[tag].alloc_cnt--;    /*Not a new allocation*/
+#endif
+
     if(new_p == NULL) {
         LV_LOG_WARN("Couldn't allocate memory");
         return NULL;
@@ -373,6 +527,35 @@ void lv_mem_defrag(void)
 #endif
 }
 
+/**
+ * Give the freed blocks kept in the slab lists back to the heap.
+ * Useful e.g. after deleting a screen whose objects won't be created again to let the heap
+ * use the memory for blocks of other sizes. It also happens automatically if an allocation fails.
+ * @note It has effect only if `LV_MEM_CUSTOM == 0` and `LV_MEM_SLAB_MAX_SIZE > 0`
+ */
+void lv_mem_slab_flush(void)
+{
+#if MEM_SLAB
+    if(slab_cnt == 0) return;
+
+    uint32_t i;
+    for(i = 0; i < MEM_SLAB_CNT; i++) {
+        lv_mem_ent_t * e = slab_head[i];
+        while(e) {
+            lv_mem_ent_t * e_next = MEM_SLAB_NEXT(e);
+            e->header.s.cached = 0;
+            e->header.s.used = 0;
+            e = e_next;
+        }
+        slab_head[i] = NULL;
+    }
+
+    slab_cnt = 0;
+    slab_size = 0;
+    lv_mem_defrag();
+#endif
+}
+
 lv_res_t lv_mem_test(void)
 {
 #if LV_MEM_CUSTOM == 0
@@ -420,6 +603,12 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 
         e = ent_get_next(e);
     }
+#if MEM_SLAB
+    /*The blocks in the slab lists are "used" for the heap but free for the application*/
+    mon_p->used_cnt -= slab_cnt;
+    mon_p->free_cnt += slab_cnt;
+    mon_p->free_size += slab_size;
+#endif
     mon_p->total_size = LV_MEM_SIZE;
     mon_p->max_used = mem_max_size;
     mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
@@ -433,6 +622,156 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 #endif
 }
 
+#if LV_MEM_TELEMETRY
+
+/**
+ * Set the tag of the following allocations. E.g. tag the allocations of a subsystem or widget:
+ * `const char * old = lv_mem_tag_set("chart"); ... lv_mem_tag_set(old);`
+ * @param tag a string which stays valid (typically a literal). It's compared by address.
+ *            NULL: untagged (or the caller's address with `LV_MEM_TELEMETRY_CALLER`)
+ * @return the previous tag
+ */
+const char * lv_mem_tag_set(const char * tag)
+{
+    const char * old = tag_act;
+    tag_act = tag;
+    return old;
+}
+
+/**
+ * Save the current statistics of the tags, the size histogram and the heap
+ * @param snap store the snapshot here
+ */
+void lv_mem_snapshot(lv_mem_snapshot_t * snap)
+{
+    _lv_memcpy(snap->tags, tags, sizeof(tags));
+    _lv_memcpy_small(snap->hist, hist, sizeof(hist));
+    snap->tag_cnt = tag_cnt;
+    lv_mem_monitor(&snap->mon);
+}
+
+/**
+ * Compare two snapshots to find the tags whose memory grew or shrank, e.g. to find leaks
+ * @param before the earlier snapshot
+ * @param after the later snapshot
+ * @param diff array to store the changed tags
+ * @param diff_max size of `diff`
+ * @return number of changed tags (can be more than `diff_max`)
+ */
+uint32_t lv_mem_snapshot_diff(const lv_mem_snapshot_t * before, const lv_mem_snapshot_t * after,
+                              lv_mem_tag_diff_t * diff, uint32_t diff_max)
+{
+    uint32_t diff_cnt = 0;
+    uint32_t i;
+    uint32_t j;
+
+    /*Tags can be reused so find the tags by key*/
+    for(i = 0; i < after->tag_cnt; i++) {
+        const lv_mem_tag_stat_t * a = &after->tags[i];
+        int32_t size = a->cur_size;
+        int32_t cnt = a->cur_cnt;
+
+        for(j = 0; j < before->tag_cnt; j++) {
+            if(before->tags[j].key == a->key) {
+                size -= before->tags[j].cur_size;
+                cnt -= before->tags[j].cur_cnt;
+                break;
+            }
+        }
+
+        if(size == 0 && cnt == 0) continue;
+
+        if(diff_cnt < diff_max) {
+            diff[diff_cnt].key = a->key;
+            diff[diff_cnt].is_addr = a->is_addr;
+            diff[diff_cnt].size = size;
+            diff[diff_cnt].cnt = cnt;
+        }
+        diff_cnt++;
+    }
+
+    /*Tags whose blocks were all freed and which were reused for an other key since `before`*/
+    for(j = 0; j < before->tag_cnt; j++) {
+        const lv_mem_tag_stat_t * b = &before->tags[j];
+        if(b->cur_cnt == 0) continue;
+
+        for(i = 0; i < after->tag_cnt; i++) {
+            if(after->tags[i].key == b->key) break;
+        }
+        if(i < after->tag_cnt) continue;
+
+        if(diff_cnt < diff_max) {
+            diff[diff_cnt].key = b->key;
+            diff[diff_cnt].is_addr = b->is_addr;
+            diff[diff_cnt].size = -(int32_t)b->cur_size;
+            diff[diff_cnt].cnt = -(int32_t)b->cur_cnt;
+        }
+        diff_cnt++;
+    }
+
+    return diff_cnt;
+}
+
+/**
+ * Print a snapshot line by line
+ * @param snap pointer to a snapshot
+ * @param print_cb function to print a line, e.g. to the UART
+ */
+void lv_mem_snapshot_print(const lv_mem_snapshot_t * snap, lv_mem_print_cb_t print_cb)
+{
+    if(print_cb == NULL) return;
+
+    char line[128];
+
+#if LV_MEM_CUSTOM == 0
+    lv_snprintf(line, sizeof(line), "Heap: %lu of %lu bytes used (max. %lu), %lu free blocks, biggest %lu, %d%% frag.",
+                (unsigned long)(snap->mon.total_size - snap->mon.free_size), (unsigned long)snap->mon.total_size,
+                (unsigned long)snap->mon.max_used, (unsigned long)snap->mon.free_cnt,
+                (unsigned long)snap->mon.free_biggest_size, snap->mon.frag_pct);
+    print_cb(line);
+#endif
+
+    print_cb("Live blocks per size:");
+    uint32_t i;
+    uint32_t limit = 8;
+    for(i = 0; i < LV_MEM_HIST_CNT; i++) {
+        if(i < LV_MEM_HIST_CNT - 1) lv_snprintf(line, sizeof(line), "  <= %5lu: %lu", (unsigned long)limit,
+                                                    (unsigned long)snap->hist[i]);
+        else lv_snprintf(line, sizeof(line), "   > %5lu: %lu", (unsigned long)(limit >> 1),
+                             (unsigned long)snap->hist[i]);
+        print_cb(line);
+        limit <<= 1;
+    }
+
+    print_cb("Tags:                          size   blocks     max. size     allocs");
+    for(i = 0; i < snap->tag_cnt; i++) {
+        const lv_mem_tag_stat_t * t = &snap->tags[i];
+        char name[24];
+        if(t->key == NULL) lv_snprintf(name, sizeof(name), "%s", "(untagged)");
+        else if(t->is_addr) lv_snprintf(name, sizeof(name), "%p", t->key);
+        else lv_snprintf(name, sizeof(name), "%s", (const char *)t->key);
+
+        lv_snprintf(line, sizeof(line), "  %-24s %10lu %8lu %13lu %10lu", name,
+                    (unsigned long)t->cur_size, (unsigned long)t->cur_cnt,
+                    (unsigned long)t->max_size, (unsigned long)t->alloc_cnt);
+        print_cb(line);
+    }
+}
+
+/**
+ * Clear the allocation counters and high-water marks. The currently allocated sizes are kept.
+ */
+void lv_mem_telemetry_reset(void)
+{
+    uint32_t i;
+    for(i = 0; i < tag_cnt; i++) {
+        tags[i].max_size = tags[i].cur_size;
+        tags[i].alloc_cnt = 0;
+    }
+}
+
+#endif /*LV_MEM_TELEMETRY*/
+
 /**
  * Give the size of an allocated memory
  * @param data pointer to an allocated memory
@@ -758,6 +1097,31 @@ LV_ATTRIBUTE_FAST_MEM void _lv_memset_ff(void * dst, size_t len)
  **********************/
 
 #if LV_MEM_CUSTOM == 0
+/**
+ * Allocate a block from the first free entry which is large enough
+ * @param size size of the new memory in bytes (already rounded up to ALIGN_MASK)
+ * @return pointer to the allocated memory or NULL if there is no free entry large enough
+ */
+static void * heap_alloc(size_t size)
+{
+    void * alloc = NULL;
+    lv_mem_ent_t * e = NULL;
+
+    /* Search for a appropriate entry*/
+    do {
+        /* Get the next entry*/
+        e = ent_get_next(e);
+
+        /*If there is next entry then try to allocate there*/
+        if(e != NULL) {
+            alloc = ent_alloc(e, size);
+        }
+        /* End if there is not next entry OR the alloc. is successful*/
+    } while(e != NULL && alloc == NULL);
+
+    return alloc;
+}
+
 /**
  * Give the next entry after 'act_e'
  * @param act_e pointer to an entry
@@ -794,6 +1158,9 @@ static void * ent_alloc(lv_mem_ent_t * e, size_t size)
         /*Truncate the entry to the desired size */
         ent_trunc(e, size);
         e->header.s.used = 1;
+#if MEM_SLAB
+        e->header.s.cached = 0;
+#endif
 
         /*Save the allocated data*/
         alloc = &e->first_data;
@@ -830,3 +1197,94 @@ static void ent_trunc(lv_mem_ent_t * e, size_t size)
 }
 
 #endif
+
+#if LV_MEM_TELEMETRY
+
+/**
+ * Get the index of the current tag. Add it to `tags` if it's new.
+ * @param caller address of the allocating function. Used if no tag is set.
+ * @return index in `tags`. 0 if untagged or all the tags have live blocks.
+ */
+static uint8_t tag_get(const void * caller)
+{
+    const void * key = tag_act;
+    uint8_t is_addr = 0;
+    if(key == NULL) {
+        key = caller;
+        is_addr = 1;
+    }
+
+    if(key == NULL) return 0;
+
+    uint32_t i;
+    for(i = 1; i < tag_cnt; i++) {
+        if(tags[i].key == key) return i;
+    }
+
+    if(tag_cnt < LV_MEM_TELEMETRY_TAG_CNT) {
+        i = tag_cnt;
+        tag_cnt++;
+    }
+    else {
+        /*Reuse a tag without live blocks. No header refers to it anymore.*/
+        for(i = 1; i < tag_cnt; i++) {
+            if(tags[i].cur_cnt == 0) break;
+        }
+        if(i == tag_cnt) return 0;
+    }
+
+    _lv_memset_00(&tags[i], sizeof(lv_mem_tag_stat_t));
+    tags[i].key = key;
+    tags[i].is_addr = is_addr;
+
+    return i;
+}
+
+/**
+ * Account a new block to a tag and to the size histogram
+ * @param tag index of the tag
+ * @param size size of the block
+ */
+static void tag_add_block(uint8_t tag, uint32_t size)
+{
+    lv_mem_tag_stat_t * t = &tags[tag];
+    t->cur_size += size;
+    t->cur_cnt++;
+    t->alloc_cnt++;
+    if(t->cur_size > t->max_size) t->max_size = t->cur_size;
+
+    hist[hist_get_idx(size)]++;
+}
+
+/**
+ * Remove a freed block from a tag and from the size histogram
+ * @param tag index of the tag
+ * @param size size of the block
+ */
+static void tag_remove_block(uint8_t tag, uint32_t size)
+{
+    lv_mem_tag_stat_t * t = &tags[tag];
+    t->cur_size -= size;
+    t->cur_cnt--;
+
+    hist[hist_get_idx(size)]--;
+}
+
+/**
+ * Get the size class of a block
+ * @param size size of the block
+ * @return index in `hist`
+ */
+static uint32_t hist_get_idx(uint32_t size)
+{
+    uint32_t i = 0;
+    uint32_t limit = 8;
+    while(size > limit && i < LV_MEM_HIST_CNT - 1) {
+        limit <<= 1;
+        i++;
+    }
+
+    return i;
+}
+
+#endif /*LV_MEM_TELEMETRY*/
@@ -32,6 +32,11 @@ extern "C" {
 #define LV_MEM_BUF_MAX_NUM    16
 #endif
 
+#if LV_MEM_TELEMETRY
+/*Number of size classes in the block size histogram: <= 8, <= 16, ... <= 8192 and larger*/
+#define LV_MEM_HIST_CNT     12
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -59,6 +64,47 @@ typedef struct {
 typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_MEM_BUF_MAX_NUM];
 extern lv_mem_buf_arr_t _lv_mem_buf;
 
+#if LV_MEM_TELEMETRY
+
+/**
+ * Allocation statistics of a tag
+ */
+typedef struct {
+    const void * key;   /**< The tag set by `lv_mem_tag_set()` or the caller's address. NULL: untagged*/
+    uint8_t is_addr;    /**< 1: `key` is the address of the caller instead of a string*/
+    uint32_t cur_size;  /**< Size of the currently allocated blocks*/
+    uint32_t cur_cnt;   /**< Number of the currently allocated blocks*/
+    uint32_t max_size;  /**< High-water mark of `cur_size`*/
+    uint32_t alloc_cnt; /**< Number of allocations so far*/
+} lv_mem_tag_stat_t;
+
+/**
+ * State of the heap at a given moment
+ */
+typedef struct {
+    lv_mem_tag_stat_t tags[LV_MEM_TELEMETRY_TAG_CNT];
+    uint32_t tag_cnt;
+    uint32_t hist[LV_MEM_HIST_CNT];     /**< Number of live blocks per size class*/
+    lv_mem_monitor_t mon;               /**< Only the built-in allocator fills it*/
+} lv_mem_snapshot_t;
+
+/**
+ * Change of a tag between two snapshots
+ */
+typedef struct {
+    const void * key;
+    uint8_t is_addr;
+    int32_t size;       /**< Change of the allocated size*/
+    int32_t cnt;        /**< Change of the number of blocks*/
+} lv_mem_tag_diff_t;
+
+/**
+ * Print a line (without new line character), e.g. to the UART
+ */
+typedef void (*lv_mem_print_cb_t)(const char * line);
+
+#endif /*LV_MEM_TELEMETRY*/
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -101,6 +147,14 @@ void * lv_mem_realloc(void * data_p, size_t new_size);
  */
 void lv_mem_defrag(void);
 
+/**
+ * Give the freed blocks kept in the slab lists back to the heap.
+ * Useful e.g. after deleting a screen whose objects won't be created again to let the heap
+ * use the memory for blocks of other sizes. It also happens automatically if an allocation fails.
+ * @note It has effect only if `LV_MEM_CUSTOM == 0` and `LV_MEM_SLAB_MAX_SIZE > 0`
+ */
+void lv_mem_slab_flush(void);
+
 /**
  *
  * @return
@@ -114,6 +168,48 @@ lv_res_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+#if LV_MEM_TELEMETRY
+
+/**
+ * Set the tag of the following allocations. E.g. tag the allocations of a subsystem or widget:
+ * `const char * old = lv_mem_tag_set("chart"); ... lv_mem_tag_set(old);`
+ * @param tag a string which stays valid (typically a literal). It's compared by address.
+ *            NULL: untagged (or the caller's address with `LV_MEM_TELEMETRY_CALLER`)
+ * @return the previous tag
+ */
+const char * lv_mem_tag_set(const char * tag);
+
+/**
+ * Save the current statistics of the tags, the size histogram and the heap
+ * @param snap store the snapshot here
+ */
+void lv_mem_snapshot(lv_mem_snapshot_t * snap);
+
+/**
+ * Compare two snapshots to find the tags whose memory grew or shrank, e.g. to find leaks
+ * @param before the earlier snapshot
+ * @param after the later snapshot
+ * @param diff array to store the changed tags
+ * @param diff_max size of `diff`
+ * @return number of changed tags (can be more than `diff_max`)
+ */
+uint32_t lv_mem_snapshot_diff(const lv_mem_snapshot_t * before, const lv_mem_snapshot_t * after,
+                              lv_mem_tag_diff_t * diff, uint32_t diff_max);
+
+/**
+ * Print a snapshot line by line
+ * @param snap pointer to a snapshot
+ * @param print_cb function to print a line, e.g. to the UART
+ */
+void lv_mem_snapshot_print(const lv_mem_snapshot_t * snap, lv_mem_print_cb_t print_cb);
+
+/**
+ * Clear the allocation counters and high-water marks. The currently allocated sizes are kept.
+ */
+void lv_mem_telemetry_reset(void);
+
+#endif /*LV_MEM_TELEMETRY*/
+
 /**
  * Give the size of an allocated memory
  * @param data pointer to an allocated memory
@@ -0,0 +1,244 @@
+/**
+ * @file lv_prof.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_prof.h"
+
+#if LV_USE_PROFILER
+#include "lv_mem.h"
+#include "lv_printf.h"
+#include "../lv_core/lv_obj.h"
+#include "../lv_hal/lv_hal_tick.h"
+
+#if LV_PROFILER_TIME_CUSTOM
+#include LV_PROFILER_TIME_INCLUDE
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LINE_MAX    128
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_prof_obj_stat_t stat;
+    lv_design_cb_t design_cb;   /*Widget types are told apart by their design function*/
+} obj_type_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_prof_frame_t history[LV_PROFILER_HISTORY];
+static uint32_t history_next;   /*Index where the next frame will be saved*/
+static uint32_t history_cnt;
+static uint32_t frame_start;
+static uint32_t phase_time[_LV_PROF_PHASE_NUM];
+static obj_type_t obj_types[LV_PROFILER_OBJ_TYPES];
+static uint32_t obj_type_cnt;
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+uint32_t _lv_prof_cnt[_LV_PROF_CNT_NUM];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Get the number of frames in the history
+ * @return number of frames (at most `LV_PROFILER_HISTORY`)
+ */
+uint32_t lv_prof_get_frame_cnt(void)
+{
+    return history_cnt;
+}
+
+/**
+ * Get a frame from the history
+ * @param idx 0: the last frame, 1: the one before it, ...
+ * @return pointer to the frame or NULL if `idx` is out of the history
+ */
+const lv_prof_frame_t * lv_prof_get_frame(uint32_t idx)
+{
+    if(idx >= history_cnt) return NULL;
+
+    uint32_t i = (history_next + LV_PROFILER_HISTORY - 1 - idx) % LV_PROFILER_HISTORY;
+    return &history[i];
+}
+
+/**
+ * Get the number of widget types drawn since the last reset
+ * @return number of widget types
+ */
+uint32_t lv_prof_get_obj_stat_cnt(void)
+{
+    return obj_type_cnt;
+}
+
+/**
+ * Get the draw statistics of a widget type
+ * @param idx index of the widget type `[0 .. lv_prof_get_obj_stat_cnt() - 1]`
+ * @return pointer to the statistics or NULL if `idx` is invalid
+ */
+const lv_prof_obj_stat_t * lv_prof_get_obj_stat(uint32_t idx)
+{
+    if(idx >= obj_type_cnt) return NULL;
+
+    return &obj_types[idx].stat;
+}
+
+/**
+ * Clear the frame history, the counters and the widget type statistics
+ */
+void lv_prof_reset(void)
+{
+    history_next = 0;
+    history_cnt = 0;
+    obj_type_cnt = 0;
+    _lv_memset_00(history, sizeof(history));
+    _lv_memset_00(phase_time, sizeof(phase_time));
+    _lv_memset_00(_lv_prof_cnt, sizeof(_lv_prof_cnt));
+    _lv_memset_00(obj_types, sizeof(obj_types));
+}
+
+/**
+ * Print the frame history (newest first) and the widget type statistics line by line
+ * @param print_cb function to print a line, e.g. to the UART
+ */
+void lv_prof_dump(lv_prof_print_cb_t print_cb)
+{
+    if(print_cb == NULL) return;
+
+    char line[LINE_MAX];
+
+    lv_snprintf(line, sizeof(line), "Profiler: %lu frames, times in us", (unsigned long)history_cnt);
+    print_cb(line);
+    print_cb("   total    join   cover    draw   blend   flush |   inv px  refr px strips   style  alloc  hit miss");
+
+    uint32_t i;
+    for(i = 0; i < history_cnt; i++) {
+        const lv_prof_frame_t * f = lv_prof_get_frame(i);
+        lv_snprintf(line, sizeof(line), "%8lu%8lu%8lu%8lu%8lu%8lu |%9lu%9lu%7lu%8lu%7lu%5lu%5lu",
+                    (unsigned long)f->time,
+                    (unsigned long)f->phase_time[LV_PROF_PHASE_JOIN],
+                    (unsigned long)f->phase_time[LV_PROF_PHASE_COVER_CHK],
+                    (unsigned long)f->phase_time[LV_PROF_PHASE_DRAW],
+                    (unsigned long)f->phase_time[LV_PROF_PHASE_BLEND],
+                    (unsigned long)f->phase_time[LV_PROF_PHASE_FLUSH],
+                    (unsigned long)f->cnt[LV_PROF_CNT_INV_PX],
+                    (unsigned long)f->cnt[LV_PROF_CNT_REFR_PX],
+                    (unsigned long)f->cnt[LV_PROF_CNT_STRIP],
+                    (unsigned long)f->cnt[LV_PROF_CNT_STYLE_GET],
+                    (unsigned long)f->cnt[LV_PROF_CNT_ALLOC],
+                    (unsigned long)f->cnt[LV_PROF_CNT_IMG_CACHE_HIT],
+                    (unsigned long)f->cnt[LV_PROF_CNT_IMG_CACHE_MISS]);
+        print_cb(line);
+    }
+
+    print_cb("Draw time per widget type:");
+    for(i = 0; i < obj_type_cnt; i++) {
+        const lv_prof_obj_stat_t * s = &obj_types[i].stat;
+        lv_snprintf(line, sizeof(line), "%16s %10lu us %8lu draws", s->name ? s->name : "?",
+                    (unsigned long)s->time, (unsigned long)s->cnt);
+        print_cb(line);
+    }
+}
+
+/**
+ * Get the current time of the profiler's time source
+ * @return time in µs
+ */
+uint32_t _lv_prof_time(void)
+{
+#if LV_PROFILER_TIME_CUSTOM
+    return LV_PROFILER_TIME_US_EXPR;
+#else
+    return lv_tick_get() * 1000;
+#endif
+}
+
+/**
+ * Add time to a phase of the current frame
+ * @param phase a phase from `LV_PROF_PHASE_...`
+ * @param time time to add in µs
+ */
+void _lv_prof_add_time(lv_prof_phase_t phase, uint32_t time)
+{
+    phase_time[phase] += time;
+}
+
+/**
+ * Add the time of an object's draw to its type
+ * @param obj pointer to the drawn object
+ * @param time time of the draw in µs
+ */
+void _lv_prof_add_obj_time(const struct _lv_obj_t * obj, uint32_t time)
+{
+    uint32_t i;
+    for(i = 0; i < obj_type_cnt; i++) {
+        if(obj_types[i].design_cb == _LV_OBJ_DESIGN_CB(obj)) break;
+    }
+
+    if(i == obj_type_cnt) {
+        if(obj_type_cnt >= LV_PROFILER_OBJ_TYPES) return;
+
+        /*Getting the type is slow so do it only when a type is seen first*/
+        lv_obj_type_t type;
+        lv_obj_get_type(obj, &type);
+        obj_types[i].design_cb = _LV_OBJ_DESIGN_CB(obj);
+        obj_types[i].stat.name = type.type[0];
+        obj_type_cnt++;
+    }
+
+    obj_types[i].stat.time += time;
+    obj_types[i].stat.cnt++;
+}
+
+/**
+ * Mark the beginning of a refresh
+ */
+void _lv_prof_frame_start(void)
+{
+    frame_start = _lv_prof_time();
+    _lv_memset_00(phase_time, sizeof(phase_time));
+}
+
+/**
+ * Mark the end of a refresh and save the current frame to the history
+ */
+void _lv_prof_frame_end(void)
+{
+    lv_prof_frame_t * f = &history[history_next];
+    f->time = _lv_prof_time() - frame_start;
+    _lv_memcpy_small(f->phase_time, phase_time, sizeof(phase_time));
+    _lv_memcpy_small(f->cnt, _lv_prof_cnt, sizeof(_lv_prof_cnt));
+
+    history_next++;
+    if(history_next >= LV_PROFILER_HISTORY) history_next = 0;
+    if(history_cnt < LV_PROFILER_HISTORY) history_cnt++;
+
+    /*The counters collect the events until the next frame is saved*/
+    _lv_memset_00(_lv_prof_cnt, sizeof(_lv_prof_cnt));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#endif /*LV_USE_PROFILER*/
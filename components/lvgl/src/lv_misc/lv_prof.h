@@ -0,0 +1,189 @@
+/**
+ * @file lv_prof.h
+ * Built-in profiler: time of the refresh phases, draw time per widget type,
+ * counters and a history of the last frames.
+ */
+
+#ifndef LV_PROF_H
+#define LV_PROF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_PROFILER
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_obj_t;
+
+/**
+ * Timed phases of a refresh. The times are exclusive except `BLEND`
+ * which is part of `DRAW`.
+ */
+enum {
+    LV_PROF_PHASE_JOIN,         /*Joining the invalidated areas*/
+    LV_PROF_PHASE_COVER_CHK,    /*Searching the top object which covers the area*/
+    LV_PROF_PHASE_DRAW,         /*Drawing the objects (blending included)*/
+    LV_PROF_PHASE_BLEND,        /*Blending fills and maps into the buffer*/
+    LV_PROF_PHASE_FLUSH,        /*Waiting for the previous flush and calling `flush_cb`*/
+    _LV_PROF_PHASE_NUM
+};
+typedef uint8_t lv_prof_phase_t;
+
+/**
+ * Counted events
+ */
+enum {
+    LV_PROF_CNT_INV_PX,         /*Invalidated pixels (as saved by `_lv_inv_area`)*/
+    LV_PROF_CNT_REFR_PX,        /*Refreshed pixels after joining the areas*/
+    LV_PROF_CNT_STRIP,          /*Rendered strips (parts of areas fitting into the buffer)*/
+    LV_PROF_CNT_STYLE_GET,      /*Style property lookups*/
+    LV_PROF_CNT_ALLOC,          /*`lv_mem_alloc` calls*/
+    LV_PROF_CNT_IMG_CACHE_HIT,  /*Images found in the image cache*/
+    LV_PROF_CNT_IMG_CACHE_MISS, /*Images opened again by the decoder*/
+    _LV_PROF_CNT_NUM
+};
+typedef uint8_t lv_prof_cnt_t;
+
+/**
+ * A frame in the history. The times are in µs.
+ */
+typedef struct {
+    uint32_t time;                          /*Duration of the whole refresh*/
+    uint32_t phase_time[_LV_PROF_PHASE_NUM];
+    uint32_t cnt[_LV_PROF_CNT_NUM];         /*Events since the previous frame*/
+} lv_prof_frame_t;
+
+/**
+ * Accumulated draw time of a widget type
+ */
+typedef struct {
+    const char * name;  /*E.g. "lv_btn"*/
+    uint32_t time;      /*Sum of the `LV_DESIGN_DRAW_MAIN/POST` times in µs*/
+    uint32_t cnt;       /*Number of draws*/
+} lv_prof_obj_stat_t;
+
+/**
+ * Print a line of the dump (without new line character), e.g. to the UART
+ */
+typedef void (*lv_prof_print_cb_t)(const char * line);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the number of frames in the history
+ * @return number of frames (at most `LV_PROFILER_HISTORY`)
+ */
+uint32_t lv_prof_get_frame_cnt(void);
+
+/**
+ * Get a frame from the history
+ * @param idx 0: the last frame, 1: the one before it, ...
+ * @return pointer to the frame or NULL if `idx` is out of the history
+ */
+const lv_prof_frame_t * lv_prof_get_frame(uint32_t idx);
+
+/**
+ * Get the number of widget types drawn since the last reset
+ * @return number of widget types
+ */
+uint32_t lv_prof_get_obj_stat_cnt(void);
+
+/**
+ * Get the draw statistics of a widget type
+ * @param idx index of the widget type `[0 .. lv_prof_get_obj_stat_cnt() - 1]`
+ * @return pointer to the statistics or NULL if `idx` is invalid
+ */
+const lv_prof_obj_stat_t * lv_prof_get_obj_stat(uint32_t idx);
+
+/**
+ * Clear the frame history, the counters and the widget type statistics
+ */
+void lv_prof_reset(void);
+
+/**
+ * Print the frame history (newest first) and the widget type statistics line by line
+ * @param print_cb function to print a line, e.g. to the UART
+ */
+void lv_prof_dump(lv_prof_print_cb_t print_cb);
+
+/**
+ * Get the current time of the profiler's time source
+ * @return time in µs
+ */
+uint32_t _lv_prof_time(void);
+
+/**
+ * Add time to a phase of the current frame
+ * @param phase a phase from `LV_PROF_PHASE_...`
+ * @param time time to add in µs
+ */
+void _lv_prof_add_time(lv_prof_phase_t phase, uint32_t time);
+
+/**
+ * Add the time of an object's draw to its type
+ * @param obj pointer to the drawn object
+ * @param time time of the draw in µs
+ */
+void _lv_prof_add_obj_time(const struct _lv_obj_t * obj, uint32_t time);
+
+/**
+ * Mark the beginning of a refresh
+ */
+void _lv_prof_frame_start(void);
+
+/**
+ * Mark the end of a refresh and save the current frame to the history
+ */
+void _lv_prof_frame_end(void);
+
+/**
+ * The counters of the frame being collected. Used by `_LV_PROF_COUNT` to keep the counting cheap.
+ */
+extern uint32_t _lv_prof_cnt[_LV_PROF_CNT_NUM];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/*Start a timer named `name` in the current scope*/
+#define _LV_PROF_START(name)            uint32_t _lv_prof_start_##name = _lv_prof_time()
+
+/*Add the time elapsed since `_LV_PROF_START(name)` to a phase*/
+#define _LV_PROF_END(name, phase)       _lv_prof_add_time(phase, _lv_prof_time() - _lv_prof_start_##name)
+
+/*Add the time elapsed since `_LV_PROF_START(name)` to the type of `obj`*/
+#define _LV_PROF_END_OBJ(name, obj)     _lv_prof_add_obj_time(obj, _lv_prof_time() - _lv_prof_start_##name)
+
+/*Increment a counter with `n`*/
+#define _LV_PROF_COUNT(cnt, n)          _lv_prof_cnt[cnt] += (n)
+
+#else /*LV_USE_PROFILER*/
+
+#define _LV_PROF_START(name)
+#define _LV_PROF_END(name, phase)
+#define _LV_PROF_END_OBJ(name, obj)
+#define _LV_PROF_COUNT(cnt, n)
+
+#endif /*LV_USE_PROFILER*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_PROF_H*/
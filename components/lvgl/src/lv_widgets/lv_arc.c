@@ -94,13 +94,14 @@ lv_obj_t * lv_arc_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->last_tick = lv_tick_get();
     ext->last_angle = ext->arc_angle_end;
     lv_style_list_init(&ext->style_arc);
+    _lv_style_list_set_owner(&ext->style_arc, arc, LV_ARC_PART_INDIC);
     lv_style_list_init(&ext->style_knob);
+    _lv_style_list_set_owner(&ext->style_knob, arc, LV_ARC_PART_KNOB);
 
     lv_obj_set_size(arc, LV_DPI, LV_DPI);
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(arc, lv_arc_signal);
-    lv_obj_set_design_cb(arc, lv_arc_design);
+    lv_obj_set_signal_design_cb(arc, lv_arc_signal, lv_arc_design);
 
     /*Init the new arc arc*/
     if(copy == NULL) {
@@ -105,9 +105,9 @@ lv_obj_t * lv_bar_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->type         = LV_BAR_TYPE_NORMAL;
 
     lv_style_list_init(&ext->style_indic);
+    _lv_style_list_set_owner(&ext->style_indic, bar, LV_BAR_PART_INDIC);
 
-    lv_obj_set_signal_cb(bar, lv_bar_signal);
-    lv_obj_set_design_cb(bar, lv_bar_design);
+    lv_obj_set_signal_design_cb(bar, lv_bar_signal, lv_bar_design);
 
     /*Init the new bar object*/
     if(copy == NULL) {
@@ -79,8 +79,7 @@ lv_obj_t * lv_btn_create(lv_obj_t * par, const lv_obj_t * copy)
 
     ext->checkable = 0;
 
-    lv_obj_set_signal_cb(btn, lv_btn_signal);
-    lv_obj_set_design_cb(btn, lv_btn_design);
+    lv_obj_set_signal_design_cb(btn, lv_btn_signal, lv_btn_design);
 
     /*If no copy do the basic initialization*/
     if(copy == NULL) {
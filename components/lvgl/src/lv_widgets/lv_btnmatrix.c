@@ -98,12 +98,12 @@ lv_obj_t * lv_btnmatrix_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->recolor        = 0;
     ext->one_check      = 0;
     lv_style_list_init(&ext->style_btn);
+    _lv_style_list_set_owner(&ext->style_btn, btnm, LV_BTNMATRIX_PART_BTN);
     ext->style_btn.ignore_trans = 1;
 
     if(ancestor_design_f == NULL) ancestor_design_f = lv_obj_get_design_cb(btnm);
 
-    lv_obj_set_signal_cb(btnm, lv_btnmatrix_signal);
-    lv_obj_set_design_cb(btnm, lv_btnmatrix_design);
+    lv_obj_set_signal_design_cb(btnm, lv_btnmatrix_signal, lv_btnmatrix_design);
 
     /*Init the new button matrix object*/
     if(copy == NULL) {
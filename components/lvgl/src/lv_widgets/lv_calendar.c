@@ -120,15 +120,17 @@ lv_obj_t * lv_calendar_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->btn_pressing = 0;
 
     lv_style_list_init(&ext->style_date_nums);
+    _lv_style_list_set_owner(&ext->style_date_nums, calendar, LV_CALENDAR_PART_DATE);
     lv_style_list_init(&ext->style_day_names);
+    _lv_style_list_set_owner(&ext->style_day_names, calendar, LV_CALENDAR_PART_DAY_NAMES);
     lv_style_list_init(&ext->style_header);
+    _lv_style_list_set_owner(&ext->style_header, calendar, LV_CALENDAR_PART_HEADER);
     ext->style_date_nums.skip_trans = 1;
     ext->style_day_names.skip_trans = 1;
     ext->style_header.skip_trans = 1;
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(calendar, lv_calendar_signal);
-    lv_obj_set_design_cb(calendar, lv_calendar_design);
+    lv_obj_set_signal_design_cb(calendar, lv_calendar_signal, lv_calendar_design);
 
     /*Init the new calendar calendar*/
     if(copy == NULL) {
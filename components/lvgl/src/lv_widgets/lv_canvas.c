@@ -11,6 +11,7 @@
 #include "../lv_misc/lv_debug.h"
 #include "../lv_misc/lv_math.h"
 #include "../lv_draw/lv_draw.h"
+#include "../lv_draw/lv_img_cache.h"
 #include "../lv_core/lv_refr.h"
 #include "../lv_themes/lv_theme.h"
 
@@ -48,6 +49,7 @@ static void set_px_cb_alpha8(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t
                              lv_color_t color, lv_opa_t opa);
 
 static void set_px_alpha_generic(lv_img_dsc_t * d, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa);
+static void invalidate_image(lv_obj_t * canvas);
 
 /**********************
  *  STATIC VARIABLES
@@ -147,6 +149,8 @@ void lv_canvas_set_buffer(lv_obj_t * canvas, void * buf, lv_coord_t w, lv_coord_
     ext->dsc.header.h  = h;
     ext->dsc.data      = buf;
 
+    /*The descriptor is the same so drop the cached (e.g. transformed) versions of the old buffer*/
+    lv_img_cache_invalidate_src(&ext->dsc);
     lv_img_set_src(canvas, &ext->dsc);
 }
 
@@ -164,7 +168,7 @@ void lv_canvas_set_px(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_color_t
     lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
 
     lv_img_buf_set_px_color(&ext->dsc, x, y, c);
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 }
 
 /**
@@ -184,7 +188,7 @@ void lv_canvas_set_palette(lv_obj_t * canvas, uint8_t id, lv_color_t c)
     lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
 
     lv_img_buf_set_palette(&ext->dsc, id, c);
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 }
 
 /*=====================
@@ -256,6 +260,8 @@ void lv_canvas_copy_buf(lv_obj_t * canvas, const void * to_copy, lv_coord_t x, l
         px += ext->dsc.header.w * px_size;
         to_copy8 += w * px_size;
     }
+
+    invalidate_image(canvas);
 }
 
 /**
@@ -361,7 +367,7 @@ void lv_canvas_transform(lv_obj_t * canvas, lv_img_dsc_t * img, int16_t angle, u
         }
     }
 
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 #else
     LV_UNUSED(canvas);
     LV_UNUSED(img);
@@ -505,7 +511,7 @@ void lv_canvas_blur_hor(lv_obj_t * canvas, const lv_area_t * area, uint16_t r)
             if(has_alpha) asum += opa;
         }
     }
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 
     _lv_mem_buf_release(line_buf);
 }
@@ -644,7 +650,7 @@ void lv_canvas_blur_ver(lv_obj_t * canvas, const lv_area_t * area, uint16_t r)
         }
     }
 
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 
     _lv_mem_buf_release(col_buf);
 }
@@ -681,7 +687,7 @@ void lv_canvas_fill_bg(lv_obj_t * canvas, lv_color_t color, lv_opa_t opa)
         }
     }
 
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 }
 
 /**
@@ -751,7 +757,7 @@ void lv_canvas_draw_rect(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord
 
     _lv_refr_set_disp_refreshing(refr_ori);
 
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 }
 
 /**
@@ -831,7 +837,7 @@ void lv_canvas_draw_text(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord
 
     _lv_refr_set_disp_refreshing(refr_ori);
 
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 }
 
 /**
@@ -895,7 +901,7 @@ void lv_canvas_draw_img(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, const voi
 
     _lv_refr_set_disp_refreshing(refr_ori);
 
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 }
 
 /**
@@ -958,7 +964,7 @@ void lv_canvas_draw_line(lv_obj_t * canvas, const lv_point_t points[], uint32_t
 
     _lv_refr_set_disp_refreshing(refr_ori);
 
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 }
 
 /**
@@ -1019,7 +1025,7 @@ void lv_canvas_draw_polygon(lv_obj_t * canvas, const lv_point_t points[], uint32
 
     _lv_refr_set_disp_refreshing(refr_ori);
 
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 }
 
 /**
@@ -1083,7 +1089,7 @@ void lv_canvas_draw_arc(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord_
 
     _lv_refr_set_disp_refreshing(refr_ori);
 
-    lv_obj_invalidate(canvas);
+    invalidate_image(canvas);
 }
 
 /**********************
@@ -1107,12 +1113,28 @@ static lv_res_t lv_canvas_signal(lv_obj_t * canvas, lv_signal_t sign, void * par
     if(sign == LV_SIGNAL_GET_TYPE) return lv_obj_handle_get_type_signal(param, LV_OBJX_NAME);
 
     if(sign == LV_SIGNAL_CLEANUP) {
-        /*Nothing to cleanup. (No dynamically allocated memory in 'ext')*/
+        /*The address of the descriptor might be reused by a new image*/
+        lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
+        lv_img_cache_invalidate_src(&ext->dsc);
     }
 
     return res;
 }
 
+/**
+ * Redraw the canvas after its buffer has changed.
+ * The cached (e.g. transformed) versions of the old content are dropped too
+ * because they are found by the address of the descriptor which remains the same.
+ * @param canvas pointer to a canvas object
+ */
+static void invalidate_image(lv_obj_t * canvas)
+{
+    lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
+
+    lv_img_cache_invalidate_src(&ext->dsc);
+    lv_obj_invalidate(canvas);
+}
+
 static void set_set_px_cb(lv_disp_drv_t * disp_drv, lv_img_cf_t cf)
 {
     switch(cf) {
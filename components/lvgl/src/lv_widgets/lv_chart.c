@@ -50,11 +50,16 @@ static lv_style_list_t * lv_chart_get_style(lv_obj_t * chart, uint8_t part);
 
 static void draw_series_bg(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * mask);
 static void draw_series_line(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * clip_area);
+static void draw_series_line_decimated(lv_obj_t * chart, lv_chart_series_t * ser, const lv_area_t * series_area,
+                                       const lv_area_t * series_mask, const lv_draw_line_dsc_t * line_dsc,
+                                       const lv_draw_rect_dsc_t * area_dsc, lv_draw_mask_fade_param_t * mask_fade_p);
 static void draw_series_column(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * clip_area);
 static void draw_cursors(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * clip_area);
 static void draw_axes(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * mask);
-static void invalidate_lines(lv_obj_t * chart, uint16_t i);
-static void invalidate_columns(lv_obj_t * chart, uint16_t i);
+static void invalidate_series(lv_obj_t * chart);
+static void invalidate_series_band(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t v_min, lv_coord_t v_max);
+static void invalidate_lines(lv_obj_t * chart, uint16_t i_first, uint16_t i_last);
+static void invalidate_columns(lv_obj_t * chart, uint16_t i_first, uint16_t i_last);
 static void get_next_axis_label(lv_chart_label_iterator_t * iterator, char * buf);
 static inline bool is_tick_with_label(uint8_t tick_num, lv_chart_axis_cfg_t * axis);
 static lv_chart_label_iterator_t create_axis_label_iter(const char * list, uint8_t iterator_dir);
@@ -111,6 +116,7 @@ lv_obj_t * lv_chart_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->point_cnt             = LV_CHART_PNUM_DEF;
     ext->type                  = LV_CHART_TYPE_LINE;
     ext->update_mode           = LV_CHART_UPDATE_MODE_SHIFT;
+    ext->decimation            = 0;
     _lv_memset_00(&ext->x_axis, sizeof(ext->x_axis));
     _lv_memset_00(&ext->y_axis, sizeof(ext->y_axis));
     _lv_memset_00(&ext->secondary_y_axis, sizeof(ext->secondary_y_axis));
@@ -122,14 +128,16 @@ lv_obj_t * lv_chart_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->secondary_y_axis.minor_tick_len = LV_CHART_TICK_LENGTH_AUTO;
 
     lv_style_list_init(&ext->style_series_bg);
+    _lv_style_list_set_owner(&ext->style_series_bg, chart, LV_CHART_PART_SERIES_BG);
     lv_style_list_init(&ext->style_series);
+    _lv_style_list_set_owner(&ext->style_series, chart, LV_CHART_PART_SERIES);
     lv_style_list_init(&ext->style_cursors);
+    _lv_style_list_set_owner(&ext->style_cursors, chart, LV_CHART_PART_CURSOR);
 
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_cb(chart);
     if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_cb(chart);
 
-    lv_obj_set_signal_cb(chart, lv_chart_signal);
-    lv_obj_set_design_cb(chart, lv_chart_design);
+    lv_obj_set_signal_design_cb(chart, lv_chart_signal, lv_chart_design);
 
     /*Init the new chart background object*/
     if(copy == NULL) {
@@ -148,6 +156,7 @@ lv_obj_t * lv_chart_create(lv_obj_t * par, const lv_obj_t * copy)
         ext->hdiv_cnt   = ext_copy->hdiv_cnt;
         ext->vdiv_cnt   = ext_copy->vdiv_cnt;
         ext->point_cnt  = ext_copy->point_cnt;
+        ext->decimation = ext_copy->decimation;
         _lv_memcpy_small(ext->ymin, ext_copy->ymin, sizeof(ext->ymin));
         _lv_memcpy_small(ext->ymax, ext_copy->ymax, sizeof(ext->ymax));
         _lv_memcpy(&ext->x_axis, &ext_copy->x_axis, sizeof(lv_chart_axis_cfg_t));
@@ -464,24 +473,77 @@ void lv_chart_set_points(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t y
  * @param y the new value of the rightmost data
  */
 void lv_chart_set_next(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t y)
+{
+    lv_chart_set_next_array(chart, ser, &y, 1);
+}
+
+/**
+ * Add more new points to a data line at once. Works like calling `lv_chart_set_next` for every value
+ * but the chart is invalidated only once.
+ * @param chart pointer to chart object
+ * @param ser pointer to a data series on 'chart'
+ * @param y_array array of the new values
+ * @param cnt number of values in `y_array`
+ */
+void lv_chart_set_next_array(lv_obj_t * chart, lv_chart_series_t * ser, const lv_coord_t y_array[], uint16_t cnt)
 {
     LV_ASSERT_OBJ(chart, LV_OBJX_NAME);
     LV_ASSERT_NULL(ser);
 
+    if(cnt == 0) return;
+
     lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+
+    /*Only the last `point_cnt` values remain visible*/
+    if(cnt > ext->point_cnt) {
+        y_array += cnt - ext->point_cnt;
+        cnt = ext->point_cnt;
+    }
+
+    /*In shift mode every point moves so the band covered by the old and new values changes*/
+    lv_coord_t v_min = LV_COORD_MAX;
+    lv_coord_t v_max = LV_COORD_MIN;
+    uint16_t i;
     if(ext->update_mode == LV_CHART_UPDATE_MODE_SHIFT) {
-        ser->points[ser->start_point] =
-            y; /*This was the place of the former left most value, after shifting it is the rightmost*/
-        ser->start_point = (ser->start_point + 1) % ext->point_cnt;
-        lv_chart_refresh(chart);
+        for(i = 0; i < ext->point_cnt; i++) {
+            lv_coord_t v = ser->points[i];
+            if(v == LV_CHART_POINT_DEF) continue;
+            if(v < v_min) v_min = v;
+            if(v > v_max) v_max = v;
+        }
     }
-    else if(ext->update_mode == LV_CHART_UPDATE_MODE_CIRCULAR) {
-        ser->points[ser->start_point] = y;
 
-        if(ext->type & LV_CHART_TYPE_LINE) invalidate_lines(chart, ser->start_point);
-        if(ext->type & LV_CHART_TYPE_COLUMN) invalidate_columns(chart, ser->start_point);
+    /*The points are stored in a ring buffer: no data is moved, only the start point*/
+    uint16_t first = ser->start_point;
+    for(i = 0; i < cnt; i++) {
+        ser->points[ser->start_point] = y_array[i];
+        ser->start_point = (ser->start_point + 1) % ext->point_cnt;
+
+        if(y_array[i] == LV_CHART_POINT_DEF) continue;
+        if(y_array[i] < v_min) v_min = y_array[i];
+        if(y_array[i] > v_max) v_max = y_array[i];
+    }
 
-        ser->start_point = (ser->start_point + 1) % ext->point_cnt; /*update the x for next incoming y*/
+    if(ext->update_mode == LV_CHART_UPDATE_MODE_SHIFT) {
+        /*Nothing was and nothing will be drawn*/
+        if(v_min > v_max) return;
+        invalidate_series_band(chart, ser, v_min, v_max);
+    }
+    else if(ext->update_mode == LV_CHART_UPDATE_MODE_CIRCULAR) {
+        /*Invalidate only the changed range which might wrap around.
+         *`first + cnt` can exceed the 16 bit range with large point counts*/
+        uint32_t last = (uint32_t)first + cnt - 1;
+        uint16_t last_1 = last < ext->point_cnt ? (uint16_t)last : ext->point_cnt - 1;
+
+        if(ext->type & LV_CHART_TYPE_LINE) invalidate_lines(chart, first, last_1);
+        if(ext->type & LV_CHART_TYPE_COLUMN) invalidate_columns(chart, first, last_1);
+
+        if(last >= ext->point_cnt) {
+            /*`cnt <= point_cnt` so the wrapped part always ends before `first`*/
+            uint16_t last_2 = (uint16_t)(last - ext->point_cnt);
+            if(ext->type & LV_CHART_TYPE_LINE) invalidate_lines(chart, 0, last_2);
+            if(ext->type & LV_CHART_TYPE_COLUMN) invalidate_columns(chart, 0, last_2);
+        }
     }
 }
 
@@ -501,6 +563,26 @@ void lv_chart_set_update_mode(lv_obj_t * chart, lv_chart_update_mode_t update_mo
     lv_obj_invalidate(chart);
 }
 
+/**
+ * Enable/disable min/max decimation of line charts.
+ * If there are more points than pixels in the series area only the min/max values
+ * of the points falling to the same pixel column are drawn.
+ * The point markers (`LV_STYLE_SIZE` of `LV_CHART_PART_SERIES`) are not drawn then
+ * because they would cover each other anyway.
+ * @param chart pointer to a chart object
+ * @param en true: enable decimation
+ */
+void lv_chart_set_decimation(lv_obj_t * chart, bool en)
+{
+    LV_ASSERT_OBJ(chart, LV_OBJX_NAME);
+
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    if(ext->decimation == (en ? 1 : 0)) return;
+
+    ext->decimation = en ? 1 : 0;
+    invalidate_series(chart);
+}
+
 /**
  * Set the length of the tick marks on the x axis
  * @param chart pointer to the chart
@@ -739,6 +821,19 @@ uint16_t lv_chart_get_point_count(const lv_obj_t * chart)
     return ext->point_cnt;
 }
 
+/**
+ * Tell whether min/max decimation is enabled on a chart
+ * @param chart pointer to chart object
+ * @return true: decimation is enabled
+ */
+bool lv_chart_get_decimation(const lv_obj_t * chart)
+{
+    LV_ASSERT_OBJ(chart, LV_OBJX_NAME);
+
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    return ext->decimation ? true : false;
+}
+
 /**
  * Get the current index of the x-axis start point in the data array
  * @param ser               pointer to a data series on 'chart'
@@ -1172,6 +1267,12 @@ static void draw_series_line(lv_obj_t * chart, const lv_area_t * series_area, co
     /*Do not bother with line ending is the point will over it*/
     if(point_radius > line_dsc.width / 2) line_dsc.raw_end = 1;
 
+    /*Lines and points might overhang their points by this much*/
+    lv_coord_t x_margin = line_dsc.width + point_radius;
+
+    /*With more points than pixels draw only the min/max of the pixel columns*/
+    bool decimate = ext->decimation && ext->point_cnt > w ? true : false;
+
     /*Go through all data lines*/
     _LV_LL_READ_BACK(ext->series_ll, ser) {
         if(ser->hidden) continue;
@@ -1180,6 +1281,12 @@ static void draw_series_line(lv_obj_t * chart, const lv_area_t * series_area, co
         area_dsc.bg_color = ser->color;
         area_dsc.bg_grad_color = ser->color;
 
+        if(decimate) {
+            draw_series_line_decimated(chart, ser, series_area, &series_mask, &line_dsc,
+                                       has_area ? &area_dsc : NULL, has_fade ? &mask_fade_p : NULL);
+            continue;
+        }
+
         lv_coord_t start_point = ext->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
         p1.x = 0 + x_ofs;
@@ -1203,6 +1310,13 @@ static void draw_series_line(lv_obj_t * chart, const lv_area_t * series_area, co
             y_tmp = y_tmp / (ext->ymax[ser->y_axis] - ext->ymin[ser->y_axis]);
             p2.y  = h - y_tmp + y_ofs;
 
+            /*Skip the lines left to the clip area and stop after the last line which can be visible*/
+            if(p2.x + x_margin < clip_area->x1) {
+                p_prev = p_act;
+                continue;
+            }
+            if(p1.x - x_margin > clip_area->x2) break;
+
             /*Don't draw the first point. A second point is also required to draw the line*/
             if(i != 0 && ser->points[p_prev] != LV_CHART_POINT_DEF && ser->points[p_act] != LV_CHART_POINT_DEF) {
                 lv_draw_line(&p1, &p2, &series_mask, &line_dsc);
@@ -1269,6 +1383,84 @@ static void draw_series_line(lv_obj_t * chart, const lv_area_t * series_area, co
     }
 }
 
+/**
+ * Draw a data line with min/max decimation. In every pixel column a vertical line is drawn
+ * between the smallest and largest value of the points mapped to that column.
+ * The last point of the previous column is also considered to keep the line continuous.
+ * No point markers are drawn.
+ * @param chart pointer to chart object
+ * @param ser the series to draw
+ * @param series_area the area of the series
+ * @param series_mask the series area clipped to the clip area
+ * @param line_dsc line descriptor with the series' color
+ * @param area_dsc rectangle descriptor to fill the area below the line or NULL if not used
+ * @param mask_fade_p fade mask for the area or NULL if not used
+ */
+static void draw_series_line_decimated(lv_obj_t * chart, lv_chart_series_t * ser, const lv_area_t * series_area,
+                                       const lv_area_t * series_mask, const lv_draw_line_dsc_t * line_dsc,
+                                       const lv_draw_rect_dsc_t * area_dsc, lv_draw_mask_fade_param_t * mask_fade_p)
+{
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+
+    int32_t w     = lv_area_get_width(series_area);
+    int32_t h     = lv_area_get_height(series_area);
+    int32_t n     = ext->point_cnt - 1;
+    int32_t y_min = ext->ymin[ser->y_axis];
+    int32_t y_range = ext->ymax[ser->y_axis] - y_min;
+    uint16_t start_point = ext->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+
+    /*Only the columns on the clip area are drawn*/
+    int32_t x_first = series_mask->x1 - series_area->x1 - line_dsc->width;
+    int32_t x_last = series_mask->x2 - series_area->x1 + line_dsc->width;
+    if(x_first < 0) x_first = 0;
+    if(x_last > w - 1) x_last = w - 1;
+
+    int32_t x;
+    for(x = x_first; x <= x_last; x++) {
+        /*The points mapped to this column: x <= w * i / n < x + 1*/
+        int32_t i_first = (x * n + w - 1) / w;
+        int32_t i_end = ((x + 1) * n + w - 1) / w;
+        /*The last point would be mapped right after the series area so draw it in the last column*/
+        if(i_end > n + 1 || x == w - 1) i_end = n + 1;
+
+        int32_t i = i_first > 0 ? i_first - 1 : 0;
+        lv_coord_t v_min = LV_COORD_MAX;
+        lv_coord_t v_max = LV_COORD_MIN;
+        for(; i < i_end; i++) {
+            lv_coord_t v = ser->points[(start_point + i) % ext->point_cnt];
+            if(v == LV_CHART_POINT_DEF) continue;
+            if(v < v_min) v_min = v;
+            if(v > v_max) v_max = v;
+        }
+
+        /*No valid points in this column*/
+        if(v_min > v_max) continue;
+
+        lv_point_t p1;
+        lv_point_t p2;
+        p1.x = x + series_area->x1;
+        p2.x = p1.x;
+        p1.y = h - ((v_max - y_min) * h) / y_range + series_area->y1;
+        p2.y = h - ((v_min - y_min) * h) / y_range + series_area->y1;
+        if(p1.y == p2.y) p2.y++;
+
+        lv_draw_line(&p1, &p2, series_mask, line_dsc);
+
+        if(area_dsc) {
+            lv_area_t a;
+            a.x1 = p1.x;
+            a.x2 = p1.x;
+            a.y1 = p2.y;
+            a.y2 = series_area->y2;
+
+            int16_t mask_fade_id = LV_MASK_ID_INV;
+            if(mask_fade_p) mask_fade_id = lv_draw_mask_add(mask_fade_p, NULL);
+            lv_draw_rect(&a, series_mask, area_dsc);
+            lv_draw_mask_remove_id(mask_fade_id);
+        }
+    }
+}
+
 /**
  * Draw the data lines as columns on a chart
  * @param chart pointer to chart object
@@ -1792,14 +1984,79 @@ static void draw_axes(lv_obj_t * chart, const lv_area_t * series_area, const lv_
     draw_x_ticks(chart, series_area, mask);
 }
 
+/**
+ * Invalidate the series area of a chart including the overhanging lines and points
+ * @param chart pointer to chart object
+ */
+static void invalidate_series(lv_obj_t * chart)
+{
+    lv_area_t coords;
+    lv_chart_get_series_area(chart, &coords);
+
+    lv_style_int_t line_width = lv_obj_get_style_line_width(chart, LV_CHART_PART_SERIES);
+    lv_style_int_t point_radius = lv_obj_get_style_size(chart, LV_CHART_PART_SERIES);
+
+    coords.x1 -= line_width + point_radius;
+    coords.x2 += line_width + point_radius;
+    coords.y1 -= line_width + point_radius;
+    coords.y2 += line_width + point_radius;
+    lv_obj_invalidate_area(chart, &coords);
+}
+
+/**
+ * Invalidate the horizontal band of the series area in which the values of a series are drawn
+ * @param chart pointer to chart object
+ * @param ser pointer to a data series on 'chart'
+ * @param v_min the smallest value of the series
+ * @param v_max the largest value of the series
+ */
+static void invalidate_series_band(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t v_min, lv_coord_t v_max)
+{
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+
+    lv_area_t coords;
+    lv_chart_get_series_area(chart, &coords);
+
+    lv_style_int_t line_width = lv_obj_get_style_line_width(chart, LV_CHART_PART_SERIES);
+    lv_style_int_t point_radius = lv_obj_get_style_size(chart, LV_CHART_PART_SERIES);
+
+    int32_t h = lv_area_get_height(&coords);
+    int32_t y_min = ext->ymin[ser->y_axis];
+    int32_t y_range = ext->ymax[ser->y_axis] - y_min;
+    int32_t y_top = h - ((int32_t)(v_max - y_min) * h) / y_range + coords.y1;
+    int32_t y_bottom = h - ((int32_t)(v_min - y_min) * h) / y_range + coords.y1;
+
+    /*The columns and the area below the lines reach the bottom of the series area*/
+    bool to_bottom = ext->type & LV_CHART_TYPE_COLUMN ? true : false;
+    if(lv_obj_get_style_bg_opa(chart, LV_CHART_PART_SERIES) > LV_OPA_MIN) to_bottom = true;
+    if(to_bottom || y_bottom > coords.y2) y_bottom = coords.y2;
+    if(y_bottom < coords.y1) y_bottom = coords.y1;
+    if(y_top < coords.y1) y_top = coords.y1;
+    if(y_top > coords.y2) y_top = coords.y2;
+
+    coords.x1 -= line_width + point_radius;
+    coords.x2 += line_width + point_radius;
+    coords.y1 = y_top - line_width - point_radius;
+    coords.y2 = y_bottom + line_width + point_radius;
+    lv_obj_invalidate_area(chart, &coords);
+}
+
 /**
  * invalid area of the new line data lines on a chart
- * @param obj pointer to chart object
+ * @param chart pointer to chart object
+ * @param i_first index of the first changed point
+ * @param i_last index of the last changed point
  */
-static void invalidate_lines(lv_obj_t * chart, uint16_t i)
+static void invalidate_lines(lv_obj_t * chart, uint16_t i_first, uint16_t i_last)
 {
     lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
-    if(i >= ext->point_cnt) return;
+    if(i_first >= ext->point_cnt) return;
+    if(i_last >= ext->point_cnt) i_last = ext->point_cnt - 1;
+
+    if(ext->point_cnt < 2) {
+        invalidate_series(chart);
+        return;
+    }
 
     lv_area_t series_area;
     lv_chart_get_series_area(chart, &series_area);
@@ -1810,32 +2067,30 @@ static void invalidate_lines(lv_obj_t * chart, uint16_t i)
     lv_style_int_t line_width = lv_obj_get_style_line_width(chart, LV_CHART_PART_SERIES);
     lv_style_int_t point_radius = lv_obj_get_style_size(chart, LV_CHART_PART_SERIES);
 
+    /*The lines from the previous point and to the next point change too*/
+    uint16_t i_start = i_first > 0 ? i_first - 1 : 0;
+    uint16_t i_end = i_last < ext->point_cnt - 1 ? i_last + 1 : i_last;
+
     lv_area_t coords;
     lv_area_copy(&coords, &series_area);
     coords.y1 -= line_width + point_radius;
     coords.y2 += line_width + point_radius;
-
-    if(i < ext->point_cnt - 1) {
-        coords.x1 = ((w * i) / (ext->point_cnt - 1)) + x_ofs - line_width - point_radius;
-        coords.x2 = ((w * (i + 1)) / (ext->point_cnt - 1)) + x_ofs + line_width + point_radius;
-        lv_obj_invalidate_area(chart, &coords);
-    }
-
-    if(i > 0) {
-        coords.x1 = ((w * (i - 1)) / (ext->point_cnt - 1)) + x_ofs - line_width - point_radius;
-        coords.x2 = ((w * i) / (ext->point_cnt - 1)) + x_ofs + line_width + point_radius;
-        lv_obj_invalidate_area(chart, &coords);
-    }
+    coords.x1 = (((int32_t)w * i_start) / (ext->point_cnt - 1)) + x_ofs - line_width - point_radius;
+    coords.x2 = (((int32_t)w * i_end) / (ext->point_cnt - 1)) + x_ofs + line_width + point_radius;
+    lv_obj_invalidate_area(chart, &coords);
 }
 
 /**
  * invalid area of the new column data lines on a chart
  * @param chart pointer to chart object
- * @param mask mask, inherited from the design function
+ * @param i_first index of the first changed point
+ * @param i_last index of the last changed point
  */
-static void invalidate_columns(lv_obj_t * chart, uint16_t i)
+static void invalidate_columns(lv_obj_t * chart, uint16_t i_first, uint16_t i_last)
 {
     lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    if(i_first >= ext->point_cnt) return;
+    if(i_last >= ext->point_cnt) i_last = ext->point_cnt - 1;
 
     lv_area_t series_area;
     lv_chart_get_series_area(chart, &series_area);
@@ -1845,13 +2100,11 @@ static void invalidate_columns(lv_obj_t * chart, uint16_t i)
     lv_coord_t col_w = w / ((_lv_ll_get_len(&ext->series_ll) + 1) * ext->point_cnt); /* Suppose + 1 series as separator*/
     lv_coord_t x_ofs = col_w / 2;                                    /*Shift with a half col.*/
 
-    lv_coord_t x_act;
-    x_act = (int32_t)((int32_t)w * i) / ext->point_cnt;
-    x_act += series_area.x1 + x_ofs;
-
     lv_obj_get_coords(chart, &col_a);
-    col_a.x1 = x_act;
-    col_a.x2 = col_a.x1 + col_w;
+    col_a.x1 = (int32_t)((int32_t)w * i_first) / ext->point_cnt;
+    col_a.x1 += series_area.x1 + x_ofs;
+    col_a.x2 = (int32_t)((int32_t)w * i_last) / ext->point_cnt;
+    col_a.x2 += series_area.x1 + x_ofs + col_w;
 
     _lv_inv_area(lv_obj_get_disp(chart), &col_a);
 }
@@ -118,6 +118,7 @@ typedef struct {
     lv_chart_axis_cfg_t x_axis;
     lv_chart_axis_cfg_t secondary_y_axis;
     uint8_t update_mode : 1;
+    uint8_t decimation : 1; /*Draw only the min/max of the points falling to the same pixel column*/
 } lv_chart_ext_t;
 
 /*Parts of the chart*/
@@ -243,6 +244,16 @@ void lv_chart_set_points(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t y
  */
 void lv_chart_set_next(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t y);
 
+/**
+ * Add more new points to a data line at once. Works like calling `lv_chart_set_next` for every value
+ * but the chart is invalidated only once.
+ * @param chart pointer to chart object
+ * @param ser pointer to a data series on 'chart'
+ * @param y_array array of the new values
+ * @param cnt number of values in `y_array`
+ */
+void lv_chart_set_next_array(lv_obj_t * chart, lv_chart_series_t * ser, const lv_coord_t y_array[], uint16_t cnt);
+
 /**
  * Set update mode of the chart object.
  * @param chart pointer to a chart object
@@ -250,6 +261,17 @@ void lv_chart_set_next(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t y);
  */
 void lv_chart_set_update_mode(lv_obj_t * chart, lv_chart_update_mode_t update_mode);
 
+/**
+ * Enable/disable min/max decimation of line charts.
+ * If there are more points than pixels in the series area only the min/max values
+ * of the points falling to the same pixel column are drawn.
+ * The point markers (`LV_STYLE_SIZE` of `LV_CHART_PART_SERIES`) are not drawn then
+ * because they would cover each other anyway.
+ * @param chart pointer to a chart object
+ * @param en true: enable decimation
+ */
+void lv_chart_set_decimation(lv_obj_t * chart, bool en);
+
 /**
  * Set the length of the tick marks on the x axis
  * @param chart pointer to the chart
@@ -374,6 +396,13 @@ lv_chart_type_t lv_chart_get_type(const lv_obj_t * chart);
  */
 uint16_t lv_chart_get_point_count(const lv_obj_t * chart);
 
+/**
+ * Tell whether min/max decimation is enabled on a chart
+ * @param chart pointer to chart object
+ * @return true: decimation is enabled
+ */
+bool lv_chart_get_decimation(const lv_obj_t * chart);
+
 /**
  * get the current index of the x-axis start point in the data array
  * @param ser               pointer to a data series on 'chart'
@@ -40,6 +40,7 @@
  **********************/
 static lv_res_t lv_cont_signal(lv_obj_t * cont, lv_signal_t sign, void * param);
 static lv_style_list_t * lv_cont_get_style(lv_obj_t * cont, uint8_t type);
+static void lv_cont_refr(lv_obj_t * cont);
 static void lv_cont_refr_layout(lv_obj_t * cont);
 static void lv_cont_layout_col(lv_obj_t * cont);
 static void lv_cont_layout_row(lv_obj_t * cont);
@@ -142,7 +143,7 @@ void lv_cont_set_layout(lv_obj_t * cont, lv_layout_t layout)
     ext->layout = layout;
 
     /*Send a signal to refresh the layout*/
-    cont->signal_cb(cont, LV_SIGNAL_CHILD_CHG, NULL);
+    _LV_OBJ_SIGNAL_CB(cont)(cont, LV_SIGNAL_CHILD_CHG, NULL);
 }
 
 /**
@@ -170,7 +171,7 @@ void lv_cont_set_fit4(lv_obj_t * cont, lv_fit_t left, lv_fit_t right, lv_fit_t t
     ext->fit_bottom = bottom;
 
     /*Send a signal to refresh the layout*/
-    cont->signal_cb(cont, LV_SIGNAL_CHILD_CHG, NULL);
+    _LV_OBJ_SIGNAL_CB(cont)(cont, LV_SIGNAL_CHILD_CHG, NULL);
 }
 
 /*=====================
@@ -270,19 +271,23 @@ static lv_res_t lv_cont_signal(lv_obj_t * cont, lv_signal_t sign, void * param)
     if(sign == LV_SIGNAL_GET_TYPE) return lv_obj_handle_get_type_signal(param, LV_OBJX_NAME);
 
     if(sign == LV_SIGNAL_STYLE_CHG) { /*Recalculate the padding if the style changed*/
-        lv_cont_refr_layout(cont);
-        lv_cont_refr_autofit(cont);
+        lv_cont_refr(cont);
     }
     else if(sign == LV_SIGNAL_CHILD_CHG) {
-        lv_cont_refr_layout(cont);
-        lv_cont_refr_autofit(cont);
+        lv_cont_refr(cont);
     }
     else if(sign == LV_SIGNAL_COORD_CHG) {
-        if(lv_obj_get_width(cont) != lv_area_get_width(param) || lv_obj_get_height(cont) != lv_area_get_height(param)) {
-            lv_cont_refr_layout(cont);
-            lv_cont_refr_autofit(cont);
+        if(lv_area_get_width(&cont->coords) != lv_area_get_width(param) ||
+           lv_area_get_height(&cont->coords) != lv_area_get_height(param)) {
+            lv_cont_refr(cont);
         }
     }
+#if LV_USE_LAYOUT_DEFER
+    else if(sign == LV_SIGNAL_REFR_LAYOUT) {
+        lv_cont_refr_layout(cont);
+        lv_cont_refr_autofit(cont);
+    }
+#endif
     else if(sign == LV_SIGNAL_PARENT_SIZE_CHG) {
         /*MAX and EDGE fit needs to be refreshed if the parent's size has changed*/
         lv_cont_refr_autofit(cont);
@@ -305,6 +310,29 @@ static lv_style_list_t * lv_cont_get_style(lv_obj_t * cont, uint8_t type)
     return style_dsc_p;
 }
 
+/**
+ * Refresh the layout and the auto fit of a container, or only mark them to refresh
+ * if the layouts are deferred (`LV_USE_LAYOUT_DEFER`)
+ * @param cont pointer to a container object
+ */
+static void lv_cont_refr(lv_obj_t * cont)
+{
+#if LV_USE_LAYOUT_DEFER
+    /*The layout and auto fit do nothing if the children are just being rearranged*/
+    if(lv_obj_is_protected(cont, LV_PROTECT_CHILD_CHG)) return;
+    lv_cont_ext_t * ext = lv_obj_get_ext_attr(cont);
+    if(ext->layout == LV_LAYOUT_OFF && ext->fit_left == LV_FIT_NONE && ext->fit_right == LV_FIT_NONE &&
+       ext->fit_top == LV_FIT_NONE && ext->fit_bottom == LV_FIT_NONE) {
+        return;
+    }
+
+    lv_obj_mark_layout_dirty(cont);
+#else
+    lv_cont_refr_layout(cont);
+    lv_cont_refr_autofit(cont);
+#endif
+}
+
 /**
  * Refresh the layout of a container
  * @param cont pointer to an object which layout should be refreshed
@@ -789,13 +817,14 @@ static void lv_cont_refr_autofit(lv_obj_t * cont)
 
             lv_obj_invalidate(cont);
             lv_area_copy(&cont->coords, &new_area);
+            _lv_obj_coords_changed(cont, false);
             lv_obj_invalidate(cont);
 
             /*Notify the object about its new coordinates*/
-            cont->signal_cb(cont, LV_SIGNAL_COORD_CHG, &ori);
+            _LV_OBJ_SIGNAL_CB(cont)(cont, LV_SIGNAL_COORD_CHG, &ori);
 
             /*Inform the parent about the new coordinates*/
-            par->signal_cb(par, LV_SIGNAL_CHILD_CHG, cont);
+            _LV_OBJ_SIGNAL_CB(par)(par, LV_SIGNAL_CHILD_CHG, cont);
 
             if(lv_obj_get_auto_realign(cont)) {
                 lv_obj_realign(cont);
@@ -803,7 +832,7 @@ static void lv_cont_refr_autofit(lv_obj_t * cont)
 
             /*Tell the children the parent's size has changed*/
             _LV_LL_READ(cont->child_ll, child_i) {
-                child_i->signal_cb(child_i, LV_SIGNAL_PARENT_SIZE_CHG, &ori);
+                _LV_OBJ_SIGNAL_CB(child_i)(child_i, LV_SIGNAL_PARENT_SIZE_CHG, &ori);
             }
         }
     }
@@ -128,10 +128,10 @@ lv_obj_t * lv_cpicker_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->last_change_time = 0;
 
     lv_style_list_init(&ext->knob.style_list);
+    _lv_style_list_set_owner(&ext->knob.style_list, cpicker, LV_CPICKER_PART_KNOB);
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(cpicker, lv_cpicker_signal);
-    lv_obj_set_design_cb(cpicker, lv_cpicker_design);
+    lv_obj_set_signal_design_cb(cpicker, lv_cpicker_signal, lv_cpicker_design);
 
     /*If no copy do the basic initialization*/
     if(copy == NULL) {
@@ -116,12 +116,14 @@ lv_obj_t * lv_dropdown_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->dir = LV_DROPDOWN_DIR_DOWN;
     ext->max_height = (3 * lv_disp_get_ver_res(NULL)) / 4;
     lv_style_list_init(&ext->style_page);
+    _lv_style_list_set_owner(&ext->style_page, ddlist, LV_DROPDOWN_PART_LIST);
     lv_style_list_init(&ext->style_scrlbar);
+    _lv_style_list_set_owner(&ext->style_scrlbar, ddlist, LV_DROPDOWN_PART_SCROLLBAR);
     lv_style_list_init(&ext->style_selected);
+    _lv_style_list_set_owner(&ext->style_selected, ddlist, LV_DROPDOWN_PART_SELECTED);
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(ddlist, lv_dropdown_signal);
-    lv_obj_set_design_cb(ddlist, lv_dropdown_design);
+    lv_obj_set_signal_design_cb(ddlist, lv_dropdown_signal, lv_dropdown_design);
 
     /*Init the new drop down list drop down list*/
     if(copy == NULL) {
@@ -621,9 +623,12 @@ void lv_dropdown_open(lv_obj_t * ddlist)
     }
     page_ext->ddlist = ddlist;
 
-    lv_obj_set_design_cb(ext->page, lv_dropdown_page_design);
-    lv_obj_set_signal_cb(ext->page, lv_dropdown_page_signal);
+    lv_obj_set_signal_design_cb(ext->page, lv_dropdown_page_signal, lv_dropdown_page_design);
     lv_obj_set_signal_cb(lv_page_get_scrollable(ext->page), lv_dropdown_page_scrl_signal);
+#if LV_USE_FAST_SCROLL
+    /*The pressed and selected options are highlighted by the page*/
+    lv_obj_set_fast_scroll(lv_page_get_scrollable(ext->page), false);
+#endif
 
     lv_style_list_copy(lv_obj_get_style_list(ext->page, LV_PAGE_PART_BG), &ext->style_page);
     lv_style_list_copy(lv_obj_get_style_list(ext->page, LV_PAGE_PART_SCROLLBAR), &ext->style_scrlbar);
@@ -93,11 +93,12 @@ lv_obj_t * lv_gauge_create(lv_obj_t * par, const lv_obj_t * copy)
     if(ancestor_design == NULL) ancestor_design = lv_obj_get_design_cb(gauge);
 
     lv_style_list_init(&ext->style_strong);
+    _lv_style_list_set_owner(&ext->style_strong, gauge, LV_GAUGE_PART_MAJOR);
     lv_style_list_init(&ext->style_needle);
+    _lv_style_list_set_owner(&ext->style_needle, gauge, LV_GAUGE_PART_NEEDLE);
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(gauge, lv_gauge_signal);
-    lv_obj_set_design_cb(gauge, lv_gauge_design);
+    lv_obj_set_signal_design_cb(gauge, lv_gauge_signal, lv_gauge_design);
 
     /*Init the new gauge gauge*/
     if(copy == NULL) {
@@ -91,8 +91,7 @@ lv_obj_t * lv_img_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->pivot.y = 0;
 
     /*Init the new object*/
-    lv_obj_set_signal_cb(img, lv_img_signal);
-    lv_obj_set_design_cb(img, lv_img_design);
+    lv_obj_set_signal_design_cb(img, lv_img_signal, lv_img_design);
 
     if(copy == NULL) {
         lv_theme_apply(img, LV_THEME_IMAGE);
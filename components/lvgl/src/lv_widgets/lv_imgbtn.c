@@ -83,8 +83,7 @@ lv_obj_t * lv_imgbtn_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->act_cf = LV_IMG_CF_UNKNOWN;
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(imgbtn, lv_imgbtn_signal);
-    lv_obj_set_design_cb(imgbtn, lv_imgbtn_design);
+    lv_obj_set_signal_design_cb(imgbtn, lv_imgbtn_signal, lv_imgbtn_design);
 
     /*Init the new image button image button*/
     if(copy == NULL) {
@@ -73,8 +73,7 @@ lv_obj_t * lv_led_create(lv_obj_t * par, const lv_obj_t * copy)
 
     ext->bright = LV_LED_BRIGHT_MAX;
 
-    lv_obj_set_signal_cb(led, lv_led_signal);
-    lv_obj_set_design_cb(led, lv_led_design);
+    lv_obj_set_signal_design_cb(led, lv_led_signal, lv_led_design);
 
     /*Init the new led object*/
     if(copy == NULL) {
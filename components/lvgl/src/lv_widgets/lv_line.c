@@ -74,8 +74,7 @@ lv_obj_t * lv_line_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->auto_size   = 1;
     ext->y_inv       = 0;
 
-    lv_obj_set_design_cb(line, lv_line_design);
-    lv_obj_set_signal_cb(line, lv_line_signal);
+    lv_obj_set_signal_design_cb(line, lv_line_signal, lv_line_design);
 
     /*Init the new line*/
     if(copy == NULL) {
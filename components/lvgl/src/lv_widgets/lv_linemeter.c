@@ -79,8 +79,7 @@ lv_obj_t * lv_linemeter_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->mirrored = 0;
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(linemeter, lv_linemeter_signal);
-    lv_obj_set_design_cb(linemeter, lv_linemeter_design);
+    lv_obj_set_signal_design_cb(linemeter, lv_linemeter_signal, lv_linemeter_design);
 
     /*Init the new line meter line meter*/
     if(copy == NULL) {
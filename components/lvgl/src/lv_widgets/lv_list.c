@@ -36,6 +36,11 @@
  **********************/
 static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param);
 static lv_res_t lv_list_btn_signal(lv_obj_t * btn, lv_signal_t sign, void * param);
+static lv_res_t lv_list_scrl_signal(lv_obj_t * scrl, lv_signal_t sign, void * param);
+static void data_pool_create(lv_obj_t * list);
+static void data_scrl_refr_height(lv_obj_t * list);
+static void data_rows_refr(lv_obj_t * list, bool force);
+static uint16_t data_get_pool_cnt(lv_obj_t * list);
 static lv_style_list_t * lv_list_get_style(lv_obj_t * list, uint8_t part);
 static bool lv_list_is_list_btn(lv_obj_t * list_btn);
 static bool lv_list_is_list_img(lv_obj_t * list_btn);
@@ -50,6 +55,7 @@ static bool lv_list_is_list_label(lv_obj_t * list_btn);
 static lv_signal_cb_t label_signal;
 static lv_signal_cb_t ancestor_page_signal;
 static lv_signal_cb_t ancestor_btn_signal;
+static lv_signal_cb_t ancestor_scrl_signal;
 
 /**********************
  *      MACROS
@@ -87,6 +93,10 @@ lv_obj_t * lv_list_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->last_sel_btn = NULL;
 #endif
     ext->act_sel_btn = NULL;
+    ext->data_cb = NULL;
+    ext->data_row_cnt = 0;
+    ext->data_pool_cnt = 0;
+    ext->data_row_h = 0;
 
     lv_obj_set_signal_cb(list, lv_list_signal);
 
@@ -102,7 +112,8 @@ lv_obj_t * lv_list_create(lv_obj_t * par, const lv_obj_t * copy)
 
     }
     else {
-        lv_obj_t * copy_btn = lv_list_get_next_btn(copy, NULL);
+        lv_list_ext_t * copy_ext = lv_obj_get_ext_attr(copy);
+        lv_obj_t * copy_btn = copy_ext->data_cb ? NULL : lv_list_get_next_btn(copy, NULL);
         while(copy_btn) {
             const void * img_src = NULL;
 #if LV_USE_IMG
@@ -113,6 +124,8 @@ lv_obj_t * lv_list_create(lv_obj_t * par, const lv_obj_t * copy)
             copy_btn = lv_list_get_next_btn(copy, copy_btn);
         }
 
+        if(copy_ext->data_cb) lv_list_set_data_cb(list, copy_ext->data_cb, copy_ext->data_row_cnt);
+
         /*Refresh the style with new signal function*/
         lv_obj_refresh_style(list, LV_OBJ_PART_ALL, LV_STYLE_PROP_ALL);
     }
@@ -229,7 +242,7 @@ lv_obj_t * lv_list_add_btn(lv_obj_t * list, const void * img_src, const char * t
 
     lv_obj_clear_protect(scrl, LV_PROTECT_CHILD_CHG);
     lv_obj_clear_protect(btn, LV_PROTECT_CHILD_CHG);
-    btn->signal_cb(btn, LV_SIGNAL_CHILD_CHG, NULL);
+    _LV_OBJ_SIGNAL_CB(btn)(btn, LV_SIGNAL_CHILD_CHG, NULL);
 
     lv_obj_set_pos(list, pos_x_ori, pos_y_ori);
 
@@ -302,6 +315,53 @@ void lv_list_focus_btn(lv_obj_t * list, lv_obj_t * btn)
     }
 }
 
+/**
+ * Get the rows of the list from a callback. Only a few buttons are created to cover the visible area
+ * and they are recycled (moved and refilled by `data_cb`) while the list is scrolled.
+ * This way the memory usage doesn't depend on the number of rows.
+ * The existing buttons are deleted and the buttons are created with a label only.
+ * Call it again with the same callback to change the number of rows or to refresh the visible rows.
+ * The total height of the rows is limited to `LV_COORD_MAX`. Use 32 bit `lv_coord_t` for very long data.
+ * @param list pointer to a list object
+ * @param data_cb the callback to set the content of the buttons or NULL to use normal buttons again
+ * @param row_cnt number of rows provided by `data_cb`
+ */
+void lv_list_set_data_cb(lv_obj_t * list, lv_list_data_cb_t data_cb, uint16_t row_cnt)
+{
+    LV_ASSERT_OBJ(list, LV_OBJX_NAME);
+
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+
+    if(data_cb == NULL) {
+        if(ext->data_cb == NULL) return;
+        ext->data_cb = NULL;
+        ext->data_row_cnt = 0;
+        data_pool_create(list); /*Only deletes the recycled buttons*/
+        lv_obj_set_signal_cb(scrl, ancestor_scrl_signal);
+        lv_page_set_scrollable_fit2(list, LV_FIT_PARENT, LV_FIT_TIGHT);
+        lv_page_set_scrl_layout(list, LV_LIST_LAYOUT_DEF);
+        return;
+    }
+
+    /*Follow the scrolling to recycle the buttons*/
+    if(ancestor_scrl_signal == NULL) ancestor_scrl_signal = lv_obj_get_signal_cb(scrl);
+    lv_obj_set_signal_cb(scrl, lv_list_scrl_signal);
+
+    bool cb_changed = ext->data_cb != data_cb ? true : false;
+    ext->data_cb = data_cb;
+    ext->data_row_cnt = row_cnt;
+
+    /*Keep the buttons if only the number of rows has changed*/
+    if(cb_changed || ext->data_row_h == 0 || data_get_pool_cnt(list) != ext->data_pool_cnt) {
+        data_pool_create(list);
+    }
+    else {
+        data_scrl_refr_height(list);
+        data_rows_refr(list, true);
+    }
+}
+
 /**
  * Set layout of a list
  * @param list pointer to a list object
@@ -346,6 +406,19 @@ void lv_list_set_layout(lv_obj_t * list, lv_layout_t layout)
  * Getter functions
  *====================*/
 
+/**
+ * Get the callback which provides the rows of the list
+ * @param list pointer to a list object
+ * @return the data callback or NULL if normal buttons are used
+ */
+lv_list_data_cb_t lv_list_get_data_cb(const lv_obj_t * list)
+{
+    LV_ASSERT_OBJ(list, LV_OBJX_NAME);
+
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    return ext->data_cb;
+}
+
 /**
  * Get the text of a list element
  * @param btn pointer to list element
@@ -475,6 +548,15 @@ int32_t lv_list_get_btn_index(const lv_obj_t * list, const lv_obj_t * btn)
     }
     LV_ASSERT_OBJ(list, LV_OBJX_NAME);
 
+    /*The recycled buttons' position tells which row they show*/
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->data_cb) {
+        if(ext->data_row_h <= 0 || lv_obj_get_parent(btn) != lv_page_get_scrollable(list)) return -1;
+        if(lv_obj_get_hidden(btn)) return -1;
+        lv_style_int_t pad_top = lv_obj_get_style_pad_top(lv_page_get_scrollable(list), LV_CONT_PART_MAIN);
+        return (lv_obj_get_y(btn) - pad_top) / ext->data_row_h;
+    }
+
     lv_obj_t * e = lv_list_get_next_btn(list, NULL);
     while(e != NULL) {
         if(e == btn) {
@@ -495,6 +577,9 @@ uint16_t lv_list_get_size(const lv_obj_t * list)
 {
     LV_ASSERT_OBJ(list, LV_OBJX_NAME);
 
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->data_cb) return ext->data_row_cnt;
+
     uint16_t size = 0;
     lv_obj_t * btn = lv_list_get_next_btn(list, NULL);
     while(btn) {
@@ -656,7 +741,17 @@ static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param)
     if(res != LV_RES_OK) return res;
     if(sign == LV_SIGNAL_GET_TYPE) return lv_obj_handle_get_type_signal(param, LV_OBJX_NAME);
 
-    if(sign == LV_SIGNAL_RELEASED || sign == LV_SIGNAL_PRESSED || sign == LV_SIGNAL_PRESSING ||
+    if(sign == LV_SIGNAL_COORD_CHG || sign == LV_SIGNAL_STYLE_CHG) {
+        lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+        if(ext->data_cb) {
+            /*A new size or style might require different number or size of buttons*/
+            if(sign == LV_SIGNAL_STYLE_CHG ||
+               lv_obj_get_height(list) != lv_area_get_height(param) || lv_obj_get_width(list) != lv_area_get_width(param)) {
+                data_pool_create(list);
+            }
+        }
+    }
+    else if(sign == LV_SIGNAL_RELEASED || sign == LV_SIGNAL_PRESSED || sign == LV_SIGNAL_PRESSING ||
        sign == LV_SIGNAL_LONG_PRESS || sign == LV_SIGNAL_LONG_PRESS_REP) {
 #if LV_USE_GROUP
         /*If pressed/released etc by a KEYPAD or ENCODER delegate signal and events to the button*/
@@ -780,6 +875,28 @@ static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param)
     return res;
 }
 
+/**
+ * Signal function of the list's scrollable in data callback mode
+ * @param scrl pointer to the scrollable of a list
+ * @param sign a signal type from lv_signal_t enum
+ * @param param pointer to a signal specific variable
+ * @return LV_RES_OK: the object is not deleted in the function; LV_RES_INV: the object is deleted
+ */
+static lv_res_t lv_list_scrl_signal(lv_obj_t * scrl, lv_signal_t sign, void * param)
+{
+    lv_res_t res;
+
+    /* Include the ancient signal function */
+    res = ancestor_scrl_signal(scrl, sign, param);
+    if(res != LV_RES_OK) return res;
+
+    if(sign == LV_SIGNAL_COORD_CHG) {
+        data_rows_refr(lv_obj_get_parent(scrl), false);
+    }
+
+    return res;
+}
+
 /**
  * Signal function of the list buttons
  * @param btn pointer to a button on the list
@@ -878,6 +995,123 @@ static lv_style_list_t * lv_list_get_style(lv_obj_t * list, uint8_t part)
     return style_dsc_p;
 }
 
+/**
+ * Get the number of recycled buttons required to cover the list
+ * @param list pointer to a list with data callback
+ * @return the number of required buttons
+ */
+static uint16_t data_get_pool_cnt(lv_obj_t * list)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->data_row_h <= 0) return 0;
+
+    /*+2 because the first and last rows might be partially visible*/
+    uint32_t pool_cnt = lv_obj_get_height(list) / ext->data_row_h + 2;
+    return LV_MATH_MIN(pool_cnt, ext->data_row_cnt);
+}
+
+/**
+ * Delete the buttons of a list and create the recycled buttons for the data callback
+ * @param list pointer to a list object
+ */
+static void data_pool_create(lv_obj_t * list)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+
+    lv_list_clean(list);
+#if LV_USE_GROUP
+    ext->last_sel_btn = NULL;
+#endif
+    ext->act_sel_btn = NULL;
+    ext->data_pool_cnt = 0;
+    ext->data_row_h = 0;
+
+    if(ext->data_cb == NULL) return;
+
+    /*Create the buttons in column layout to get their final size*/
+    lv_page_set_scrl_layout(list, LV_LIST_LAYOUT_DEF);
+    lv_page_set_scrollable_fit2(list, LV_FIT_PARENT, LV_FIT_TIGHT);
+    if(ext->data_row_cnt == 0) return;
+
+    lv_obj_t * btn = lv_list_add_btn(list, NULL, "");
+    ext->data_row_h = lv_obj_get_height(btn) + lv_obj_get_style_pad_inner(scrl, LV_CONT_PART_MAIN);
+    if(ext->data_row_h <= 0) ext->data_row_h = 1;
+
+    /*Save the number of buttons only at the end to not move them while the layout is active*/
+    uint16_t pool_cnt = data_get_pool_cnt(list);
+    uint16_t i;
+    for(i = 1; i < pool_cnt; i++) {
+        lv_list_add_btn(list, NULL, "");
+    }
+    ext->data_pool_cnt = pool_cnt;
+
+    /*The buttons will be positioned manually to the rows and the scrollable is as large as all the rows*/
+    lv_page_set_scrl_layout(list, LV_LAYOUT_OFF);
+    lv_page_set_scrollable_fit2(list, LV_FIT_PARENT, LV_FIT_NONE);
+    data_scrl_refr_height(list);
+
+    data_rows_refr(list, true);
+}
+
+/**
+ * Set the height of the scrollable to hold all rows of the data callback
+ * @param list pointer to a list object
+ */
+static void data_scrl_refr_height(lv_obj_t * list)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+
+    lv_style_int_t pad_top = lv_obj_get_style_pad_top(scrl, LV_CONT_PART_MAIN);
+    lv_style_int_t pad_bottom = lv_obj_get_style_pad_bottom(scrl, LV_CONT_PART_MAIN);
+    int32_t h = (int32_t)ext->data_row_h * ext->data_row_cnt + pad_top + pad_bottom;
+
+    /*The buttons are refilled by the caller so don't refill them on the scrollable's coordinate change too*/
+    uint16_t pool_cnt = ext->data_pool_cnt;
+    ext->data_pool_cnt = 0;
+    lv_obj_set_height(scrl, (lv_coord_t)LV_MATH_MIN(h, LV_COORD_MAX));
+    ext->data_pool_cnt = pool_cnt;
+}
+
+/**
+ * Move the recycled buttons to the visible rows and let the data callback set their content
+ * @param list pointer to a list object
+ * @param force true: refill all buttons; false: refill only the buttons moved to a new row
+ */
+static void data_rows_refr(lv_obj_t * list, bool force)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->data_cb == NULL || ext->data_row_h <= 0 || ext->data_pool_cnt == 0) return;
+
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+    lv_style_int_t pad_top = lv_obj_get_style_pad_top(scrl, LV_CONT_PART_MAIN);
+
+    /*The first (at least partially) visible row*/
+    lv_coord_t y = list->coords.y1 - scrl->coords.y1 - pad_top;
+    uint32_t first = y > 0 ? y / ext->data_row_h : 0;
+    if(first + ext->data_pool_cnt > ext->data_row_cnt) first = ext->data_row_cnt - ext->data_pool_cnt;
+
+    /*Row `r` is always shown by the `r % pool_cnt`th button, so scrolling by one row moves only one button*/
+    uint32_t slot = 0;
+    lv_obj_t * btn = lv_list_get_next_btn(list, NULL);
+    while(btn) {
+        uint32_t row = first + (slot + ext->data_pool_cnt - first % ext->data_pool_cnt) % ext->data_pool_cnt;
+        lv_coord_t row_y = pad_top + row * ext->data_row_h;
+        if(row >= ext->data_row_cnt) {
+            lv_obj_set_hidden(btn, true);
+        }
+        else if(force || lv_obj_get_hidden(btn) || lv_obj_get_y(btn) != row_y) {
+            lv_obj_set_hidden(btn, false);
+            lv_obj_set_y(btn, row_y);
+            ext->data_cb(list, btn, row);
+        }
+
+        slot++;
+        btn = lv_list_get_next_btn(list, btn);
+    }
+}
+
 /**
  * Check if this is really a list button or another object.
  * @param list_btn List button
@@ -43,6 +43,16 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
+
+/**
+ * Sets the content of a recycled button when the list gets its rows from a callback.
+ * Called when a row scrolls in to the list and the button is moved to show it.
+ * @param list pointer to the list
+ * @param btn pointer to the button showing the row. Use e.g. `lv_list_get_btn_label(btn)` to set its text.
+ * @param row index of the row to show
+ */
+typedef void (*lv_list_data_cb_t)(lv_obj_t * list, lv_obj_t * btn, uint16_t row);
+
 /*Data of list*/
 typedef struct {
     lv_page_ext_t page; /*Ext. of ancestor*/
@@ -52,6 +62,10 @@ typedef struct {
     lv_obj_t * last_sel_btn;     /* The last selected button. It will be reverted when the list is focused again */
 #endif
     lv_obj_t * act_sel_btn; /* The button is currently being selected*/
+    lv_list_data_cb_t data_cb; /*If set only the visible rows have buttons and this callback sets their content*/
+    uint16_t data_row_cnt;      /*Number of rows provided by `data_cb`*/
+    uint16_t data_pool_cnt;     /*Number of recycled buttons*/
+    lv_coord_t data_row_h;      /*Distance of the rows provided by `data_cb`*/
 } lv_list_ext_t;
 
 /** List styles. */
@@ -117,6 +131,19 @@ bool lv_list_remove(const lv_obj_t * list, uint16_t index);
  */
 void lv_list_focus_btn(lv_obj_t * list, lv_obj_t * btn);
 
+/**
+ * Get the rows of the list from a callback. Only a few buttons are created to cover the visible area
+ * and they are recycled (moved and refilled by `data_cb`) while the list is scrolled.
+ * This way the memory usage doesn't depend on the number of rows.
+ * The existing buttons are deleted and the buttons are created with a label only.
+ * Call it again with the same callback to change the number of rows or to refresh the visible rows.
+ * The total height of the rows is limited to `LV_COORD_MAX`. Use 32 bit `lv_coord_t` for very long data.
+ * @param list pointer to a list object
+ * @param data_cb the callback to set the content of the buttons or NULL to use normal buttons again
+ * @param row_cnt number of rows provided by `data_cb`
+ */
+void lv_list_set_data_cb(lv_obj_t * list, lv_list_data_cb_t data_cb, uint16_t row_cnt);
+
 /**
  * Set the scroll bar mode of a list
  * @param list pointer to a list object
@@ -169,6 +196,13 @@ void lv_list_set_layout(lv_obj_t * list, lv_layout_t layout);
  * Getter functions
  *====================*/
 
+/**
+ * Get the callback which provides the rows of the list
+ * @param list pointer to a list object
+ * @return the data callback or NULL if normal buttons are used
+ */
+lv_list_data_cb_t lv_list_get_data_cb(const lv_obj_t * list);
+
 /**
  * Get the text of a list element
  * @param btn pointer to list element
@@ -209,14 +243,15 @@ lv_obj_t * lv_list_get_next_btn(const lv_obj_t * list, lv_obj_t * prev_btn);
  * Get the index of the button in the list
  * @param list pointer to a list object. If NULL, assumes btn is part of a list.
  * @param btn pointer to a list element (button)
- * @return the index of the button in the list, or -1 of the button not in this list
+ * @return the index of the button in the list, or -1 of the button not in this list.
+ *         With a data callback the index of the row shown by the button.
  */
 int32_t lv_list_get_btn_index(const lv_obj_t * list, const lv_obj_t * btn);
 
 /**
  * Get the number of buttons in the list
  * @param list pointer to a list object
- * @return the number of buttons in the list
+ * @return the number of buttons in the list. With a data callback the number of rows.
  */
 uint16_t lv_list_get_size(const lv_obj_t * list);
 
@@ -499,7 +499,7 @@ static lv_res_t lv_msgbox_signal(lv_obj_t * mbox, lv_signal_t sign, void * param
 #endif
         sign == LV_SIGNAL_FOCUS || sign == LV_SIGNAL_DEFOCUS) {
         if(ext->btnm) {
-            ext->btnm->signal_cb(ext->btnm, sign, param);
+            _LV_OBJ_SIGNAL_CB(ext->btnm)(ext->btnm, sign, param);
         }
 
         /* The button matrix with ENCODER input supposes it's in a group but in this case it isn't
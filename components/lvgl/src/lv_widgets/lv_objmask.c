@@ -73,8 +73,7 @@ lv_obj_t * lv_objmask_create(lv_obj_t * par, const lv_obj_t * copy)
     _lv_ll_init(&ext->mask_ll, sizeof(lv_objmask_mask_t));
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(objmask, lv_objmask_signal);
-    lv_obj_set_design_cb(objmask, lv_objmask_design);
+    lv_obj_set_signal_design_cb(objmask, lv_objmask_signal, lv_objmask_design);
 
     /*Init the new object mask object mask*/
     if(copy == NULL) {
@@ -80,8 +80,7 @@ lv_obj_t * lv_templ_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->xyz = 0;
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(new_templ, lv_templ_signal);
-    lv_obj_set_design_cb(new_templ, lv_templ_design);
+    lv_obj_set_signal_design_cb(new_templ, lv_templ_signal, lv_templ_design);
 
     /*Init the new template template*/
     if(copy == NULL) {
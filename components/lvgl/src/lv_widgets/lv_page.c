@@ -99,11 +99,13 @@ lv_obj_t * lv_page_create(lv_obj_t * par, const lv_obj_t * copy)
 
     ext->scrl        = NULL;
     lv_style_list_init(&ext->scrlbar.style);
+    _lv_style_list_set_owner(&ext->scrlbar.style, page, LV_PAGE_PART_SCROLLBAR);
     ext->scrlbar.hor_draw = 0;
     ext->scrlbar.ver_draw = 0;
     ext->scrlbar.mode     = LV_SCROLLBAR_MODE_AUTO;
 #if LV_USE_ANIMATION
     lv_style_list_init(&ext->edge_flash.style);
+    _lv_style_list_set_owner(&ext->edge_flash.style, page, LV_PAGE_PART_EDGE_FLASH);
     ext->edge_flash.enabled   = 0;
     ext->edge_flash.bottom_ip = 0;
     ext->edge_flash.top_ip    = 0;
@@ -121,6 +123,9 @@ lv_obj_t * lv_page_create(lv_obj_t * par, const lv_obj_t * copy)
         lv_obj_set_focus_parent(ext->scrl, true);
         lv_obj_set_drag(ext->scrl, true);
         lv_obj_set_drag_throw(ext->scrl, true);
+#if LV_USE_FAST_SCROLL
+        lv_obj_set_fast_scroll(ext->scrl, true);
+#endif
         lv_obj_add_protect(ext->scrl, LV_PROTECT_PARENT | LV_PROTECT_PRESS_LOST);
         lv_cont_set_fit(ext->scrl, LV_FIT_MAX);
         lv_obj_set_event_cb(ext->scrl, scrl_def_event_cb); /*Propagate some event to the background
@@ -129,8 +134,7 @@ lv_obj_t * lv_page_create(lv_obj_t * par, const lv_obj_t * copy)
 
         /* Add the signal function only if 'scrolling' is created
         +         * because everything has to be ready before any signal is received*/
-        lv_obj_set_signal_cb(page, lv_page_signal);
-        lv_obj_set_design_cb(page, lv_page_design);
+        lv_obj_set_signal_design_cb(page, lv_page_signal, lv_page_design);
 
         lv_page_set_scrollbar_mode(page, ext->scrlbar.mode);
 
@@ -149,8 +153,7 @@ lv_obj_t * lv_page_create(lv_obj_t * par, const lv_obj_t * copy)
 
         /* Add the signal function only if 'scrolling' is created
          * because everything has to be ready before any signal is received*/
-        lv_obj_set_signal_cb(page, lv_page_signal);
-        lv_obj_set_design_cb(page, lv_page_design);
+        lv_obj_set_signal_design_cb(page, lv_page_signal, lv_page_design);
 
         lv_page_set_scrollbar_mode(page, copy_ext->scrlbar.mode);
     }
@@ -846,7 +849,7 @@ static lv_res_t lv_page_signal(lv_obj_t * page, lv_signal_t sign, void * param)
         /*Refresh the scrollbar and notify the scrl if the size is changed*/
         if(ext->scrl != NULL && (lv_obj_get_width(page) != lv_area_get_width(param) ||
                                  lv_obj_get_height(page) != lv_area_get_height(param))) {
-            ext->scrl->signal_cb(ext->scrl, LV_SIGNAL_COORD_CHG, &ext->scrl->coords);
+            _LV_OBJ_SIGNAL_CB(ext->scrl)(ext->scrl, LV_SIGNAL_COORD_CHG, &ext->scrl->coords);
 
             /*The scrollbars are important only if they are visible now*/
             if(ext->scrlbar.hor_draw || ext->scrlbar.ver_draw) scrlbar_refresh(page);
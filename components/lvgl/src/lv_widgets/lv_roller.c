@@ -94,10 +94,10 @@ lv_obj_t * lv_roller_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->sel_opt_id_ori = 0;
     ext->auto_fit = 1;
     lv_style_list_init(&ext->style_sel);
+    _lv_style_list_set_owner(&ext->style_sel, roller, LV_ROLLER_PART_SELECTED);
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(roller, lv_roller_signal);
-    lv_obj_set_design_cb(roller, lv_roller_design);
+    lv_obj_set_signal_design_cb(roller, lv_roller_signal, lv_roller_design);
 
     /*Init the new roller roller*/
     if(copy == NULL) {
@@ -108,6 +108,9 @@ lv_obj_t * lv_roller_create(lv_obj_t * par, const lv_obj_t * copy)
         lv_obj_set_design_cb(label, lv_roller_label_design);
         lv_obj_t * scrl = lv_page_get_scrollable(roller);
         lv_obj_set_drag(scrl, true);
+#if LV_USE_FAST_SCROLL
+        lv_obj_set_fast_scroll(scrl, false); /*The selected option is highlighted at a fixed position*/
+#endif
         lv_page_set_scrollable_fit2(roller, LV_FIT_PARENT, LV_FIT_NONE); /*Height is specified directly*/
         lv_roller_set_anim_time(roller, LV_ROLLER_DEF_ANIM_TIME);
         lv_roller_set_options(roller, "Option 1\nOption 2\nOption 3\nOption 4\nOption 5", LV_ROLLER_MODE_NORMAL);
@@ -83,10 +83,10 @@ lv_obj_t * lv_slider_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->dragging = 0;
     ext->left_knob_focus = 0;
     lv_style_list_init(&ext->style_knob);
+    _lv_style_list_set_owner(&ext->style_knob, slider, LV_SLIDER_PART_KNOB);
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(slider, lv_slider_signal);
-    lv_obj_set_design_cb(slider, lv_slider_design);
+    lv_obj_set_signal_design_cb(slider, lv_slider_signal, lv_slider_design);
 
     /*Init the new slider slider*/
     if(copy == NULL) {
@@ -417,7 +417,7 @@ static lv_res_t lv_slider_signal(lv_obj_t * slider, lv_signal_t sign, void * par
          * During the drawing method the ext. size is used by the knob so refresh the ext. size.*/
         if(lv_obj_get_width(slider) != lv_area_get_width(param) ||
            lv_obj_get_height(slider) != lv_area_get_height(param)) {
-            slider->signal_cb(slider, LV_SIGNAL_REFR_EXT_DRAW_PAD, NULL);
+            _LV_OBJ_SIGNAL_CB(slider)(slider, LV_SIGNAL_REFR_EXT_DRAW_PAD, NULL);
         }
     }
     else if(sign == LV_SIGNAL_REFR_EXT_DRAW_PAD) {
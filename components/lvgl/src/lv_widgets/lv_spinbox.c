@@ -81,8 +81,7 @@ lv_obj_t * lv_spinbox_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->rollover           = false;
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(spinbox, lv_spinbox_signal);
-    lv_obj_set_design_cb(spinbox, ancestor_design); /*Leave the Text area's design function*/
+    lv_obj_set_signal_design_cb(spinbox, lv_spinbox_signal, ancestor_design); /*Leave the Text area's design function*/
 
     /*Init the new spinbox*/
     if(copy == NULL) {
@@ -80,10 +80,10 @@ lv_obj_t * lv_switch_create(lv_obj_t * par, const lv_obj_t * copy)
     }
 
     lv_style_list_init(&ext->style_knob);
+    _lv_style_list_set_owner(&ext->style_knob, sw, LV_SWITCH_PART_KNOB);
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(sw, lv_switch_signal);
-    lv_obj_set_design_cb(sw, lv_switch_design);
+    lv_obj_set_signal_design_cb(sw, lv_switch_signal, lv_switch_design);
 
     /*Init the new switch switch*/
     if(copy == NULL) {
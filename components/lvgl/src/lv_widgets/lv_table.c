@@ -84,10 +84,14 @@ lv_obj_t * lv_table_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->row_cnt       = 0;
     ext->row_h         = NULL;
     ext->cell_types    = 1;
+    ext->data_cb       = NULL;
+    ext->data_row_cnt  = 0;
+    ext->data_row_h    = 0;
 
     uint16_t i;
     for(i = 0; i < LV_TABLE_CELL_STYLE_CNT; i++) {
         lv_style_list_init(&ext->cell_style[i]);
+        _lv_style_list_set_owner(&ext->cell_style[i], table, LV_TABLE_PART_CELL1 + i);
     }
 
     for(i = 0; i < LV_TABLE_COL_MAX; i++) {
@@ -95,8 +99,7 @@ lv_obj_t * lv_table_create(lv_obj_t * par, const lv_obj_t * copy)
     }
 
     /*The signal and design functions are not copied so set them here*/
-    lv_obj_set_signal_cb(table, lv_table_signal);
-    lv_obj_set_design_cb(table, lv_table_design);
+    lv_obj_set_signal_design_cb(table, lv_table_signal, lv_table_design);
 
     /*Init the new table table*/
     if(copy == NULL) {
@@ -110,6 +113,7 @@ lv_obj_t * lv_table_create(lv_obj_t * par, const lv_obj_t * copy)
         }
         lv_table_set_row_cnt(table, copy_ext->row_cnt);
         lv_table_set_col_cnt(table, copy_ext->col_cnt);
+        if(copy_ext->data_cb) lv_table_set_data_cb(table, copy_ext->data_cb, copy_ext->data_row_cnt);
 
         /*Refresh the style with new signal function*/
         lv_obj_refresh_style(table, LV_OBJ_PART_ALL, LV_STYLE_PROP_ALL);
@@ -367,6 +371,41 @@ void lv_table_set_col_cnt(lv_obj_t * table, uint16_t col_cnt)
     refr_size(table);
 }
 
+/**
+ * Get the cells' text from a callback instead of storing them in the table.
+ * Only the visible cells are asked so the memory usage doesn't depend on the number of rows.
+ * The cells are single line, left aligned and use the `LV_TABLE_PART_CELL1` style.
+ * The stored cells (set by `lv_table_set_cell_value`) are deleted.
+ * Call it again to change the number of rows and `lv_obj_invalidate` to redraw the changed content.
+ * The total height of the rows is limited to `LV_COORD_MAX`. Use 32 bit `lv_coord_t` for very long data.
+ * @param table pointer to a Table object
+ * @param data_cb the callback providing the cells' text or NULL to store the cells again
+ * @param row_cnt number of rows provided by `data_cb`
+ */
+void lv_table_set_data_cb(lv_obj_t * table, lv_table_data_cb_t data_cb, uint16_t row_cnt)
+{
+    LV_ASSERT_OBJ(table, LV_OBJX_NAME);
+
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+
+    /*Free the stored cells, they are not used with a data callback*/
+    if(data_cb && ext->row_cnt > 0) {
+        uint32_t i;
+        for(i = 0; i < (uint32_t)ext->col_cnt * ext->row_cnt; i++) {
+            if(ext->cell_data[i]) {
+                lv_mem_free(ext->cell_data[i]);
+                ext->cell_data[i] = NULL;
+            }
+        }
+        lv_table_set_row_cnt(table, 0);
+    }
+
+    ext->data_cb = data_cb;
+    ext->data_row_cnt = data_cb ? row_cnt : 0;
+
+    refr_size(table);
+}
+
 /**
  * Set the width of a column
  * @param table table pointer to a Table object
@@ -580,14 +619,14 @@ const char * lv_table_get_cell_value(lv_obj_t * table, uint16_t row, uint16_t co
 /**
  * Get the number of rows.
  * @param table table pointer to a Table object
- * @return number of rows.
+ * @return number of rows. (Including the rows provided by the data callback)
  */
 uint16_t lv_table_get_row_cnt(lv_obj_t * table)
 {
     LV_ASSERT_OBJ(table, LV_OBJX_NAME);
 
     lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
-    return ext->row_cnt;
+    return ext->data_cb ? ext->data_row_cnt : ext->row_cnt;
 }
 
 /**
@@ -622,6 +661,19 @@ lv_coord_t lv_table_get_col_width(lv_obj_t * table, uint16_t col_id)
     return ext->col_w[col_id];
 }
 
+/**
+ * Get the callback which provides the cells' text
+ * @param table pointer to a Table object
+ * @return the data callback or NULL if the cells are stored in the table
+ */
+lv_table_data_cb_t lv_table_get_data_cb(lv_obj_t * table)
+{
+    LV_ASSERT_OBJ(table, LV_OBJX_NAME);
+
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+    return ext->data_cb;
+}
+
 /**
  * Get the text align of a cell
  * @param table pointer to a Table object
@@ -774,9 +826,16 @@ lv_res_t lv_table_get_pressed_cell(lv_obj_t * table, uint16_t * row, uint16_t *
         *row = 0;
         tmp = 0;
 
-        for(*row = 0; *row < ext->row_cnt; (*row)++) {
-            tmp += ext->row_h[*row];
-            if(y < tmp) break;
+        if(ext->data_cb) {
+            /*The rows of the data callback have the same height*/
+            if(y < 0 || ext->data_row_h == 0) *row = 0;
+            else *row = LV_MATH_MIN(y / ext->data_row_h, ext->data_row_cnt);
+        }
+        else {
+            for(*row = 0; *row < ext->row_cnt; (*row)++) {
+                tmp += ext->row_h[*row];
+                if(y < tmp) break;
+            }
         }
     }
 
@@ -852,9 +911,20 @@ static lv_design_res_t lv_table_design(lv_obj_t * table, const lv_area_t * clip_
 
         bool rtl = lv_obj_get_base_dir(table) == LV_BIDI_DIR_RTL ? true : false;
 
+        uint16_t row_cnt = ext->data_cb ? ext->data_row_cnt : ext->row_cnt;
+        uint16_t row_start = 0;
+        char data_buf[LV_TABLE_DATA_BUF_SIZE + 1];  /*Format byte + text from the data callback*/
+
         cell_area.y2 = table->coords.y1 + bg_top - 1;
-        for(row = 0; row < ext->row_cnt; row++) {
-            lv_coord_t h_row = ext->row_h[row];
+
+        /*The rows of the data callback have the same height so the first visible row can be calculated*/
+        if(ext->data_cb && ext->data_row_h > 0 && clip_area->y1 > cell_area.y2) {
+            row_start = LV_MATH_MIN((clip_area->y1 - cell_area.y2 - 1) / ext->data_row_h, row_cnt);
+            cell_area.y2 += row_start * ext->data_row_h;
+        }
+
+        for(row = row_start; row < row_cnt; row++) {
+            lv_coord_t h_row = ext->data_cb ? ext->data_row_h : ext->row_h[row];
 
             cell_area.y1 = cell_area.y2 + 1;
             cell_area.y2 = cell_area.y1 + h_row - 1;
@@ -866,15 +936,29 @@ static lv_design_res_t lv_table_design(lv_obj_t * table, const lv_area_t * clip_
 
             for(col = 0; col < ext->col_cnt; col++) {
 
+                char * cell_txt;
                 lv_table_cell_format_t format;
-                if(ext->cell_data[cell]) {
-                    format.format_byte = ext->cell_data[cell][0];
+                if(ext->data_cb == NULL && ext->cell_data[cell]) {
+                    cell_txt = ext->cell_data[cell];
+                    format.format_byte = cell_txt[0];
                 }
                 else {
                     format.s.right_merge = 0;
                     format.s.align       = LV_LABEL_ALIGN_LEFT;
                     format.s.type        = 0;
                     format.s.crop        = 1;
+
+                    if(ext->data_cb) {
+                        /*Let the callback print the text into the recycled buffer*/
+                        data_buf[0] = format.format_byte;
+                        data_buf[1] = '\0';
+                        ext->data_cb(table, row, col, &data_buf[1], LV_TABLE_DATA_BUF_SIZE);
+                        data_buf[LV_TABLE_DATA_BUF_SIZE] = '\0';
+                        cell_txt = data_buf;
+                    }
+                    else {
+                        cell_txt = NULL;
+                    }
                 }
 
                 if(rtl) {
@@ -887,7 +971,7 @@ static lv_design_res_t lv_table_design(lv_obj_t * table, const lv_area_t * clip_
                 }
 
                 uint16_t col_merge = 0;
-                for(col_merge = 0; col_merge + col < ext->col_cnt - 1; col_merge++) {
+                for(col_merge = 0; ext->data_cb == NULL && col_merge + col < ext->col_cnt - 1; col_merge++) {
                     if(ext->cell_data[cell + col_merge] != NULL) {
                         format.format_byte = ext->cell_data[cell + col_merge][0];
                         if(format.s.right_merge)
@@ -928,7 +1012,7 @@ static lv_design_res_t lv_table_design(lv_obj_t * table, const lv_area_t * clip_
 
                 lv_draw_rect(&cell_area_border, clip_area, &rect_dsc[cell_type]);
 
-                if(ext->cell_data[cell]) {
+                if(cell_txt) {
                     txt_area.x1 = cell_area.x1 + cell_left[cell_type];
                     txt_area.x2 = cell_area.x2 - cell_right[cell_type];
                     txt_area.y1 = cell_area.y1 + cell_top[cell_type];
@@ -942,7 +1026,7 @@ static lv_design_res_t lv_table_design(lv_obj_t * table, const lv_area_t * clip_
                         txt_flags = LV_TXT_FLAG_EXPAND;
                     }
 
-                    _lv_txt_get_size(&txt_size, ext->cell_data[cell] + 1, label_dsc[cell_type].font,
+                    _lv_txt_get_size(&txt_size, cell_txt + 1, label_dsc[cell_type].font,
                                      label_dsc[cell_type].letter_space, label_dsc[cell_type].line_space,
                                      lv_area_get_width(&txt_area), txt_flags);
 
@@ -970,7 +1054,7 @@ static lv_design_res_t lv_table_design(lv_obj_t * table, const lv_area_t * clip_
                     bool label_mask_ok;
                     label_mask_ok = _lv_area_intersect(&label_mask, clip_area, &cell_area);
                     if(label_mask_ok) {
-                        lv_draw_label(&txt_area, &label_mask, &label_dsc[cell_type], ext->cell_data[cell] + 1, NULL);
+                        lv_draw_label(&txt_area, &label_mask, &label_dsc[cell_type], cell_txt + 1, NULL);
                     }
 
                     /*Draw lines after '\n's*/
@@ -978,10 +1062,10 @@ static lv_design_res_t lv_table_design(lv_obj_t * table, const lv_area_t * clip_
                     lv_point_t p2;
                     p1.x = cell_area.x1;
                     p2.x = cell_area.x2;
-                    for(i = 1; ext->cell_data[cell][i] != '\0'; i++) {
-                        if(ext->cell_data[cell][i] == '\n') {
-                            ext->cell_data[cell][i] = '\0';
-                            _lv_txt_get_size(&txt_size, ext->cell_data[cell] + 1, label_dsc[cell_type].font,
+                    for(i = 1; cell_txt[i] != '\0'; i++) {
+                        if(cell_txt[i] == '\n') {
+                            cell_txt[i] = '\0';
+                            _lv_txt_get_size(&txt_size, cell_txt + 1, label_dsc[cell_type].font,
                                              label_dsc[cell_type].letter_space, label_dsc[cell_type].line_space,
                                              lv_area_get_width(&txt_area), txt_flags);
 
@@ -989,7 +1073,7 @@ static lv_design_res_t lv_table_design(lv_obj_t * table, const lv_area_t * clip_
                             p2.y = txt_area.y1 + txt_size.y + label_dsc[cell_type].line_space / 2;
                             lv_draw_line(&p1, &p2, clip_area, &line_dsc[cell_type]);
 
-                            ext->cell_data[cell][i] = '\n';
+                            cell_txt[i] = '\n';
                         }
                     }
                 }
@@ -1084,7 +1168,8 @@ static void refr_size(lv_obj_t * table)
     lv_coord_t w = 0;
 
     lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
-    if(ext->row_cnt == 0 || ext->col_cnt == 0) {
+    uint16_t row_cnt = ext->data_cb ? ext->data_row_cnt : ext->row_cnt;
+    if(row_cnt == 0 || ext->col_cnt == 0) {
         lv_obj_set_size(table, w, h);
         return;
     }
@@ -1113,10 +1198,17 @@ static void refr_size(lv_obj_t * table)
         font[i] = lv_obj_get_style_text_font(table, LV_TABLE_PART_CELL1 + i);
     }
 
-    for(i = 0; i < ext->row_cnt; i++) {
-        ext->row_h[i] = get_row_height(table, i, font, letter_space, line_space,
-                                       cell_left, cell_right, cell_top, cell_bottom);
-        h += ext->row_h[i];
+    if(ext->data_cb) {
+        /*The rows of the data callback are single line so no need to measure the texts*/
+        ext->data_row_h = lv_font_get_line_height(font[0]) + cell_top[0] + cell_bottom[0];
+        h = (lv_coord_t)LV_MATH_MIN((int32_t)ext->data_row_h * row_cnt, LV_COORD_MAX);
+    }
+    else {
+        for(i = 0; i < ext->row_cnt; i++) {
+            ext->row_h[i] = get_row_height(table, i, font, letter_space, line_space,
+                                           cell_left, cell_right, cell_top, cell_bottom);
+            h += ext->row_h[i];
+        }
     }
 
     lv_style_int_t bg_top = lv_obj_get_style_pad_top(table, LV_TABLE_PART_BG);
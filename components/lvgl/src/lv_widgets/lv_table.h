@@ -43,10 +43,22 @@ extern "C" {
 #if (LV_TABLE_CELL_STYLE_CNT > 16)
 #  error LV_TABLE_CELL_STYLE_CNT cannot exceed 16
 #endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Provides the text of a cell when the table gets its content from a callback.
+ * The text should be printed to `buf` (e.g. with `lv_snprintf`). It's called only for the visible cells.
+ * @param table pointer to the table
+ * @param row id of the row [0 .. row_cnt -1]
+ * @param col id of the column [0 .. col_cnt -1]
+ * @param buf buffer to print the text to
+ * @param buf_size size of `buf` (`LV_TABLE_DATA_BUF_SIZE`)
+ */
+typedef void (*lv_table_data_cb_t)(lv_obj_t * table, uint16_t row, uint16_t col, char * buf, uint16_t buf_size);
+
 /**
  * Internal table cell format structure.
  *
@@ -73,6 +85,9 @@ typedef struct {
     lv_coord_t col_w[LV_TABLE_COL_MAX];
 uint16_t cell_types :
     LV_TABLE_CELL_STYLE_CNT; /*Keep track which cell types exists to avoid dealing with unused ones*/
+    lv_table_data_cb_t data_cb;  /*If set the cells are not stored but asked from this callback*/
+    uint16_t data_row_cnt;       /*Number of rows provided by `data_cb`*/
+    lv_coord_t data_row_h;       /*Height of the rows provided by `data_cb`*/
 } lv_table_ext_t;
 
 /*Parts of the table*/
@@ -134,6 +149,19 @@ void lv_table_set_row_cnt(lv_obj_t * table, uint16_t row_cnt);
  */
 void lv_table_set_col_cnt(lv_obj_t * table, uint16_t col_cnt);
 
+/**
+ * Get the cells' text from a callback instead of storing them in the table.
+ * Only the visible cells are asked so the memory usage doesn't depend on the number of rows.
+ * The cells are single line, left aligned and use the `LV_TABLE_PART_CELL1` style.
+ * The stored cells (set by `lv_table_set_cell_value`) are deleted.
+ * Call it again to change the number of rows and `lv_obj_invalidate` to redraw the changed content.
+ * The total height of the rows is limited to `LV_COORD_MAX`. Use 32 bit `lv_coord_t` for very long data.
+ * @param table pointer to a Table object
+ * @param data_cb the callback providing the cells' text or NULL to store the cells again
+ * @param row_cnt number of rows provided by `data_cb`
+ */
+void lv_table_set_data_cb(lv_obj_t * table, lv_table_data_cb_t data_cb, uint16_t row_cnt);
+
 /**
  * Set the width of a column
  * @param table table pointer to a Table object
@@ -194,7 +222,7 @@ const char * lv_table_get_cell_value(lv_obj_t * table, uint16_t row, uint16_t co
 /**
  * Get the number of rows.
  * @param table table pointer to a Table object
- * @return number of rows.
+ * @return number of rows. (Including the rows provided by the data callback)
  */
 uint16_t lv_table_get_row_cnt(lv_obj_t * table);
 
@@ -213,6 +241,13 @@ uint16_t lv_table_get_col_cnt(lv_obj_t * table);
  */
 lv_coord_t lv_table_get_col_width(lv_obj_t * table, uint16_t col_id);
 
+/**
+ * Get the callback which provides the cells' text
+ * @param table pointer to a Table object
+ * @return the data callback or NULL if the cells are stored in the table
+ */
+lv_table_data_cb_t lv_table_get_data_cb(lv_obj_t * table);
+
 /**
  * Get the text align of a cell
  * @param table pointer to a Table object
@@ -674,7 +674,7 @@ static lv_res_t lv_tabview_signal(lv_obj_t * tabview, lv_signal_t sign, void * p
 
         /* The button matrix is not in a group (the tab view is in it) but it should handle the
          * group signals. So propagate the related signals to the button matrix manually*/
-        ext->btns->signal_cb(ext->btns, sign, param);
+        _LV_OBJ_SIGNAL_CB(ext->btns)(ext->btns, sign, param);
 
         /*Make the active tab's button focused*/
         if(sign == LV_SIGNAL_FOCUS) {
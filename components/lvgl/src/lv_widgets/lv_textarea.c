@@ -126,16 +126,18 @@ lv_obj_t * lv_textarea_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->placeholder_txt = NULL;
 
     lv_style_list_init(&ext->cursor.style);
+    _lv_style_list_set_owner(&ext->cursor.style, ta, LV_TEXTAREA_PART_CURSOR);
     lv_style_list_init(&ext->style_placeholder);
+    _lv_style_list_set_owner(&ext->style_placeholder, ta, LV_TEXTAREA_PART_PLACEHOLDER);
 
 #if LV_USE_ANIMATION == 0
     ext->pwd_show_time     = 0;
     ext->cursor.blink_time = 0;
 #endif
 
-    lv_obj_set_signal_cb(ta, lv_textarea_signal);
-    lv_obj_set_signal_cb(lv_page_get_scrollable(ta), lv_textarea_scrollable_signal);
-    lv_obj_set_design_cb(ta, lv_textarea_design);
+    lv_obj_set_signal_design_cb(ta, lv_textarea_signal, lv_textarea_design);
+    lv_obj_set_signal_design_cb(lv_page_get_scrollable(ta), lv_textarea_scrollable_signal,
+                                lv_textarea_scrollable_design);
 
     /*Init the new text area object*/
     if(copy == NULL) {
@@ -143,8 +145,6 @@ lv_obj_t * lv_textarea_create(lv_obj_t * par, const lv_obj_t * copy)
 
         ext->label = lv_label_create(ta, NULL);
 
-        lv_obj_set_design_cb(ext->page.scrl, lv_textarea_scrollable_design);
-
         lv_label_set_long_mode(ext->label, LV_LABEL_LONG_BREAK);
         lv_label_set_text(ext->label, "Text area");
         lv_obj_set_click(ext->label, false);
@@ -157,7 +157,6 @@ lv_obj_t * lv_textarea_create(lv_obj_t * par, const lv_obj_t * copy)
     }
     /*Copy an existing object*/
     else {
-        lv_obj_set_design_cb(ext->page.scrl, lv_textarea_scrollable_design);
         lv_textarea_ext_t * copy_ext = lv_obj_get_ext_attr(copy);
         ext->label             = lv_label_create(ta, copy_ext->label);
         ext->pwd_mode          = copy_ext->pwd_mode;
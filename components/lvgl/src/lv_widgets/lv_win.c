@@ -695,7 +695,7 @@ static lv_res_t lv_win_signal(lv_obj_t * win, lv_signal_t sign, void * param)
     else if(sign == LV_SIGNAL_CONTROL) {
 #if LV_USE_GROUP
         /*Forward all the control signals to the page*/
-        ext->page->signal_cb(ext->page, sign, param);
+        _LV_OBJ_SIGNAL_CB(ext->page)(ext->page, sign, param);
 #endif
     }
 
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+
+# Build and run the render benchmark with the configuration of the target (see sdkconfig).
+# Usage: ./bench.py [output.json]
+
+import os
+import sys
+
+lvgldirname = os.path.abspath('..')
+lvgldirname = os.path.basename(lvgldirname)
+lvgldirname = '"' + lvgldirname + '"'
+
+base_defines = '"-DLV_CONF_PATH=' + lvgldirname +'/tests/lv_test_conf.h -DLV_BUILD_BENCH"'
+optimization = '"-O3 -g0"'
+
+def build(defines, opt):
+  global base_defines
+
+  d_all = base_defines[:-1] + " ";
+
+  for d in defines:
+    d_all += " -D" + d + "=" + str(defines[d])
+
+  d_all += '"'
+  cmd = "make bench -j8 LVGL_DIR_NAME=" + lvgldirname + " DEFINES=" + d_all + " OPTIMIZATION=" + opt
+
+  print("---------------------------")
+  print("Clean")
+  print("---------------------------")
+  os.system("make clean LVGL_DIR_NAME=" + lvgldirname)
+  os.system("rm -f ./bench.bin")
+  print("---------------------------")
+  print("Build")
+  print("---------------------------")
+  ret = os.system(cmd)
+  if(ret != 0):
+    print("BUILD ERROR! (error code " + str(ret) + ")")
+    exit(1)
+
+def run(cmd):
+  print("---------------------------")
+  print("Run")
+  print("---------------------------")
+  ret = os.system(cmd)
+  if(ret != 0):
+    print("RUN ERROR! (error code " + str(ret) + ")")
+    exit(1)
+
+def bench(name, defines, json_path):
+  global optimization
+
+  print("=============================")
+  print(name)
+  print("=============================")
+
+  build(defines, optimization)
+  run("./bench.bin " + json_path)
+
+  os.system("make clean LVGL_DIR_NAME=" + lvgldirname)
+
+  print("---------------------------")
+  print("Finished")
+  print("---------------------------")
+
+target = {
+  "LV_DPI":130,
+  "LV_MEM_CUSTOM":1,
+  "LV_MEM_CUSTOM_ALLOC":"lv_bench_malloc",
+  "LV_MEM_CUSTOM_FREE":"lv_bench_free",
+  "LV_HOR_RES_MAX":480,
+  "LV_VER_RES_MAX":320,
+  "LV_BENCH_BUF_LINES":40,
+  "LV_COLOR_DEPTH":16,
+  "LV_COLOR_16_SWAP":1,
+  "LV_USE_ANIMATION":1,
+  "LV_ANTIALIAS":1,
+  "LV_USE_SHADOW":1,
+  "LV_USE_IMG_TRANSFORM":1,
+  "LV_USE_LAYOUT_DEFER":1,
+  "LV_USE_STYLE_INDEX":1,
+  "LV_USE_HIT_INDEX":1,
+  "LV_USE_OBJ_COMPACT":1,
+  "LV_USE_FAST_SCROLL":1,
+  "LV_USE_SCR_SNAPSHOT":1,
+  "LV_USE_GROUP_INDEX":1,
+  "LV_USE_SUBTREE_BOUNDS":1,
+  "LV_USE_LOG":0,
+  "LV_USE_DEBUG":0,
+  "LV_USE_ASSERT_NULL":0,
+  "LV_USE_ASSERT_MEM":0,
+  "LV_USE_ASSERT_STR":0,
+  "LV_USE_ASSERT_OBJ":0,
+  "LV_USE_ASSERT_STYLE":0,
+  "LV_USE_THEME_MATERIAL":1,
+  "LV_THEME_DEFAULT_INIT": "\\\"lv_theme_material_init\\\"",
+  "LV_THEME_DEFAULT_COLOR_PRIMARY":      "\\\"LV_COLOR_RED\\\"",
+  "LV_THEME_DEFAULT_COLOR_SECONDARY":    "\\\"LV_COLOR_BLUE\\\"",
+  "LV_THEME_DEFAULT_FLAG"         :     "\\\"LV_THEME_MATERIAL_FLAG_LIGHT\\\"",
+  "LV_THEME_DEFAULT_FONT_SMALL"    :     "\\\"&lv_font_montserrat_16\\\"",
+  "LV_THEME_DEFAULT_FONT_NORMAL"   :     "\\\"&lv_font_montserrat_16\\\"",
+  "LV_THEME_DEFAULT_FONT_SUBTITLE" :     "\\\"&lv_font_montserrat_16\\\"",
+  "LV_THEME_DEFAULT_FONT_TITLE"    :     "\\\"&lv_font_montserrat_16\\\"",
+  "LV_FONT_MONTSERRAT_14":1,
+  "LV_FONT_MONTSERRAT_16":1,
+  "LV_USE_BTN":1,
+  "LV_USE_CHART":1,
+  "LV_USE_CONT":1,
+  "LV_USE_IMG":1,
+  "LV_USE_LABEL":1,
+  "LV_USE_PAGE":1,
+  "LV_USE_SLIDER":1,
+  "LV_USE_SWITCH":1
+}
+
+if __name__ == "__main__":
+  json_path = sys.argv[1] if len(sys.argv) > 1 else "bench.json"
+  bench("Target configuration", target, json_path)
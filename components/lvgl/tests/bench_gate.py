@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+
+# Deterministic performance gate: run the benchmark scenes under callgrind,
+# sum the executed instructions (Ir) per scene and per subsystem
+# and compare them with bench_baseline.json.
+#
+# Usage: ./bench_gate.py            compare with the baseline, exit with 1 on regression
+#        ./bench_gate.py --update   save the current costs as the new baseline
+#
+# The instruction counts depend on the compiler, so the baseline is valid only with the
+# toolchain it was recorded with. The CI records it from the base revision of the pull request.
+
+import glob
+import json
+import os
+import shutil
+import sys
+
+import bench
+
+baseline_path = "bench_baseline.json"
+out_dir = "callgrind_out"
+
+# Instruction counts don't depend on the number of frames, so few frames are enough
+frame_cnt = 10
+
+# Inclusive cost of these functions is recorded. Static functions can get
+# suffixes like ".part.0" or ".isra.0", they are matched too.
+subsystems = {
+  "refr_obj": ["lv_refr_obj"],
+  "draw_rect": ["lv_draw_rect"],
+  "draw_label": ["lv_draw_label"],
+  "blend_fill": ["_lv_blend_fill"],
+  "style_get": ["_lv_obj_get_style_int", "_lv_obj_get_style_color", "_lv_obj_get_style_opa", "_lv_obj_get_style_ptr"],
+  "mem_alloc": ["lv_mem_alloc"],
+}
+
+def parse_name(s, names):
+  # Compressed names: "(id) name" at first use, "(id)" later
+  if s.startswith("("):
+    end = s.index(")")
+    key = s[:end + 1]
+    if end + 1 < len(s):
+      names[key] = s[end + 1:].strip()
+    return names[key]
+  return s
+
+def parse_callgrind(path):
+  names = {}
+  self_cost = {}
+  call_cost = {}
+  total = 0
+  pos_cnt = 1
+  fn = None
+  cfn = None
+  in_call = False
+
+  for line in open(path):
+    line = line.rstrip("\n")
+    if not line:
+      continue
+
+    c = line[0]
+    if c.isdigit() or c in "+-*":
+      parts = line.split()
+      ir = int(parts[pos_cnt]) if len(parts) > pos_cnt else 0
+      if in_call:
+        # Recursive calls are already in the self cost of the function
+        if cfn != fn:
+          call_cost[fn] = call_cost.get(fn, 0) + ir
+        in_call = False
+      else:
+        self_cost[fn] = self_cost.get(fn, 0) + ir
+    elif line.startswith("fn="):
+      fn = parse_name(line[3:], names)
+    elif line.startswith("cfn="):
+      cfn = parse_name(line[4:], names)
+    elif line.startswith("calls="):
+      in_call = True
+    elif line.startswith("positions:"):
+      pos_cnt = len(line.split()) - 1
+    elif line.startswith("summary:") or line.startswith("totals:"):
+      total = int(line.split()[1])
+
+  costs = {"total": total}
+  for sub in subsystems:
+    costs[sub] = 0
+
+  for f in set(self_cost) | set(call_cost):
+    base = f.split(".")[0]
+    for sub in subsystems:
+      if base in subsystems[sub]:
+        costs[sub] += self_cost.get(f, 0) + call_cost.get(f, 0)
+
+  return costs
+
+def measure():
+  if shutil.which("valgrind") is None:
+    print("valgrind is required for the instruction count gate")
+    exit(2)
+
+  defines = dict(bench.target)
+
+  # Use the built-in allocator: valgrind replaces malloc and doesn't count its instructions
+  defines["LV_MEM_CUSTOM"] = 0
+  defines["LV_MEM_SIZE"] = 128 * 1024
+  del defines["LV_MEM_CUSTOM_ALLOC"]
+  del defines["LV_MEM_CUSTOM_FREE"]
+  defines["LV_BENCH_FRAME_CNT"] = frame_cnt
+
+  bench.build(defines, '"-O2 -g"')
+
+  shutil.rmtree(out_dir, ignore_errors=True)
+  os.mkdir(out_dir)
+
+  # One dump is created after every `lv_bench_run_frames`, i.e. after every scene
+  bench.run("valgrind --tool=callgrind --collect-atstart=no --toggle-collect=lv_bench_run_frames "
+            "--dump-after=lv_bench_run_frames --callgrind-out-file=" + out_dir + "/cg.out "
+            "./bench.bin " + out_dir + "/bench.json")
+
+  scenes = [s["name"] for s in json.load(open(out_dir + "/bench.json"))["scenes"]]
+
+  dumps = glob.glob(out_dir + "/cg.out.*")
+  dumps.sort(key=lambda p: int(p.split(".")[-1]))
+  if len(dumps) != len(scenes):
+    print("Expected " + str(len(scenes)) + " callgrind dumps, found " + str(len(dumps)))
+    exit(1)
+
+  res = {}
+  for i in range(len(scenes)):
+    res[scenes[i]] = parse_callgrind(dumps[i])
+
+  os.system("make clean LVGL_DIR_NAME=" + bench.lvgldirname)
+  shutil.rmtree(out_dir, ignore_errors=True)
+
+  return res
+
+def compare(baseline, res):
+  failed = False
+  missing = False
+  default_tol = baseline.get("tolerance", 1.0)
+
+  print("%-16s %-12s %14s %14s %9s" % ("scene", "cost", "baseline", "current", "diff"))
+  for scene in res:
+    ref = baseline["scenes"].get(scene, {})
+    tol = ref.get("tolerance", default_tol)
+    ref_cost = ref.get("cost", {})
+
+    for name in res[scene]:
+      cur = res[scene][name]
+      if name not in ref_cost:
+        print("%-16s %-12s %14s %14d %9s" % (scene, name, "-", cur, "missing"))
+        missing = True
+        continue
+
+      diff = (cur - ref_cost[name]) * 100.0 / ref_cost[name] if ref_cost[name] else 0.0
+      mark = ""
+      if diff > tol:
+        mark = "  REGRESSION (tolerance " + str(tol) + "%)"
+        failed = True
+      elif diff < -tol:
+        mark = "  improved, consider --update"
+
+      print("%-16s %-12s %14d %14d %+8.2f%%%s" % (scene, name, ref_cost[name], cur, diff, mark))
+
+  # A scene which is not measured anymore can't be compared either
+  for scene in baseline["scenes"]:
+    if scene not in res:
+      print("%-16s %-12s %14s %14s %9s" % (scene, "-", "-", "-", "not run"))
+      missing = True
+
+  if missing:
+    print("Every scene and cost needs a baseline, run ./bench_gate.py --update with the reference revision")
+
+  return not failed and not missing
+
+baseline = json.load(open(baseline_path))
+res = measure()
+
+if "--update" in sys.argv:
+  for scene in res:
+    baseline["scenes"].setdefault(scene, {})["cost"] = res[scene]
+  with open(baseline_path, "w") as f:
+    json.dump(baseline, f, indent=2)
+    f.write("\n")
+  print("Baseline updated: " + baseline_path)
+  exit(0)
+
+if not compare(baseline, res):
+  print("Performance regression!")
+  exit(1)
+
+print("No performance regression")
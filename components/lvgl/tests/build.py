@@ -207,6 +207,17 @@ all_obj_minimal_features = {
 all_obj_all_features = {
   "LV_DPI":100,
   "LV_MEM_SIZE":32*1024,
+  "LV_MEM_SLAB_MAX_SIZE":128,
+  "LV_MEM_TELEMETRY":1,
+  "LV_USE_DRAW_BACKEND":1,
+  "LV_USE_LAYOUT_DEFER":1,
+  "LV_USE_STYLE_INDEX":1,
+  "LV_USE_HIT_INDEX":1,
+  "LV_USE_OBJ_COMPACT":1,
+  "LV_USE_FAST_SCROLL":1,
+  "LV_USE_SCR_SNAPSHOT":1,
+  "LV_USE_GROUP_INDEX":1,
+  "LV_USE_SUBTREE_BOUNDS":1,
   "LV_HOR_RES_MAX":480,
   "LV_VER_RES_MAX":320,
   "LV_COLOR_DEPTH":32,
@@ -286,6 +297,7 @@ advanced_features = {
   "LV_DPI":100,
   "LV_MEM_SIZE":4*1024*1024,
   "LV_MEM_CUSTOM":1,
+  "LV_MEM_TELEMETRY":1,
   "LV_HOR_RES_MAX":800,
   "LV_VER_RES_MAX":480,
   "LV_COLOR_DEPTH":32,
@@ -300,6 +312,19 @@ advanced_features = {
   "LV_USE_API_EXTENSION_V6":1,
   "LV_USE_USER_DATA":1,
   "LV_IMG_CACHE_DEF_SIZE":32,
+  "LV_IMG_TRANSFORM_CACHE_SIZE":64*1024,
+  "LV_IMG_TRANSFORM_CACHE_ANGLE_STEP":10,
+  "LV_FS_CACHE_SIZE":128,
+  "LV_USE_PROFILER":1,
+  "LV_USE_DRAW_BACKEND":1,
+  "LV_USE_LAYOUT_DEFER":1,
+  "LV_USE_STYLE_INDEX":1,
+  "LV_USE_HIT_INDEX":1,
+  "LV_USE_OBJ_COMPACT":1,
+  "LV_USE_FAST_SCROLL":1,
+  "LV_USE_SCR_SNAPSHOT":1,
+  "LV_USE_GROUP_INDEX":1,
+  "LV_USE_SUBTREE_BOUNDS":1,
   "LV_USE_LOG":1,
   "LV_USE_THEME_MATERIAL":1,
   "LV_USE_THEME_EMPTY":1,
@@ -0,0 +1,189 @@
+/**
+ * @file lv_bench.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_bench.h"
+
+#if LV_BUILD_BENCH
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t time_us(void);
+static void load_empty_scr(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint64_t px_cnt;
+static uint32_t alloc_cnt;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_bench_run(const lv_bench_scene_t * scenes, uint32_t scene_cnt, lv_bench_result_t * res)
+{
+    uint32_t s;
+    for(s = 0; s < scene_cnt; s++) {
+        lv_bench_result_t * r = &res[s];
+        memset(r, 0, sizeof(lv_bench_result_t));
+        r->name = scenes[s].name;
+        r->frame_cnt = LV_BENCH_FRAME_CNT;
+
+        load_empty_scr();
+
+        alloc_cnt = 0;
+        uint32_t t = time_us();
+        scenes[s].create_cb(lv_scr_act());
+        r->create_time_us = time_us() - t;
+        r->create_alloc_cnt = alloc_cnt;
+
+        /*Warm up: the first frame also creates the caches*/
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(NULL);
+
+        lv_bench_run_frames(&scenes[s], r);
+    }
+
+    load_empty_scr();
+}
+
+__attribute__((noinline)) void lv_bench_run_frames(const lv_bench_scene_t * scene, lv_bench_result_t * res)
+{
+    px_cnt = 0;
+    alloc_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; i < LV_BENCH_FRAME_CNT; i++) {
+        if(scene->frame_cb) scene->frame_cb(i);
+        else lv_obj_invalidate(lv_scr_act());
+
+        /*Measure only the rendering, not the changes of the scene*/
+        uint32_t t = time_us();
+        lv_refr_now(NULL);
+        t = time_us() - t;
+
+        res->time_sum_us += t;
+        if(t > res->time_max_us) res->time_max_us = t;
+    }
+
+    res->px_cnt = px_cnt;
+    res->frame_alloc_cnt = alloc_cnt;
+}
+
+void lv_bench_print(const lv_bench_result_t * res, uint32_t cnt)
+{
+    printf("%-16s %10s %10s %12s %10s %10s %10s\n", "scene", "us/frame", "max us", "Mpx/s", "create us", "allocs",
+           "allocs/fr");
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        const lv_bench_result_t * r = &res[i];
+        double us = (double)r->time_sum_us / r->frame_cnt;
+        double mpx = r->time_sum_us ? (double)r->px_cnt / r->time_sum_us : 0.0;
+        printf("%-16s %10.1f %10u %12.2f %10u %10u %10.2f\n", r->name, us, (unsigned int)r->time_max_us, mpx,
+               (unsigned int)r->create_time_us, (unsigned int)r->create_alloc_cnt,
+               (double)r->frame_alloc_cnt / r->frame_cnt);
+    }
+}
+
+bool lv_bench_write_json(const char * path, const lv_bench_result_t * res, uint32_t cnt)
+{
+    FILE * f = fopen(path, "w");
+    if(f == NULL) return false;
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"hor_res\": %d,\n", LV_HOR_RES_MAX);
+    fprintf(f, "  \"ver_res\": %d,\n", LV_VER_RES_MAX);
+    fprintf(f, "  \"color_depth\": %d,\n", LV_COLOR_DEPTH);
+    fprintf(f, "  \"scenes\": [\n");
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        const lv_bench_result_t * r = &res[i];
+        double us = (double)r->time_sum_us / r->frame_cnt;
+        double px_per_sec = r->time_sum_us ? (double)r->px_cnt * 1000000.0 / r->time_sum_us : 0.0;
+
+        fprintf(f, "    {\n");
+        fprintf(f, "      \"name\": \"%s\",\n", r->name);
+        fprintf(f, "      \"frames\": %u,\n", (unsigned int)r->frame_cnt);
+        fprintf(f, "      \"us_per_frame\": %.1f,\n", us);
+        fprintf(f, "      \"us_max\": %u,\n", (unsigned int)r->time_max_us);
+        fprintf(f, "      \"px_per_frame\": %llu,\n", (unsigned long long)(r->px_cnt / r->frame_cnt));
+        fprintf(f, "      \"px_per_sec\": %.0f,\n", px_per_sec);
+        fprintf(f, "      \"create_us\": %u,\n", (unsigned int)r->create_time_us);
+        fprintf(f, "      \"create_allocs\": %u,\n", (unsigned int)r->create_alloc_cnt);
+        fprintf(f, "      \"frame_allocs\": %u\n", (unsigned int)r->frame_alloc_cnt);
+        fprintf(f, "    }%s\n", i + 1 < cnt ? "," : "");
+    }
+
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+
+    fclose(f);
+    return true;
+}
+
+void lv_bench_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    LV_UNUSED(color_p);
+
+    px_cnt += lv_area_get_size(area);
+    lv_disp_flush_ready(disp_drv);
+}
+
+void * lv_bench_malloc(size_t size)
+{
+    alloc_cnt++;
+    return malloc(size);
+}
+
+void lv_bench_free(void * p)
+{
+    free(p);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/**
+ * Load a new, empty screen and delete the previous one with its children
+ */
+static void load_empty_scr(void)
+{
+    lv_obj_t * old = lv_scr_act();
+    lv_obj_t * scr = lv_obj_create(NULL, NULL);
+    lv_scr_load(scr);
+    if(old) lv_obj_del(old);
+}
+
+#endif /*LV_BUILD_BENCH*/
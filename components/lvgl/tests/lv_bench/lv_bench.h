@@ -0,0 +1,122 @@
+/**
+ * @file lv_bench.h
+ *
+ */
+
+#ifndef LV_BENCH_H
+#define LV_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdbool.h>
+#include <stdint.h>
+#include "../../lvgl.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Number of measured frames per scene*/
+#ifndef LV_BENCH_FRAME_CNT
+#define LV_BENCH_FRAME_CNT  100
+#endif
+
+/*Number of lines in the display buffer*/
+#ifndef LV_BENCH_BUF_LINES
+#define LV_BENCH_BUF_LINES  LV_VER_RES_MAX
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A scene to measure
+ */
+typedef struct {
+    const char * name;
+
+    /*Create the scene on `scr` (already loaded and empty)*/
+    void (*create_cb)(lv_obj_t * scr);
+
+    /*Change something before the `i`th frame.
+     *NULL: invalidate the whole screen to measure a full redraw*/
+    void (*frame_cb)(uint32_t i);
+} lv_bench_scene_t;
+
+/**
+ * The measured values of a scene
+ */
+typedef struct {
+    const char * name;
+    uint32_t frame_cnt;
+    uint64_t time_sum_us;       /*Sum of the frame times*/
+    uint32_t time_max_us;       /*Time of the slowest frame*/
+    uint64_t px_cnt;            /*Number of flushed pixels*/
+    uint32_t create_time_us;    /*Time of creating the scene*/
+    uint32_t create_alloc_cnt;  /*Allocations while the scene was created*/
+    uint32_t frame_alloc_cnt;   /*Allocations during the measured frames*/
+} lv_bench_result_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Measure the scenes one after the other
+ * @param scenes array of scenes
+ * @param scene_cnt number of scenes
+ * @param res array with `scene_cnt` elements to store the results
+ */
+void lv_bench_run(const lv_bench_scene_t * scenes, uint32_t scene_cnt, lv_bench_result_t * res);
+
+/**
+ * Render the measured frames of a scene which is already created.
+ * It's a separate function so that profilers can be limited to it
+ * (e.g. `valgrind --tool=callgrind --toggle-collect=lv_bench_run_frames`).
+ * @param scene pointer to the scene
+ * @param res store the time, pixel and allocation counts here
+ */
+void lv_bench_run_frames(const lv_bench_scene_t * scene, lv_bench_result_t * res);
+
+/**
+ * Print the results as a table
+ * @param res array of results
+ * @param cnt number of results
+ */
+void lv_bench_print(const lv_bench_result_t * res, uint32_t cnt);
+
+/**
+ * Write the results to a JSON file for regression tracking
+ * @param path path of the file
+ * @param res array of results
+ * @param cnt number of results
+ * @return true: the file was written; false: error
+ */
+bool lv_bench_write_json(const char * path, const lv_bench_result_t * res, uint32_t cnt);
+
+/**
+ * Flush callback of the headless display. Only counts the pixels.
+ */
+void lv_bench_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
+
+/**
+ * Allocation wrappers used as `LV_MEM_CUSTOM_ALLOC/FREE` to count the allocations
+ */
+void * lv_bench_malloc(size_t size);
+void lv_bench_free(void * p);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_BENCH_H*/
@@ -0,0 +1,383 @@
+/**
+ * @file lv_bench_scenes.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_bench_scenes.h"
+
+#if LV_BUILD_BENCH
+
+/*********************
+ *      DEFINES
+ *********************/
+#define IMG_W       64
+#define IMG_H       64
+#define CHART_POINT_CNT 100
+#define SCROLL_STEP 8
+#define REFLOW_ITEM_CNT 20
+#define ALIGN_OBJ_CNT   200
+#define ALIGN_OBJ_SIZE  16
+#define ALIGN_ROW_CNT   20
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void basic_layout_create(lv_obj_t * scr);
+static void rects_create(lv_obj_t * scr);
+static void labels_create(lv_obj_t * scr);
+static void imgs_create(lv_obj_t * scr);
+static void img_transform_create(lv_obj_t * scr);
+static void img_transform_frame(uint32_t i);
+static void chart_create(lv_obj_t * scr);
+static void chart_frame(uint32_t i);
+static void scroll_create(lv_obj_t * scr);
+static void scroll_frame(uint32_t i);
+static void reflow_create(lv_obj_t * scr);
+static void reflow_frame(uint32_t i);
+static void align_create(lv_obj_t * scr);
+static void img_init(void);
+static lv_coord_t next_value(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const lv_bench_scene_t scenes[] = {
+    {"basic_layout",    basic_layout_create,    NULL},
+    {"rects",           rects_create,           NULL},
+    {"labels",          labels_create,          NULL},
+    {"imgs",            imgs_create,            NULL},
+    {"img_transform",   img_transform_create,   img_transform_frame},
+    {"chart",           chart_create,           chart_frame},
+    {"scroll",          scroll_create,          scroll_frame},
+    {"reflow",          reflow_create,          reflow_frame},
+    {"align",           align_create,           NULL},
+};
+
+static const char * lorem = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, "
+                            "sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. "
+                            "Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris.";
+
+static lv_color_t img_map[IMG_W * IMG_H];
+static lv_img_dsc_t img_dsc;
+
+static lv_obj_t * transform_imgs[4];
+static lv_obj_t * chart;
+static lv_chart_series_t * chart_ser[2];
+static lv_obj_t * scroll_page;
+static lv_obj_t * reflow_cont;
+static uint32_t rnd_seed;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const lv_bench_scene_t * lv_bench_get_scenes(uint32_t * cnt)
+{
+    *cnt = sizeof(scenes) / sizeof(scenes[0]);
+    return scenes;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * The screen of the application (`basic_layout()` in main/main.c) without the event callbacks
+ */
+static void basic_layout_create(lv_obj_t * scr)
+{
+    static lv_style_t style_screen;
+    lv_style_init(&style_screen);
+    lv_style_set_bg_color(&style_screen, LV_STATE_DEFAULT, LV_COLOR_NAVY);
+    lv_obj_add_style(scr, LV_OBJ_PART_MAIN, &style_screen);
+
+    lv_obj_t * cont = lv_cont_create(scr, NULL);
+    lv_obj_set_pos(cont, 0, 0);
+    lv_obj_set_size(cont, 480, 39);
+
+    lv_obj_t * label = lv_label_create(cont, NULL);
+    lv_obj_set_pos(label, 0, 20);
+    lv_label_set_text(label, LV_SYMBOL_WIFI);
+
+    label = lv_label_create(cont, NULL);
+    lv_obj_set_pos(label, 189, 20);
+    lv_label_set_text(label, "RRR TECHNOLOGIES");
+
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_text_color(&style, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+    lv_style_set_text_letter_space(&style, LV_STATE_DEFAULT, 5);
+
+    static const char * texts[] = {"HUMIDITY", "TIME", "TEMPERATURE"};
+    static const lv_point_t label_pos[] = {{277, 128}, {28, 64}, {280, 193}};
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        label = lv_label_create(scr, NULL);
+        lv_label_set_text(label, texts[i]);
+        lv_obj_set_pos(label, label_pos[i].x, label_pos[i].y);
+        lv_obj_add_style(label, LV_LABEL_PART_MAIN, &style);
+    }
+
+    for(i = 0; i < 6; i++) {
+        lv_obj_t * sw = lv_switch_create(scr, NULL);
+        lv_obj_set_pos(sw, 14 + (i % 3) * 77, i < 3 ? 126 : 190);
+        lv_obj_set_size(sw, 60, 35);
+        lv_obj_set_style_local_bg_color(sw, LV_SWITCH_PART_BG, LV_STATE_DEFAULT, LV_COLOR_RED);
+        lv_obj_set_style_local_bg_color(sw, LV_SWITCH_PART_INDIC, LV_STATE_CHECKED, LV_COLOR_GREEN);
+        if(i % 2) lv_switch_on(sw, LV_ANIM_OFF);
+    }
+
+    lv_obj_t * slider = lv_slider_create(scr, NULL);
+    lv_obj_set_pos(slider, 263, 264);
+    lv_obj_set_size(slider, 190, 14);
+    lv_slider_set_range(slider, 0, 100);
+    lv_slider_set_value(slider, 40, LV_ANIM_OFF);
+}
+
+/**
+ * Rectangles with radius, border, gradient and shadow
+ */
+static void rects_create(lv_obj_t * scr)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_radius(&style, LV_STATE_DEFAULT, 12);
+    lv_style_set_bg_opa(&style, LV_STATE_DEFAULT, LV_OPA_COVER);
+    lv_style_set_bg_color(&style, LV_STATE_DEFAULT, LV_COLOR_BLUE);
+    lv_style_set_bg_grad_color(&style, LV_STATE_DEFAULT, LV_COLOR_CYAN);
+    lv_style_set_bg_grad_dir(&style, LV_STATE_DEFAULT, LV_GRAD_DIR_VER);
+    lv_style_set_border_width(&style, LV_STATE_DEFAULT, 2);
+    lv_style_set_border_color(&style, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+    lv_style_set_shadow_width(&style, LV_STATE_DEFAULT, 16);
+    lv_style_set_shadow_ofs_y(&style, LV_STATE_DEFAULT, 4);
+    lv_style_set_shadow_color(&style, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+
+    lv_coord_t w = LV_HOR_RES_MAX / 4;
+    lv_coord_t h = LV_VER_RES_MAX / 3;
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        lv_obj_t * obj = lv_obj_create(scr, NULL);
+        lv_obj_add_style(obj, LV_OBJ_PART_MAIN, &style);
+        lv_obj_set_size(obj, w - 24, h - 24);
+        lv_obj_set_pos(obj, (i % 4) * w + 12, (i / 4) * h + 12);
+        /*Every second one has a different radius to bypass the shadow cache*/
+        if(i % 2) lv_obj_set_style_local_radius(obj, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 4 + i);
+    }
+}
+
+/**
+ * A page full of wrapped and recolored text
+ */
+static void labels_create(lv_obj_t * scr)
+{
+    lv_coord_t w = LV_HOR_RES_MAX / 2;
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        lv_obj_t * label = lv_label_create(scr, NULL);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_BREAK);
+        lv_obj_set_width(label, w - 10);
+        lv_obj_set_pos(label, (i % 2) * w + 5, (i / 2) * (LV_VER_RES_MAX / 3) + 5);
+        if(i == 2) {
+            lv_label_set_recolor(label, true);
+            lv_label_set_text(label, "#ff0000 Recolored# text with #00ff00 several# colors in #0000ff one# label "
+                              "and a long tail to wrap it to more lines.");
+        }
+        else {
+            lv_label_set_text(label, lorem);
+        }
+    }
+}
+
+/**
+ * Plain image blits
+ */
+static void imgs_create(lv_obj_t * scr)
+{
+    img_init();
+
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y + IMG_H <= LV_VER_RES_MAX; y += IMG_H + 8) {
+        for(x = 0; x + IMG_W <= LV_HOR_RES_MAX; x += IMG_W + 8) {
+            lv_obj_t * img = lv_img_create(scr, NULL);
+            lv_img_set_src(img, &img_dsc);
+            lv_obj_set_pos(img, x, y);
+        }
+    }
+}
+
+/**
+ * Rotated and zoomed images. The angle changes in every frame.
+ */
+static void img_transform_create(lv_obj_t * scr)
+{
+    img_init();
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * img = lv_img_create(scr, NULL);
+        lv_img_set_src(img, &img_dsc);
+        lv_obj_set_pos(img, (i % 2) * (LV_HOR_RES_MAX / 2) + LV_HOR_RES_MAX / 4 - IMG_W / 2,
+                       (i / 2) * (LV_VER_RES_MAX / 2) + LV_VER_RES_MAX / 4 - IMG_H / 2);
+        lv_img_set_zoom(img, i < 2 ? LV_IMG_ZOOM_NONE : LV_IMG_ZOOM_NONE * 3 / 2);
+        lv_img_set_antialias(img, i % 2 ? true : false);
+        transform_imgs[i] = img;
+    }
+}
+
+static void img_transform_frame(uint32_t i)
+{
+    uint32_t k;
+    for(k = 0; k < 4; k++) {
+        lv_img_set_angle(transform_imgs[k], (int16_t)((i * 35 + k * 450) % 3600));
+    }
+}
+
+/**
+ * A line chart with two series. A new point is added to both in every frame.
+ */
+static void chart_create(lv_obj_t * scr)
+{
+    chart = lv_chart_create(scr, NULL);
+    lv_obj_set_size(chart, LV_HOR_RES_MAX - 20, LV_VER_RES_MAX - 20);
+    lv_obj_align(chart, NULL, LV_ALIGN_CENTER, 0, 0);
+    lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+    lv_chart_set_point_count(chart, CHART_POINT_CNT);
+    lv_chart_set_div_line_count(chart, 3, 5);
+
+    chart_ser[0] = lv_chart_add_series(chart, LV_COLOR_RED);
+    chart_ser[1] = lv_chart_add_series(chart, LV_COLOR_BLUE);
+
+    rnd_seed = 1;
+    uint32_t i;
+    for(i = 0; i < CHART_POINT_CNT; i++) {
+        lv_chart_set_next(chart, chart_ser[0], next_value());
+        lv_chart_set_next(chart, chart_ser[1], next_value());
+    }
+}
+
+static void chart_frame(uint32_t i)
+{
+    LV_UNUSED(i);
+
+    lv_chart_set_next(chart, chart_ser[0], next_value());
+    lv_chart_set_next(chart, chart_ser[1], next_value());
+}
+
+/**
+ * A full screen page with a long list of buttons, scrolled in every frame
+ */
+static void scroll_create(lv_obj_t * scr)
+{
+    scroll_page = lv_page_create(scr, NULL);
+    lv_obj_set_size(scroll_page, LV_HOR_RES_MAX, LV_VER_RES_MAX);
+    lv_page_set_scrl_layout(scroll_page, LV_LAYOUT_COLUMN_MID);
+
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_obj_t * btn = lv_btn_create(scroll_page, NULL);
+        lv_obj_set_width(btn, LV_HOR_RES_MAX - 60);
+        lv_obj_t * label = lv_label_create(btn, NULL);
+        lv_label_set_text_fmt(label, "Button %d", (int)i);
+    }
+}
+
+static void scroll_frame(uint32_t i)
+{
+    lv_obj_t * scrl = lv_page_get_scrollable(scroll_page);
+    lv_coord_t max = lv_obj_get_height(scrl) - lv_obj_get_height(scroll_page);
+    if(max <= 0) max = 1;
+
+    /*Go down and up*/
+    lv_coord_t y = (lv_coord_t)((i * SCROLL_STEP) % (2 * max));
+    if(y > max) y = 2 * max - y;
+    lv_obj_set_y(scrl, -y);
+}
+
+/**
+ * A column of buttons in a tightly fit container, rebuilt in every frame
+ */
+static void reflow_create(lv_obj_t * scr)
+{
+    reflow_cont = lv_cont_create(scr, NULL);
+    lv_cont_set_layout(reflow_cont, LV_LAYOUT_COLUMN_MID);
+    lv_cont_set_fit(reflow_cont, LV_FIT_TIGHT);
+    reflow_frame(0);
+}
+
+static void reflow_frame(uint32_t i)
+{
+    lv_obj_clean(reflow_cont);
+
+    uint32_t j;
+    for(j = 0; j < REFLOW_ITEM_CNT; j++) {
+        lv_obj_t * btn = lv_btn_create(reflow_cont, NULL);
+        lv_btn_set_fit(btn, LV_FIT_TIGHT);
+        lv_obj_t * label = lv_label_create(btn, NULL);
+        lv_label_set_text_fmt(label, "Item %d", (int)(i + j));
+    }
+}
+
+/**
+ * A grid of small objects, each aligned to the previous one with auto realign
+ */
+static void align_create(lv_obj_t * scr)
+{
+    lv_obj_t * row_start = NULL;
+    lv_obj_t * prev = NULL;
+    uint32_t i;
+    for(i = 0; i < ALIGN_OBJ_CNT; i++) {
+        lv_obj_t * obj = lv_obj_create(scr, NULL);
+        lv_obj_set_size(obj, ALIGN_OBJ_SIZE, ALIGN_OBJ_SIZE);
+        lv_obj_set_auto_realign(obj, true);
+        if(i == 0) lv_obj_align(obj, NULL, LV_ALIGN_IN_TOP_LEFT, 4, 4);
+        else if(i % ALIGN_ROW_CNT == 0) lv_obj_align(obj, row_start, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 4);
+        else lv_obj_align(obj, prev, LV_ALIGN_OUT_RIGHT_MID, 4, 0);
+
+        if(i % ALIGN_ROW_CNT == 0) row_start = obj;
+        prev = obj;
+    }
+}
+
+/**
+ * Fill the test image with a gradient pattern
+ */
+static void img_init(void)
+{
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            img_map[y * IMG_W + x] = LV_COLOR_MAKE(x * 4, y * 4, (x ^ y) * 4);
+        }
+    }
+
+    img_dsc.header.always_zero = 0;
+    img_dsc.header.w = IMG_W;
+    img_dsc.header.h = IMG_H;
+    img_dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    img_dsc.data_size = sizeof(img_map);
+    img_dsc.data = (const uint8_t *)img_map;
+}
+
+/**
+ * Simple deterministic pseudo random values for the chart
+ */
+static lv_coord_t next_value(void)
+{
+    rnd_seed = rnd_seed * 1103515245 + 12345;
+    return (lv_coord_t)((rnd_seed >> 16) % 100);
+}
+
+#endif /*LV_BUILD_BENCH*/
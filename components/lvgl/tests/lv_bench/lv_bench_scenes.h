@@ -0,0 +1,45 @@
+/**
+ * @file lv_bench_scenes.h
+ *
+ */
+
+#ifndef LV_BENCH_SCENES_H
+#define LV_BENCH_SCENES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_bench.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the built-in scenes
+ * @param cnt store the number of scenes here
+ * @return array of scenes
+ */
+const lv_bench_scene_t * lv_bench_get_scenes(uint32_t * cnt);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_BENCH_SCENES_H*/
@@ -0,0 +1,72 @@
+#include "../lvgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "lv_bench/lv_bench.h"
+#include "lv_bench/lv_bench_scenes.h"
+
+#if LV_BUILD_BENCH
+
+static void hal_init(void);
+#if LV_USE_PROFILER
+static void prof_print_cb(const char * line);
+#endif
+
+int main(int argc, char ** argv)
+{
+    lv_init();
+
+    hal_init();
+
+    uint32_t scene_cnt;
+    const lv_bench_scene_t * scenes = lv_bench_get_scenes(&scene_cnt);
+
+    lv_bench_result_t * res = malloc(scene_cnt * sizeof(lv_bench_result_t));
+    if(res == NULL) return 1;
+
+    lv_bench_run(scenes, scene_cnt, res);
+    lv_bench_print(res, scene_cnt);
+
+#if LV_USE_PROFILER
+    /*Frames of the last scene and the draw time of the widget types in all scenes*/
+    lv_prof_dump(prof_print_cb);
+#endif
+
+    /*Optionally save the results for regression tracking*/
+    if(argc > 1) {
+        if(!lv_bench_write_json(argv[1], res, scene_cnt)) {
+            fprintf(stderr, "Couldn't write %s\n", argv[1]);
+            free(res);
+            return 1;
+        }
+        printf("Results saved to %s\n", argv[1]);
+    }
+
+    free(res);
+    return 0;
+}
+
+/**
+ * Headless display. The buffer has `LV_BENCH_BUF_LINES` lines to match the target's buffer.
+ */
+static void hal_init(void)
+{
+    static lv_disp_buf_t disp_buf;
+    lv_color_t * disp_buf1 = (lv_color_t *)malloc(LV_HOR_RES_MAX * LV_BENCH_BUF_LINES * sizeof(lv_color_t));
+
+    lv_disp_buf_init(&disp_buf, disp_buf1, NULL, LV_HOR_RES_MAX * LV_BENCH_BUF_LINES);
+
+    lv_disp_drv_t disp_drv;
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.buffer = &disp_buf;
+    disp_drv.flush_cb = lv_bench_flush_cb;
+    lv_disp_drv_register(&disp_drv);
+}
+
+#if LV_USE_PROFILER
+static void prof_print_cb(const char * line)
+{
+    puts(line);
+}
+#endif
+
+#endif
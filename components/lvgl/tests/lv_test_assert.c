@@ -232,6 +232,18 @@ void lv_test_assert_img_eq(const char * fn_ref, const char * s)
     }
 }
 
+lv_color_t lv_test_get_px(lv_coord_t x, lv_coord_t y)
+{
+    extern lv_color_t test_fb[];
+
+    /*Redraw the whole screen to get it in one flush at the start of the frame buffer*/
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    lv_refr_now(disp);
+
+    return test_fb[y * lv_disp_get_hor_res(disp) + x];
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
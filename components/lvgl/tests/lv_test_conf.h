@@ -39,6 +39,13 @@ typedef void * lv_img_decoder_user_data_t;
  * GLOBAL PROTOTYPES
  **********************/
 
+#ifdef LV_BUILD_BENCH
+#include <stddef.h>
+/*Used as `LV_MEM_CUSTOM_ALLOC/FREE` to count the allocations*/
+void * lv_bench_malloc(size_t size);
+void lv_bench_free(void * p);
+#endif
+
 /**********************
  *      MACROS
  **********************/
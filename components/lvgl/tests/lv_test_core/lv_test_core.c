@@ -13,6 +13,19 @@
 #include "lv_test_obj.h"
 #include "lv_test_style.h"
 #include "lv_test_font_loader.h"
+#include "lv_test_mem.h"
+#include "lv_test_draw_backend.h"
+#include "lv_test_mono_page.h"
+#include "lv_test_layout.h"
+#include "lv_test_hit_index.h"
+#include "lv_test_fast_scroll.h"
+#include "lv_test_rotate.h"
+#include "lv_test_snapshot.h"
+#include "lv_test_group_index.h"
+#include "lv_test_subtree_bounds.h"
+#include "lv_test_fs_cache.h"
+#include "lv_test_transform_cache.h"
+#include "lv_test_img_blit.h"
 
 /*********************
  *      DEFINES
@@ -48,6 +61,19 @@ void lv_test_core(void)
     lv_test_obj();
     lv_test_style();
     lv_test_font_loader();
+    lv_test_mem();
+    lv_test_draw_backend();
+    lv_test_mono_page();
+    lv_test_layout();
+    lv_test_hit_index();
+    lv_test_fast_scroll();
+    lv_test_rotate();
+    lv_test_snapshot();
+    lv_test_group_index();
+    lv_test_subtree_bounds();
+    lv_test_fs_cache();
+    lv_test_transform_cache();
+    lv_test_img_blit();
 }
 
 /**********************
@@ -0,0 +1,240 @@
+/**
+ * @file lv_test_draw_backend.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_draw_backend.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_DRAW_BACKEND
+static void native_frame(void);
+static void fallback_to_software(void);
+static void fallback_on_mask(void);
+static void keep_failure(void);
+static void refr_screen(void);
+static bool frame_start_cb(lv_disp_drv_t * disp_drv);
+static bool frame_finish_cb(lv_disp_drv_t * disp_drv);
+static void frame_abort_cb(lv_disp_drv_t * disp_drv);
+static bool rect_cb(lv_disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                    const lv_draw_rect_dsc_t * dsc);
+static bool letter_cb(lv_disp_drv_t * disp_drv, const lv_point_t * pos, const lv_area_t * clip,
+                      const lv_font_t * font, uint32_t letter, lv_color_t color, lv_opa_t opa);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_DRAW_BACKEND
+static const lv_draw_backend_t backend = {
+    .frame_start_cb = frame_start_cb,
+    .frame_finish_cb = frame_finish_cb,
+    .frame_abort_cb = frame_abort_cb,
+    .rect_cb = rect_cb,
+    .letter_cb = letter_cb,
+};
+
+static uint32_t finish_cnt;
+static uint32_t abort_cnt;
+static uint32_t rect_cnt;
+static uint32_t letter_cnt;
+static bool rect_fail;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_draw_backend(void)
+{
+#if LV_USE_DRAW_BACKEND
+    lv_test_print("");
+    lv_test_print("===========================");
+    lv_test_print("Start lv_draw_backend tests");
+    lv_test_print("===========================");
+
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver.draw_backend = &backend;
+
+    native_frame();
+    fallback_to_software();
+    fallback_on_mask();
+    keep_failure();
+
+    disp->driver.draw_backend = NULL;
+    refr_screen();
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_DRAW_BACKEND
+
+static void native_frame(void)
+{
+    lv_test_print("");
+    lv_test_print("Draw a frame natively:");
+    lv_test_print("----------------------");
+
+    lv_obj_clean(lv_scr_act());
+    lv_obj_t * label = lv_label_create(lv_scr_act(), NULL);
+    lv_label_set_text(label, "Native");
+
+    refr_screen();
+
+    lv_test_assert_int_eq(1, finish_cnt, "Finished frames");
+    lv_test_assert_int_eq(0, abort_cnt, "Aborted frames");
+    lv_test_assert_int_gt(0, rect_cnt, "Rectangles passed to the backend");
+    lv_test_assert_int_eq(6, letter_cnt, "Letters passed to the backend");
+    lv_test_assert_int_eq(1, lv_disp_get_default()->draw_native, "Last frame is native");
+}
+
+static void fallback_to_software(void)
+{
+    lv_test_print("");
+    lv_test_print("Render by software if the backend fails:");
+    lv_test_print("----------------------------------------");
+
+    rect_fail = true;
+    refr_screen();
+    rect_fail = false;
+
+    lv_test_assert_int_eq(0, finish_cnt, "Finished frames");
+    lv_test_assert_int_eq(1, abort_cnt, "Aborted frames");
+    lv_test_assert_int_eq(0, letter_cnt, "No letters after the failed rectangle");
+    lv_test_assert_int_eq(0, lv_disp_get_default()->draw_native, "Last frame is software rendered");
+
+    refr_screen();
+    lv_test_assert_int_eq(1, finish_cnt, "Native again after a software frame");
+}
+
+static void fallback_on_mask(void)
+{
+    lv_test_print("");
+    lv_test_print("Render by software if a mask is used:");
+    lv_test_print("-------------------------------------");
+
+    lv_obj_clean(lv_scr_act());
+    lv_obj_t * arc = lv_arc_create(lv_scr_act(), NULL);
+    lv_arc_set_angles(arc, 0, 90);
+
+    refr_screen();
+
+    lv_test_assert_int_eq(0, finish_cnt, "Finished frames");
+    lv_test_assert_int_eq(1, abort_cnt, "Aborted frames");
+
+    lv_obj_del(arc);
+}
+
+static void keep_failure(void)
+{
+    lv_test_print("");
+    lv_test_print("Try again only if the failed object changes:");
+    lv_test_print("--------------------------------------------");
+
+    lv_obj_clean(lv_scr_act());
+    lv_obj_t * arc = lv_arc_create(lv_scr_act(), NULL);
+    lv_arc_set_angles(arc, 0, 90);
+    lv_obj_t * label = lv_label_create(lv_scr_act(), NULL);
+    lv_label_set_text(label, "A");
+    lv_obj_align(label, NULL, LV_ALIGN_IN_BOTTOM_RIGHT, 0, 0);
+
+    refr_screen();
+    lv_test_assert_int_eq(1, abort_cnt, "Aborted frames");
+
+    abort_cnt = 0;
+    lv_label_set_text(label, "B");
+    lv_refr_now(NULL);
+    lv_test_assert_int_eq(0, abort_cnt + finish_cnt, "Native frames after changing an other object");
+
+    lv_arc_set_angles(arc, 0, 180);
+    lv_refr_now(NULL);
+    lv_test_assert_int_eq(1, abort_cnt, "Native frames after changing the failed object");
+
+    abort_cnt = 0;
+    lv_obj_del(arc);
+    lv_refr_now(NULL);
+    lv_test_assert_int_eq(0, abort_cnt, "Aborted frames after deleting the failed object");
+    lv_test_assert_int_eq(1, finish_cnt, "Finished frames after deleting the failed object");
+}
+
+static void refr_screen(void)
+{
+    finish_cnt = 0;
+    abort_cnt = 0;
+    rect_cnt = 0;
+    letter_cnt = 0;
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+static bool frame_start_cb(lv_disp_drv_t * disp_drv)
+{
+    LV_UNUSED(disp_drv);
+    return true;
+}
+
+static bool frame_finish_cb(lv_disp_drv_t * disp_drv)
+{
+    LV_UNUSED(disp_drv);
+    finish_cnt++;
+    return true;
+}
+
+static void frame_abort_cb(lv_disp_drv_t * disp_drv)
+{
+    LV_UNUSED(disp_drv);
+    abort_cnt++;
+}
+
+static bool rect_cb(lv_disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                    const lv_draw_rect_dsc_t * dsc)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(coords);
+    LV_UNUSED(clip);
+    LV_UNUSED(dsc);
+    rect_cnt++;
+    return !rect_fail;
+}
+
+static bool letter_cb(lv_disp_drv_t * disp_drv, const lv_point_t * pos, const lv_area_t * clip,
+                      const lv_font_t * font, uint32_t letter, lv_color_t color, lv_opa_t opa)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(pos);
+    LV_UNUSED(clip);
+    LV_UNUSED(font);
+    LV_UNUSED(letter);
+    LV_UNUSED(color);
+    LV_UNUSED(opa);
+    letter_cnt++;
+    return true;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @file lv_test_draw_backend.h
+ *
+ */
+
+#ifndef LV_TEST_DRAW_BACKEND_H
+#define LV_TEST_DRAW_BACKEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void lv_test_draw_backend(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_DRAW_BACKEND_H*/
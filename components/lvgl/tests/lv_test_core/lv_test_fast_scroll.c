@@ -0,0 +1,257 @@
+/**
+ * @file lv_test_fast_scroll.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_fast_scroll.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SCROLL_HOR_RES  48
+#define SCROLL_VER_RES  40
+#define SCROLL_PX_CNT   (SCROLL_HOR_RES * SCROLL_VER_RES)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_FAST_SCROLL
+static lv_disp_t * scroll_disp_create(lv_disp_drv_t * drv, lv_disp_buf_t * disp_buf, bool true_double_buf);
+static void scroll_disp_remove(lv_disp_t * disp);
+static lv_obj_t * create_page(lv_disp_t * disp);
+static void move_and_compare(lv_disp_t * disp, lv_obj_t * page, bool moved);
+static uint32_t get_inv_px(lv_disp_t * disp);
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
+static bool scroll_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_FAST_SCROLL
+static lv_color_t buf1[SCROLL_PX_CNT];
+static lv_color_t buf2[SCROLL_PX_CNT];
+static lv_color_t panel[SCROLL_PX_CNT];      /*What the display shows*/
+static lv_color_t panel_tmp[SCROLL_PX_CNT];
+static lv_color_t moved_frame[SCROLL_PX_CNT];
+static uint32_t scroll_cnt;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_fast_scroll(void)
+{
+#if LV_USE_FAST_SCROLL
+    lv_test_print("");
+    lv_test_print("==========================");
+    lv_test_print("Start lv_fast_scroll tests");
+    lv_test_print("==========================");
+
+    lv_disp_t * def_disp = lv_disp_get_default();
+    static lv_disp_drv_t drv;
+    static lv_disp_buf_t disp_buf;
+    lv_disp_t * disp;
+    lv_obj_t * page;
+
+    lv_test_print("");
+    lv_test_print("Move in the frame buffer:");
+    lv_test_print("-------------------------");
+
+    disp = scroll_disp_create(&drv, &disp_buf, true);
+    page = create_page(disp);
+    move_and_compare(disp, page, true);
+    scroll_disp_remove(disp);
+
+    lv_test_print("");
+    lv_test_print("Move with scroll_cb:");
+    lv_test_print("--------------------");
+
+    disp = scroll_disp_create(&drv, &disp_buf, false);
+    page = create_page(disp);
+    scroll_cnt = 0;
+    move_and_compare(disp, page, true);
+    lv_test_assert_int_eq(1, scroll_cnt, "The movements are done at once by scroll_cb");
+
+    lv_test_print("");
+    lv_test_print("Redraw if something is on the page:");
+    lv_test_print("-----------------------------------");
+
+    lv_obj_t * top = lv_obj_create(lv_disp_get_layer_top(disp), NULL);
+    lv_obj_reset_style_list(top, LV_OBJ_PART_MAIN);
+    lv_obj_set_style_local_bg_color(top, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLUE);
+    lv_obj_set_style_local_bg_opa(top, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+    lv_obj_set_pos(top, 20, 20);
+    lv_obj_set_size(top, 8, 8);
+    lv_refr_now(disp);
+
+    scroll_cnt = 0;
+    move_and_compare(disp, page, false);
+    lv_test_assert_int_eq(0, scroll_cnt, "scroll_cb is not used");
+
+    scroll_disp_remove(disp);
+
+    lv_disp_set_default(def_disp);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_FAST_SCROLL
+static lv_disp_t * scroll_disp_create(lv_disp_drv_t * drv, lv_disp_buf_t * disp_buf, bool true_double_buf)
+{
+    /*Render in 8 lines high bands if the content is moved by `scroll_cb`*/
+    if(true_double_buf) lv_disp_buf_init(disp_buf, buf1, buf2, SCROLL_PX_CNT);
+    else lv_disp_buf_init(disp_buf, buf1, NULL, SCROLL_HOR_RES * 8);
+
+    lv_disp_drv_init(drv);
+    drv->hor_res = SCROLL_HOR_RES;
+    drv->ver_res = SCROLL_VER_RES;
+    drv->buffer = disp_buf;
+    drv->flush_cb = flush_cb;
+    if(true_double_buf == false) drv->scroll_cb = scroll_cb;
+#if LV_COLOR_SCREEN_TRANSP
+    drv->screen_transp = 0;
+#endif
+
+    return lv_disp_drv_register(drv);
+}
+
+static void scroll_disp_remove(lv_disp_t * disp)
+{
+    /*Deleting the objects invalidates the display so delete the refresher task last*/
+    lv_obj_del(disp->act_scr);
+    lv_obj_del(disp->top_layer);
+    lv_obj_del(disp->sys_layer);
+    lv_task_del(disp->refr_task);
+    lv_disp_remove(disp);
+}
+
+static lv_obj_t * create_page(lv_disp_t * disp)
+{
+    lv_obj_t * scr = lv_disp_get_scr_act(disp);
+    lv_obj_set_style_local_bg_color(scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+    lv_obj_set_style_local_bg_opa(scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+
+    /*A page with a border and always visible scrollbars*/
+    lv_obj_t * page = lv_page_create(scr, NULL);
+    lv_obj_reset_style_list(page, LV_PAGE_PART_BG);
+    lv_obj_reset_style_list(page, LV_PAGE_PART_SCROLLABLE);
+    lv_obj_reset_style_list(page, LV_PAGE_PART_SCROLLBAR);
+    lv_obj_set_style_local_bg_color(page, LV_PAGE_PART_BG, LV_STATE_DEFAULT, LV_COLOR_SILVER);
+    lv_obj_set_style_local_bg_opa(page, LV_PAGE_PART_BG, LV_STATE_DEFAULT, LV_OPA_COVER);
+    lv_obj_set_style_local_border_color(page, LV_PAGE_PART_BG, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+    lv_obj_set_style_local_border_width(page, LV_PAGE_PART_BG, LV_STATE_DEFAULT, 2);
+    lv_obj_set_style_local_bg_color(page, LV_PAGE_PART_SCROLLBAR, LV_STATE_DEFAULT, LV_COLOR_RED);
+    lv_obj_set_style_local_bg_opa(page, LV_PAGE_PART_SCROLLBAR, LV_STATE_DEFAULT, LV_OPA_COVER);
+    lv_obj_set_style_local_size(page, LV_PAGE_PART_SCROLLBAR, LV_STATE_DEFAULT, 3);
+    lv_page_set_scrollbar_mode(page, LV_SCROLLBAR_MODE_ON);
+    lv_page_set_scrollable_fit(page, LV_FIT_NONE);
+    lv_obj_set_pos(page, 4, 5);
+    lv_obj_set_size(page, 36, 30);
+
+    lv_obj_t * scrl = lv_page_get_scrollable(page);
+    lv_obj_set_size(scrl, 80, 80);
+
+    /*Rectangles with different colors make a wrong movement visible*/
+    lv_color_t colors[] = {LV_COLOR_GREEN, LV_COLOR_NAVY, LV_COLOR_ORANGE, LV_COLOR_PURPLE};
+    uint32_t i;
+    for(i = 0; i < 16; i++) {
+        lv_obj_t * rect = lv_obj_create(page, NULL);
+        lv_obj_reset_style_list(rect, LV_OBJ_PART_MAIN);
+        lv_obj_set_style_local_bg_color(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, colors[i % 4]);
+        lv_obj_set_style_local_bg_opa(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+        lv_obj_set_style_local_radius(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 3);
+        lv_obj_set_pos(rect, (i % 4) * 20 + (i / 4) * 2, (i / 4) * 20 + 1);
+        lv_obj_set_size(rect, 13, 9 + i % 3);
+    }
+
+    lv_refr_now(disp);
+
+    return page;
+}
+
+/**
+ * Move the scrollable of a page diagonally in two steps and compare the result with a redrawn screen
+ */
+static void move_and_compare(lv_disp_t * disp, lv_obj_t * page, bool moved)
+{
+    lv_obj_t * scrl = lv_page_get_scrollable(page);
+    lv_obj_set_pos(scrl, lv_obj_get_x(scrl) - 3, lv_obj_get_y(scrl) - 5);
+    lv_obj_set_y(scrl, lv_obj_get_y(scrl) - 2);
+
+    int32_t page_px = lv_obj_get_width(page) * lv_obj_get_height(page);
+    /*The border and the scrollbars are invalidated too but less than the whole page*/
+    if(moved) lv_test_assert_int_lt(page_px, get_inv_px(disp), "Only the exposed bands are invalidated");
+    else lv_test_assert_int_gt(page_px - 1, get_inv_px(disp), "The whole page is invalidated");
+
+    lv_refr_now(disp);
+    _lv_memcpy(moved_frame, panel, sizeof(panel));
+
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    lv_refr_now(disp);
+    lv_test_assert_array_eq((uint8_t *)panel, (uint8_t *)moved_frame, sizeof(panel), "Same as redrawing the screen");
+}
+
+static uint32_t get_inv_px(lv_disp_t * disp)
+{
+    uint32_t px = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) px += lv_area_get_size(&disp->inv_areas[i]);
+
+    return px;
+}
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        _lv_memcpy(&panel[y * SCROLL_HOR_RES + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+
+    lv_disp_flush_ready(disp_drv);
+}
+
+/*Move the content of the "display"*/
+static bool scroll_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy)
+{
+    LV_UNUSED(disp_drv);
+
+    _lv_memcpy(panel_tmp, panel, sizeof(panel));
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        for(x = area->x1; x <= area->x2; x++) {
+            lv_coord_t src_x = x - dx;
+            lv_coord_t src_y = y - dy;
+            if(src_x < area->x1 || src_x > area->x2 || src_y < area->y1 || src_y > area->y2) continue;
+            panel[y * SCROLL_HOR_RES + x] = panel_tmp[src_y * SCROLL_HOR_RES + src_x];
+        }
+    }
+
+    scroll_cnt++;
+    return true;
+}
+#endif
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @file lv_test_fast_scroll.h
+ *
+ */
+
+#ifndef LV_TEST_FAST_SCROLL_H
+#define LV_TEST_FAST_SCROLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void lv_test_fast_scroll(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_FAST_SCROLL_H*/
@@ -33,6 +33,7 @@
 
 #if LV_USE_FILESYSTEM
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2);
+static void compare_paged_bitmaps(lv_font_t * f1, lv_font_t * f2);
 #endif
 
 /**********************
@@ -70,6 +71,19 @@ void lv_test_font_loader(void)
     lv_font_free(font_1_bin);
     lv_font_free(font_2_bin);
     lv_font_free(font_3_bin);
+
+    /*Small cache to test that the glyphs are reloaded correctly*/
+    lv_font_t * font_1_paged = lv_font_load_paged("f:font_1.fnt", 256);
+    lv_font_t * font_2_paged = lv_font_load_paged("f:font_2.fnt", 256);
+    lv_font_t * font_3_paged = lv_font_load_paged("f:font_3.fnt", 256);
+
+    compare_paged_bitmaps(&font_1, font_1_paged);
+    compare_paged_bitmaps(&font_2, font_2_paged);
+    compare_paged_bitmaps(&font_3, font_3_paged);
+
+    lv_font_free(font_1_paged);
+    lv_font_free(font_2_paged);
+    lv_font_free(font_3_paged);
 #else
     lv_test_print("SKIP: font load test because it requires LV_USE_FILESYSTEM 1 and LV_FONT_FMT_TXT_LARGE 0");
 #endif
@@ -213,6 +227,35 @@ static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
     LV_LOG_INFO("No differences found!");
     return 0;
 }
+
+static void compare_paged_bitmaps(lv_font_t * f1, lv_font_t * f2)
+{
+    lv_test_assert_true(f1 != NULL && f2 != NULL, "font not null");
+
+    lv_font_fmt_txt_dsc_t * dsc1 = (lv_font_fmt_txt_dsc_t *) f1->dsc;
+    lv_font_fmt_txt_dsc_t * dsc2 = (lv_font_fmt_txt_dsc_t *) f2->dsc;
+
+    lv_test_assert_true(dsc2->get_glyph_bitmap_cb != NULL, "get_glyph_bitmap_cb");
+
+    uint32_t total_glyphs = 0;
+    for(int i = 0; i < dsc1->cmap_num; ++i) {
+        const lv_font_fmt_txt_cmap_t * cmap = &dsc1->cmaps[i];
+        total_glyphs += cmap->unicode_list ? cmap->list_length : cmap->range_length;
+    }
+
+    /*Go through the glyphs twice to read them from the file and from the cache too*/
+    for(int pass = 0; pass < 2; pass++) {
+        for(uint32_t i = 1; i < total_glyphs; ++i) {
+            int size1 = dsc1->glyph_dsc[i + 1].bitmap_index - dsc1->glyph_dsc[i].bitmap_index;
+            if(size1 <= 0) continue;
+
+            const uint8_t * bmp2 = dsc2->get_glyph_bitmap_cb(f2, i);
+            lv_test_assert_true(bmp2 != NULL, "paged glyph_bitmap");
+            lv_test_assert_array_eq(dsc1->glyph_bitmap + dsc1->glyph_dsc[i].bitmap_index, bmp2, size1,
+                                    "paged glyph_bitmap");
+        }
+    }
+}
 #endif
 
 #pragma GCC diagnostic pop
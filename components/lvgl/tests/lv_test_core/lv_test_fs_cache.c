@@ -0,0 +1,132 @@
+/**
+ * @file lv_test_fs_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_fs_cache.h"
+
+#if LV_BUILD_TEST
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEST_FILE_NAME  "font_1.fnt"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_FILESYSTEM && LV_FS_CACHE_SIZE
+static void read_and_compare(lv_fs_file_t * f, FILE * ref, uint32_t pos, uint32_t btr, const char * s);
+static void check_stat(uint32_t hit, uint32_t miss, uint32_t drv_read_cnt, const char * s);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_fs_cache(void)
+{
+#if LV_USE_FILESYSTEM && LV_FS_CACHE_SIZE
+    lv_test_print("");
+    lv_test_print("=======================");
+    lv_test_print("Start lv_fs_cache tests");
+    lv_test_print("=======================");
+
+    FILE * ref = fopen(TEST_FILE_NAME, "rb");
+    if(ref == NULL) {
+        lv_test_print("SKIP: " TEST_FILE_NAME " is not found");
+        return;
+    }
+
+    lv_fs_file_t f;
+    lv_fs_res_t res = lv_fs_open(&f, "f:" TEST_FILE_NAME, LV_FS_MODE_RD);
+    lv_test_assert_int_eq(LV_FS_RES_OK, res, "Open the test file");
+    lv_test_assert_true(f.cache != NULL, "Files opened for reading are cached");
+
+    lv_test_print("");
+    lv_test_print("Count the hits and misses:");
+    lv_test_print("--------------------------");
+
+    lv_fs_cache_reset_stat();
+    check_stat(0, 0, 0, "No reads after reset");
+
+    read_and_compare(&f, ref, 0, 4, "First small read");
+    check_stat(0, 1, 1, "The first read fills the cache");
+
+    read_and_compare(&f, ref, 4, 8, "Second small read");
+    check_stat(1, 1, 1, "Small read from the filled cache");
+
+    read_and_compare(&f, ref, 12, LV_FS_CACHE_SIZE - 12 + 4, "Read over the end of the cache");
+    check_stat(1, 2, 2, "Reading over the end of the cache refills it");
+
+    lv_fs_seek(&f, LV_FS_CACHE_SIZE + 8);
+    read_and_compare(&f, ref, LV_FS_CACHE_SIZE + 8, 4, "Read after seeking inside the cache");
+    check_stat(2, 2, 2, "Seeking inside the cache doesn't need the driver");
+
+    lv_fs_seek(&f, 0);
+    read_and_compare(&f, ref, 0, 4, "Read after seeking out of the cache");
+    check_stat(2, 3, 3, "Seeking out of the cache needs the driver");
+
+    lv_fs_cache_reset_stat();
+    read_and_compare(&f, ref, 4, LV_FS_CACHE_SIZE * 2, "Large read");
+    lv_fs_cache_stat_t stat;
+    lv_fs_cache_get_stat(&stat);
+    lv_test_assert_int_eq(1, stat.drv_read_cnt, "Large reads go directly to the driver");
+    lv_test_assert_int_eq(LV_FS_CACHE_SIZE * 2 - (LV_FS_CACHE_SIZE - 4), stat.drv_read_size,
+                          "Only the bytes missing from the cache are read");
+
+    lv_fs_close(&f);
+    fclose(ref);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_FILESYSTEM && LV_FS_CACHE_SIZE
+static void read_and_compare(lv_fs_file_t * f, FILE * ref, uint32_t pos, uint32_t btr, const char * s)
+{
+    uint8_t buf[LV_FS_CACHE_SIZE * 2];
+    uint8_t buf_ref[LV_FS_CACHE_SIZE * 2];
+
+    uint32_t br = 0;
+    lv_fs_res_t res = lv_fs_read(f, buf, btr, &br);
+    lv_test_assert_int_eq(LV_FS_RES_OK, res, s);
+    lv_test_assert_int_eq(btr, br, s);
+
+    fseek(ref, (long)pos, SEEK_SET);
+    size_t br_ref = fread(buf_ref, 1, btr, ref);
+    lv_test_assert_int_eq(btr, br_ref, s);
+    lv_test_assert_array_eq(buf_ref, buf, btr, s);
+}
+
+static void check_stat(uint32_t hit, uint32_t miss, uint32_t drv_read_cnt, const char * s)
+{
+    lv_fs_cache_stat_t stat;
+    lv_fs_cache_get_stat(&stat);
+    lv_test_assert_int_eq(hit, stat.hit, s);
+    lv_test_assert_int_eq(miss, stat.miss, s);
+    lv_test_assert_int_eq(drv_read_cnt, stat.drv_read_cnt, s);
+}
+#endif
+
+#endif
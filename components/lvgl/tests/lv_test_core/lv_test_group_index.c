@@ -0,0 +1,311 @@
+/**
+ * @file lv_test_group_index.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_group_index.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define GRID_COL    5
+#define GRID_ROW    4
+#define OBJ_CNT     (GRID_COL * GRID_ROW)
+#define EXTRA_CNT   30
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_GROUP && LV_USE_GROUP_INDEX
+static void focus_next_prev(void);
+static void follow_changes(void);
+static void focus_dir(void);
+static void focus_dir_added(void);
+static void separate_geometry(void);
+static lv_group_t * create_objs(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_GROUP && LV_USE_GROUP_INDEX
+static lv_obj_t * objs[OBJ_CNT];
+static lv_obj_t * extra[EXTRA_CNT];
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_group_index(void)
+{
+#if LV_USE_GROUP && LV_USE_GROUP_INDEX
+    lv_test_print("");
+    lv_test_print("=============================");
+    lv_test_print("Start lv_group index tests");
+    lv_test_print("=============================");
+
+    focus_next_prev();
+    follow_changes();
+    focus_dir();
+    focus_dir_added();
+    separate_geometry();
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_GROUP && LV_USE_GROUP_INDEX
+
+static void focus_next_prev(void)
+{
+    lv_test_print("");
+    lv_test_print("Focus the next and previous objects:");
+    lv_test_print("------------------------------------");
+
+    lv_group_t * g = create_objs();
+    lv_test_assert_ptr_eq(objs[0], lv_group_get_focused(g), "The first object is focused");
+
+    lv_group_add_obj(g, objs[1]);
+    lv_test_assert_int_eq(OBJ_CNT, _lv_ll_get_len(&g->obj_ll), "An object is added only once");
+
+    lv_obj_set_hidden(objs[2], true);
+    lv_obj_add_state(objs[3], LV_STATE_DISABLED);
+
+    lv_group_focus_next(g);
+    lv_test_assert_ptr_eq(objs[1], lv_group_get_focused(g), "Focus the next object");
+    lv_group_focus_next(g);
+    lv_test_assert_ptr_eq(objs[4], lv_group_get_focused(g), "Skip the hidden and disabled objects");
+    lv_group_focus_prev(g);
+    lv_test_assert_ptr_eq(objs[1], lv_group_get_focused(g), "Skip them backward too");
+
+    lv_group_focus_obj(objs[OBJ_CNT - 1]);
+    lv_test_assert_ptr_eq(objs[OBJ_CNT - 1], lv_group_get_focused(g), "Focus an object directly");
+    lv_group_focus_next(g);
+    lv_test_assert_ptr_eq(objs[0], lv_group_get_focused(g), "Wrap to the first object");
+    lv_group_focus_prev(g);
+    lv_test_assert_ptr_eq(objs[OBJ_CNT - 1], lv_group_get_focused(g), "Wrap to the last object");
+
+    lv_group_set_wrap(g, false);
+    lv_group_focus_next(g);
+    lv_test_assert_ptr_eq(objs[OBJ_CNT - 1], lv_group_get_focused(g), "Don't wrap if disabled");
+    lv_group_set_wrap(g, true);
+
+    /*Hidden objects can still be focused directly*/
+    lv_group_focus_obj(objs[2]);
+    lv_test_assert_ptr_eq(objs[2], lv_group_get_focused(g), "Focus a hidden object directly");
+    lv_group_focus_next(g);
+    lv_test_assert_ptr_eq(objs[4], lv_group_get_focused(g), "Focus the next object after a hidden one");
+
+    lv_group_del(g);
+    lv_obj_clean(lv_scr_act());
+}
+
+static void follow_changes(void)
+{
+    lv_test_print("");
+    lv_test_print("Follow the changes of the group:");
+    lv_test_print("--------------------------------");
+
+    lv_group_t * g = create_objs();
+    lv_obj_add_state(objs[3], LV_STATE_DISABLED);
+
+    lv_group_focus_obj(objs[2]);
+    lv_group_focus_next(g);
+    lv_test_assert_ptr_eq(objs[4], lv_group_get_focused(g), "Skip the disabled object");
+
+    lv_obj_clear_state(objs[3], LV_STATE_DISABLED);
+    lv_group_focus_prev(g);
+    lv_test_assert_ptr_eq(objs[3], lv_group_get_focused(g), "Focus the enabled object");
+
+    lv_obj_del(objs[4]);
+    objs[4] = NULL;
+    lv_group_focus_next(g);
+    lv_test_assert_ptr_eq(objs[5], lv_group_get_focused(g), "Skip the deleted object");
+
+    /*The focus goes to the previous object by default*/
+    lv_obj_del(objs[5]);
+    objs[5] = NULL;
+    lv_test_assert_ptr_eq(objs[3], lv_group_get_focused(g), "Refocus when the focused object is deleted");
+
+    /*Add many objects to make the index grow*/
+    uint32_t i;
+    for(i = 0; i < EXTRA_CNT; i++) {
+        extra[i] = lv_obj_create(lv_scr_act(), NULL);
+        lv_group_add_obj(g, extra[i]);
+    }
+
+    /*Remove most of them to compact the index*/
+    for(i = 0; i < EXTRA_CNT - 2; i++) {
+        lv_obj_del(extra[i]);
+    }
+
+    uint32_t focusable_cnt = OBJ_CNT - 2 + 2;
+    lv_group_focus_obj(objs[0]);
+    uint32_t step_cnt = 0;
+    do {
+        lv_group_focus_next(g);
+        step_cnt++;
+    } while(lv_group_get_focused(g) != objs[0] && step_cnt <= focusable_cnt);
+
+    lv_test_assert_int_eq(focusable_cnt, step_cnt, "Visit every focusable object once");
+
+    lv_group_del(g);
+    lv_obj_clean(lv_scr_act());
+}
+
+static void focus_dir(void)
+{
+    lv_test_print("");
+    lv_test_print("Focus the nearest object in a direction:");
+    lv_test_print("----------------------------------------");
+
+    lv_group_t * g = create_objs();
+
+    lv_group_focus_obj(objs[6]);
+    lv_group_focus_dir(g, LV_KEY_RIGHT);
+    lv_test_assert_ptr_eq(objs[7], lv_group_get_focused(g), "Focus the right neighbor");
+    lv_group_focus_dir(g, LV_KEY_DOWN);
+    lv_test_assert_ptr_eq(objs[12], lv_group_get_focused(g), "Focus the bottom neighbor");
+    lv_group_focus_dir(g, LV_KEY_LEFT);
+    lv_test_assert_ptr_eq(objs[11], lv_group_get_focused(g), "Focus the left neighbor");
+    lv_group_focus_dir(g, LV_KEY_UP);
+    lv_test_assert_ptr_eq(objs[6], lv_group_get_focused(g), "Focus the top neighbor");
+    lv_group_focus_dir(g, LV_KEY_UP);
+    lv_group_focus_dir(g, LV_KEY_UP);
+    lv_test_assert_ptr_eq(objs[1], lv_group_get_focused(g), "Stay at the edge");
+
+    lv_obj_set_hidden(objs[7], true);
+    lv_group_focus_obj(objs[6]);
+    lv_group_focus_dir(g, LV_KEY_RIGHT);
+    lv_test_assert_ptr_eq(objs[8], lv_group_get_focused(g), "Skip the hidden object");
+
+    /*Show the right neighbor again but far below*/
+    lv_obj_set_hidden(objs[7], false);
+    lv_obj_set_y(objs[7], 200);
+    lv_group_focus_obj(objs[6]);
+    lv_group_focus_dir(g, LV_KEY_RIGHT);
+    lv_test_assert_ptr_eq(objs[8], lv_group_get_focused(g), "Follow the moved object");
+
+    lv_group_del(g);
+    lv_obj_clean(lv_scr_act());
+}
+
+static void focus_dir_added(void)
+{
+    lv_test_print("");
+    lv_test_print("Focus in a direction from an added object:");
+    lv_test_print("------------------------------------------");
+
+    lv_group_t * g = create_objs();
+
+    /*Read the geometry before adding the new objects*/
+    lv_group_focus_obj(objs[6]);
+    lv_group_focus_dir(g, LV_KEY_RIGHT);
+
+    /*Not focusable objects can still be focused directly*/
+    lv_obj_t * hidden = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_set_size(hidden, 20, 20);
+    lv_obj_set_pos(hidden, 5, 200);
+    lv_obj_set_hidden(hidden, true);
+    lv_group_add_obj(g, hidden);
+
+    lv_group_focus_obj(hidden);
+    lv_group_focus_dir(g, LV_KEY_UP);
+    lv_test_assert_ptr_eq(objs[OBJ_CNT - GRID_COL], lv_group_get_focused(g), "Focus up from a hidden object");
+
+    lv_obj_t * disabled = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_set_size(disabled, 20, 20);
+    lv_obj_set_pos(disabled, 200, 5);
+    lv_obj_add_state(disabled, LV_STATE_DISABLED);
+    lv_group_add_obj(g, disabled);
+
+    lv_group_focus_obj(disabled);
+    lv_group_focus_dir(g, LV_KEY_LEFT);
+    lv_test_assert_ptr_eq(objs[GRID_COL - 1], lv_group_get_focused(g), "Focus left from a disabled object");
+
+    lv_group_del(g);
+    lv_obj_clean(lv_scr_act());
+}
+
+static void separate_geometry(void)
+{
+    lv_test_print("");
+    lv_test_print("Keep the geometry of the not affected groups:");
+    lv_test_print("---------------------------------------------");
+
+    lv_obj_t * cont = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_set_size(cont, 200, 200);
+
+    lv_group_t * g = lv_group_create();
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        objs[i] = lv_obj_create(cont, NULL);
+        lv_obj_set_size(objs[i], 20, 20);
+        lv_obj_set_pos(objs[i], i * 30, 0);
+        lv_group_add_obj(g, objs[i]);
+    }
+
+    lv_group_focus_obj(objs[0]);
+    lv_group_focus_dir(g, LV_KEY_RIGHT);
+    lv_test_assert_ptr_eq(objs[1], lv_group_get_focused(g), "Focus the right neighbor");
+
+    /*Objects outside of the group's common parent don't matter*/
+    lv_obj_t * other = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_t * other_child = lv_obj_create(other, NULL);
+    lv_obj_t * leaf = lv_obj_create(cont, NULL);
+    lv_obj_set_x(other, 250);
+    lv_obj_set_size(other_child, 10, 10);
+    lv_obj_set_y(leaf, 100);
+    lv_test_assert_int_eq(1, g->index.geometry_valid, "Moving not related objects keeps the geometry");
+
+    lv_obj_set_x(objs[2], 100);
+    lv_test_assert_int_eq(0, g->index.geometry_valid, "Moving an object of the group drops the geometry");
+    lv_group_focus_dir(g, LV_KEY_RIGHT);
+    lv_test_assert_ptr_eq(objs[2], lv_group_get_focused(g), "Focus the moved object");
+
+    lv_obj_set_x(cont, 10);
+    lv_test_assert_int_eq(0, g->index.geometry_valid, "Moving the parent of the group drops the geometry");
+
+    lv_group_del(g);
+    lv_obj_clean(lv_scr_act());
+}
+
+/**
+ * Create a grid of objects and add them to a new group in row-major order
+ * @return the new group
+ */
+static lv_group_t * create_objs(void)
+{
+    lv_group_t * g = lv_group_create();
+
+    uint32_t i;
+    for(i = 0; i < OBJ_CNT; i++) {
+        objs[i] = lv_obj_create(lv_scr_act(), NULL);
+        lv_obj_set_size(objs[i], 20, 20);
+        lv_obj_set_pos(objs[i], (i % GRID_COL) * 30 + 5, (i / GRID_COL) * 30 + 5);
+        lv_group_add_obj(g, objs[i]);
+    }
+
+    return g;
+}
+#endif
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @file lv_test_group_index.h
+ *
+ */
+
+#ifndef LV_TEST_GROUP_INDEX_H
+#define LV_TEST_GROUP_INDEX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void lv_test_group_index(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_GROUP_INDEX_H*/
@@ -0,0 +1,222 @@
+/**
+ * @file lv_test_hit_index.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_hit_index.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BTN_CNT     24
+#define POINT_STEP  3
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_HIT_INDEX
+static void same_as_visiting_all(void);
+static void follow_changes(void);
+static void separate_roots(void);
+static void create_objs(void);
+static uint32_t get_mismatch_cnt(void);
+static lv_obj_t * search_all(lv_obj_t * obj, lv_point_t * point);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_HIT_INDEX
+static lv_obj_t * btns[BTN_CNT];
+static lv_obj_t * cont;
+static lv_obj_t * img;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_hit_index(void)
+{
+#if LV_USE_HIT_INDEX
+    lv_test_print("");
+    lv_test_print("======================");
+    lv_test_print("Start hit index tests");
+    lv_test_print("======================");
+
+    create_objs();
+    same_as_visiting_all();
+    follow_changes();
+    separate_roots();
+
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_HIT_INDEX
+
+static void same_as_visiting_all(void)
+{
+    lv_test_print("");
+    lv_test_print("Find the same objects as visiting all:");
+    lv_test_print("--------------------------------------");
+
+    lv_test_assert_int_eq(0, get_mismatch_cnt(), "Points with different result");
+
+    lv_point_t p;
+    p.x = btns[0]->coords.x1 + 1;
+    p.y = btns[0]->coords.y1 + 1;
+    lv_test_assert_ptr_eq(btns[0], lv_indev_search_obj(lv_scr_act(), &p), "Button is found");
+
+    p.x = (btns[3]->coords.x1 + btns[3]->coords.x2) / 2;
+    p.y = (btns[3]->coords.y1 + btns[3]->coords.y2) / 2;
+    lv_test_assert_true(lv_indev_search_obj(lv_scr_act(), &p) != btns[3], "Hidden button is not found");
+}
+
+static void follow_changes(void)
+{
+    lv_test_print("");
+    lv_test_print("Follow the changes of the objects:");
+    lv_test_print("----------------------------------");
+
+    lv_obj_set_pos(btns[0], 300, 200);
+    lv_point_t p = {301, 201};
+    lv_test_assert_ptr_eq(btns[0], lv_indev_search_obj(lv_scr_act(), &p), "Moved button is found");
+
+    lv_obj_set_pos(cont, 60, 140);
+    lv_obj_set_size(btns[1], 90, 90);
+    lv_obj_set_hidden(btns[2], true);
+    lv_obj_set_hidden(btns[3], false);
+    lv_obj_add_state(btns[4], LV_STATE_DISABLED);
+    lv_obj_clear_state(btns[5], LV_STATE_DISABLED);
+    lv_obj_set_click(btns[6], false);
+    lv_obj_set_ext_click_area(btns[8], 5, 5, 5, 5);
+    lv_obj_move_background(btns[9]);
+    lv_obj_set_parent(btns[10], cont);
+    lv_obj_del(btns[11]);
+    lv_btn_create(cont, NULL);
+    lv_obj_set_adv_hittest(img, false);
+    lv_test_assert_int_eq(0, get_mismatch_cnt(), "Points with different result after the changes");
+}
+
+static void separate_roots(void)
+{
+    lv_test_print("");
+    lv_test_print("Rebuild only the grids of the changed objects:");
+    lv_test_print("----------------------------------------------");
+
+    lv_obj_t * top_btn = lv_btn_create(lv_layer_top(), NULL);
+    lv_obj_set_size(top_btn, 20, 20);
+    lv_obj_set_pos(top_btn, LV_HOR_RES - 60, LV_VER_RES - 60);
+
+    lv_point_t p = {btns[0]->coords.x1 + 1, btns[0]->coords.y1 + 1};
+    lv_test_assert_ptr_eq(btns[0], lv_indev_search_obj(lv_scr_act(), &p), "Button on the screen is found");
+
+    /*Change the button without notifying the grids: the screen's grid finds it until the screen is changed*/
+    btns[0]->click = 0;
+    lv_obj_set_pos(top_btn, LV_HOR_RES - 30, LV_VER_RES - 30);
+    lv_point_t top_p = {LV_HOR_RES - 25, LV_VER_RES - 25};
+    lv_test_assert_ptr_eq(top_btn, lv_indev_search_obj(lv_layer_top(), &top_p), "Moved button on the top layer is found");
+    lv_test_assert_ptr_eq(btns[0], lv_indev_search_obj(lv_scr_act(), &p), "Changing the top layer keeps the screen's grid");
+
+    lv_obj_set_pos(btns[1], lv_obj_get_x(btns[1]) + 1, lv_obj_get_y(btns[1]));
+    lv_test_assert_true(lv_indev_search_obj(lv_scr_act(), &p) != btns[0], "Changing the screen rebuilds its grid");
+
+    lv_obj_set_click(btns[0], true);
+    lv_obj_del(top_btn);
+}
+
+static void create_objs(void)
+{
+    lv_obj_clean(lv_scr_act());
+
+    uint32_t i;
+    for(i = 0; i < BTN_CNT; i++) {
+        btns[i] = lv_btn_create(lv_scr_act(), NULL);
+        lv_obj_set_size(btns[i], 50, 30);
+        lv_obj_set_pos(btns[i], (i % 6) * 45, (i / 6) * 25);   /*Overlap a little*/
+        lv_label_create(btns[i], NULL);
+    }
+
+    lv_obj_set_hidden(btns[3], true);
+    lv_obj_add_state(btns[5], LV_STATE_DISABLED);
+    lv_obj_add_state(btns[7], LV_STATE_DISABLED);
+    lv_obj_add_protect(btns[7], LV_PROTECT_EVENT_TO_DISABLED);
+    lv_obj_set_ext_click_area(btns[12], 10, 10, 10, 10);
+
+    /*A not clickable container with a child sticking out*/
+    cont = lv_cont_create(lv_scr_act(), NULL);
+    lv_obj_set_click(cont, false);
+    lv_obj_set_pos(cont, 20, 80);
+    lv_obj_set_size(cont, 100, 60);
+    lv_obj_t * btn = lv_btn_create(cont, NULL);
+    lv_obj_set_pos(btn, 70, 30);
+
+    /*Images use advanced hit test*/
+    img = lv_img_create(lv_scr_act(), NULL);
+    lv_img_set_src(img, LV_SYMBOL_OK);
+    lv_obj_set_click(img, true);
+    lv_obj_set_pos(img, 200, 90);
+}
+
+static uint32_t get_mismatch_cnt(void)
+{
+    uint32_t cnt = 0;
+    lv_point_t p;
+    for(p.y = 0; p.y < LV_VER_RES; p.y += POINT_STEP) {
+        for(p.x = 0; p.x < LV_HOR_RES; p.x += POINT_STEP) {
+            if(lv_indev_search_obj(lv_scr_act(), &p) != search_all(lv_scr_act(), &p)) cnt++;
+        }
+    }
+
+    return cnt;
+}
+
+/*Search by visiting all objects as `lv_indev_search_obj` worked without the grid*/
+static lv_obj_t * search_all(lv_obj_t * obj, lv_point_t * point)
+{
+    if(lv_obj_hittest(obj, point) == false) return NULL;
+
+    lv_obj_t * child;
+    _LV_LL_READ(obj->child_ll, child) {
+        lv_obj_t * found = search_all(child, point);
+        if(found) return found;
+    }
+
+    if(lv_obj_get_click(obj) == false) return NULL;
+
+    lv_obj_t * par;
+    for(par = obj; par; par = lv_obj_get_parent(par)) {
+        if(lv_obj_get_hidden(par)) return NULL;
+    }
+
+    if(lv_obj_is_protected(obj, LV_PROTECT_EVENT_TO_DISABLED) == false &&
+       (lv_obj_get_state(obj, LV_OBJ_PART_MAIN) & LV_STATE_DISABLED)) {
+        return NULL;
+    }
+
+    return obj;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ * @file lv_test_img_blit.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_img_blit.h"
+
+#if LV_BUILD_TEST
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define IMG_W           16
+#define IMG_H           8
+
+/*The image is clipped by its parent on every side*/
+#define CLIP_X          10
+#define CLIP_Y          10
+#define CLIP_W          12
+#define CLIP_H          6
+
+/*The compared area has a 1 px frame around the parent*/
+#define CMP_W           (CLIP_W + 2)
+#define CMP_H           (CLIP_H + 2)
+
+#define TEST_FILE_NAME  "img_blit.bin"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_IMG
+static void compare_with_generic(const void * src, const char * s);
+static void get_area_px(lv_color_t * buf);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_IMG
+static lv_color_t img_px[IMG_W * IMG_H];
+static lv_color_t px_blit[CMP_W * CMP_H];
+static lv_color_t px_generic[CMP_W * CMP_H];
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_img_blit(void)
+{
+#if LV_USE_IMG
+    lv_test_print("");
+    lv_test_print("=======================");
+    lv_test_print("Start lv_img_blit tests");
+    lv_test_print("=======================");
+
+    uint32_t x;
+    uint32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            img_px[y * IMG_W + x] = LV_COLOR_MAKE(x * 16, y * 32, (x + y) * 8);
+        }
+    }
+
+    lv_test_print("");
+    lv_test_print("Copy the image variables:");
+    lv_test_print("-------------------------");
+
+    lv_img_dsc_t img_dsc;
+    _lv_memset_00(&img_dsc, sizeof(img_dsc));
+    img_dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    img_dsc.header.w = IMG_W;
+    img_dsc.header.h = IMG_H;
+    img_dsc.data_size = sizeof(img_px);
+    img_dsc.data = (const uint8_t *)img_px;
+
+    compare_with_generic(&img_dsc, "The copied pixels are the same as the blended ones");
+    lv_img_cache_invalidate_src(&img_dsc);
+
+#if LV_USE_FILESYSTEM
+    lv_test_print("");
+    lv_test_print("Read the lines of the image files:");
+    lv_test_print("----------------------------------");
+
+    FILE * f = fopen(TEST_FILE_NAME, "wb");
+    if(f == NULL) {
+        lv_test_print("SKIP: " TEST_FILE_NAME " can't be created");
+        return;
+    }
+    fwrite(&img_dsc.header, sizeof(img_dsc.header), 1, f);
+    fwrite(img_px, sizeof(img_px), 1, f);
+    fclose(f);
+
+    compare_with_generic("f:" TEST_FILE_NAME, "The read lines are the same as the blended ones");
+    lv_img_cache_invalidate_src("f:" TEST_FILE_NAME);
+    remove(TEST_FILE_NAME);
+#endif
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_IMG
+/**
+ * Draw an image once with the direct copy and once with a full cover mask
+ * which forces the generic blending and compare the results.
+ * @param src the source of the image
+ * @param s the description of the test
+ */
+static void compare_with_generic(const void * src, const char * s)
+{
+    lv_obj_t * parent = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_set_pos(parent, CLIP_X, CLIP_Y);
+    lv_obj_set_size(parent, CLIP_W, CLIP_H);
+    lv_obj_set_style_local_border_width(parent, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_radius(parent, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
+
+    lv_obj_t * img = lv_img_create(parent, NULL);
+    lv_img_set_src(img, src);
+    lv_obj_set_pos(img, -3, -1);
+
+    get_area_px(px_blit);
+    lv_test_assert_color_eq(img_px[1 * IMG_W + 3], px_blit[1 * CMP_W + 1], "The image is drawn");
+
+    lv_draw_mask_radius_param_t mask_param;
+    lv_area_t mask_area;
+    lv_area_set(&mask_area, 0, 0, LV_HOR_RES - 1, LV_VER_RES - 1);
+    lv_draw_mask_radius_init(&mask_param, &mask_area, 0, false);
+    int16_t mask_id = lv_draw_mask_add(&mask_param, NULL);
+
+    get_area_px(px_generic);
+    lv_draw_mask_remove_id(mask_id);
+
+    lv_test_assert_array_eq((const uint8_t *)px_generic, (const uint8_t *)px_blit, sizeof(px_blit), s);
+
+    lv_obj_del(parent);
+}
+
+/**
+ * Get the pixels of the compared area from the screen
+ * @param buf store the pixels here
+ */
+static void get_area_px(lv_color_t * buf)
+{
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < CMP_H; y++) {
+        for(x = 0; x < CMP_W; x++) {
+            buf[y * CMP_W + x] = lv_test_get_px(CLIP_X - 1 + x, CLIP_Y - 1 + y);
+        }
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,276 @@
+/**
+ * @file lv_test_layout.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../../src/lv_misc/lv_gc.h"
+#include "../lv_test_assert.h"
+#include "lv_test_layout.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CHILD_CNT   10
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_LAYOUT_DEFER
+static void deferred_until_read(void);
+static void one_pass_per_child(void);
+static void merged_invalidation(void);
+static void separate_invalidation(void);
+static void deepest_first(void);
+static void delete_dirty(void);
+static lv_obj_t * create_column(void);
+static lv_res_t child_signal(lv_obj_t * obj, lv_signal_t sign, void * param);
+static lv_res_t cont_signal(lv_obj_t * obj, lv_signal_t sign, void * param);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_LAYOUT_DEFER
+static lv_obj_t * children[CHILD_CNT];
+static uint32_t coord_chg_cnt[CHILD_CNT];
+static lv_signal_cb_t ancestor_signal;
+static lv_signal_cb_t cont_ancestor_signal;
+static uint32_t layout_refr_cnt;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_layout(void)
+{
+#if LV_USE_LAYOUT_DEFER
+    lv_test_print("");
+    lv_test_print("===================");
+    lv_test_print("Start layout tests");
+    lv_test_print("===================");
+
+    deferred_until_read();
+    one_pass_per_child();
+    merged_invalidation();
+    separate_invalidation();
+    deepest_first();
+    delete_dirty();
+
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_LAYOUT_DEFER
+
+static void deferred_until_read(void)
+{
+    lv_test_print("");
+    lv_test_print("Refresh the layout when it's read:");
+    lv_test_print("----------------------------------");
+
+    lv_obj_t * cont = create_column();
+
+    lv_test_assert_int_eq(1, cont->layout_dirty, "Container is dirty after adding the children");
+    lv_test_assert_int_eq(children[0]->coords.y1, children[1]->coords.y1, "Children are not arranged yet");
+
+    lv_coord_t h = lv_obj_get_height(cont);
+
+    lv_test_assert_int_eq(0, cont->layout_dirty, "Container is clean after reading its height");
+    lv_test_assert_int_gt(CHILD_CNT * 10 - 1, h, "Container fits the children");
+
+    uint32_t i;
+    bool stacked = true;
+    for(i = 1; i < CHILD_CNT; i++) {
+        if(lv_obj_get_y(children[i]) <= lv_obj_get_y(children[i - 1])) stacked = false;
+    }
+    lv_test_assert_true(stacked, "Children are arranged in a column");
+
+    lv_obj_del(cont);
+}
+
+static void one_pass_per_child(void)
+{
+    lv_test_print("");
+    lv_test_print("Move the children only once:");
+    lv_test_print("----------------------------");
+
+    lv_obj_t * cont = create_column();
+    lv_obj_update_layout();
+
+    uint32_t i;
+    uint32_t max_cnt = 0;
+    for(i = 0; i < CHILD_CNT; i++) {
+        if(coord_chg_cnt[i] > max_cnt) max_cnt = coord_chg_cnt[i];
+    }
+    lv_test_assert_int_lt(3, max_cnt, "Coordinate changes per child");
+
+    lv_obj_del(cont);
+}
+
+static void merged_invalidation(void)
+{
+    lv_test_print("");
+    lv_test_print("Merge the invalidations of a layout pass:");
+    lv_test_print("-----------------------------------------");
+
+    lv_obj_t * cont = create_column();
+    lv_refr_now(NULL);
+
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_test_assert_int_eq(0, disp->inv_p, "No invalid areas after refreshing");
+
+    lv_obj_set_height(children[0], 30);
+    uint32_t inv_p = disp->inv_p;
+    lv_obj_update_layout();
+
+    lv_test_assert_int_lt(2, disp->inv_p - inv_p, "Areas added by the layout pass");
+    lv_test_assert_int_eq(0, cont->layout_dirty, "Container is clean after the layout pass");
+
+    lv_obj_del(cont);
+    lv_refr_now(NULL);
+}
+
+static void separate_invalidation(void)
+{
+    lv_test_print("");
+    lv_test_print("Keep the separate areas of a layout pass:");
+    lv_test_print("-----------------------------------------");
+
+    lv_obj_t * cont1 = create_column();
+    lv_obj_t * child1 = children[0];
+    lv_obj_t * cont2 = create_column();
+    lv_obj_t * child2 = children[0];
+    lv_obj_align(cont2, NULL, LV_ALIGN_IN_TOP_RIGHT, 0, 0);
+    lv_refr_now(NULL);
+
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_obj_set_height(child1, 30);
+    lv_obj_set_height(child2, 30);
+    uint32_t inv_p = disp->inv_p;
+    lv_obj_update_layout();
+
+    lv_test_assert_int_eq(2, disp->inv_p - inv_p, "One area per column added by the layout pass");
+
+    lv_point_t p = {LV_HOR_RES / 2, 5};
+    bool gap_inv = false;
+    uint32_t i;
+    for(i = inv_p; i < disp->inv_p; i++) {
+        if(_lv_area_is_point_on(&disp->inv_areas[i], &p, 0)) gap_inv = true;
+    }
+    lv_test_assert_true(!gap_inv, "The gap between the columns is not invalidated");
+
+    lv_obj_del(cont1);
+    lv_obj_del(cont2);
+    lv_refr_now(NULL);
+}
+
+static void deepest_first(void)
+{
+    lv_test_print("");
+    lv_test_print("Refresh the deepest layouts first:");
+    lv_test_print("----------------------------------");
+
+    /*Nested tight containers: refreshing a parent before its child would refresh the parent again later*/
+    lv_obj_t * conts[CHILD_CNT];
+    uint32_t i;
+    for(i = 0; i < CHILD_CNT; i++) {
+        conts[i] = lv_cont_create(i == 0 ? lv_scr_act() : conts[i - 1], NULL);
+        lv_cont_set_layout(conts[i], LV_LAYOUT_COLUMN_MID);
+        lv_cont_set_fit(conts[i], LV_FIT_TIGHT);
+        if(cont_ancestor_signal == NULL) cont_ancestor_signal = lv_obj_get_signal_cb(conts[i]);
+        lv_obj_set_signal_cb(conts[i], cont_signal);
+    }
+    lv_obj_t * leaf = lv_obj_create(conts[CHILD_CNT - 1], NULL);
+    lv_obj_set_size(leaf, 20, 10);
+    lv_obj_update_layout();
+
+    /*Mark from the top to refresh them in the other order than the marking*/
+    lv_obj_set_height(leaf, 30);
+    for(i = 0; i < CHILD_CNT; i++) lv_obj_mark_layout_dirty(conts[i]);
+    layout_refr_cnt = 0;
+    lv_obj_update_layout();
+
+    /*The fit marks a container again when it resizes it, but its parent is still waiting*/
+    lv_test_assert_int_lt(2 * CHILD_CNT + 1, layout_refr_cnt, "Every layout is refreshed at most twice");
+    lv_test_assert_int_gt(30, lv_obj_get_height(conts[0]), "The outermost container fits the leaf");
+
+    lv_obj_del(conts[0]);
+}
+
+static void delete_dirty(void)
+{
+    lv_test_print("");
+    lv_test_print("Delete a dirty container:");
+    lv_test_print("-------------------------");
+
+    lv_obj_t * cont = create_column();
+    lv_obj_t * inner = lv_cont_create(cont, NULL);
+    lv_cont_set_layout(inner, LV_LAYOUT_ROW_MID);
+    lv_obj_create(inner, NULL);
+
+    lv_test_assert_int_eq(1, inner->layout_dirty, "Inner container is dirty");
+    lv_obj_del(cont);
+    lv_obj_update_layout();
+
+    lv_test_assert_int_eq(0, _lv_ll_get_len(&LV_GC_ROOT(_lv_obj_layout_ll)), "No dirty objects are left");
+}
+
+static lv_obj_t * create_column(void)
+{
+    lv_obj_t * cont = lv_cont_create(lv_scr_act(), NULL);
+    lv_cont_set_layout(cont, LV_LAYOUT_COLUMN_MID);
+    lv_cont_set_fit(cont, LV_FIT_TIGHT);
+
+    uint32_t i;
+    for(i = 0; i < CHILD_CNT; i++) {
+        children[i] = lv_obj_create(cont, NULL);
+        lv_obj_set_size(children[i], 20, 10);
+        if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_cb(children[i]);
+        lv_obj_set_signal_cb(children[i], child_signal);
+        coord_chg_cnt[i] = 0;
+    }
+
+    return cont;
+}
+
+static lv_res_t child_signal(lv_obj_t * obj, lv_signal_t sign, void * param)
+{
+    if(sign == LV_SIGNAL_COORD_CHG) {
+        uint32_t i;
+        for(i = 0; i < CHILD_CNT; i++) {
+            if(children[i] == obj) coord_chg_cnt[i]++;
+        }
+    }
+
+    return ancestor_signal(obj, sign, param);
+}
+
+static lv_res_t cont_signal(lv_obj_t * obj, lv_signal_t sign, void * param)
+{
+    if(sign == LV_SIGNAL_REFR_LAYOUT) layout_refr_cnt++;
+
+    return cont_ancestor_signal(obj, sign, param);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,254 @@
+/**
+ * @file lv_test_mem.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_mem.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_MEM_TELEMETRY
+static void tagged_alloc(void);
+static void create_delete_no_leak(void);
+#endif
+#if LV_MEM_CUSTOM == 0
+#if LV_MEM_SLAB_MAX_SIZE
+static void slab_reuse(void);
+static void slab_flush_on_fail(void);
+#endif
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_MEM_TELEMETRY
+static lv_mem_snapshot_t snap_before;
+static lv_mem_snapshot_t snap_after;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_mem(void)
+{
+    lv_test_print("");
+    lv_test_print("==================");
+    lv_test_print("Start lv_mem tests");
+    lv_test_print("==================");
+
+#if LV_MEM_TELEMETRY
+    tagged_alloc();
+    create_delete_no_leak();
+#endif
+
+#if LV_MEM_CUSTOM == 0
+#if LV_MEM_SLAB_MAX_SIZE
+    slab_reuse();
+    slab_flush_on_fail();
+#endif
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_MEM_TELEMETRY
+
+static void tagged_alloc(void)
+{
+    lv_test_print("");
+    lv_test_print("Attribute an allocation to a tag:");
+    lv_test_print("---------------------------------");
+
+    lv_mem_tag_diff_t diff[4];
+
+    lv_mem_snapshot(&snap_before);
+    const char * tag_old = lv_mem_tag_set("test");
+    void * p = lv_mem_alloc(100);
+    lv_mem_tag_set(tag_old);
+    lv_mem_snapshot(&snap_after);
+
+    lv_test_assert_int_eq(1, lv_mem_snapshot_diff(&snap_before, &snap_after, diff, 4), "Changed tags after alloc");
+    lv_test_assert_str_eq("test", diff[0].key, "Tag of the allocation");
+    lv_test_assert_int_eq(1, diff[0].cnt, "New blocks of the tag");
+    lv_test_assert_true(diff[0].size >= 100, "New size of the tag");
+    lv_test_assert_int_eq(snap_before.hist[4] + 1, snap_after.hist[4], "Blocks in the <= 128 size class");
+
+    lv_mem_free(p);
+    lv_mem_snapshot(&snap_after);
+    lv_test_assert_int_eq(0, lv_mem_snapshot_diff(&snap_before, &snap_after, diff, 4), "Changed tags after free");
+
+    /*Reallocate without an active tag*/
+    tag_old = lv_mem_tag_set("test");
+    p = lv_mem_alloc(100);
+    lv_mem_tag_set(tag_old);
+
+    lv_mem_snapshot(&snap_before);
+    p = lv_mem_realloc(p, 300);
+    lv_mem_snapshot(&snap_after);
+
+    lv_test_assert_int_eq(1, lv_mem_snapshot_diff(&snap_before, &snap_after, diff, 4), "Changed tags after realloc");
+    lv_test_assert_str_eq("test", diff[0].key, "Realloc keeps the tag of the block");
+    lv_test_assert_int_eq(0, diff[0].cnt, "New blocks of the tag after realloc");
+    lv_test_assert_int_gt(199, diff[0].size, "New size of the tag after realloc");
+
+    lv_mem_free(p);
+}
+
+static void create_delete_no_leak(void)
+{
+    lv_test_print("");
+    lv_test_print("Create and delete widgets without leak:");
+    lv_test_print("---------------------------------------");
+
+    lv_mem_tag_diff_t diff[4];
+
+    lv_mem_snapshot(&snap_before);
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_t * label = lv_label_create(obj, NULL);
+    lv_label_set_text(label, "Some text to allocate");
+    lv_label_set_text(label, "A longer text to reallocate the text buffer");
+
+    lv_mem_snapshot(&snap_after);
+    lv_test_assert_int_gt(0, lv_mem_snapshot_diff(&snap_before, &snap_after, diff, 4), "Changed tags after create");
+
+    lv_obj_del(obj);
+    lv_mem_snapshot(&snap_after);
+    lv_test_assert_int_eq(0, lv_mem_snapshot_diff(&snap_before, &snap_after, diff, 4), "Changed tags after delete");
+}
+
+#endif
+
+#if LV_MEM_CUSTOM == 0
+#if LV_MEM_SLAB_MAX_SIZE
+
+static void slab_reuse(void)
+{
+    lv_test_print("");
+    lv_test_print("Reuse the freed blocks of the same size:");
+    lv_test_print("----------------------------------------");
+
+    lv_mem_monitor_t mon_before;
+    lv_mem_monitor_t mon_after;
+
+    lv_mem_slab_flush();
+    lv_mem_monitor(&mon_before);
+
+    uint8_t * p1 = lv_mem_alloc(40);
+    uint8_t * p2 = lv_mem_alloc(40);
+    lv_mem_free(p1);
+
+    lv_mem_monitor(&mon_after);
+    lv_test_assert_int_eq(mon_before.used_cnt + 1, mon_after.used_cnt, "Kept block is not counted as used");
+    lv_test_assert_int_gt(mon_before.free_size - 2 * 40, mon_after.free_size, "Kept block is counted as free");
+
+    /*A block can be a little larger than requested if it filled a hole in the heap.
+     *It's kept in the list of its real size.*/
+    uint8_t * p3 = lv_mem_alloc(_lv_mem_get_size(p1));
+    lv_test_assert_ptr_eq(p1, p3, "Same size reuses the freed block");
+    uint8_t * p4 = lv_mem_alloc(40);
+    lv_test_assert_true(p4 != p1 && p4 != p2, "New block if no freed one is kept");
+
+    uint32_t p4_size = _lv_mem_get_size(p4);
+    uint8_t * p5 = lv_mem_realloc(p4, 80);
+    lv_test_assert_true(p5 != NULL, "Grow a block");
+    uint8_t * p6 = lv_mem_alloc(p4_size);
+    lv_test_assert_ptr_eq(p4, p6, "Block freed by realloc is reused");
+
+    lv_mem_free(p2);
+    lv_mem_free(p3);
+    lv_mem_free(p5);
+    lv_mem_free(p6);
+
+    /*Freeing a kept block again shouldn't add it to the list twice*/
+    lv_mem_monitor_t mon_freed;
+    lv_mem_monitor(&mon_freed);
+    lv_mem_free(p6);
+    lv_mem_monitor(&mon_after);
+    lv_test_assert_int_eq(mon_freed.free_cnt, mon_after.free_cnt, "Double free doesn't keep the block again");
+    lv_test_assert_int_eq(mon_freed.free_size, mon_after.free_size, "Double free doesn't change the free size");
+
+    uint8_t * p7 = lv_mem_alloc(40);
+    uint8_t * p8 = lv_mem_alloc(40);
+    lv_test_assert_true(p7 != p8, "Double free is ignored");
+    lv_mem_free(p7);
+    lv_mem_free(p8);
+
+    lv_mem_slab_flush();
+    lv_mem_monitor(&mon_after);
+    lv_test_assert_int_eq(mon_before.free_size, mon_after.free_size, "Free size after flush");
+    lv_test_assert_int_eq(mon_before.free_biggest_size, mon_after.free_biggest_size, "Biggest free block after flush");
+
+    lv_test_print("Recreate the same objects:");
+    lv_obj_t * btn = lv_btn_create(lv_scr_act(), NULL);
+    lv_obj_t * label = lv_label_create(btn, NULL);
+    lv_obj_del(btn);
+    lv_obj_t * btn2 = lv_btn_create(lv_scr_act(), NULL);
+    lv_obj_t * label2 = lv_label_create(btn2, NULL);
+    lv_test_assert_ptr_eq(btn, btn2, "Button reuses the freed block");
+    lv_test_assert_ptr_eq(label, label2, "Label reuses the freed block");
+    lv_obj_del(btn2);
+
+    lv_mem_slab_flush();
+    lv_mem_monitor(&mon_after);
+    lv_test_assert_int_eq(mon_before.free_size, mon_after.free_size, "Free size after deleting the objects");
+}
+
+static void slab_flush_on_fail(void)
+{
+    lv_test_print("");
+    lv_test_print("Give back the kept blocks if an allocation fails:");
+    lv_test_print("-------------------------------------------------");
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t big_size = mon.free_biggest_size / 2;
+
+    /*Fill the heap with small blocks, and keep all of them after free*/
+    uint32_t cnt = 0;
+    void ** blocks = lv_mem_alloc(sizeof(void *) * 512);
+    while(cnt < 512) {
+        blocks[cnt] = lv_mem_alloc(96);
+        if(blocks[cnt] == NULL) break;
+        cnt++;
+    }
+    lv_test_assert_int_lt(512, cnt, "The heap is full");
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) lv_mem_free(blocks[i]);
+
+    void * big = lv_mem_alloc(big_size);
+    lv_test_assert_true(big != NULL, "Large block is allocated from the kept blocks");
+
+    lv_mem_free(big);
+    lv_mem_free(blocks);
+    lv_mem_slab_flush();
+}
+
+#endif
+#endif
+
+#endif
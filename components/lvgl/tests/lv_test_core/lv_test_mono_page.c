@@ -0,0 +1,219 @@
+/**
+ * @file lv_test_mono_page.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_mono_page.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MONO_HOR_RES    32
+#define MONO_VER_RES    24
+#define MONO_BUF_SIZE   (MONO_HOR_RES * MONO_VER_RES / 8)
+#define MONO_IMG_SIZE   8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_disp_t * mono_disp_create(lv_disp_drv_t * drv, lv_disp_buf_t * disp_buf, uint8_t * buf, bool mono_page);
+static void mono_disp_remove(lv_disp_t * disp);
+static void create_content(lv_disp_t * disp);
+static bool get_px(const uint8_t * frame, lv_coord_t x, lv_coord_t y);
+static void rounder_cb(lv_disp_drv_t * disp_drv, lv_area_t * area);
+static void set_px_cb(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
+                      lv_color_t color, lv_opa_t opa);
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t page_buf[MONO_BUF_SIZE];
+static uint8_t ref_buf[MONO_BUF_SIZE];
+static uint8_t page_frame[MONO_BUF_SIZE];
+static uint8_t ref_frame[MONO_BUF_SIZE];
+static lv_color_t img_map[MONO_IMG_SIZE * MONO_IMG_SIZE];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_mono_page(void)
+{
+    lv_test_print("");
+    lv_test_print("========================");
+    lv_test_print("Start lv_mono_page tests");
+    lv_test_print("========================");
+
+    lv_disp_t * def_disp = lv_disp_get_default();
+
+    /*Render the same content on a `mono_page` display and on a `set_px_cb` display writing the same format.
+     *Use them one after the other to save memory.*/
+    static lv_disp_drv_t page_drv;
+    static lv_disp_drv_t ref_drv;
+    static lv_disp_buf_t page_disp_buf;
+    static lv_disp_buf_t ref_disp_buf;
+
+    lv_disp_t * page_disp = mono_disp_create(&page_drv, &page_disp_buf, page_buf, true);
+    create_content(page_disp);
+    lv_refr_now(page_disp);
+    mono_disp_remove(page_disp);
+
+    lv_disp_t * ref_disp = mono_disp_create(&ref_drv, &ref_disp_buf, ref_buf, false);
+    create_content(ref_disp);
+    lv_refr_now(ref_disp);
+    mono_disp_remove(ref_disp);
+
+    lv_disp_set_default(def_disp);
+
+    lv_test_print("");
+    lv_test_print("Compare with set_px_cb:");
+    lv_test_print("-----------------------");
+
+    lv_test_assert_array_eq(ref_frame, page_frame, MONO_BUF_SIZE, "Same frame as with set_px_cb");
+
+    /*The rectangle is at (2;5) - (11;13) so it crosses the first page boundary*/
+    lv_test_assert_int_eq(0, get_px(page_frame, 1, 5), "Background left to the rectangle");
+    lv_test_assert_int_eq(1, get_px(page_frame, 2, 5), "Top left pixel of the rectangle");
+    lv_test_assert_int_eq(1, get_px(page_frame, 11, 13), "Bottom right pixel of the rectangle");
+    lv_test_assert_int_eq(0, get_px(page_frame, 11, 14), "Background below the rectangle");
+    lv_test_assert_int_eq(0, get_px(page_frame, 12, 13), "Background right to the rectangle");
+
+    /*The image is at (20;8) - (27;15): its left half is dark, its right half is light*/
+    lv_test_assert_int_eq(1, get_px(page_frame, 20, 8), "Dark pixel of the image");
+    lv_test_assert_int_eq(0, get_px(page_frame, 24, 8), "Light pixel of the image");
+    lv_test_assert_int_eq(1, get_px(page_frame, 23, 15), "Dark pixel of the image");
+
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_disp_t * mono_disp_create(lv_disp_drv_t * drv, lv_disp_buf_t * disp_buf, uint8_t * buf, bool mono_page)
+{
+    /*The size of the buffer is given in pixels*/
+    lv_disp_buf_init(disp_buf, buf, NULL, MONO_HOR_RES * MONO_VER_RES);
+
+    lv_disp_drv_init(drv);
+    drv->hor_res = MONO_HOR_RES;
+    drv->ver_res = MONO_VER_RES;
+    drv->buffer = disp_buf;
+    drv->flush_cb = flush_cb;
+    drv->rounder_cb = rounder_cb;
+#if LV_COLOR_SCREEN_TRANSP
+    /*The buffer is smaller than `size` ARGB pixels*/
+    drv->screen_transp = 0;
+#endif
+    if(mono_page) drv->mono_page = 1;
+    else drv->set_px_cb = set_px_cb;
+
+    return lv_disp_drv_register(drv);
+}
+
+static void mono_disp_remove(lv_disp_t * disp)
+{
+    /*Deleting the objects invalidates the display so delete the refresher task last*/
+    lv_obj_del(disp->act_scr);
+    lv_obj_del(disp->top_layer);
+    lv_obj_del(disp->sys_layer);
+    lv_task_del(disp->refr_task);
+    lv_disp_remove(disp);
+}
+
+static void create_content(lv_disp_t * disp)
+{
+    lv_obj_t * scr = lv_disp_get_scr_act(disp);
+    lv_obj_set_style_local_bg_color(scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+    lv_obj_set_style_local_bg_opa(scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+
+    lv_obj_t * rect = lv_obj_create(scr, NULL);
+    lv_obj_reset_style_list(rect, LV_OBJ_PART_MAIN);
+    lv_obj_set_style_local_bg_color(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+    lv_obj_set_style_local_bg_opa(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+    lv_obj_set_pos(rect, 2, 5);
+    lv_obj_set_size(rect, 10, 9);
+
+    /*A rounded, semi transparent rectangle to blend with a mask*/
+    lv_obj_t * round = lv_obj_create(scr, NULL);
+    lv_obj_reset_style_list(round, LV_OBJ_PART_MAIN);
+    lv_obj_set_style_local_bg_color(round, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+    lv_obj_set_style_local_bg_opa(round, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_70);
+    lv_obj_set_style_local_radius(round, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 4);
+    lv_obj_set_pos(round, 6, 15);
+    lv_obj_set_size(round, 12, 9);
+
+    lv_obj_t * label = lv_label_create(scr, NULL);
+    lv_obj_set_style_local_text_color(label, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+    lv_label_set_text(label, "Ag");
+    lv_obj_set_pos(label, 12, 0);
+
+    /*An image with a dark left and a light right half*/
+    uint32_t i;
+    for(i = 0; i < MONO_IMG_SIZE * MONO_IMG_SIZE; i++) {
+        img_map[i] = (i % MONO_IMG_SIZE) < MONO_IMG_SIZE / 2 ? LV_COLOR_BLACK : LV_COLOR_WHITE;
+    }
+
+    static lv_img_dsc_t img_dsc;
+    img_dsc.header.always_zero = 0;
+    img_dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    img_dsc.header.w = MONO_IMG_SIZE;
+    img_dsc.header.h = MONO_IMG_SIZE;
+    img_dsc.data_size = sizeof(img_map);
+    img_dsc.data = (const uint8_t *)img_map;
+
+    lv_obj_t * img = lv_img_create(scr, NULL);
+    lv_img_set_src(img, &img_dsc);
+    lv_obj_set_pos(img, 20, 8);
+}
+
+static bool get_px(const uint8_t * frame, lv_coord_t x, lv_coord_t y)
+{
+    return (frame[(y >> 3) * MONO_HOR_RES + x] >> (y & 0x7)) & 0x1;
+}
+
+static void rounder_cb(lv_disp_drv_t * disp_drv, lv_area_t * area)
+{
+    /*Always refresh the whole screen to make the frames easy to compare*/
+    area->x1 = 0;
+    area->y1 = 0;
+    area->x2 = disp_drv->hor_res - 1;
+    area->y2 = disp_drv->ver_res - 1;
+}
+
+/*Write the same format as `mono_page` would*/
+static void set_px_cb(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
+                      lv_color_t color, lv_opa_t opa)
+{
+    LV_UNUSED(disp_drv);
+    if(opa < LV_OPA_50) return;
+
+    uint8_t * byte = &buf[(y >> 3) * buf_w + x];
+    if(lv_color_to1(color) == 0) *byte |= 1 << (y & 0x7);
+    else *byte &= ~(1 << (y & 0x7));
+}
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    LV_UNUSED(area);
+    uint8_t * frame = disp_drv->mono_page ? page_frame : ref_frame;
+    _lv_memcpy(frame, color_p, MONO_BUF_SIZE);
+    lv_disp_flush_ready(disp_drv);
+}
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @file lv_test_mono_page.h
+ *
+ */
+
+#ifndef LV_TEST_MONO_PAGE_H
+#define LV_TEST_MONO_PAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void lv_test_mono_page(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_MONO_PAGE_H*/
@@ -9,12 +9,14 @@
 #include "../../lvgl.h"
 #include "../lv_test_assert.h"
 #include "lv_test_obj.h"
+#include "../../src/lv_misc/lv_gc.h"
 
 #if LV_BUILD_TEST
 
 /*********************
  *      DEFINES
  *********************/
+#define ALIGN_OBJ_CNT   20
 
 /**********************
  *      TYPEDEFS
@@ -24,6 +26,12 @@
  *  STATIC PROTOTYPES
  **********************/
 static void create_delete_change_parent(void);
+#if LV_USE_OBJ_COMPACT
+static void compact(void);
+#if LV_USE_OBJ_REALIGN
+static void compact_align(void);
+#endif
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -45,6 +53,12 @@ void lv_test_obj(void)
     lv_test_print("==================");
 
     create_delete_change_parent();
+#if LV_USE_OBJ_COMPACT
+    compact();
+#if LV_USE_OBJ_REALIGN
+    compact_align();
+#endif
+#endif
 }
 
 /**********************
@@ -85,4 +99,170 @@ static void create_delete_change_parent(void)
     lv_obj_del(obj_parent);
     lv_test_assert_int_eq(0, lv_obj_count_children(lv_scr_act()), "Screen's children count after delete");
 }
+
+#if LV_USE_OBJ_COMPACT
+static void compact(void)
+{
+    lv_test_print("");
+    lv_test_print("Compact objects:");
+    lv_test_print("----------------");
+
+    uint32_t class_cnt = _lv_ll_get_len(&LV_GC_ROOT(_lv_obj_class_ll));
+
+    lv_obj_t * btn1 = lv_btn_create(lv_scr_act(), NULL);
+    lv_obj_t * btn2 = lv_btn_create(lv_scr_act(), NULL);
+    lv_obj_t * obj = lv_obj_create(lv_scr_act(), NULL);
+
+    lv_test_assert_ptr_eq(btn1->class_p, btn2->class_p, "Same class for the same type");
+    lv_test_assert_int_eq(2, btn1->class_p->ref_cnt, "Users of the class");
+    lv_test_assert_true(lv_obj_get_signal_cb(btn1) == lv_obj_get_signal_cb(btn2), "Same signal function");
+    lv_test_assert_true(lv_obj_get_design_cb(btn1) != lv_obj_get_design_cb(obj), "Different design function");
+    lv_test_assert_int_eq(class_cnt + 1, _lv_ll_get_len(&LV_GC_ROOT(_lv_obj_class_ll)), "Classes after create");
+
+#if LV_USE_OBJ_REALIGN
+    lv_test_assert_int_eq(0, btn1->has_realign, "No realign parameters before align");
+
+    lv_obj_set_size(btn1, 100, 50);
+    lv_obj_align(btn1, NULL, LV_ALIGN_CENTER, 10, 0);
+    lv_obj_set_auto_realign(btn1, true);
+    lv_test_assert_int_eq(1, btn1->has_realign, "Realign parameters after align");
+    lv_test_assert_true(lv_obj_get_auto_realign(btn1), "Auto realign");
+    lv_test_assert_true(!lv_obj_get_auto_realign(btn2), "No auto realign");
+
+    lv_obj_set_size(btn1, 60, 40);
+    lv_test_assert_int_eq((LV_HOR_RES - 60) / 2 + 10, lv_obj_get_x(btn1), "Realigned x");
+    lv_test_assert_int_eq((LV_VER_RES - 40) / 2, lv_obj_get_y(btn1), "Realigned y");
+
+    lv_obj_t * btn3 = lv_btn_create(lv_scr_act(), btn1);
+    lv_test_assert_true(lv_obj_get_auto_realign(btn3), "Auto realign of the copy");
+    lv_obj_set_size(btn3, 20, 20);
+    lv_test_assert_int_eq((LV_HOR_RES - 20) / 2 + 10, lv_obj_get_x(btn3), "Realigned x of the copy");
+    lv_test_assert_int_eq(1, btn3->has_realign, "Realign parameters of the copy");
+    lv_obj_del(btn3);
+#endif
+
+#if LV_USE_EXT_CLICK_AREA == LV_EXT_CLICK_AREA_FULL
+    lv_obj_set_ext_click_area(btn2, 0, 0, 0, 0);
+    lv_test_assert_int_eq(0, btn2->has_click_pad, "No click paddings if zero");
+
+    lv_obj_set_ext_click_area(btn2, 1, 2, 3, 4);
+    lv_test_assert_int_eq(1, btn2->has_click_pad, "Click paddings set");
+    lv_test_assert_int_eq(1, lv_obj_get_ext_click_pad_left(btn2), "Left click padding");
+    lv_test_assert_int_eq(2, lv_obj_get_ext_click_pad_right(btn2), "Right click padding");
+    lv_test_assert_int_eq(3, lv_obj_get_ext_click_pad_top(btn2), "Top click padding");
+    lv_test_assert_int_eq(4, lv_obj_get_ext_click_pad_bottom(btn2), "Bottom click padding");
+    lv_test_assert_int_eq(0, lv_obj_get_ext_click_pad_left(btn1), "No click padding on other objects");
+
+    lv_obj_set_ext_click_area(btn2, 0, 0, 0, 0);
+    lv_test_assert_int_eq(0, btn2->has_click_pad, "Click paddings removed if zero");
+    lv_test_assert_int_eq(0, lv_obj_get_ext_click_pad_left(btn2), "Left click padding after removing");
+#endif
+
+    lv_signal_cb_t obj_signal = lv_obj_get_signal_cb(obj);
+    lv_design_cb_t obj_design = lv_obj_get_design_cb(obj);
+    lv_obj_set_signal_design_cb(obj, lv_obj_get_signal_cb(btn1), lv_obj_get_design_cb(btn1));
+    lv_test_assert_ptr_eq(btn1->class_p, obj->class_p, "Same class after setting both functions");
+    lv_test_assert_int_eq(3, btn1->class_p->ref_cnt, "Users of the class after setting both functions");
+    lv_test_assert_int_eq(class_cnt + 1, _lv_ll_get_len(&LV_GC_ROOT(_lv_obj_class_ll)),
+                          "No new class after setting both functions");
+
+    /*The button's signal function would handle the object as a button*/
+    lv_obj_set_signal_design_cb(obj, obj_signal, obj_design);
+    lv_test_assert_int_eq(2, btn1->class_p->ref_cnt, "Users of the class after setting them back");
+
+    lv_obj_del(btn1);
+    lv_obj_del(btn2);
+    lv_obj_del(obj);
+    lv_test_assert_int_eq(class_cnt, _lv_ll_get_len(&LV_GC_ROOT(_lv_obj_class_ll)), "Classes after delete");
+}
+
+#if LV_USE_OBJ_REALIGN
+static void compact_align(void)
+{
+    lv_test_print("");
+    lv_test_print("Align many compact objects:");
+    lv_test_print("---------------------------");
+
+    lv_obj_t * base = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_t * objs[ALIGN_OBJ_CNT];
+    uint32_t i;
+    for(i = 0; i < ALIGN_OBJ_CNT; i++) {
+        objs[i] = lv_obj_create(lv_scr_act(), NULL);
+        lv_obj_set_size(objs[i], 10, 10);
+    }
+
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t free_ori = mon.free_size;
+#endif
+
+    for(i = 0; i < ALIGN_OBJ_CNT; i++) {
+        lv_obj_align(objs[i], i == 0 ? base : objs[i - 1], LV_ALIGN_OUT_RIGHT_MID, 1, 0);
+    }
+
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor(&mon);
+    lv_test_assert_int_eq(free_ori, mon.free_size, "No memory is used to align without auto realign");
+#endif
+    lv_test_assert_int_eq(0, objs[ALIGN_OBJ_CNT - 1]->has_realign, "No realign parameters without auto realign");
+
+    lv_obj_t * last = objs[ALIGN_OBJ_CNT - 1];
+    lv_obj_set_x(last, 0);
+    lv_obj_realign(last);
+    lv_test_assert_int_eq(lv_obj_get_x(objs[ALIGN_OBJ_CNT - 2]) + 10 + 1, lv_obj_get_x(last),
+                          "The last aligned object can be realigned");
+
+    for(i = 0; i < ALIGN_OBJ_CNT; i++) {
+        lv_obj_set_auto_realign(objs[i], true);
+        lv_obj_align(objs[i], i == 0 ? base : objs[i - 1], LV_ALIGN_OUT_RIGHT_MID, 1, 0);
+    }
+
+    for(i = 0; i < ALIGN_OBJ_CNT; i++) {
+        lv_obj_set_size(objs[i], 20, 20);
+    }
+
+    bool ok = true;
+    for(i = 1; i < ALIGN_OBJ_CNT; i++) {
+        if(lv_obj_get_x(objs[i]) != lv_obj_get_x(objs[i - 1]) + 20 + 1) ok = false;
+    }
+    lv_test_assert_true(ok, "All objects are realigned");
+
+    /*Remove every second entry to check the others are still found*/
+    for(i = 0; i < ALIGN_OBJ_CNT; i += 2) {
+        lv_obj_set_auto_realign(objs[i], false);
+    }
+
+    for(i = 1; i < ALIGN_OBJ_CNT; i += 2) {
+        lv_obj_set_size(objs[i], 20, 40);
+    }
+
+    ok = true;
+    for(i = 1; i < ALIGN_OBJ_CNT; i += 2) {
+        if(lv_obj_get_y(objs[i]) != lv_obj_get_y(objs[i - 1]) - 10) ok = false;
+        if(lv_obj_get_auto_realign(objs[i - 1])) ok = false;
+    }
+    lv_test_assert_true(ok, "Only the objects with auto realign are realigned");
+
+    for(i = 1; i < ALIGN_OBJ_CNT; i += 2) {
+        lv_obj_set_auto_realign(objs[i], false);
+    }
+
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor(&mon);
+    lv_test_assert_int_eq(free_ori, mon.free_size, "The realign table is freed when empty");
+#endif
+
+    lv_obj_del(base);
+    for(i = 0; i < ALIGN_OBJ_CNT; i++) {
+        lv_obj_del(objs[i]);
+    }
+
+    /*Give back and join the freed blocks, the next tests need large blocks from the small test heap*/
+    lv_mem_slab_flush();
+    lv_mem_defrag();
+}
+#endif
+#endif
+
 #endif
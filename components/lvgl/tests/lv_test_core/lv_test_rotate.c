@@ -0,0 +1,250 @@
+/**
+ * @file lv_test_rotate.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_rotate.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Wide enough to rotate the buffer in several chunks*/
+#define ROT_WIDTH   300
+#define ROT_HEIGHT  20
+#define ROT_PX_CNT  (ROT_WIDTH * ROT_HEIGHT)
+
+/*The rotation buffer is allocated from LVGL's heap*/
+#define ROT_TEST_ENABLED    (LV_MEM_CUSTOM || LV_MEM_SIZE >= 2 * LV_DISP_ROT_MAX_BUF)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if ROT_TEST_ENABLED
+static void rotate_and_compare(lv_disp_rot_t rotation, lv_coord_t w, lv_coord_t h);
+static lv_disp_t * rot_disp_create(lv_disp_drv_t * drv, lv_disp_buf_t * disp_buf, lv_color_t * buf,
+                                   lv_coord_t w, lv_coord_t h, lv_disp_rot_t rotation);
+static void rot_disp_remove(lv_disp_t * disp);
+static void create_content(lv_disp_t * disp);
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
+static void wait_cb(lv_disp_drv_t * disp_drv);
+static void flush_finish(lv_disp_drv_t * disp_drv);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if ROT_TEST_ENABLED
+static lv_color_t buf_ref[ROT_PX_CNT];
+static lv_color_t buf_rot[ROT_PX_CNT];
+static lv_color_t panel_ref[ROT_PX_CNT];
+static lv_color_t panel_rot[ROT_PX_CNT];
+static lv_coord_t panel_w;              /*Width of the display being flushed in its native orientation*/
+static lv_color_t * panel_act;
+static lv_area_t flush_area;            /*The area being flushed, written to the panel when it's ready*/
+static lv_color_t * flush_color_p;
+static uint32_t flush_cnt;
+static uint32_t flush_last_cnt;
+static uint32_t flush_overlap_cnt;      /*flush_cb was called while the previous area was being flushed*/
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_rotate(void)
+{
+#if ROT_TEST_ENABLED
+    lv_test_print("");
+    lv_test_print("=====================");
+    lv_test_print("Start lv_rotate tests");
+    lv_test_print("=====================");
+
+    lv_test_print("");
+    lv_test_print("Rotate by 90 degrees in chunks:");
+    lv_test_print("-------------------------------");
+    rotate_and_compare(LV_DISP_ROT_90, ROT_WIDTH, ROT_HEIGHT);
+
+    lv_test_print("");
+    lv_test_print("Rotate by 270 degrees in chunks:");
+    lv_test_print("--------------------------------");
+    rotate_and_compare(LV_DISP_ROT_270, ROT_WIDTH, ROT_HEIGHT);
+
+    lv_test_print("");
+    lv_test_print("Rotate a tall buffer by 90 degrees:");
+    lv_test_print("-----------------------------------");
+    rotate_and_compare(LV_DISP_ROT_90, 12, 30);
+
+    lv_test_print("");
+    lv_test_print("Rotate a tall buffer by 270 degrees:");
+    lv_test_print("------------------------------------");
+    rotate_and_compare(LV_DISP_ROT_270, 12, 30);
+#else
+    lv_test_print("SKIP: rotate test because LV_MEM_SIZE is too small for LV_DISP_ROT_MAX_BUF");
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if ROT_TEST_ENABLED
+
+/**
+ * Draw the same screen on a rotated and a not rotated display and compare the pixels
+ * @param rotation rotation of the display
+ * @param w horizontal resolution of the rotated display as seen by the application
+ * @param h vertical resolution of the rotated display as seen by the application
+ */
+static void rotate_and_compare(lv_disp_rot_t rotation, lv_coord_t w, lv_coord_t h)
+{
+    lv_disp_t * def_disp = lv_disp_get_default();
+    static lv_disp_drv_t drv_ref;
+    static lv_disp_drv_t drv_rot;
+    static lv_disp_buf_t disp_buf_ref;
+    static lv_disp_buf_t disp_buf_rot;
+
+    lv_disp_t * disp_ref = rot_disp_create(&drv_ref, &disp_buf_ref, buf_ref, w, h, LV_DISP_ROT_NONE);
+    create_content(disp_ref);
+    panel_act = panel_ref;
+    panel_w = w;
+    lv_refr_now(disp_ref);
+    flush_finish(&drv_ref);
+
+    lv_disp_t * disp_rot = rot_disp_create(&drv_rot, &disp_buf_rot, buf_rot, w, h, rotation);
+    create_content(disp_rot);
+    panel_act = panel_rot;
+    panel_w = h;
+    flush_cnt = 0;
+    flush_last_cnt = 0;
+    flush_overlap_cnt = 0;
+    lv_refr_now(disp_rot);
+    flush_finish(&drv_rot);
+
+    lv_test_assert_int_gt(1, flush_cnt, "Flushed in several chunks");
+    lv_test_assert_int_eq(0, flush_overlap_cnt, "A chunk is flushed only when the previous is ready");
+    lv_test_assert_int_eq(1, flush_last_cnt, "Only the last chunk is the last flush");
+
+    uint32_t diff_cnt = 0;
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            lv_color_t c_rot;
+            if(rotation == LV_DISP_ROT_90) c_rot = panel_rot[(w - 1 - x) * h + y];
+            else c_rot = panel_rot[x * h + (h - 1 - y)];
+            if(c_rot.full != panel_ref[y * w + x].full) diff_cnt++;
+        }
+    }
+
+    lv_test_assert_int_eq(0, diff_cnt, "Same as the not rotated display");
+
+    rot_disp_remove(disp_rot);
+    rot_disp_remove(disp_ref);
+    lv_disp_set_default(def_disp);
+}
+
+static lv_disp_t * rot_disp_create(lv_disp_drv_t * drv, lv_disp_buf_t * disp_buf, lv_color_t * buf,
+                                   lv_coord_t w, lv_coord_t h, lv_disp_rot_t rotation)
+{
+    lv_disp_buf_init(disp_buf, buf, NULL, w * h);
+
+    lv_disp_drv_init(drv);
+    /*The resolution is set in the native orientation of the display*/
+    if(rotation == LV_DISP_ROT_90 || rotation == LV_DISP_ROT_270) {
+        drv->hor_res = h;
+        drv->ver_res = w;
+    }
+    else {
+        drv->hor_res = w;
+        drv->ver_res = h;
+    }
+    drv->rotated = rotation;
+    drv->sw_rotate = 1;
+    drv->buffer = disp_buf;
+    drv->flush_cb = flush_cb;
+    drv->wait_cb = wait_cb;
+#if LV_COLOR_SCREEN_TRANSP
+    drv->screen_transp = 0;
+#endif
+
+    return lv_disp_drv_register(drv);
+}
+
+static void rot_disp_remove(lv_disp_t * disp)
+{
+    /*Deleting the objects invalidates the display so delete the refresher task last*/
+    lv_obj_del(disp->act_scr);
+    lv_obj_del(disp->top_layer);
+    lv_obj_del(disp->sys_layer);
+    lv_task_del(disp->refr_task);
+    lv_disp_remove(disp);
+}
+
+static void create_content(lv_disp_t * disp)
+{
+    lv_obj_t * scr = lv_disp_get_scr_act(disp);
+    lv_obj_set_style_local_bg_color(scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+    lv_obj_set_style_local_bg_opa(scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+
+    /*Rectangles with different colors and sizes make a wrong rotation visible*/
+    lv_color_t colors[] = {LV_COLOR_GREEN, LV_COLOR_NAVY, LV_COLOR_ORANGE, LV_COLOR_PURPLE};
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        lv_obj_t * rect = lv_obj_create(scr, NULL);
+        lv_obj_reset_style_list(rect, LV_OBJ_PART_MAIN);
+        lv_obj_set_style_local_bg_color(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, colors[i % 4]);
+        lv_obj_set_style_local_bg_opa(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+        lv_obj_set_pos(rect, (i * 23) % lv_disp_get_hor_res(disp), (i * 7) % lv_disp_get_ver_res(disp));
+        lv_obj_set_size(rect, 3 + i, 2 + i % 5);
+    }
+}
+
+/*Start "sending" an area. It's written to the panel only when the flushing is ready*/
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    if(flush_color_p) flush_overlap_cnt++;
+
+    lv_area_copy(&flush_area, area);
+    flush_color_p = color_p;
+    flush_cnt++;
+    if(lv_disp_flush_is_last(disp_drv)) flush_last_cnt++;
+}
+
+static void wait_cb(lv_disp_drv_t * disp_drv)
+{
+    flush_finish(disp_drv);
+}
+
+/*Write the area being flushed to the panel and tell the flushing is ready*/
+static void flush_finish(lv_disp_drv_t * disp_drv)
+{
+    if(flush_color_p == NULL) return;
+
+    lv_coord_t w = lv_area_get_width(&flush_area);
+    lv_coord_t y;
+    for(y = flush_area.y1; y <= flush_area.y2; y++) {
+        _lv_memcpy(&panel_act[y * panel_w + flush_area.x1], flush_color_p, w * sizeof(lv_color_t));
+        flush_color_p += w;
+    }
+
+    flush_color_p = NULL;
+    lv_disp_flush_ready(disp_drv);
+}
+#endif
+
+#endif
@@ -0,0 +1,293 @@
+/**
+ * @file lv_test_snapshot.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_snapshot.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SNAPSHOT_HOR_RES    48
+#define SNAPSHOT_VER_RES    40
+#define SNAPSHOT_PX_CNT     (SNAPSHOT_HOR_RES * SNAPSHOT_VER_RES)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_SCR_SNAPSHOT
+static lv_obj_t * create_scr(lv_color_t bg_color);
+static void compare_with_redraw(lv_disp_t * disp);
+static uint32_t render_in_task(lv_disp_t * disp, lv_obj_t * scr);
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
+static void monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_SCR_SNAPSHOT
+static lv_color_t buf1[SNAPSHOT_HOR_RES * 8];
+static lv_color_t panel[SNAPSHOT_PX_CNT];   /*What the display shows*/
+static lv_color_t loaded_frame[SNAPSHOT_PX_CNT];
+static uint32_t flush_cnt;
+static uint32_t redrawn_px;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_snapshot(void)
+{
+#if LV_USE_SCR_SNAPSHOT
+    lv_test_print("");
+    lv_test_print("=======================");
+    lv_test_print("Start lv_snapshot tests");
+    lv_test_print("=======================");
+
+    lv_disp_t * def_disp = lv_disp_get_default();
+    static lv_disp_drv_t drv;
+    static lv_disp_buf_t disp_buf;
+    lv_disp_buf_init(&disp_buf, buf1, NULL, SNAPSHOT_HOR_RES * 8);
+    lv_disp_drv_init(&drv);
+    drv.hor_res = SNAPSHOT_HOR_RES;
+    drv.ver_res = SNAPSHOT_VER_RES;
+    drv.buffer = &disp_buf;
+    drv.flush_cb = flush_cb;
+    drv.monitor_cb = monitor_cb;
+#if LV_COLOR_SCREEN_TRANSP
+    drv.screen_transp = 0;
+#endif
+    lv_disp_t * disp = lv_disp_drv_register(&drv);
+    lv_disp_set_default(disp);
+
+    lv_obj_t * scr1 = lv_disp_get_scr_act(disp);
+    lv_obj_t * scr2 = create_scr(LV_COLOR_SILVER);
+    lv_refr_now(disp);
+
+    lv_test_print("");
+    lv_test_print("Load a screen from its snapshot:");
+    lv_test_print("--------------------------------");
+
+    lv_test_assert_int_eq(LV_RES_OK, lv_scr_snapshot_enable(scr2), "Snapshot enabled");
+    lv_test_assert_int_eq(LV_RES_OK, lv_scr_snapshot_update(scr2), "Snapshot rendered");
+    lv_test_assert_int_eq(1, lv_scr_snapshot_is_ready(scr2), "Snapshot is ready");
+    lv_test_assert_int_lt(SNAPSHOT_PX_CNT * sizeof(lv_color_t), lv_scr_snapshot_get_size(scr2),
+                          "The snapshot is compressed");
+
+    flush_cnt = 0;
+    redrawn_px = 0;
+    lv_scr_load(scr2);
+    lv_refr_now(disp);
+    lv_test_assert_int_eq(SNAPSHOT_VER_RES / 8, flush_cnt, "The snapshot is flushed in buffer sized bands");
+    lv_test_assert_int_eq(0, redrawn_px, "Nothing is redrawn");
+    compare_with_redraw(disp);
+
+    lv_test_print("");
+    lv_test_print("Redraw what has changed since the snapshot:");
+    lv_test_print("-------------------------------------------");
+
+    /*Redrawing the loaded screen has made its snapshot outdated*/
+    lv_scr_load(scr1);
+    lv_refr_now(disp);
+    lv_test_assert_int_eq(LV_RES_OK, lv_scr_snapshot_update(scr2), "Snapshot rendered again");
+
+    lv_obj_t * rect = lv_obj_get_child(scr2, NULL);
+    lv_obj_set_pos(rect, 30, 25);
+    lv_refr_now(disp);
+    lv_test_assert_int_eq(0, lv_scr_snapshot_is_ready(scr2), "Snapshot is outdated");
+
+    /*Something on the top layer is drawn on the snapshot*/
+    lv_obj_t * top = lv_obj_create(lv_disp_get_layer_top(disp), NULL);
+    lv_obj_reset_style_list(top, LV_OBJ_PART_MAIN);
+    lv_obj_set_style_local_bg_color(top, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLUE);
+    lv_obj_set_style_local_bg_opa(top, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+    lv_obj_set_pos(top, 2, 30);
+    lv_obj_set_size(top, 6, 6);
+    lv_refr_now(disp);
+
+    redrawn_px = 0;
+    lv_scr_load(scr2);
+    lv_refr_now(disp);
+    lv_test_assert_int_gt(0, redrawn_px, "The changed area is redrawn");
+    lv_test_assert_int_lt(SNAPSHOT_PX_CNT / 2, redrawn_px, "Only the changed area is redrawn");
+    compare_with_redraw(disp);
+
+    lv_test_print("");
+    lv_test_print("Render the snapshot when idle:");
+    lv_test_print("------------------------------");
+
+    lv_scr_load(scr1);
+    lv_refr_now(disp);
+    lv_task_ready(disp->snapshot_task);
+    lv_task_handler();
+    lv_test_assert_int_eq(0, lv_scr_snapshot_is_ready(scr2), "Only a strip is rendered in a task run");
+
+    uint32_t run_cnt = 1 + render_in_task(disp, scr2);
+    lv_test_assert_int_eq(1, lv_scr_snapshot_is_ready(scr2), "Snapshot is ready");
+    lv_test_assert_int_gt(2, run_cnt, "The snapshot is rendered in strips");
+
+    flush_cnt = 0;
+    redrawn_px = 0;
+    lv_scr_load(scr2);
+    lv_refr_now(disp);
+    lv_test_assert_int_eq(SNAPSHOT_VER_RES / 8 + 1, flush_cnt, "The snapshot and the top layer are flushed");
+    lv_test_assert_int_eq(6 * 6, redrawn_px, "Only the top layer is redrawn");
+    compare_with_redraw(disp);
+
+    lv_test_print("");
+    lv_test_print("Render the snapshot again if a rendered strip changes:");
+    lv_test_print("-----------------------------------------------------");
+
+    lv_scr_load(scr1);
+    lv_refr_now(disp);
+    rect = lv_obj_get_child_back(scr2, NULL);
+    lv_obj_set_style_local_bg_color(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_RED);
+    lv_refr_now(disp);
+    lv_task_ready(disp->snapshot_task);
+    lv_task_handler();
+
+    /*The first strip has the old color*/
+    lv_obj_set_style_local_bg_color(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_YELLOW);
+    lv_test_assert_int_eq(run_cnt, render_in_task(disp, scr2), "The rendering is started again");
+
+    redrawn_px = 0;
+    lv_scr_load(scr2);
+    lv_refr_now(disp);
+    lv_test_assert_int_eq(6 * 6, redrawn_px, "Only the top layer is redrawn");
+    compare_with_redraw(disp);
+
+    lv_test_print("");
+    lv_test_print("Keep the separate changed areas:");
+    lv_test_print("--------------------------------");
+
+    lv_scr_load(scr1);
+    lv_refr_now(disp);
+    lv_test_assert_int_eq(LV_RES_OK, lv_scr_snapshot_update(scr2), "Snapshot rendered again");
+
+    /*The first and the last rectangles are in the opposite corners*/
+    lv_obj_t * rect_last = lv_obj_get_child(scr2, NULL);
+    lv_obj_set_style_local_bg_color(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_LIME);
+    lv_obj_set_style_local_bg_color(rect_last, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_LIME);
+
+    lv_area_t bounds;
+    _lv_area_join(&bounds, &rect->coords, &rect_last->coords);
+    redrawn_px = 0;
+    lv_scr_load(scr2);
+    lv_refr_now(disp);
+    lv_test_assert_int_lt(lv_area_get_size(&bounds) / 2, redrawn_px, "Only the changed rectangles are redrawn");
+    compare_with_redraw(disp);
+
+    lv_obj_del(top);
+    lv_scr_load(scr1);
+    lv_obj_del(scr2);
+    lv_test_assert_int_eq(0, lv_scr_snapshot_is_ready(scr1), "No snapshot after deleting the screen");
+
+    /*Deleting the objects invalidates the display so delete the refresher task last*/
+    lv_obj_del(disp->act_scr);
+    lv_obj_del(disp->top_layer);
+    lv_obj_del(disp->sys_layer);
+    lv_task_del(disp->refr_task);
+    lv_disp_remove(disp);
+
+    lv_disp_set_default(def_disp);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_SCR_SNAPSHOT
+static lv_obj_t * create_scr(lv_color_t bg_color)
+{
+    lv_obj_t * scr = lv_obj_create(NULL, NULL);
+    lv_obj_reset_style_list(scr, LV_OBJ_PART_MAIN);
+    lv_obj_set_style_local_bg_color(scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, bg_color);
+    lv_obj_set_style_local_bg_opa(scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+
+    /*Rectangles with different colors make a wrong snapshot visible*/
+    lv_color_t colors[] = {LV_COLOR_GREEN, LV_COLOR_NAVY, LV_COLOR_ORANGE, LV_COLOR_PURPLE};
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        lv_obj_t * rect = lv_obj_create(scr, NULL);
+        lv_obj_reset_style_list(rect, LV_OBJ_PART_MAIN);
+        lv_obj_set_style_local_bg_color(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, colors[i % 4]);
+        lv_obj_set_style_local_bg_opa(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+        lv_obj_set_style_local_radius(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 3);
+        lv_obj_set_pos(rect, (i % 4) * 12 + 1, (i / 4) * 18 + 2);
+        lv_obj_set_size(rect, 9, 7 + i);
+    }
+
+    return scr;
+}
+
+/**
+ * Compare what the display shows with the redrawn screen
+ */
+static void compare_with_redraw(lv_disp_t * disp)
+{
+    _lv_memcpy(loaded_frame, panel, sizeof(panel));
+
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    lv_refr_now(disp);
+    lv_test_assert_array_eq((uint8_t *)panel, (uint8_t *)loaded_frame, sizeof(panel), "Same as redrawing the screen");
+}
+
+/**
+ * Run the snapshot task until the snapshot of a screen is ready
+ * @return number of task runs
+ */
+static uint32_t render_in_task(lv_disp_t * disp, lv_obj_t * scr)
+{
+    uint32_t cnt = 0;
+    while(!lv_scr_snapshot_is_ready(scr) && cnt < SNAPSHOT_VER_RES) {
+        /*The snapshot is rendered only if the display is idle*/
+        lv_refr_now(disp);
+        lv_task_ready(disp->snapshot_task);
+        lv_task_handler();
+        cnt++;
+    }
+
+    return cnt;
+}
+
+static void flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        _lv_memcpy(&panel[y * SNAPSHOT_HOR_RES + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+
+    flush_cnt++;
+    lv_disp_flush_ready(disp_drv);
+}
+
+static void monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(time);
+
+    redrawn_px += px;
+}
+#endif
+
+#endif
@@ -29,6 +29,10 @@ static void cascade(void);
 static void copy(void);
 static void states(void);
 static void mem_leak(void);
+#if LV_USE_STYLE_INDEX
+static void style_index(void);
+static uint32_t get_ref_cnt(const lv_style_t * style);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -55,6 +59,9 @@ void lv_test_style(void)
     copy();
     states();
     mem_leak();
+#if LV_USE_STYLE_INDEX
+    style_index();
+#endif
 }
 
 /**********************
@@ -621,4 +628,74 @@ static void mem_leak(void)
     lv_mem_monitor(&mon_end);
     lv_test_assert_int_lt(sizeof(void*) * 8, mon_start.free_size - mon_end.free_size, "Style memory leak");
 }
+#if LV_USE_STYLE_INDEX
+static void style_index(void)
+{
+    lv_test_print("");
+    lv_test_print("Test the users of a style:");
+    lv_test_print("--------------------------");
+
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_radius(&style, LV_STATE_DEFAULT, 0);
+
+    lv_obj_t * obj1 = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_t * obj2 = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_t * obj3 = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_t * slider = lv_slider_create(lv_scr_act(), NULL);
+
+    lv_obj_set_style_local_radius(obj1, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 5);
+    lv_obj_add_style(obj1, LV_OBJ_PART_MAIN, &style);
+    lv_obj_add_style(obj2, LV_OBJ_PART_MAIN, &style);
+    lv_obj_add_style(slider, LV_SLIDER_PART_KNOB, &style);
+
+    lv_test_assert_int_eq(3, get_ref_cnt(&style), "Users after adding the style");
+    lv_test_assert_ptr_eq(slider, style.refs->obj, "Object of the last user");
+    lv_test_assert_int_eq(LV_SLIDER_PART_KNOB, style.refs->part, "Part of the last user");
+
+    lv_obj_t * obj4 = lv_obj_create(lv_scr_act(), obj2);
+    lv_test_assert_int_eq(4, get_ref_cnt(&style), "Users after copying an object");
+
+    lv_obj_get_style_radius(obj2, LV_OBJ_PART_MAIN);
+    lv_style_reset(&style);
+    lv_test_assert_int_eq(0, get_ref_cnt(&style), "The users are unlinked by resetting the style");
+    lv_style_set_radius(&style, LV_STATE_DEFAULT, 10);
+    lv_obj_report_style_mod(&style);
+    lv_test_assert_int_eq(4, get_ref_cnt(&style), "The users are linked again by reporting the reset style");
+    lv_test_assert_int_eq(10, lv_obj_get_style_radius(obj2, LV_OBJ_PART_MAIN), "Modified property is reported");
+    lv_test_assert_int_eq(5, lv_obj_get_style_radius(obj1, LV_OBJ_PART_MAIN), "Local property is kept");
+
+    lv_obj_remove_style(obj2, LV_OBJ_PART_MAIN, &style);
+    lv_test_assert_int_eq(3, get_ref_cnt(&style), "Users after removing the style");
+
+    /*The unlinked users can be unlinked again*/
+    lv_style_reset(&style);
+    lv_obj_remove_style(slider, LV_SLIDER_PART_KNOB, &style);
+    lv_test_assert_int_eq(0, get_ref_cnt(&style), "Users after removing the reset style");
+
+    lv_style_set_radius(&style, LV_STATE_DEFAULT, 20);
+    lv_obj_report_style_mod(&style);
+    lv_test_assert_int_eq(2, get_ref_cnt(&style), "Users after reporting the reset style again");
+    lv_test_assert_int_eq(20, lv_obj_get_style_radius(obj4, LV_OBJ_PART_MAIN),
+                          "Modified property is reported after reset");
+
+    lv_obj_del(obj1);
+    lv_obj_del(obj4);
+    lv_obj_del(slider);
+    lv_test_assert_int_eq(0, get_ref_cnt(&style), "Users after deleting the objects");
+
+    lv_obj_del(obj2);
+    lv_obj_del(obj3);
+    lv_style_reset(&style);
+}
+
+static uint32_t get_ref_cnt(const lv_style_t * style)
+{
+    uint32_t cnt = 0;
+    lv_style_ref_t * ref;
+    for(ref = style->refs; ref; ref = ref->next) cnt++;
+    return cnt;
+}
+#endif
+
 #endif
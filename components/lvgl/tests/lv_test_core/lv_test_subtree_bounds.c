@@ -0,0 +1,157 @@
+/**
+ * @file lv_test_subtree_bounds.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_subtree_bounds.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_SUBTREE_BOUNDS
+static lv_obj_t * create_rect(lv_obj_t * parent, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h);
+static void check_bounds(lv_obj_t * obj, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2,
+                         const char * s);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_subtree_bounds(void)
+{
+#if LV_USE_SUBTREE_BOUNDS
+    lv_test_print("");
+    lv_test_print("=============================");
+    lv_test_print("Start lv_subtree_bounds tests");
+    lv_test_print("=============================");
+
+    lv_test_print("");
+    lv_test_print("Follow the changes of the children:");
+    lv_test_print("-----------------------------------");
+
+    lv_obj_t * cont = create_rect(lv_scr_act(), 10, 10, 200, 200);
+    lv_area_t bounds;
+    lv_test_assert_int_eq(0, _lv_obj_get_subtree_bounds(cont, &bounds), "No bounds without children");
+
+    lv_obj_t * child1 = create_rect(cont, 5, 5, 20, 20);
+    lv_obj_t * child2 = create_rect(cont, 50, 60, 30, 30);
+    lv_obj_t * child3 = create_rect(cont, 150, 150, 10, 10);
+    lv_obj_set_hidden(child3, true);
+    check_bounds(cont, 15, 15, 89, 99, "The visible children are in the bounds");
+
+    /*The grandchildren are clipped to the children so they don't count*/
+    create_rect(child1, 30, 30, 100, 100);
+    check_bounds(cont, 15, 15, 89, 99, "The grandchildren are not in the bounds");
+
+    lv_obj_set_pos(cont, 20, 30);
+    check_bounds(cont, 25, 35, 99, 119, "Follow the parent");
+
+    lv_obj_set_pos(child2, 100, 60);
+    check_bounds(cont, 25, 35, 149, 119, "Follow a moved child");
+
+    lv_obj_set_size(child2, 10, 10);
+    check_bounds(cont, 25, 35, 129, 99, "Follow a resized child");
+
+    lv_obj_set_hidden(child3, false);
+    check_bounds(cont, 25, 35, 179, 189, "Follow a shown child");
+
+    lv_obj_set_style_local_shadow_width(child1, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 10);
+    lv_obj_set_style_local_shadow_opa(child1, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+    lv_obj_set_style_local_bg_opa(child1, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
+    lv_coord_t pad = child1->ext_draw_pad;
+    lv_test_assert_int_gt(0, pad, "The shadow needs extra draw size");
+    check_bounds(cont, 25 - pad, 35 - pad, 179, 189, "Include the extra draw size");
+
+    lv_obj_t * cont2 = create_rect(lv_scr_act(), 0, 0, 50, 50);
+    lv_obj_set_parent(child3, cont2);
+    check_bounds(cont, 25 - pad, 35 - pad, 129, 99, "Follow a child moved to an other parent");
+    check_bounds(cont2, 150, 150, 159, 159, "Include the child on the new parent");
+
+    lv_obj_del(child1);
+    lv_obj_del(child2);
+    lv_test_assert_int_eq(0, _lv_obj_get_subtree_bounds(cont, &bounds), "No bounds after deleting the children");
+
+    lv_obj_clean(lv_scr_act());
+
+#if LV_USE_CONT
+    lv_test_print("");
+    lv_test_print("Follow the fit of the containers:");
+    lv_test_print("---------------------------------");
+
+    lv_obj_t * holder = create_rect(lv_scr_act(), 10, 10, 200, 200);
+    lv_obj_t * fit = lv_cont_create(holder, NULL);
+    lv_obj_reset_style_list(fit, LV_CONT_PART_MAIN);
+    lv_obj_refresh_ext_draw_pad(fit);
+    lv_obj_set_pos(fit, 20, 20);
+    lv_cont_set_fit(fit, LV_FIT_TIGHT);
+    lv_obj_t * fit_child = create_rect(fit, 0, 0, 20, 20);
+    check_bounds(holder, 30, 30, 49, 49, "The fitted container is in the bounds");
+
+    lv_obj_set_size(fit_child, 20, 100);
+    check_bounds(holder, 30, 30, 49, 129, "Follow a container grown by its fit");
+
+    lv_obj_set_x(fit_child, -10);
+    check_bounds(holder, 20, 30, 39, 129, "Follow a container moved by its fit");
+
+    lv_obj_clean(lv_scr_act());
+#endif
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_SUBTREE_BOUNDS
+static lv_obj_t * create_rect(lv_obj_t * parent, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h)
+{
+    lv_obj_t * obj = lv_obj_create(parent, NULL);
+    lv_obj_reset_style_list(obj, LV_OBJ_PART_MAIN);
+    lv_obj_refresh_ext_draw_pad(obj);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+
+    return obj;
+}
+
+static void check_bounds(lv_obj_t * obj, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2,
+                         const char * s)
+{
+    lv_area_t bounds;
+    lv_area_t exp;
+    lv_area_set(&exp, x1, y1, x2, y2);
+#if LV_USE_LAYOUT_DEFER
+    /*The fit of the containers is refreshed before drawing too*/
+    lv_obj_update_layout();
+#endif
+    _lv_memset_00(&bounds, sizeof(bounds));
+    _lv_obj_get_subtree_bounds(obj, &bounds);
+    lv_test_assert_array_eq((const uint8_t *)&exp, (const uint8_t *)&bounds, sizeof(lv_area_t), s);
+}
+#endif
+
+#endif
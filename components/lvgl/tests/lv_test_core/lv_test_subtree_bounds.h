@@ -0,0 +1,38 @@
+/**
+ * @file lv_test_subtree_bounds.h
+ *
+ */
+
+#ifndef LV_TEST_SUBTREE_BOUNDS_H
+#define LV_TEST_SUBTREE_BOUNDS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void lv_test_subtree_bounds(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_SUBTREE_BOUNDS_H*/
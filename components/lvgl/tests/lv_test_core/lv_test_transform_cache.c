@@ -0,0 +1,124 @@
+/**
+ * @file lv_test_transform_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_transform_cache.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CANVAS_X    10
+#define CANVAS_Y    10
+#define CANVAS_W    20
+#define CANVAS_H    20
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_CANVAS && LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+static lv_color_t get_center_px(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_CANVAS && LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+static uint8_t canvas_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(CANVAS_W, CANVAS_H)];
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_transform_cache(void)
+{
+#if LV_USE_CANVAS && LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+    lv_test_print("");
+    lv_test_print("==============================");
+    lv_test_print("Start lv_transform_cache tests");
+    lv_test_print("==============================");
+
+    lv_test_print("");
+    lv_test_print("Redraw the modified canvases:");
+    lv_test_print("-----------------------------");
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act(), NULL);
+    lv_canvas_set_buffer(canvas, canvas_buf, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR);
+    lv_obj_set_pos(canvas, CANVAS_X, CANVAS_Y);
+    lv_img_set_zoom(canvas, 512);
+    lv_canvas_fill_bg(canvas, LV_COLOR_RED, LV_OPA_COVER);
+
+    lv_test_assert_color_eq(LV_COLOR_RED, get_center_px(), "Draw the zoomed canvas");
+    lv_test_assert_color_eq(LV_COLOR_RED, get_center_px(), "Draw the zoomed canvas from the cache");
+
+    lv_canvas_fill_bg(canvas, LV_COLOR_BLUE, LV_OPA_COVER);
+    lv_test_assert_color_eq(LV_COLOR_BLUE, get_center_px(), "Redraw the canvas after filling it");
+
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < CANVAS_H; y++) {
+        for(x = 0; x < CANVAS_W; x++) {
+            lv_canvas_set_px(canvas, x, y, LV_COLOR_LIME);
+        }
+    }
+    lv_test_assert_color_eq(LV_COLOR_LIME, get_center_px(), "Redraw the canvas after setting its pixels");
+
+    lv_test_print("");
+    lv_test_print("Redraw the modified image variables:");
+    lv_test_print("------------------------------------");
+
+    /*Modify the buffer directly as the user would do it with an image variable*/
+    lv_color_t * px = (lv_color_t *)canvas_buf;
+    uint32_t i;
+    for(i = 0; i < CANVAS_W * CANVAS_H; i++) px[i] = LV_COLOR_RED;
+
+    lv_img_cache_invalidate_src(lv_canvas_get_img(canvas));
+    lv_test_assert_color_eq(LV_COLOR_RED, get_center_px(), "Redraw the image after invalidating it");
+
+    lv_obj_del(canvas);
+
+#if LV_IMG_TRANSFORM_CACHE_ANGLE_STEP > 1
+    lv_test_print("");
+    lv_test_print("Invalidate the area of the rounded angle:");
+    lv_test_print("-----------------------------------------");
+
+    /*Rounded up to a larger area*/
+    int16_t angle = LV_IMG_TRANSFORM_CACHE_ANGLE_STEP / 2;
+    lv_point_t pivot = {100, 100};
+    lv_area_t area_round;
+    lv_area_t area;
+    _lv_img_buf_get_transformed_area(&area_round, 200, 200, _lv_img_cache_round_angle(angle), LV_IMG_ZOOM_NONE, &pivot);
+    _lv_img_buf_get_transformed_area(&area, 200, 200, angle, LV_IMG_ZOOM_NONE, &pivot);
+    lv_test_assert_true(_lv_area_is_in(&area_round, &area, 0), "The area includes the cached transformation");
+#endif
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_CANVAS && LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_SIZE
+static lv_color_t get_center_px(void)
+{
+    return lv_test_get_px(CANVAS_X + CANVAS_W / 2, CANVAS_Y + CANVAS_H / 2);
+}
+#endif
+
+#endif
@@ -3,6 +3,9 @@
 #include <stdlib.h>
 #include "lv_test_core/lv_test_core.h"
 #include "lv_test_widgets/lv_test_label.h"
+#include "lv_test_widgets/lv_test_chart.h"
+#include "lv_test_widgets/lv_test_list.h"
+#include "lv_test_widgets/lv_test_table.h"
 
 #if LV_BUILD_TEST
 #include <sys/time.h>
@@ -21,6 +24,9 @@ int main(void)
 
     lv_test_core();
     lv_test_label();
+    lv_test_chart();
+    lv_test_list();
+    lv_test_table();
 
     printf("Exit with success!\n");
     return 0;
@@ -0,0 +1,194 @@
+/**
+ * @file lv_test_chart.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_chart.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CHART_X     10
+#define CHART_Y     5
+#define CHART_W     50
+#define CHART_H     50
+#define POINT_CNT   200
+
+/*Pixel of the screen relative to the chart*/
+#define CHART_PX(x, y)  lv_test_get_px(CHART_X + (x), CHART_Y + (y))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_CHART
+static void set_next_array(void);
+static void decimation(void);
+static void shift_invalidation(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_CHART
+static lv_coord_t points[POINT_CNT];
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_chart(void)
+{
+    lv_test_print("");
+    lv_test_print("===================");
+    lv_test_print("Start lv_chart tests");
+    lv_test_print("===================");
+
+#if LV_USE_CHART
+    set_next_array();
+    decimation();
+    shift_invalidation();
+#else
+    lv_test_print("Skip chart test: LV_USE_CHART == 0");
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_CHART
+static void set_next_array(void)
+{
+    lv_test_print("");
+    lv_test_print("Add more points at once:");
+    lv_test_print("------------------------");
+
+    lv_obj_t * chart = lv_chart_create(lv_scr_act(), NULL);
+    lv_chart_set_point_count(chart, 5);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, LV_COLOR_RED);
+    lv_chart_init_points(chart, ser, 0);
+
+    const lv_coord_t y1[] = {1, 2, 3};
+    lv_chart_set_next_array(chart, ser, y1, 3);
+    lv_test_assert_int_eq(1, lv_chart_get_point_id(chart, ser, 0), "First point of the first array");
+    lv_test_assert_int_eq(3, lv_chart_get_point_id(chart, ser, 2), "Last point of the first array");
+    lv_test_assert_int_eq(0, lv_chart_get_point_id(chart, ser, 3), "The next point is not set yet");
+    lv_test_assert_int_eq(3, lv_chart_get_x_start_point(ser), "Start point after the first array");
+
+    const lv_coord_t y2[] = {4, 5, 6};
+    lv_chart_set_next_array(chart, ser, y2, 3);
+    lv_test_assert_int_eq(5, lv_chart_get_point_id(chart, ser, 4), "The second array is stored to the end");
+    lv_test_assert_int_eq(6, lv_chart_get_point_id(chart, ser, 0), "The second array wraps around");
+    lv_test_assert_int_eq(2, lv_chart_get_point_id(chart, ser, 1), "The points after the wrap are kept");
+    lv_test_assert_int_eq(1, lv_chart_get_x_start_point(ser), "Start point after the second array");
+
+    /*Only the last `point_cnt` values are stored from longer arrays*/
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    const lv_coord_t y3[] = {10, 11, 12, 13, 14, 15, 16};
+    lv_chart_set_next_array(chart, ser, y3, 7);
+    lv_test_assert_int_eq(12, lv_chart_get_point_id(chart, ser, 1), "First stored point of a long array");
+    lv_test_assert_int_eq(15, lv_chart_get_point_id(chart, ser, 4), "Points of a long array before the wrap");
+    lv_test_assert_int_eq(16, lv_chart_get_point_id(chart, ser, 0), "Last point of a long array");
+    lv_test_assert_int_eq(1, lv_chart_get_x_start_point(ser), "A full array doesn't move the start point");
+
+    lv_obj_del(chart);
+}
+
+static void decimation(void)
+{
+    lv_test_print("");
+    lv_test_print("Draw the min/max of the decimated columns:");
+    lv_test_print("------------------------------------------");
+
+    lv_obj_t * chart = lv_chart_create(lv_scr_act(), NULL);
+    lv_obj_set_pos(chart, CHART_X, CHART_Y);
+    lv_obj_set_size(chart, CHART_W, CHART_H);
+    lv_obj_set_style_local_pad_all(chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_border_width(chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_bg_color(chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+    lv_obj_set_style_local_bg_opa(chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, LV_OPA_COVER);
+    lv_obj_set_style_local_line_width(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, 1);
+    lv_chart_set_div_line_count(chart, 0, 0);
+    lv_chart_set_point_count(chart, POINT_CNT);
+    lv_chart_set_decimation(chart, true);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, LV_COLOR_BLACK);
+
+    /*Every point is in the middle except a peak in column 25 and the last point*/
+    uint32_t i;
+    for(i = 0; i < POINT_CNT; i++) points[i] = 50;
+    points[100] = 90;
+    points[101] = 10;
+    points[POINT_CNT - 1] = 90;
+    lv_chart_set_next_array(chart, ser, points, POINT_CNT);
+
+    /*90 is drawn at y = 5, 50 at y = 25, 10 at y = 45 (relative to the series area)*/
+    lv_test_assert_color_eq(LV_COLOR_BLACK, CHART_PX(25, 10), "The min/max range of a column is drawn");
+    lv_test_assert_color_eq(LV_COLOR_BLACK, CHART_PX(25, 40), "The min/max range of a column is drawn");
+    lv_test_assert_color_eq(LV_COLOR_WHITE, CHART_PX(25, 2), "Nothing is drawn above the max");
+    lv_test_assert_color_eq(LV_COLOR_WHITE, CHART_PX(24, 10), "The peak is not drawn in the previous column");
+    lv_test_assert_color_eq(LV_COLOR_WHITE, CHART_PX(30, 10), "The peak is not drawn in later columns");
+    lv_test_assert_color_eq(LV_COLOR_BLACK, CHART_PX(30, 25), "The middle is drawn in the other columns");
+    lv_test_assert_color_eq(LV_COLOR_BLACK, CHART_PX(CHART_W - 1, 10), "The last point is drawn in the last column");
+    lv_test_assert_color_eq(LV_COLOR_WHITE, CHART_PX(CHART_W - 2, 10),
+                            "The last point is drawn only in the last column");
+
+    lv_obj_del(chart);
+}
+
+static void shift_invalidation(void)
+{
+    lv_test_print("");
+    lv_test_print("Invalidate only the band of a shifted series:");
+    lv_test_print("---------------------------------------------");
+
+    lv_obj_t * chart = lv_chart_create(lv_scr_act(), NULL);
+    lv_obj_set_pos(chart, CHART_X, CHART_Y);
+    lv_obj_set_size(chart, CHART_W, CHART_H);
+    lv_obj_set_style_local_pad_all(chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_line_width(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, 1);
+    lv_obj_set_style_local_size(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_bg_opa(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, LV_OPA_TRANSP);
+    lv_chart_set_point_count(chart, 10);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, LV_COLOR_BLACK);
+    lv_chart_init_points(chart, ser, 80);
+    lv_refr_now(NULL);
+
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_test_assert_int_eq(0, disp->inv_p, "No invalid areas after refreshing");
+
+    /*80 is drawn at y = 10, 90 at y = 5 (relative to the series area)*/
+    lv_chart_set_next(chart, ser, 90);
+    lv_test_assert_int_eq(1, disp->inv_p, "One area is invalidated");
+    lv_test_assert_int_gt(CHART_Y, disp->inv_areas[0].y1, "The top of the series area is not invalidated");
+    lv_test_assert_int_lt(CHART_Y + 15, disp->inv_areas[0].y2, "The bottom of the series area is not invalidated");
+
+    /*Nothing is drawn for undefined points*/
+    lv_refr_now(NULL);
+    lv_chart_init_points(chart, ser, LV_CHART_POINT_DEF);
+    lv_refr_now(NULL);
+    lv_chart_set_next(chart, ser, LV_CHART_POINT_DEF);
+    lv_test_assert_int_eq(0, disp->inv_p, "Nothing is invalidated without visible points");
+
+    lv_obj_del(chart);
+    lv_refr_now(NULL);
+}
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @file lv_test_list.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_list.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ROW_CNT     100
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_LIST
+static void data_cb_visible_rows(void);
+static void scroll_to_row(lv_obj_t * list, uint16_t row);
+static void data_cb(lv_obj_t * list, lv_obj_t * btn, uint16_t row);
+static void req_reset(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_LIST
+static uint32_t req_cnt;
+static uint16_t req_min;
+static uint16_t req_max;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_list(void)
+{
+    lv_test_print("");
+    lv_test_print("===================");
+    lv_test_print("Start lv_list tests");
+    lv_test_print("===================");
+
+#if LV_USE_LIST
+    data_cb_visible_rows();
+#else
+    lv_test_print("Skip list test: LV_USE_LIST == 0");
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_LIST
+static void data_cb_visible_rows(void)
+{
+    lv_test_print("");
+    lv_test_print("Request only the visible rows:");
+    lv_test_print("------------------------------");
+
+    lv_obj_t * list = lv_list_create(lv_scr_act(), NULL);
+    lv_obj_set_size(list, 100, 100);
+
+    req_reset();
+    lv_list_set_data_cb(list, data_cb, ROW_CNT);
+
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    uint16_t pool_cnt = ext->data_pool_cnt;
+    lv_test_assert_int_eq(ROW_CNT, lv_list_get_size(list), "All rows are counted");
+    lv_test_assert_int_gt(0, pool_cnt, "Buttons are created for the visible rows");
+    lv_test_assert_int_lt(ROW_CNT, pool_cnt, "Buttons are not created for every row");
+    lv_test_assert_int_eq(pool_cnt, req_cnt, "Every button is filled once");
+    lv_test_assert_int_eq(0, req_min, "The first row is requested");
+    lv_test_assert_int_eq(pool_cnt - 1, req_max, "Only the rows of the buttons are requested");
+
+    lv_test_print("");
+    lv_test_print("Request the scrolled in rows:");
+    lv_test_print("-----------------------------");
+
+    req_reset();
+    scroll_to_row(list, 10);
+    lv_test_assert_int_gt(0, req_cnt, "Rows are requested after scrolling");
+    lv_test_assert_int_lt(pool_cnt + 1, req_cnt, "At most every button is refilled");
+    lv_test_assert_int_gt(10 - 1, req_min, "The rows scrolled out are not requested");
+    lv_test_assert_int_eq(10 + pool_cnt - 1, req_max, "The last row of the scrolled position is requested");
+
+    req_reset();
+    scroll_to_row(list, 11);
+    lv_test_assert_int_eq(1, req_cnt, "Scrolling by one row refills one button");
+    lv_test_assert_int_eq(11 + pool_cnt - 1, req_min, "Only the row scrolled in is requested");
+
+    lv_obj_del(list);
+}
+
+static void scroll_to_row(lv_obj_t * list, uint16_t row)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+    lv_style_int_t pad_top = lv_obj_get_style_pad_top(scrl, LV_CONT_PART_MAIN);
+    lv_obj_set_y(scrl, -(pad_top + row * ext->data_row_h));
+}
+
+static void data_cb(lv_obj_t * list, lv_obj_t * btn, uint16_t row)
+{
+    LV_UNUSED(list);
+
+    lv_label_set_text_fmt(lv_list_get_btn_label(btn), "Row %d", row);
+
+    req_cnt++;
+    if(row < req_min) req_min = row;
+    if(row > req_max) req_max = row;
+}
+
+static void req_reset(void)
+{
+    req_cnt = 0;
+    req_min = UINT16_MAX;
+    req_max = 0;
+}
+#endif
+
+#endif
@@ -0,0 +1,128 @@
+/**
+ * @file lv_test_table.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_table.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ROW_CNT     100
+#define COL_CNT     2
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_TABLE && LV_USE_PAGE
+static void data_cb_visible_rows(void);
+static void check_visible_rows(lv_obj_t * page, lv_obj_t * table);
+static void data_cb(lv_obj_t * table, uint16_t row, uint16_t col, char * buf, uint16_t buf_size);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_TABLE && LV_USE_PAGE
+static uint32_t req_cnt;
+static uint16_t req_min;
+static uint16_t req_max;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_table(void)
+{
+    lv_test_print("");
+    lv_test_print("===================");
+    lv_test_print("Start lv_table tests");
+    lv_test_print("===================");
+
+#if LV_USE_TABLE && LV_USE_PAGE
+    data_cb_visible_rows();
+#else
+    lv_test_print("Skip table test: LV_USE_TABLE == 0 or LV_USE_PAGE == 0");
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_TABLE && LV_USE_PAGE
+static void data_cb_visible_rows(void)
+{
+    lv_test_print("");
+    lv_test_print("Request only the visible cells:");
+    lv_test_print("-------------------------------");
+
+    lv_obj_t * page = lv_page_create(lv_scr_act(), NULL);
+    lv_obj_set_size(page, 200, 100);
+
+    lv_obj_t * table = lv_table_create(page, NULL);
+    lv_table_set_col_cnt(table, COL_CNT);
+    lv_table_set_data_cb(table, data_cb, ROW_CNT);
+    lv_test_assert_int_eq(ROW_CNT, lv_table_get_row_cnt(table), "All rows are counted");
+
+    check_visible_rows(page, table);
+
+    lv_test_print("");
+    lv_test_print("Request the scrolled in cells:");
+    lv_test_print("------------------------------");
+
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+    lv_obj_set_y(lv_page_get_scrollable(page), -20 * ext->data_row_h);
+    check_visible_rows(page, table);
+
+    lv_obj_del(page);
+}
+
+static void check_visible_rows(lv_obj_t * page, lv_obj_t * table)
+{
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+    lv_coord_t rows_y1 = table->coords.y1 + lv_obj_get_style_pad_top(table, LV_TABLE_PART_BG);
+    uint16_t first = (page->coords.y1 - rows_y1) / ext->data_row_h;
+    uint16_t last = (page->coords.y2 - rows_y1) / ext->data_row_h;
+
+    req_cnt = 0;
+    req_min = UINT16_MAX;
+    req_max = 0;
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    lv_test_assert_int_lt(ROW_CNT - 1, last, "Not every row is visible");
+    lv_test_assert_int_eq(first, req_min, "The first visible row is requested");
+    lv_test_assert_int_eq(last, req_max, "The last visible row is requested");
+    lv_test_assert_int_eq((last - first + 1) * COL_CNT, req_cnt, "Every visible cell is requested once");
+}
+
+static void data_cb(lv_obj_t * table, uint16_t row, uint16_t col, char * buf, uint16_t buf_size)
+{
+    LV_UNUSED(table);
+
+    lv_snprintf(buf, buf_size, "%d/%d", row, col);
+
+    req_cnt++;
+    if(row < req_min) req_min = row;
+    if(row > req_max) req_max = row;
+}
+#endif
+
+#endif
@@ -35,6 +35,9 @@ extern "C" {
  * so the buffer size can be divided by 8, e.g. see SSD1306 display size. */
 #if defined (CONFIG_CUSTOM_DISPLAY_BUFFER_SIZE)
 #define DISP_BUF_SIZE   CONFIG_CUSTOM_DISPLAY_BUFFER_BYTES
+#elif defined (CONFIG_LV_EPD_REFRESH_MANAGER)
+/* The refresh manager keeps its own framebuffers, LVGL renders in bands */
+#define DISP_BUF_SIZE  (LV_HOR_RES_MAX * 40)
 #else
 #if defined (CONFIG_LV_TFT_DISPLAY_CONTROLLER_ST7789)
 #define DISP_BUF_SIZE  (LV_HOR_RES_MAX * 40)
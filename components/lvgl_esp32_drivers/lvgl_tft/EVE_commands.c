@@ -61,8 +61,26 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 #include <stdarg.h>
 #endif
 
+#if defined (EVE_INT)
+#include "freertos/event_groups.h"
+#endif
+
 #define TAG_LOG "FT81X"
 
+#if defined (CONFIG_LV_FT81X_CMD_BUFFER)
+#if !defined (FT81X_ENABLE)
+#error "LV_FT81X_CMD_BUFFER requires REG_CMDB_WRITE of a FT81x or BT81x"
+#endif
+#define EVE_CMDB
+#define EVE_CMDB_SPACE_MAX	(EVE_CMDFIFO_SIZE - 4)	/* the co-processor FIFO can't be filled completely */
+#define EVE_CMDB_RESERVE	288		/* room for the largest command (header and a 250 character string) */
+#endif
+
+#if defined (EVE_INT)
+#define EVE_INT_TIMEOUT_MS	20		/* look at REG_CMD_READ again if INT_N stays silent this long */
+#define EVT_CMDEMPTY		(1UL << 0UL)
+#endif
+
 /* data structure for SPI reading that has (optional) space for inserted dummy byte */
 typedef struct _spi_read_data {
 #if defined(DISP_SPI_FULL_DUPLEX)
@@ -99,11 +117,27 @@ volatile uint16_t cmdOffset = 0x0000; /* offset for the 4k co-processor FIFO */
 volatile uint8_t cmd_burst = 0; /* flag to indicate cmd-burst is active */
 
 // Buffer for SPI transactions
+#if defined (EVE_CMDB)
+static uint8_t SPIBuffers[2][SPI_BUFFER_SIZE];	// one is sent by DMA while the next commands are collected in the other
+static uint8_t SPIBufferActive = 0;
+uint8_t *SPIBuffer = SPIBuffers[0];
+static uint16_t cmdbSpace = EVE_CMDB_SPACE_MAX;	// free bytes in the co-processor FIFO, tracked instead of reading REG_CMDB_SPACE
+#else
 uint8_t SPIBuffer[SPI_BUFFER_SIZE];				// must be in DMA capable memory if DMA is used!
+#endif
 uint16_t SPIBufferIndex = 0;
 disp_spi_send_flag_t SPIInherentSendFlags = 0;	// additional inherent SPI flags (for DIO/QIO mode switching)
 uint8_t SPIDummyReadBits = 0;					// Dummy bits for reading in DIO/QIO modes
 
+#if defined (EVE_INT)
+static EventGroupHandle_t eve_evts = NULL;		// EVT_CMDEMPTY is set by the INT_N interrupt
+#endif
+
+#if defined (EVE_CMDB)
+static void EVE_cmdb_reserve(uint16_t len);
+static void EVE_cmdb_send(void);
+#endif
+
 // Macros to make SPI use explicit and less verbose
 // (macros do obscure code a little but they also help code search and readability)
 
@@ -128,10 +162,24 @@ uint8_t SPIDummyReadBits = 0;					// Dummy bits for reading in DIO/QIO modes
 	BUFFER_SPI_BYTE((uint8_t)((addr) >> 8)) \
 	BUFFER_SPI_BYTE((uint8_t)(addr))
 
+#if defined (EVE_CMDB)
+// Buffer the write address of co-processor commands: REG_CMDB_WRITE appends them to the FIFO and starts their execution
+#define BUFFER_SPI_CMD_ADDRESS() \
+	BUFFER_SPI_WRITE_ADDRESS(REG_CMDB_WRITE)
+
+// Send buffer
+#define SEND_SPI_BUFFER() \
+	EVE_cmdb_send();
+#else
+// Buffer the write address of co-processor commands
+#define BUFFER_SPI_CMD_ADDRESS() \
+	BUFFER_SPI_WRITE_ADDRESS(EVE_RAM_CMD + cmdOffset)
+
 // Send buffer
 #define SEND_SPI_BUFFER() \
 	disp_spi_transaction(SPIBuffer, SPIBufferIndex, (disp_spi_send_flag_t)(DISP_SPI_SEND_QUEUED | SPIInherentSendFlags), NULL, 0, 0); \
 	SPIBufferIndex = 0;
+#endif
 
 // Wait for DMA queued SPI transactions to complete
 #define WAIT_SPI() \
@@ -315,6 +363,9 @@ uint8_t EVE_busy(void)
 		EVE_memWrite16(REG_CMD_WRITE, 0); /* set REG_CMD_WRITE to 0 */
 		EVE_memWrite32(REG_CMD_DL, 0);    /* reset REG_CMD_DL to 0 as required by the BT81x programming guide, should not hurt FT8xx */
 		cmdOffset = 0;
+#if defined (EVE_CMDB)
+		cmdbSpace = EVE_CMDB_SPACE_MAX;
+#endif
 		EVE_memWrite8(REG_CPURESET, 0);  /* set REG_CMD_WRITE to 0 to restart the co-processor engine*/
 
 		#if defined (BT81X_ENABLE)
@@ -346,6 +397,10 @@ uint8_t EVE_busy(void)
 
 		DELAY_MS(5); /* just to be safe */
 
+#if defined (EVE_CMDB)
+		cmdbSpace = EVE_memRead16(REG_CMDB_SPACE) & 0x0ffc; /* the flash commands above were queued past the tracking */
+#endif
+
 		#endif
 	}
 
@@ -376,9 +431,49 @@ void EVE_inc_cmdoffset(uint16_t increment)
 /* order the command co-processor to start processing its FIFO queue and do not wait for completion */
 void EVE_cmd_start(void)
 {
+#if defined (EVE_CMDB)
+	/* writing to REG_CMDB_WRITE already started the co-processor, REG_CMD_WRITE was advanced by EVE */
+#else
 	WAIT_SPI();
 
 	EVE_memWrite16(REG_CMD_WRITE, cmdOffset);
+#endif
+}
+
+
+/* wait until the co-processor executed all commands in its FIFO */
+void EVE_cmd_wait(void)
+{
+#if defined (EVE_INT)
+	if(eve_evts != NULL)
+	{
+		/* reading REG_INT_FLAGS clears CMDEMPTY and releases INT_N, so the FIFO running empty from now on causes a new edge */
+		/* the read is a polling transaction, all commands have been written to EVE at this point */
+		xEventGroupClearBits(eve_evts, EVT_CMDEMPTY);
+		EVE_memRead8(REG_INT_FLAGS);
+
+		if(EVE_busy())
+		{
+			while((xEventGroupWaitBits(eve_evts, EVT_CMDEMPTY, pdTRUE, pdTRUE, pdMS_TO_TICKS(EVE_INT_TIMEOUT_MS)) & EVT_CMDEMPTY) == 0)
+			{
+				if(!EVE_busy())	/* missed the edge, e.g. INT_N is not connected */
+				{
+					break;
+				}
+			}
+		}
+	}
+	else
+	{
+		while (EVE_busy());
+	}
+#else
+	while (EVE_busy());
+#endif
+
+#if defined (EVE_CMDB)
+	cmdbSpace = EVE_CMDB_SPACE_MAX;
+#endif
 }
 
 
@@ -386,14 +481,107 @@ void EVE_cmd_start(void)
 void EVE_cmd_execute(void)
 {
 	EVE_cmd_start();
-	while (EVE_busy());
+	EVE_cmd_wait();
 }
 
 
+#if defined (EVE_CMDB)
+/* make sure the co-processor FIFO can take "len" more bytes */
+static void EVE_cmdb_reserve(uint16_t len)
+{
+	if(len > cmdbSpace)
+	{
+		/* the co-processor has been working since the last update, ask how much it consumed */
+		cmdbSpace = EVE_memRead16(REG_CMDB_SPACE) & 0x0ffc;
+
+		if(len > cmdbSpace)
+		{
+			EVE_cmd_wait();
+		}
+	}
+
+	cmdbSpace -= len;
+}
+
+
+/* send the collected commands to REG_CMDB_WRITE and continue in the other buffer */
+static void EVE_cmdb_send(void)
+{
+	if(SPIBufferIndex <= 3)	/* nothing but the write address */
+	{
+		SPIBufferIndex = 0;
+		return;
+	}
+
+	EVE_cmdb_reserve(SPIBufferIndex - 3);
+
+	WAIT_SPI()	/* the transfer of the other buffer has to be done before it is filled again */
+	disp_spi_transaction(SPIBuffer, SPIBufferIndex, (disp_spi_send_flag_t)(DISP_SPI_SEND_QUEUED | SPIInherentSendFlags), NULL, 0, 0);
+
+	SPIBufferActive ^= 1;
+	SPIBuffer = SPIBuffers[SPIBufferActive];
+	SPIBufferIndex = 0;
+}
+
+
+/* in a cmd-burst, send the buffer if the next command might not fit anymore */
+static void EVE_cmdb_make_room(void)
+{
+	if(cmd_burst && SPIBufferIndex > SPI_BUFFER_SIZE - EVE_CMDB_RESERVE)
+	{
+		EVE_cmdb_send();
+		BUFFER_SPI_CMD_ADDRESS()
+	}
+}
+#endif
+
+
+#if defined (EVE_INT)
+static void IRAM_ATTR EVE_int_isr(void *arg)
+{
+	BaseType_t xResult;
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	xResult = xEventGroupSetBitsFromISR(eve_evts, EVT_CMDEMPTY, &xHigherPriorityTaskWoken);
+	/* the bits are set by the timer daemon task, switch to it only if it has a higher priority than the interrupted task */
+	if((xResult == pdPASS) && (xHigherPriorityTaskWoken == pdTRUE))
+	{
+		portYIELD_FROM_ISR();
+	}
+}
+
+
+/* let EVE signal an empty co-processor FIFO on INT_N */
+static void EVE_init_int(void)
+{
+	eve_evts = xEventGroupCreate();
+	if(eve_evts == NULL)
+	{
+		ESP_LOGE(TAG_LOG, "Failed to create the event group, polling the co-processor instead");
+		return;
+	}
+
+	gpio_config_t io_conf = {
+		.intr_type = GPIO_INTR_NEGEDGE,
+		.mode = GPIO_MODE_INPUT,
+		.pin_bit_mask = (1ULL << EVE_INT),
+		.pull_down_en = 0,
+		.pull_up_en = 1,	/* INT_N is open-drain by default */
+	};
+	ESP_ERROR_CHECK(gpio_config(&io_conf));
+	gpio_install_isr_service(0);
+	gpio_isr_handler_add(EVE_INT, EVE_int_isr, NULL);
+
+	EVE_memWrite8(REG_INT_MASK, EVE_INT_CMDEMPTY);
+	EVE_memWrite8(REG_INT_EN, 1);
+	EVE_memRead8(REG_INT_FLAGS);	/* clear the flags collected so far */
+}
+#endif
+
+
 /* begin a co-processor command, this is used for all non-display-list commands */
 void EVE_begin_cmd(uint32_t command)
 {
-	BUFFER_SPI_WRITE_ADDRESS(EVE_RAM_CMD + cmdOffset)
+	BUFFER_SPI_CMD_ADDRESS()
 	BUFFER_SPI_DWORD(command)
 
 	EVE_inc_cmdoffset(4);	// only count the command size - not the write address directive
@@ -477,7 +665,9 @@ void eve_spi_CMD_write(uint64_t addr, const uint8_t *data, uint16_t len)
 	// padding is another transaction and needs it's own address (this is a DMA requirement)
 	if(padding)
 	{
-		addr += len;
+#if !defined (EVE_CMDB)
+		addr += len;	/* REG_CMDB_WRITE is not incremented */
+#endif
 
 		uint8_t padData[4] = {0};
 		disp_spi_transaction(padData, padding, (disp_spi_send_flag_t)(DISP_SPI_SEND_QUEUED | DISP_SPI_ADDRESS_24 | SPIInherentSendFlags), NULL, (addr | MEM_WRITE_24), 0);
@@ -501,7 +691,12 @@ void block_transfer(const uint8_t *data, uint32_t len)
 		uint32_t block_len;
 		block_len = (bytes_left > BLOCK_TRANSFER_SIZE ? BLOCK_TRANSFER_SIZE : bytes_left);
 
+#if defined (EVE_CMDB)
+		EVE_cmdb_reserve((block_len + 3) & ~3);
+		eve_spi_CMD_write(REG_CMDB_WRITE, data, block_len);
+#else
 		eve_spi_CMD_write(EVE_RAM_CMD + cmdOffset, data, block_len);
+#endif
 
 		data += block_len;
 		bytes_left -= block_len;
@@ -1008,6 +1203,10 @@ uint8_t EVE_init(void)
 
 	EVE_get_cmdoffset(); /* just to be safe */
 
+#if defined (EVE_INT)
+	EVE_init_int();
+#endif
+
 #if defined (EVE_DMA)
 	EVE_init_dma(); /* prepare DMA */
 #endif
@@ -1026,7 +1225,7 @@ void EVE_start_cmd_burst(void)
 	cmd_burst = 42;
 
 	WAIT_SPI()	// it is important to wait before writing to the SPI buffer as it might be in a DMA transaction
-	BUFFER_SPI_WRITE_ADDRESS(EVE_RAM_CMD + cmdOffset)
+	BUFFER_SPI_CMD_ADDRESS()
 }
 
 
@@ -1044,8 +1243,14 @@ void EVE_start_cmd(uint32_t command)
 	if(!cmd_burst)
 	{
 		WAIT_SPI()	// it is important to wait before writing to the SPI buffer as it might be in a DMA transaction
-		BUFFER_SPI_WRITE_ADDRESS(EVE_RAM_CMD + cmdOffset)
+		BUFFER_SPI_CMD_ADDRESS()
 	}
+#if defined (EVE_CMDB)
+	else
+	{
+		EVE_cmdb_make_room();
+	}
+#endif
 
 	BUFFER_SPI_DWORD(command)
 
@@ -1067,6 +1272,9 @@ void EVE_cmd_dl(uint32_t command)
 {
 	if(cmd_burst)
 	{
+#if defined (EVE_CMDB)
+		EVE_cmdb_make_room();
+#endif
 		BUFFER_SPI_DWORD(command)
 
 		EVE_inc_cmdoffset(4); /* update the command-ram pointer */
@@ -1496,6 +1704,9 @@ void EVE_cmd_clock(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_
 
 void EVE_color_rgb(uint8_t red, uint8_t green, uint8_t blue)
 {
+#if defined (EVE_CMDB)
+	EVE_cmdb_make_room();
+#endif
 	BUFFER_SPI_BYTE(green)	/* low-byte */
 	BUFFER_SPI_BYTE(blue)
 	BUFFER_SPI_BYTE(red)
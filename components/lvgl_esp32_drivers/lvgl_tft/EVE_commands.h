@@ -79,6 +79,7 @@ void EVE_cmd_mediafifo(uint32_t ptr, uint32_t size);
 
 void EVE_cmd_start(void);
 void EVE_cmd_execute(void);
+void EVE_cmd_wait(void);
 
 void EVE_start_cmd_burst(void);
 void EVE_end_cmd_burst(void);
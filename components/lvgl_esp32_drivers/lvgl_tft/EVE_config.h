@@ -49,6 +49,9 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 #define EVE_MOSI	DISP_SPI_MOSI				// green
 #define EVE_CS 		DISP_SPI_CS					// blue
 #define EVE_PDN		CONFIG_LV_DISP_PIN_RST		// grey
+#if defined (CONFIG_LV_FT81X_USE_INT_PIN)
+#define EVE_INT		CONFIG_LV_FT81X_PIN_INT
+#endif
 
 #define SPI_TRANSER_SIZE (DISP_BUF_SIZE * (LV_COLOR_DEPTH / 8))
 
@@ -56,7 +59,11 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 #define BYTES_PER_LINE (EVE_HSIZE * BYTES_PER_PIXEL)
 #define SCREEN_BUFFER_SIZE (EVE_HSIZE * EVE_VSIZE * BYTES_PER_PIXEL)
 
+#if defined (CONFIG_LV_FT81X_CMD_BUFFER)
+#define SPI_BUFFER_SIZE CONFIG_LV_FT81X_CMD_BUFFER_SIZE	// the commands are collected and sent to REG_CMDB_WRITE at once
+#else
 #define SPI_BUFFER_SIZE 256				// size in bytes (multiples of 4) of SPI transaction buffer for streaming commands
+#endif
 
 /* select the settings for the TFT attached */
 #if 0
@@ -4,6 +4,7 @@
 #include "driver/gpio.h"
 
 #include "FT81x.h"
+#include "FT81x_dl.h"
 
 #include "EVE.h"
 #include "EVE_commands.h"
@@ -20,9 +21,6 @@
 #define WHITE	0xffffffUL
 #define BLACK	0x000000UL
 
-/* memory-map defines */
-#define SCREEN_BITMAP_ADDR	0x00000000	// full screen buffer (0x00000000 - 0x000‭‭BBE40‬)
-
 uint8_t tft_active = 0;
 
 void touch_calibrate(void)
@@ -320,4 +318,12 @@ void TFT_WriteBitmap(uint8_t* Bitmap, uint16_t X, uint16_t Y, uint16_t Width, ui
 void FT81x_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map)
 {
 	TFT_WriteBitmap((uint8_t*)color_map, area->x1, area->y1, lv_area_get_width(area), lv_area_get_height(area));
-}
\ No newline at end of file
+
+#if defined (CONFIG_LV_FT81X_DISPLAY_LIST)
+	// the screen may show a display list, switch back to the bitmap when all of it is written
+	if(lv_disp_flush_is_last(drv))
+	{
+		FT81x_dl_show_bitmap();
+	}
+#endif
+}
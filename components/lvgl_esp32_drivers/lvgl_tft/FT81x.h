@@ -10,8 +10,14 @@
 #endif
 #include "../lvgl_helpers.h"
 
+/* memory-map defines */
+#define SCREEN_BITMAP_ADDR	0x00000000	// full screen buffer (0x00000000 - 0x000‭‭BBE40‬)
+
 void FT81x_init(void);
 
+// set the display list which shows the fullscreen bitmap
+void TFT_bitmap_display(void);
+
 void FT81x_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map);
 
 #endif /* FT81X_H_ */
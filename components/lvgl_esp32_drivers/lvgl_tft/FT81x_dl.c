@@ -0,0 +1,826 @@
+/**
+ * @file FT81x_dl.c
+ *
+ * The display list is composed here in RAM and written to RAM_DL with one
+ * burst at the end of the frame, then swapped with REG_DLSWAP.
+ *
+ * - Rectangles are RECTS with the corner radius as LINE_WIDTH. Borders and
+ *   outlines are rings: the inner area is masked out with the stencil buffer.
+ * - Lines are RECTS if they are horizontal or vertical, else LINES.
+ * - Letters: the ASCII glyphs of a font are rendered once into same sized L4
+ *   cells in RAM_G and drawn with a bitmap handle per font and CELL.
+ * - Images in flash (TRUE_COLOR, TRUE_COLOR_ALPHA, ALPHA_8BIT) are converted
+ *   and uploaded to RAM_G at their first use.
+ *
+ * Everything else (shadows, gradients, masks, transformed images, ...) makes
+ * the callbacks fail, and LVGL renders the frame into bitmaps as usual.
+ * RAM_G above the fullscreen bitmap is used for the fonts and images.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <string.h>
+
+#include "esp_log.h"
+#include "soc/soc_memory_layout.h"
+#include "sdkconfig.h"
+
+#include "FT81x_dl.h"
+
+#if defined (CONFIG_LV_FT81X_DISPLAY_LIST)
+
+#include "EVE.h"
+#include "EVE_commands.h"
+#include "disp_spi.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TAG_LOG "FT81x_dl"
+
+#define DL_SIZE         (EVE_RAM_DL_SIZE / 4)
+#define DL_RESERVED     2       /* Room for the closing commands */
+
+/* Start of the fonts and images in RAM_G */
+#define ASSET_ADDR      ((SCREEN_BITMAP_ADDR + SCREEN_BUFFER_SIZE + 3) & ~3UL)
+
+/* Handle 0 is reconfigured for every image, the fonts get 1..14.
+ * Handle 15 is used by the co-processor. */
+#define IMG_HANDLE      0
+#define FONT_CNT        14
+
+#define GLYPH_FIRST     0x20
+#define GLYPH_LAST      0x7E
+#define GLYPH_CNT       (GLYPH_LAST - GLYPH_FIRST + 1)
+
+/* Uploads are converted in this buffer. A glyph cell has to fit into it. */
+#define STAGE_SIZE      2048
+
+/* Vertices are in 1/8 pixels (VERTEX_FORMAT(3)), their range is +-2047 pixels */
+#define VERTEX_FRAC     3
+#define MAX_RADIUS      255     /* LINE_WIDTH is 12 bit in 1/16 pixels */
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const lv_font_t *font;
+    uint32_t addr;
+    uint16_t stride;
+    uint16_t cell_w;
+    uint16_t cell_h;
+    int16_t ofs_x;      /* Position of the cells relative to the position of the letter */
+    int16_t ofs_y;
+    bool valid;         /* false: the font can't be drawn natively */
+} dl_font_t;
+
+typedef struct {
+    const void *src;
+    uint32_t addr;
+    uint16_t stride;
+    uint16_t w;
+    uint16_t h;
+    uint8_t format;
+} dl_img_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool frame_start_cb(lv_disp_drv_t *drv);
+static bool frame_finish_cb(lv_disp_drv_t *drv);
+static bool rect_cb(lv_disp_drv_t *drv, const lv_area_t *coords, const lv_area_t *clip,
+                    const lv_draw_rect_dsc_t *dsc);
+static bool line_cb(lv_disp_drv_t *drv, const lv_point_t *point1, const lv_point_t *point2,
+                    const lv_area_t *clip, const lv_draw_line_dsc_t *dsc);
+static bool letter_cb(lv_disp_drv_t *drv, const lv_point_t *pos, const lv_area_t *clip,
+                      const lv_font_t *font, uint32_t letter, lv_color_t color, lv_opa_t opa);
+static bool img_cb(lv_disp_drv_t *drv, const lv_area_t *coords, const lv_area_t *clip,
+                   const void *src, const lv_draw_img_dsc_t *dsc);
+
+static bool rect_is_native(const lv_draw_rect_dsc_t *dsc, lv_coord_t radius);
+static void draw_fill(const lv_area_t *coords, lv_coord_t radius, const lv_area_t *clip);
+static void draw_ring(const lv_area_t *outer, lv_coord_t radius, lv_coord_t width, const lv_area_t *clip,
+                      lv_color_t color, lv_opa_t opa);
+
+static dl_font_t *font_get(const lv_font_t *font);
+static bool font_upload(dl_font_t *f);
+static dl_img_t *img_get(const lv_img_dsc_t *img);
+static bool img_upload(dl_img_t *entry, const lv_img_dsc_t *img);
+static bool ram_g_alloc(uint32_t size, uint32_t *addr);
+
+static void dl_add(uint32_t cmd);
+static void dl_set_clip(const lv_area_t *clip);
+static void dl_set_color(lv_color_t color, lv_opa_t opa);
+static void dl_set_line_width(uint32_t width);
+static void dl_begin(uint32_t prim);
+static void dl_vertex(int32_t x16, int32_t y16);
+static void dl_bitmap(uint32_t handle, uint32_t addr, uint32_t format, uint32_t stride, uint32_t w, uint32_t h);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const lv_draw_backend_t backend = {
+    .frame_start_cb = frame_start_cb,
+    .frame_finish_cb = frame_finish_cb,
+    .rect_cb = rect_cb,
+    .line_cb = line_cb,
+    .letter_cb = letter_cb,
+    .img_cb = img_cb,
+};
+
+static uint32_t dl_buf[DL_SIZE];
+static uint32_t dl_len;
+static bool dl_full;
+static bool dl_shown;           /* The screen shows a display list instead of the bitmap */
+
+/* Graphics state of the display list being built to skip the redundant commands */
+static lv_area_t dl_clip;
+static uint32_t dl_rgb;
+static uint32_t dl_alpha;
+static uint32_t dl_line_w;
+static uint32_t dl_prim;
+static uint32_t dl_handle;
+static const dl_img_t *dl_img;
+static uint16_t dl_font_set;    /* Bit n: the handle of `fonts[n]` is set in this display list */
+
+static dl_font_t fonts[FONT_CNT];
+static uint32_t font_cnt;
+static dl_img_t imgs[CONFIG_LV_FT81X_DL_IMG_CNT];
+static uint32_t img_cnt;
+static uint32_t ram_g_next = ASSET_ADDR;
+
+static uint8_t stage[STAGE_SIZE];
+
+/**********************
+ *      MACROS
+ **********************/
+#define STATE_NONE      0xFFFFFFFFUL
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const lv_draw_backend_t *FT81x_dl_get_backend(void)
+{
+    return &backend;
+}
+
+void FT81x_dl_show_bitmap(void)
+{
+    if (!dl_shown) {
+        return;
+    }
+
+    dl_shown = false;
+    TFT_bitmap_display();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool frame_start_cb(lv_disp_drv_t *drv)
+{
+    (void) drv;
+
+    /* The previous display list might still be sent from `dl_buf` */
+    disp_wait_for_pending_transactions();
+
+    dl_len = 0;
+    dl_full = false;
+    lv_area_set(&dl_clip, 0, 0, EVE_HSIZE - 1, EVE_VSIZE - 1);
+    dl_rgb = 0xFFFFFFUL;    /* Default state of a display list */
+    dl_alpha = 0xFFUL;
+    dl_line_w = 16;
+    dl_prim = STATE_NONE;
+    dl_handle = STATE_NONE;
+    dl_img = NULL;
+    dl_font_set = 0;
+
+    dl_add(CLEAR_COLOR_RGB(0, 0, 0));
+    dl_add(CLEAR(1, 1, 1));
+    dl_add(VERTEX_FORMAT(VERTEX_FRAC));
+
+    return true;
+}
+
+static bool frame_finish_cb(lv_disp_drv_t *drv)
+{
+    (void) drv;
+
+    if (dl_full) {
+        ESP_LOGD(TAG_LOG, "Display list is full, rendering the frame by software");
+        return false;
+    }
+
+    dl_buf[dl_len++] = END();
+    dl_buf[dl_len++] = DL_DISPLAY;
+
+    /* RAM_DL is written directly: the co-processor has to be idle and the previous list swapped */
+    EVE_cmd_wait();
+    while (EVE_memRead8(REG_DLSWAP) != EVE_DLSWAP_DONE);
+
+    EVE_memWrite_buffer(EVE_RAM_DL, (const uint8_t *) dl_buf, dl_len * 4, false);
+    EVE_memWrite8(REG_DLSWAP, EVE_DLSWAP_FRAME);
+
+    dl_shown = true;
+    return true;
+}
+
+static bool rect_cb(lv_disp_drv_t *drv, const lv_area_t *coords, const lv_area_t *clip,
+                    const lv_draw_rect_dsc_t *dsc)
+{
+    (void) drv;
+
+    /* `LV_RADIUS_CIRCLE` is resolved to the real radius here */
+    lv_coord_t w = lv_area_get_width(coords);
+    lv_coord_t h = lv_area_get_height(coords);
+    lv_coord_t radius = LV_MATH_MIN(dsc->radius, LV_MATH_MIN(w, h) / 2);
+
+    if (!rect_is_native(dsc, radius)) {
+        return false;
+    }
+
+    if (dsc->bg_opa > LV_OPA_MIN) {
+        dl_set_color(dsc->bg_color, dsc->bg_opa);
+        draw_fill(coords, radius, clip);
+    }
+
+    if (dsc->border_width > 0 && dsc->border_opa > LV_OPA_MIN && dsc->border_side != LV_BORDER_SIDE_NONE &&
+        !dsc->border_post) {
+        draw_ring(coords, radius, dsc->border_width, clip, dsc->border_color, dsc->border_opa);
+    }
+
+    if (dsc->outline_width > 0 && dsc->outline_opa > LV_OPA_MIN) {
+        /* Same geometry as LVGL's `draw_outline` */
+        lv_coord_t pad = dsc->outline_pad == 0 ? -1 : dsc->outline_pad;
+        lv_coord_t width = dsc->outline_pad == 0 ? dsc->outline_width + 1 : dsc->outline_width;
+        lv_area_t outer = *coords;
+        outer.x1 -= pad + width;
+        outer.y1 -= pad + width;
+        outer.x2 += pad + width;
+        outer.y2 += pad + width;
+        draw_ring(&outer, radius + width, width, clip, dsc->outline_color, dsc->outline_opa);
+    }
+
+    return !dl_full;
+}
+
+static bool line_cb(lv_disp_drv_t *drv, const lv_point_t *point1, const lv_point_t *point2,
+                    const lv_area_t *clip, const lv_draw_line_dsc_t *dsc)
+{
+    (void) drv;
+
+    if (dsc->blend_mode != LV_BLEND_MODE_NORMAL) {
+        return false;
+    }
+
+    if (dsc->dash_width && dsc->dash_gap) {
+        return false;
+    }
+
+    bool round = dsc->round_start || dsc->round_end;
+
+    dl_set_clip(clip);
+    dl_set_color(dsc->color, dsc->opa);
+
+    if (!round && (point1->x == point2->x || point1->y == point2->y)) {
+        /* Same area as LVGL's `draw_line_hor/ver` */
+        int32_t w = dsc->width - 1;
+        int32_t w_half0 = w >> 1;
+        int32_t w_half1 = w_half0 + (w & 0x1);
+        lv_area_t a;
+        if (point1->y == point2->y) {
+            a.x1 = LV_MATH_MIN(point1->x, point2->x);
+            a.x2 = LV_MATH_MAX(point1->x, point2->x) - 1;
+            a.y1 = point1->y - w_half1;
+            a.y2 = point1->y + w_half0;
+        } else {
+            a.x1 = point1->x - w_half1;
+            a.x2 = point1->x + w_half0;
+            a.y1 = LV_MATH_MIN(point1->y, point2->y);
+            a.y2 = LV_MATH_MAX(point1->y, point2->y) - 1;
+        }
+        draw_fill(&a, 0, clip);
+        return !dl_full;
+    }
+
+    /* LINES always have round ends. Without rounding LVGL ends the line perpendicularly,
+     * the difference is visible only on wide lines. */
+    if (!round && dsc->width > 2) {
+        return false;
+    }
+
+    dl_set_line_width(dsc->width * 8);
+    dl_begin(EVE_LINES);
+    dl_vertex(point1->x * 16 + 8, point1->y * 16 + 8);
+    dl_vertex(point2->x * 16 + 8, point2->y * 16 + 8);
+
+    return !dl_full;
+}
+
+static bool letter_cb(lv_disp_drv_t *drv, const lv_point_t *pos, const lv_area_t *clip,
+                      const lv_font_t *font, uint32_t letter, lv_color_t color, lv_opa_t opa)
+{
+    (void) drv;
+
+    lv_font_glyph_dsc_t g;
+    if (!lv_font_get_glyph_dsc(font, &g, letter, '\0')) {
+        return true;    /* Not drawn by LVGL either */
+    }
+
+    if (g.box_w == 0 || g.box_h == 0) {
+        return true;
+    }
+
+    if (letter < GLYPH_FIRST || letter > GLYPH_LAST) {
+        return false;
+    }
+
+    dl_font_t *f = font_get(font);
+    if (f == NULL) {
+        return false;
+    }
+
+    lv_area_t cell;
+    cell.x1 = pos->x + f->ofs_x;
+    cell.y1 = pos->y + f->ofs_y;
+    cell.x2 = cell.x1 + f->cell_w - 1;
+    cell.y2 = cell.y1 + f->cell_h - 1;
+    if (!_lv_area_is_on(&cell, clip)) {
+        return true;
+    }
+
+    uint32_t font_idx = f - fonts;
+    uint32_t handle = font_idx + 1;
+
+    dl_set_clip(clip);
+    dl_set_color(color, opa);
+    dl_begin(EVE_BITMAPS);
+
+    if ((dl_font_set & (1 << font_idx)) == 0) {
+        dl_bitmap(handle, f->addr, EVE_L4, f->stride, f->cell_w, f->cell_h);
+        dl_font_set |= 1 << font_idx;
+    } else if (dl_handle != handle) {
+        dl_add(BITMAP_HANDLE(handle));
+        dl_handle = handle;
+    }
+
+    dl_add(CELL(letter - GLYPH_FIRST));
+    dl_vertex(cell.x1 * 16, cell.y1 * 16);
+
+    return !dl_full;
+}
+
+static bool img_cb(lv_disp_drv_t *drv, const lv_area_t *coords, const lv_area_t *clip,
+                   const void *src, const lv_draw_img_dsc_t *dsc)
+{
+    (void) drv;
+
+    if (dsc->angle != 0 || dsc->zoom != LV_IMG_ZOOM_NONE || dsc->blend_mode != LV_BLEND_MODE_NORMAL) {
+        return false;
+    }
+
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) {
+        return false;
+    }
+
+    const lv_img_dsc_t *img = src;
+    lv_color_t color = LV_COLOR_WHITE;
+    if (img->header.cf == LV_IMG_CF_ALPHA_8BIT) {
+        color = dsc->recolor;
+    } else if (dsc->recolor_opa > LV_OPA_MIN) {
+        return false;
+    }
+
+    const dl_img_t *entry = img_get(img);
+    if (entry == NULL) {
+        return false;
+    }
+
+    dl_set_clip(clip);
+    dl_set_color(color, dsc->opa);
+    dl_begin(EVE_BITMAPS);
+
+    if (dl_img != entry) {
+        dl_bitmap(IMG_HANDLE, entry->addr, entry->format, entry->stride, entry->w, entry->h);
+        dl_img = entry;
+    } else if (dl_handle != IMG_HANDLE) {
+        dl_add(BITMAP_HANDLE(IMG_HANDLE));
+        dl_handle = IMG_HANDLE;
+    }
+
+    dl_vertex(coords->x1 * 16, coords->y1 * 16);
+
+    return !dl_full;
+}
+
+/* `radius` is the corner radius limited to the size of the rectangle */
+static bool rect_is_native(const lv_draw_rect_dsc_t *dsc, lv_coord_t radius)
+{
+    /* Larger corners can't be drawn with LINE_WIDTH */
+    if (radius > MAX_RADIUS) {
+        return false;
+    }
+
+    if (dsc->bg_opa > LV_OPA_MIN) {
+        if (dsc->bg_blend_mode != LV_BLEND_MODE_NORMAL) {
+            return false;
+        }
+
+        if (dsc->bg_grad_dir != LV_GRAD_DIR_NONE && dsc->bg_color.full != dsc->bg_grad_color.full) {
+            return false;
+        }
+    }
+
+    if (dsc->border_width > 0 && dsc->border_opa > LV_OPA_MIN && dsc->border_side != LV_BORDER_SIDE_NONE) {
+        if (dsc->border_side != LV_BORDER_SIDE_FULL || dsc->border_blend_mode != LV_BLEND_MODE_NORMAL) {
+            return false;
+        }
+    }
+
+    if (dsc->outline_width > 0 && dsc->outline_opa > LV_OPA_MIN) {
+        /* The outline's corners are larger by its width, see `rect_cb` */
+        lv_coord_t outline_w = dsc->outline_pad == 0 ? dsc->outline_width + 1 : dsc->outline_width;
+        if (dsc->outline_blend_mode != LV_BLEND_MODE_NORMAL || radius + outline_w > MAX_RADIUS) {
+            return false;
+        }
+    }
+
+    if (dsc->shadow_width > 0 && dsc->shadow_opa > LV_OPA_MIN) {
+        return false;
+    }
+
+    if (dsc->pattern_image != NULL && dsc->pattern_opa > LV_OPA_MIN) {
+        return false;
+    }
+
+    if (dsc->value_str != NULL && dsc->value_opa > LV_OPA_MIN) {
+        return false;
+    }
+
+    return true;
+}
+
+/* Fill an area with rounded corners using the current color */
+static void draw_fill(const lv_area_t *coords, lv_coord_t radius, const lv_area_t *clip)
+{
+    /* The parts far out of the clip area are cut to stay in the vertex range.
+     * The corners stay out of the clip area so the visible part doesn't change. */
+    lv_area_t a;
+    lv_area_t ext = *clip;
+    ext.x1 -= radius + 1;
+    ext.y1 -= radius + 1;
+    ext.x2 += radius + 1;
+    ext.y2 += radius + 1;
+    if (!_lv_area_intersect(&a, coords, &ext)) {
+        return;
+    }
+
+    /* RECTS are grown by the line width in each direction, which is the radius of the corners.
+     * Half a pixel keeps the corners of the not rounded rectangles sharp enough. */
+    int32_t w16 = radius > 0 ? radius * 16 : 8;
+
+    dl_set_clip(clip);
+    dl_set_line_width(w16);
+    dl_begin(EVE_RECTS);
+    dl_vertex(a.x1 * 16 + w16, a.y1 * 16 + w16);
+    dl_vertex((a.x2 + 1) * 16 - w16, (a.y2 + 1) * 16 - w16);
+}
+
+/* Draw a rounded ring: the inner area is marked in the stencil buffer and left out of the outer area */
+static void draw_ring(const lv_area_t *outer, lv_coord_t radius, lv_coord_t width, const lv_area_t *clip,
+                      lv_color_t color, lv_opa_t opa)
+{
+    lv_area_t inner = *outer;
+    inner.x1 += width;
+    inner.y1 += width;
+    inner.x2 -= width;
+    inner.y2 -= width;
+    lv_coord_t radius_in = LV_MATH_MAX(radius - width, 0);
+
+    dl_set_color(color, opa);
+
+    if (inner.x1 > inner.x2 || inner.y1 > inner.y2) {
+        draw_fill(outer, radius, clip);
+        return;
+    }
+
+    dl_add(COLOR_MASK(0, 0, 0, 0));
+    dl_add(STENCIL_FUNC(EVE_ALWAYS, 1, 255));
+    dl_add(STENCIL_OP(EVE_KEEP, EVE_REPLACE));
+    draw_fill(&inner, radius_in, clip);
+
+    dl_add(COLOR_MASK(1, 1, 1, 1));
+    dl_add(STENCIL_FUNC(EVE_EQUAL, 0, 255));
+    dl_add(STENCIL_OP(EVE_KEEP, EVE_KEEP));
+    draw_fill(outer, radius, clip);
+
+    /* Clear the stencil for the next rings */
+    dl_add(COLOR_MASK(0, 0, 0, 0));
+    dl_add(STENCIL_FUNC(EVE_ALWAYS, 0, 255));
+    dl_add(STENCIL_OP(EVE_KEEP, EVE_REPLACE));
+    draw_fill(&inner, radius_in, clip);
+
+    dl_add(COLOR_MASK(1, 1, 1, 1));
+    dl_add(STENCIL_OP(EVE_KEEP, EVE_KEEP));
+}
+
+/* Find an uploaded font or upload it now. NULL if it can't be drawn natively. */
+static dl_font_t *font_get(const lv_font_t *font)
+{
+    uint32_t i;
+    for (i = 0; i < font_cnt; i++) {
+        if (fonts[i].font == font) {
+            return fonts[i].valid ? &fonts[i] : NULL;
+        }
+    }
+
+    if (font_cnt >= FONT_CNT) {
+        return NULL;
+    }
+
+    dl_font_t *f = &fonts[font_cnt++];
+    memset(f, 0, sizeof(dl_font_t));
+    f->font = font;
+    f->valid = !font->subpx && font_upload(f);
+
+    if (!f->valid) {
+        ESP_LOGW(TAG_LOG, "Font %p can't be drawn natively", font);
+    }
+
+    return f->valid ? f : NULL;
+}
+
+/* Render the ASCII glyphs into same sized L4 cells and write them to RAM_G */
+static bool font_upload(dl_font_t *f)
+{
+    const lv_font_t *font = f->font;
+    lv_font_glyph_dsc_t g;
+    int32_t x1 = INT16_MAX;
+    int32_t y1 = INT16_MAX;
+    int32_t x2 = INT16_MIN;
+    int32_t y2 = INT16_MIN;
+    uint32_t letter;
+
+    /* The cell is the bounding box of all glyphs relative to the letter's position */
+    for (letter = GLYPH_FIRST; letter <= GLYPH_LAST; letter++) {
+        if (!lv_font_get_glyph_dsc(font, &g, letter, '\0') || g.box_w == 0 || g.box_h == 0) {
+            continue;
+        }
+
+        if (g.bpp != 1 && g.bpp != 2 && g.bpp != 4 && g.bpp != 8) {
+            return false;
+        }
+
+        int32_t top = (font->line_height - font->base_line) - g.box_h - g.ofs_y;
+        x1 = LV_MATH_MIN(x1, g.ofs_x);
+        y1 = LV_MATH_MIN(y1, top);
+        x2 = LV_MATH_MAX(x2, g.ofs_x + g.box_w);
+        y2 = LV_MATH_MAX(y2, top + g.box_h);
+    }
+
+    if (x1 >= x2 || y1 >= y2) {
+        return false;
+    }
+
+    f->ofs_x = x1;
+    f->ofs_y = y1;
+    f->cell_w = x2 - x1;
+    f->cell_h = y2 - y1;
+    f->stride = (f->cell_w + 1) / 2;
+
+    uint32_t cell_size = f->stride * f->cell_h;
+    if (cell_size > STAGE_SIZE || !ram_g_alloc(cell_size * GLYPH_CNT, &f->addr)) {
+        return false;
+    }
+
+    for (letter = GLYPH_FIRST; letter <= GLYPH_LAST; letter++) {
+        memset(stage, 0, cell_size);
+
+        const uint8_t *map = NULL;
+        if (lv_font_get_glyph_dsc(font, &g, letter, '\0') && g.box_w != 0 && g.box_h != 0) {
+            map = lv_font_get_glyph_bitmap(font, letter);
+        }
+
+        if (map != NULL) {
+            int32_t cx = g.ofs_x - f->ofs_x;
+            int32_t cy = (font->line_height - font->base_line) - g.box_h - g.ofs_y - f->ofs_y;
+            uint32_t max = (1 << g.bpp) - 1;
+            uint32_t bit = 0;
+            int32_t x;
+            int32_t y;
+            for (y = 0; y < g.box_h; y++) {
+                for (x = 0; x < g.box_w; x++) {
+                    /* The glyph bitmaps are packed without row padding, MSB first */
+                    uint32_t v = (map[bit >> 3] >> (8 - g.bpp - (bit & 0x7))) & max;
+                    bit += g.bpp;
+
+                    uint8_t l4 = (v * 15 + max / 2) / max;
+                    uint32_t px = cx + x;
+                    uint8_t *dst = &stage[(cy + y) * f->stride + px / 2];
+                    *dst |= (px & 0x1) ? l4 : (l4 << 4);
+                }
+            }
+        }
+
+        EVE_memWrite_buffer(f->addr + (letter - GLYPH_FIRST) * cell_size, stage, cell_size, false);
+        disp_wait_for_pending_transactions();
+    }
+
+    return true;
+}
+
+/* Find an uploaded image or upload it now. NULL if it can't be drawn natively. */
+static dl_img_t *img_get(const lv_img_dsc_t *img)
+{
+    uint32_t i;
+    for (i = 0; i < img_cnt; i++) {
+        if (imgs[i].src == img) {
+            return &imgs[i];
+        }
+    }
+
+    /* Images in RAM (e.g. canvases) can change any time, only the constant ones are kept */
+    if (!esp_ptr_in_drom(img->data)) {
+        return NULL;
+    }
+
+    if (img_cnt >= CONFIG_LV_FT81X_DL_IMG_CNT) {
+        return NULL;
+    }
+
+    dl_img_t *entry = &imgs[img_cnt];
+    if (!img_upload(entry, img)) {
+        return NULL;
+    }
+
+    img_cnt++;
+    return entry;
+}
+
+/* Convert an image to an EVE format and write it to RAM_G */
+static bool img_upload(dl_img_t *entry, const lv_img_dsc_t *img)
+{
+    uint32_t w = img->header.w;
+    uint32_t h = img->header.h;
+    uint32_t px_size;
+
+    switch (img->header.cf) {
+    case LV_IMG_CF_TRUE_COLOR:
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+        /* The pixels are copied as they are */
+        entry->format = EVE_RGB565;
+        px_size = LV_COLOR_SIZE / 8;
+        break;
+#else
+        /* Only 16 bit, not swapped lv_color_t is the same as RGB565 in RAM_G */
+        return false;
+#endif
+    case LV_IMG_CF_TRUE_COLOR_ALPHA:
+        entry->format = EVE_ARGB4;
+        px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+        break;
+    case LV_IMG_CF_ALPHA_8BIT:
+        entry->format = EVE_L8;
+        px_size = 1;
+        break;
+    default:
+        return false;
+    }
+
+    /* RGB565 and ARGB4 are 2 bytes per pixel, L8 is 1 */
+    uint32_t stride = entry->format == EVE_L8 ? w : w * 2;
+    if (w == 0 || h == 0 || stride > STAGE_SIZE || h > 2047) {
+        return false;
+    }
+
+    if (!ram_g_alloc(stride * h, &entry->addr)) {
+        return false;
+    }
+
+    entry->src = img;
+    entry->stride = stride;
+    entry->w = w;
+    entry->h = h;
+
+    /* Flash can't be read by DMA so convert/copy as many lines as fit into the stage buffer */
+    uint32_t lines = STAGE_SIZE / stride;
+    uint32_t y;
+    for (y = 0; y < h; y += lines) {
+        uint32_t n = LV_MATH_MIN(lines, h - y);
+        const uint8_t *src = img->data + y * w * px_size;
+        uint32_t i;
+
+        if (img->header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA) {
+            uint16_t *dst = (uint16_t *) stage;
+            for (i = 0; i < n * w; i++) {
+                lv_color_t c;
+                memcpy(&c, src, sizeof(lv_color_t));
+                lv_color32_t c32;
+                c32.full = lv_color_to32(c);
+                uint8_t a = src[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+                dst[i] = ((a >> 4) << 12) | ((c32.ch.red >> 4) << 8) | ((c32.ch.green >> 4) << 4) | (c32.ch.blue >> 4);
+                src += LV_IMG_PX_SIZE_ALPHA_BYTE;
+            }
+        } else {
+            memcpy(stage, src, n * stride);
+        }
+
+        EVE_memWrite_buffer(entry->addr + y * stride, stage, n * stride, false);
+        disp_wait_for_pending_transactions();
+    }
+
+    return true;
+}
+
+/* Allocate RAM_G for a font or an image. Nothing is freed, the assets stay until reset. */
+static bool ram_g_alloc(uint32_t size, uint32_t *addr)
+{
+    size = (size + 3) & ~3UL;
+    if (ram_g_next + size > EVE_RAM_G_SIZE) {
+        ESP_LOGW(TAG_LOG, "RAM_G is full");
+        return false;
+    }
+
+    *addr = ram_g_next;
+    ram_g_next += size;
+    return true;
+}
+
+static void dl_add(uint32_t cmd)
+{
+    if (dl_len >= DL_SIZE - DL_RESERVED) {
+        dl_full = true;
+        return;
+    }
+
+    dl_buf[dl_len++] = cmd;
+}
+
+static void dl_set_clip(const lv_area_t *clip)
+{
+    if (clip->x1 == dl_clip.x1 && clip->y1 == dl_clip.y1 && clip->x2 == dl_clip.x2 && clip->y2 == dl_clip.y2) {
+        return;
+    }
+
+    dl_add(SCISSOR_XY(clip->x1, clip->y1));
+    dl_add(SCISSOR_SIZE(lv_area_get_width(clip), lv_area_get_height(clip)));
+    dl_clip = *clip;
+}
+
+static void dl_set_color(lv_color_t color, lv_opa_t opa)
+{
+    lv_color32_t c32;
+    c32.full = lv_color_to32(color);
+    uint32_t rgb = c32.full & 0xFFFFFFUL;
+
+    if (rgb != dl_rgb) {
+        dl_add(COLOR_RGB(c32.ch.red, c32.ch.green, c32.ch.blue));
+        dl_rgb = rgb;
+    }
+
+    if (opa != dl_alpha) {
+        dl_add(COLOR_A(opa));
+        dl_alpha = opa;
+    }
+}
+
+static void dl_set_line_width(uint32_t width)
+{
+    if (width == dl_line_w) {
+        return;
+    }
+
+    dl_add(LINE_WIDTH(width));
+    dl_line_w = width;
+}
+
+static void dl_begin(uint32_t prim)
+{
+    if (prim == dl_prim) {
+        return;
+    }
+
+    dl_add(BEGIN(prim));
+    dl_prim = prim;
+}
+
+static void dl_vertex(int32_t x16, int32_t y16)
+{
+    dl_add(VERTEX2F(x16 >> (4 - VERTEX_FRAC), y16 >> (4 - VERTEX_FRAC)));
+}
+
+static void dl_bitmap(uint32_t handle, uint32_t addr, uint32_t format, uint32_t stride, uint32_t w, uint32_t h)
+{
+    dl_add(BITMAP_HANDLE(handle));
+    dl_add(BITMAP_SOURCE(addr));
+    dl_add(BITMAP_LAYOUT(format, stride, h));
+    dl_add(BITMAP_LAYOUT_H(stride, h));
+    dl_add(BITMAP_SIZE(EVE_NEAREST, EVE_BORDER, EVE_BORDER, w, h));
+    dl_add(BITMAP_SIZE_H(w, h));
+    dl_handle = handle;
+}
+
+#endif /* CONFIG_LV_FT81X_DISPLAY_LIST */
@@ -0,0 +1,54 @@
+/**
+ * @file FT81x_dl.h
+ *
+ * LVGL draw backend for FT81x: builds a display list from LVGL's rectangles,
+ * lines, letters and images, so only the display list is sent per frame
+ * instead of the rendered pixels.
+ */
+
+#ifndef FT81X_DL_H
+#define FT81X_DL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdbool.h>
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+#if defined (CONFIG_LV_FT81X_DISPLAY_LIST)
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/* The draw backend to set in `lv_disp_drv_t.draw_backend` */
+const lv_draw_backend_t *FT81x_dl_get_backend(void);
+
+/* Show the fullscreen bitmap again if the screen shows a display list.
+ * Called by FT81x_flush when the last area of a software rendered frame is written. */
+void FT81x_dl_show_bitmap(void);
+
+#endif /* CONFIG_LV_FT81X_DISPLAY_LIST */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* FT81X_DL_H */
@@ -5,6 +5,21 @@
 #include "disp_driver.h"
 #include "disp_spi.h"
 
+#if defined CONFIG_LV_EPD_REFRESH_MANAGER
+#include <assert.h>
+#include "esp_log.h"
+
+#define TAG "disp_driver"
+
+#if defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_IL3820
+static const epd_refresh_panel_t epd_panel = {il3820_epd_full, il3820_epd_partial, IL3820_COLUMNS, EPD_PANEL_HEIGHT};
+#elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_JD79653A
+static const epd_refresh_panel_t epd_panel = {jd79653a_epd_full, jd79653a_epd_partial, JD79653A_ROW_LEN, JD79653A_ROW_CNT};
+#elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_UC8151D
+static const epd_refresh_panel_t epd_panel = {uc8151d_epd_full, uc8151d_epd_partial, UC8151D_ROW_LEN, UC8151D_ROW_CNT};
+#endif
+#endif
+
 void disp_driver_init(void)
 {
 #if defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_ILI9341
@@ -40,11 +55,22 @@ void disp_driver_init(void)
 #elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_UC8151D
    uc8151d_init();
 #endif
+
+#if defined CONFIG_LV_EPD_REFRESH_MANAGER
+    /* LVGL is set up for true color buffers, the panel's own flush can't take over */
+    bool epd_ok = epd_refresh_init(&epd_panel);
+    if (!epd_ok) {
+        ESP_LOGE(TAG, "The e-paper refresh manager can't be used, nothing would be shown");
+    }
+    assert(epd_ok);
+#endif
 }
 
 void disp_driver_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map)
 {
-#if defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_ILI9341
+#if defined CONFIG_LV_EPD_REFRESH_MANAGER
+    epd_refresh_flush(drv, area, color_map);
+#elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_ILI9341
     ili9341_flush(drv, area, color_map);
 #elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_ILI9481
     ili9481_flush(drv, area, color_map);
@@ -81,7 +107,9 @@ void disp_driver_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t *
 
 void disp_driver_rounder(lv_disp_drv_t * disp_drv, lv_area_t * area)
 {
-#if defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_SSD1306
+#if defined CONFIG_LV_EPD_REFRESH_MANAGER
+    /* The refresh manager packs and aligns the areas itself */
+#elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_SSD1306
     ssd1306_rounder(disp_drv, area);
 #elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_SH1107
     sh1107_rounder(disp_drv, area);
@@ -97,7 +125,9 @@ void disp_driver_rounder(lv_disp_drv_t * disp_drv, lv_area_t * area)
 void disp_driver_set_px(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
     lv_color_t color, lv_opa_t opa) 
 {
-#if defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_SSD1306
+#if defined CONFIG_LV_EPD_REFRESH_MANAGER
+    /* Not used, LVGL renders true color pixels which are packed on flush */
+#elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_SSD1306
     ssd1306_set_px_cb(disp_drv, buf, buf_w, x, y, color, opa);
 #elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_SH1107
     sh1107_set_px_cb(disp_drv, buf, buf_w, x, y, color, opa);
@@ -109,3 +139,25 @@ void disp_driver_set_px(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_
     uc8151d_lv_set_fb_cb(disp_drv, buf, buf_w, x, y, color, opa);
 #endif
 }
+
+#if LV_USE_DRAW_BACKEND
+const lv_draw_backend_t * disp_driver_get_draw_backend(void)
+{
+#if defined CONFIG_LV_FT81X_DISPLAY_LIST
+    return FT81x_dl_get_backend();
+#else
+    return NULL;
+#endif
+}
+#endif
+
+#if LV_USE_FAST_SCROLL
+bool disp_driver_scroll(lv_disp_drv_t * drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy)
+{
+#if defined CONFIG_LV_TFT_HW_SCROLL
+    return tft_vscroll_scroll(drv, area, dx, dy);
+#else
+    return false;
+#endif
+}
+#endif
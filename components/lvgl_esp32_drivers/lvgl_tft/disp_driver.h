@@ -40,6 +40,7 @@ extern "C" {
 #include "ssd1306.h"
 #elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_FT81X
 #include "FT81x.h"
+#include "FT81x_dl.h"
 #elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_IL3820
 #include "il3820.h"
 #elif defined CONFIG_LV_TFT_DISPLAY_CONTROLLER_RA8875
@@ -52,6 +53,14 @@ extern "C" {
 #include "uc8151d.h"
 #endif
 
+#if defined CONFIG_LV_EPD_REFRESH_MANAGER
+#include "epd_refresh.h"
+#endif
+
+#if defined CONFIG_LV_TFT_HW_SCROLL
+#include "tft_vscroll.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -77,6 +86,16 @@ void disp_driver_rounder(lv_disp_drv_t * disp_drv, lv_area_t * area);
 void disp_driver_set_px(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
     lv_color_t color, lv_opa_t opa);
 
+#if LV_USE_DRAW_BACKEND
+/* Draw backend of the display or NULL if it can draw only bitmaps */
+const lv_draw_backend_t * disp_driver_get_draw_backend(void);
+#endif
+
+#if LV_USE_FAST_SCROLL
+/* Display scroll callback, moves the content of an area with the controller's hardware scrolling */
+bool disp_driver_scroll(lv_disp_drv_t * drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy);
+#endif
+
 /**********************
  *      MACROS
  **********************/
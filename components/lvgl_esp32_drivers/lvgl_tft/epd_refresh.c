@@ -0,0 +1,288 @@
+/**
+ * @file epd_refresh.c
+ *
+ * LVGL renders to a normal `lv_color_t` buffer (no `set_px_cb`), which is packed
+ * here to a full screen 1 bit per pixel framebuffer. A second, "shadow"
+ * framebuffer keeps what the panel currently shows. The changes are collected
+ * for CONFIG_LV_EPD_REFRESH_AGGREGATE_MS and only the bounding box of the
+ * pixels which really differ from the shadow is refreshed.
+ *
+ * Partial refreshes leave some ghosting behind, so the number of partial
+ * refreshes is counted for every EPD_REFRESH_BAND_H high band of the panel.
+ * When a band reaches CONFIG_LV_EPD_REFRESH_PARTIAL_CNT or the changed area is
+ * large, a full refresh is done instead.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+
+#include "epd_refresh.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TAG "epd_refresh"
+
+#define EPD_STRIDE          (epd_panel.stride)
+#define EPD_FB_SIZE         (epd_panel.stride * epd_panel.row_cnt)
+#define EPD_BAND_CNT        ((LV_VER_RES_MAX + EPD_REFRESH_BAND_H - 1) / EPD_REFRESH_BAND_H)
+
+/* Check the pending changes this often */
+#define EPD_TASK_PERIOD     LV_DISP_DEF_REFR_PERIOD
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void pack_area(const lv_area_t *area, const lv_color_t *color_map);
+static bool get_diff_area(const lv_area_t *area, lv_area_t *diff);
+static bool need_full_refresh(const lv_area_t *diff);
+static void epd_refresh_task_cb(lv_task_t *task);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static epd_refresh_panel_t epd_panel;
+static uint8_t *epd_fb;         /* What LVGL has rendered */
+static uint8_t *epd_shadow;     /* What the panel shows */
+static uint8_t epd_band_cnt[EPD_BAND_CNT];
+
+static bool epd_pending = false;
+static bool epd_full_req = true;
+static lv_area_t epd_pending_area;
+static uint32_t epd_pending_start;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool epd_refresh_init(const epd_refresh_panel_t *panel)
+{
+    if (panel == NULL || panel->full_cb == NULL) {
+        ESP_LOGE(TAG, "A full refresh callback is required");
+        return false;
+    }
+
+    /* The rows are sent as they are so the layout comes from the controller */
+    if (panel->stride * 8 < LV_HOR_RES_MAX || panel->row_cnt < LV_VER_RES_MAX) {
+        ESP_LOGE(TAG, "The panel's framebuffer (%u x %u bytes) can't hold the display",
+            panel->stride, panel->row_cnt);
+        return false;
+    }
+
+    epd_panel = *panel;
+
+    /* The framebuffers are sent directly over SPI */
+    epd_fb = heap_caps_malloc(EPD_FB_SIZE, MALLOC_CAP_DMA);
+    epd_shadow = heap_caps_malloc(EPD_FB_SIZE, MALLOC_CAP_DMA);
+    if (epd_fb == NULL || epd_shadow == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate the framebuffers (2 x %u bytes)", EPD_FB_SIZE);
+        heap_caps_free(epd_fb);
+        heap_caps_free(epd_shadow);
+        epd_fb = NULL;
+        epd_shadow = NULL;
+        return false;
+    }
+
+    memset(epd_fb, 0xff, EPD_FB_SIZE);
+    memset(epd_shadow, 0xff, EPD_FB_SIZE);
+    memset(epd_band_cnt, 0, sizeof(epd_band_cnt));
+
+    /* The panel's content is unknown so start with a full refresh */
+    epd_full_req = true;
+    epd_pending = false;
+
+    lv_task_create(epd_refresh_task_cb, EPD_TASK_PERIOD, LV_TASK_PRIO_MID, NULL);
+
+    ESP_LOGI(TAG, "Initialized, aggregation window: %d ms, partial refreshes per band: %d",
+        CONFIG_LV_EPD_REFRESH_AGGREGATE_MS, CONFIG_LV_EPD_REFRESH_PARTIAL_CNT);
+
+    return true;
+}
+
+void epd_refresh_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    if (epd_fb) {
+        pack_area(area, color_map);
+
+        if (epd_pending) {
+            _lv_area_join(&epd_pending_area, &epd_pending_area, area);
+        } else {
+            lv_area_copy(&epd_pending_area, area);
+            epd_pending_start = lv_tick_get();
+            epd_pending = true;
+        }
+    }
+
+    /* The panel is refreshed later so LVGL can continue immediately */
+    bool last = lv_disp_flush_is_last(drv);
+    lv_disp_flush_ready(drv);
+
+    if (last && CONFIG_LV_EPD_REFRESH_AGGREGATE_MS == 0) {
+        epd_refresh_commit();
+    }
+}
+
+void epd_refresh_commit(void)
+{
+    if (!epd_pending) return;
+    epd_pending = false;
+
+    lv_area_t diff;
+    if (!epd_full_req && !get_diff_area(&epd_pending_area, &diff)) {
+        ESP_LOGD(TAG, "No visible change");
+        return;
+    }
+
+    if (epd_full_req || need_full_refresh(&diff)) {
+        ESP_LOGD(TAG, "Full refresh");
+        epd_panel.full_cb(epd_fb, epd_shadow, EPD_STRIDE);
+
+        memcpy(epd_shadow, epd_fb, EPD_FB_SIZE);
+        memset(epd_band_cnt, 0, sizeof(epd_band_cnt));
+        epd_full_req = false;
+        return;
+    }
+
+    ESP_LOGD(TAG, "Partial refresh x1: %d, x2: %d, y1: %d, y2: %d", diff.x1, diff.x2, diff.y1, diff.y2);
+    epd_panel.partial_cb(&diff, epd_fb, epd_shadow, EPD_STRIDE);
+
+    uint32_t col_start = diff.x1 >> 3;
+    uint32_t col_cnt = (diff.x2 >> 3) - col_start + 1;
+    for (lv_coord_t y = diff.y1; y <= diff.y2; y++) {
+        memcpy(&epd_shadow[y * EPD_STRIDE + col_start], &epd_fb[y * EPD_STRIDE + col_start], col_cnt);
+    }
+
+    for (lv_coord_t band = diff.y1 / EPD_REFRESH_BAND_H; band <= diff.y2 / EPD_REFRESH_BAND_H; band++) {
+        if (epd_band_cnt[band] < UINT8_MAX) epd_band_cnt[band]++;
+    }
+}
+
+void epd_refresh_request_full(void)
+{
+    epd_full_req = true;
+
+    /* Refresh even if nothing has changed */
+    if (!epd_pending) {
+        epd_pending_area.x1 = 0;
+        epd_pending_area.y1 = 0;
+        epd_pending_area.x2 = LV_HOR_RES_MAX - 1;
+        epd_pending_area.y2 = LV_VER_RES_MAX - 1;
+        epd_pending_start = lv_tick_get();
+        epd_pending = true;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/* Pack the rendered pixels to the framebuffer, 8 pixels per byte where possible */
+static void pack_area(const lv_area_t *area, const lv_color_t *color_map)
+{
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        uint8_t *dst = &epd_fb[y * EPD_STRIDE + (area->x1 >> 3)];
+        lv_coord_t x = area->x1;
+
+        /* Pixels before the first byte boundary */
+        uint8_t mask = 0x80 >> (x & 0x7);
+        while ((x & 0x7) && x <= area->x2) {
+            if (lv_color_to1(*color_map)) *dst |= mask;
+            else *dst &= ~mask;
+            color_map++;
+            mask >>= 1;
+            x++;
+        }
+        if ((x & 0x7) == 0 && x != area->x1) dst++;
+
+        /* Whole bytes */
+        while (x + 7 <= area->x2) {
+            uint8_t byte = 0;
+            for (uint8_t i = 0; i < 8; i++) {
+                byte = (byte << 1) | (lv_color_to1(color_map[i]) ? 1 : 0);
+            }
+            *dst = byte;
+            dst++;
+            color_map += 8;
+            x += 8;
+        }
+
+        /* Remaining pixels */
+        mask = 0x80;
+        while (x <= area->x2) {
+            if (lv_color_to1(*color_map)) *dst |= mask;
+            else *dst &= ~mask;
+            color_map++;
+            mask >>= 1;
+            x++;
+        }
+    }
+}
+
+/* Get the byte aligned bounding box of the pixels in `area` which differ from the panel's content */
+static bool get_diff_area(const lv_area_t *area, lv_area_t *diff)
+{
+    int32_t col_min = INT32_MAX;
+    int32_t col_max = -1;
+    lv_coord_t y_min = LV_COORD_MAX;
+    lv_coord_t y_max = -1;
+
+    int32_t col_start = area->x1 >> 3;
+    int32_t col_end = area->x2 >> 3;
+
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        const uint8_t *fb_row = &epd_fb[y * EPD_STRIDE];
+        const uint8_t *shadow_row = &epd_shadow[y * EPD_STRIDE];
+        if (memcmp(&fb_row[col_start], &shadow_row[col_start], col_end - col_start + 1) == 0) continue;
+
+        for (int32_t col = col_start; col <= col_end; col++) {
+            if (fb_row[col] != shadow_row[col]) {
+                if (col < col_min) col_min = col;
+                if (col > col_max) col_max = col;
+            }
+        }
+        if (y < y_min) y_min = y;
+        y_max = y;
+    }
+
+    if (col_max < 0) return false;
+
+    diff->x1 = col_min * 8;
+    diff->x2 = col_max * 8 + 7;
+    diff->y1 = y_min;
+    diff->y2 = y_max;
+
+    return true;
+}
+
+/* Decide whether the ghosting or the size of the change requires a full refresh */
+static bool need_full_refresh(const lv_area_t *diff)
+{
+    if (epd_panel.partial_cb == NULL) return true;
+
+    uint32_t diff_size = lv_area_get_size(diff);
+    uint32_t full_size = (uint32_t)LV_HOR_RES_MAX * LV_VER_RES_MAX;
+    if (diff_size * 100 >= full_size * CONFIG_LV_EPD_REFRESH_FULL_AREA) return true;
+
+    for (lv_coord_t band = diff->y1 / EPD_REFRESH_BAND_H; band <= diff->y2 / EPD_REFRESH_BAND_H; band++) {
+        if (epd_band_cnt[band] >= CONFIG_LV_EPD_REFRESH_PARTIAL_CNT) return true;
+    }
+
+    return false;
+}
+
+/* Refresh the panel when the aggregation window of the pending changes has elapsed */
+static void epd_refresh_task_cb(lv_task_t *task)
+{
+    (void)task;
+
+    if (!epd_pending) return;
+    if (lv_tick_elaps(epd_pending_start) < CONFIG_LV_EPD_REFRESH_AGGREGATE_MS) return;
+
+    epd_refresh_commit();
+}
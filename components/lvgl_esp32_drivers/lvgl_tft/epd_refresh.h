@@ -0,0 +1,82 @@
+/**
+ * @file epd_refresh.h
+ *
+ * Refresh manager for e-paper panels: packs the rendered areas into a 1 bit per
+ * pixel framebuffer, collects the changes for a while and refreshes only the
+ * area that really differs from the panel's content.
+ */
+
+#ifndef EPD_REFRESH_H
+#define EPD_REFRESH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Height of the panel bands whose partial refreshes are counted */
+#define EPD_REFRESH_BAND_H      16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/* Framebuffer format used with the panel callbacks:
+ * row-major, 8 pixels per byte, MSB is the left pixel, 1 = white */
+typedef struct {
+    /* Write the whole framebuffer to the panel and do a full (flashing) refresh.
+     * `old_fb` is the content currently shown by the panel. */
+    void (*full_cb)(const uint8_t *fb, const uint8_t *old_fb, uint32_t stride);
+
+    /* Write `area` of the framebuffer and refresh only that window.
+     * `area->x1` is a multiple of 8, `area->x2 + 1` too.
+     * NULL if the controller can't do partial refresh. */
+    void (*partial_cb)(const lv_area_t *area, const uint8_t *fb, const uint8_t *old_fb, uint32_t stride);
+
+    /* Framebuffer layout of the controller: length of a row in bytes and the number of rows.
+     * It has to hold LV_HOR_RES_MAX x LV_VER_RES_MAX pixels. */
+    uint32_t stride;
+    uint32_t row_cnt;
+} epd_refresh_panel_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/* Allocate the framebuffers and start the aggregation task.
+ * The first refresh will be a full refresh. */
+bool epd_refresh_init(const epd_refresh_panel_t *panel);
+
+/* Display flush callback: packs the area into the framebuffer and returns immediately */
+void epd_refresh_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+
+/* Refresh the collected changes now, without waiting for the aggregation window */
+void epd_refresh_commit(void);
+
+/* Make the next refresh a full refresh (e.g. to clean the ghosting on request) */
+void epd_refresh_request_full(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*EPD_REFRESH_H*/
@@ -148,6 +148,55 @@ void il3820_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_m
 }
 
 
+#if defined (CONFIG_LV_EPD_REFRESH_MANAGER)
+/* Write the rows of the window to the graphic RAM. */
+static void il3820_write_window(const lv_area_t *area, const uint8_t *fb, uint32_t stride)
+{
+    size_t linelen = (area->x2 - area->x1 + 1) / 8;
+
+    il3820_write_cmd(IL3820_CMD_ENTRY_MODE, &il3820_scan_mode, 1);
+    il3820_set_window(area->x1, area->x2, area->y1, area->y2);
+    il3820_set_cursor(area->x1, area->y1);
+
+    il3820_send_cmd(IL3820_CMD_WRITE_RAM);
+    il3820_data_mode();
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+	disp_spi_send_data((uint8_t *) &fb[y * stride + (area->x1 >> 3)], linelen);
+    }
+}
+
+/* Full refresh callback of the e-paper refresh manager. */
+void il3820_epd_full(const uint8_t *fb, const uint8_t *old_fb, uint32_t stride)
+{
+    lv_area_t area = {0, 0, EPD_PANEL_WIDTH - 1, EPD_PANEL_HEIGHT - 1};
+    (void) old_fb;
+
+    /* Refresh with the full update waveform */
+    il3820_partial = false;
+    il3820_write_cmd(IL3820_CMD_UPDATE_LUT, il3820_lut_initial, sizeof(il3820_lut_initial));
+    il3820_write_window(&area, fb, stride);
+    il3820_update_display();
+
+    /* Back to the partial update waveform and write the image again so
+     * both RAM buffers hold it for the next partial refresh. */
+    il3820_partial = true;
+    il3820_write_cmd(IL3820_CMD_UPDATE_LUT, il3820_lut_default, sizeof(il3820_lut_default));
+    il3820_write_window(&area, fb, stride);
+}
+
+/* Partial refresh callback of the e-paper refresh manager. */
+void il3820_epd_partial(const lv_area_t *area, const uint8_t *fb, const uint8_t *old_fb, uint32_t stride)
+{
+    (void) old_fb;
+
+    il3820_write_window(area, fb, stride);
+    il3820_update_display();
+
+    /* The controller swaps its RAM buffers on update, keep them in sync */
+    il3820_write_window(area, fb, stride);
+}
+#endif
+
 /* Rotate the display by "software" when using PORTRAIT orientation.
  * BIT_SET(byte_index, bit_index) clears the bit_index pixel at byte_index of
  * the display buffer.
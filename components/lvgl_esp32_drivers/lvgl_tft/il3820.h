@@ -104,6 +104,11 @@ void il3820_rounder(lv_disp_drv_t * disp_drv, lv_area_t *area);
 void il3820_set_px_cb(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa);
 void il3820_sleep_in(void);
 
+#if defined (CONFIG_LV_EPD_REFRESH_MANAGER)
+void il3820_epd_full(const uint8_t *fb, const uint8_t *old_fb, uint32_t stride);
+void il3820_epd_partial(const lv_area_t *area, const uint8_t *fb, const uint8_t *old_fb, uint32_t stride);
+#endif
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
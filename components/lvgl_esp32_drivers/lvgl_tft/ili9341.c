@@ -8,6 +8,9 @@
  *********************/
 #include "ili9341.h"
 #include "disp_spi.h"
+#if defined CONFIG_LV_TFT_HW_SCROLL
+#include "tft_vscroll.h"
+#endif
 #include "driver/gpio.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
@@ -37,10 +40,15 @@ static void ili9341_set_orientation(uint8_t orientation);
 static void ili9341_send_cmd(uint8_t cmd);
 static void ili9341_send_data(void * data, uint16_t length);
 static void ili9341_send_color(void * data, uint16_t length);
+static void ili9341_send_color_part(void * data, uint16_t length);
+static void ili9341_set_window(const lv_area_t * area);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if defined CONFIG_LV_TFT_HW_SCROLL
+static const tft_vscroll_panel_t vscroll_panel = {ili9341_send_cmd, ili9341_send_data};
+#endif
 
 /**********************
  *      MACROS
@@ -133,31 +141,51 @@ void ili9341_init(void)
 
 void ili9341_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map)
 {
-	uint8_t data[4];
-
-	/*Column addresses*/
-	ili9341_send_cmd(0x2A);
-	data[0] = (area->x1 >> 8) & 0xFF;
-	data[1] = area->x1 & 0xFF;
-	data[2] = (area->x2 >> 8) & 0xFF;
-	data[3] = area->x2 & 0xFF;
-	ili9341_send_data(data, 4);
-
-	/*Page addresses*/
-	ili9341_send_cmd(0x2B);
-	data[0] = (area->y1 >> 8) & 0xFF;
-	data[1] = area->y1 & 0xFF;
-	data[2] = (area->y2 >> 8) & 0xFF;
-	data[3] = area->y2 & 0xFF;
-	ili9341_send_data(data, 4);
-
-	/*Memory write*/
-	ili9341_send_cmd(0x2C);
+#if defined CONFIG_LV_TFT_HW_SCROLL
+	/*The lines in the hardware scrolled area are stored with an offset, wrapping at its end.
+	 *The lines are the rows, or the columns in landscape orientations.*/
+	lv_coord_t w = lv_area_get_width(area);
+	lv_coord_t x = area->x1;
+	while(x <= area->x2) {
+		lv_area_t mem_area;
+		lv_coord_t x_last = tft_vscroll_map_cols(x, area->x2, &mem_area.x1);
+		mem_area.x2 = mem_area.x1 + x_last - x;
+
+		lv_coord_t y = area->y1;
+		while(y <= area->y2) {
+			lv_coord_t y_last = tft_vscroll_map_rows(y, area->y2, &mem_area.y1);
+			mem_area.y2 = mem_area.y1 + y_last - y;
+			ili9341_set_window(&mem_area);
+
+			bool last = x_last == area->x2 && y_last == area->y2;
+			lv_color_t * px = color_map + (y - area->y1) * w + (x - area->x1);
+			if(x == area->x1 && x_last == area->x2) {
+				uint32_t size = w * (y_last - y + 1);
+				if(last) ili9341_send_color((void*)px, size * 2);
+				else ili9341_send_color_part((void*)px, size * 2);
+			} else {
+				/*Only a part of the rows is stored contiguously*/
+				uint32_t size = x_last - x + 1;
+				lv_coord_t row;
+				for(row = y; row <= y_last; row++) {
+					if(last && row == y_last) ili9341_send_color((void*)px, size * 2);
+					else ili9341_send_color_part((void*)px, size * 2);
+					px += w;
+				}
+			}
+
+			y = y_last + 1;
+		}
 
+		x = x_last + 1;
+	}
+#else
+	ili9341_set_window(area);
 
 	uint32_t size = lv_area_get_width(area) * lv_area_get_height(area);
 
 	ili9341_send_color((void*)color_map, size * 2);
+#endif
 }
 
 void ili9341_enable_backlight(bool backlight)
@@ -216,6 +244,38 @@ static void ili9341_send_color(void * data, uint16_t length)
     disp_spi_send_colors(data, length);
 }
 
+/* Send the colors of an area without signaling the end of the flush */
+static void ili9341_send_color_part(void * data, uint16_t length)
+{
+    disp_wait_for_pending_transactions();
+    gpio_set_level(ILI9341_DC, 1);   /*Data mode*/
+    disp_spi_transaction(data, length, DISP_SPI_SEND_QUEUED, NULL, 0, 0);
+}
+
+static void ili9341_set_window(const lv_area_t * area)
+{
+	uint8_t data[4];
+
+	/*Column addresses*/
+	ili9341_send_cmd(0x2A);
+	data[0] = (area->x1 >> 8) & 0xFF;
+	data[1] = area->x1 & 0xFF;
+	data[2] = (area->x2 >> 8) & 0xFF;
+	data[3] = area->x2 & 0xFF;
+	ili9341_send_data(data, 4);
+
+	/*Page addresses*/
+	ili9341_send_cmd(0x2B);
+	data[0] = (area->y1 >> 8) & 0xFF;
+	data[1] = area->y1 & 0xFF;
+	data[2] = (area->y2 >> 8) & 0xFF;
+	data[3] = area->y2 & 0xFF;
+	ili9341_send_data(data, 4);
+
+	/*Memory write*/
+	ili9341_send_cmd(0x2C);
+}
+
 static void ili9341_set_orientation(uint8_t orientation)
 {
     // ESP_ASSERT(orientation < 4);
@@ -238,4 +298,8 @@ static void ili9341_set_orientation(uint8_t orientation)
 
     ili9341_send_cmd(0x36);
     ili9341_send_data((void *) &data[orientation], 1);
+
+#if defined CONFIG_LV_TFT_HW_SCROLL
+    tft_vscroll_init(&vscroll_panel, data[orientation]);
+#endif
 }
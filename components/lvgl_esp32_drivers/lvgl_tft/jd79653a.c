@@ -44,8 +44,8 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 #define PIN_BUSY_BIT        ((1ULL << (uint8_t)(CONFIG_LV_DISP_PIN_BUSY)))
 #define EVT_BUSY            (1UL << 0UL)
 #define EPD_WIDTH           LV_HOR_RES_MAX
-#define EPD_HEIGHT          LV_VER_RES_MAX
-#define EPD_ROW_LEN         (EPD_HEIGHT / 8u)
+#define EPD_HEIGHT          JD79653A_ROW_CNT
+#define EPD_ROW_LEN         JD79653A_ROW_LEN
 #define EPD_PARTIAL_CNT     5;
 
 #define BIT_SET(a, b)       ((a) |= (1U << (b)))
@@ -424,6 +424,61 @@ void jd79653a_lv_fb_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
     lv_disp_flush_ready(drv);
 }
 
+#if defined (CONFIG_LV_EPD_REFRESH_MANAGER)
+/* Full refresh callback of the e-paper refresh manager */
+void jd79653a_epd_full(const uint8_t *fb, const uint8_t *old_fb, uint32_t stride)
+{
+    jd79653a_power_on();
+    ESP_LOGD(TAG, "Performing full update from the refresh manager");
+
+    // Fill OLD data with what the panel shows
+    jd79653a_spi_send_cmd(0x10);
+    for (size_t h_idx = 0; h_idx < EPD_HEIGHT; h_idx++) {
+        jd79653a_spi_send_data((uint8_t *) &old_fb[h_idx * stride], EPD_ROW_LEN);
+    }
+
+    // Fill NEW data
+    jd79653a_spi_send_cmd(0x13);
+    for (size_t h_idx = 0; h_idx < EPD_HEIGHT; h_idx++) {
+        jd79653a_spi_send_data((uint8_t *) &fb[h_idx * stride], EPD_ROW_LEN);
+    }
+
+    jd79653a_spi_send_cmd(0x12); // Issue refresh command
+    vTaskDelay(pdMS_TO_TICKS(100));
+    jd79653a_wait_busy(0);
+
+    jd79653a_power_off();
+}
+
+/* Partial refresh callback of the e-paper refresh manager, only the rows of the window are sent */
+void jd79653a_epd_partial(const lv_area_t *area, const uint8_t *fb, const uint8_t *old_fb, uint32_t stride)
+{
+    (void) old_fb;
+
+    jd79653a_power_on();
+    jd79653a_partial_in();
+    ESP_LOGD(TAG, "x1: 0x%x, x2: 0x%x, y1: 0x%x, y2: 0x%x", area->x1, area->x2, area->y1, area->y2);
+
+    // Set partial window
+    uint8_t ptl_setting[7] = { area->x1, area->x2, area->y1 >> 8, area->y1 & 0xff, area->y2 >> 8, area->y2 & 0xff, 0x01 };
+    jd79653a_spi_send_cmd(0x90);
+    jd79653a_spi_send_data(ptl_setting, sizeof(ptl_setting));
+
+    size_t row_len = (area->x2 - area->x1 + 1) / 8;
+
+    jd79653a_spi_send_cmd(0x13);
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        jd79653a_spi_send_data((uint8_t *) &fb[y * stride + (area->x1 >> 3)], row_len);
+    }
+
+    jd79653a_spi_send_cmd(0x12);
+    jd79653a_wait_busy(0);
+
+    jd79653a_partial_out();
+    jd79653a_power_off();
+}
+#endif
+
 void jd79653a_deep_sleep()
 {
     jd79653a_spi_send_seq(power_off_seq, EPD_SEQ_LEN(power_off_seq));
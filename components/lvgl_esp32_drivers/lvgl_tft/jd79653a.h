@@ -17,6 +17,10 @@ extern "C"
 #include "lvgl/lvgl.h"
 #endif
 
+/* Framebuffer layout of the panel: number of rows and length of a row in bytes */
+#define JD79653A_ROW_CNT        LV_VER_RES_MAX
+#define JD79653A_ROW_LEN        (JD79653A_ROW_CNT / 8u)
+
 void jd79653a_init();
 void jd79653a_deep_sleep();
 
@@ -28,6 +32,11 @@ void jd79653a_lv_fb_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
 void jd79653a_fb_set_full_color(uint8_t color);
 void jd79653a_fb_full_update(uint8_t *data, size_t len);
 
+#if defined (CONFIG_LV_EPD_REFRESH_MANAGER)
+void jd79653a_epd_full(const uint8_t *fb, const uint8_t *old_fb, uint32_t stride);
+void jd79653a_epd_partial(const lv_area_t *area, const uint8_t *fb, const uint8_t *old_fb, uint32_t stride);
+#endif
+
 
 #ifdef __cplusplus
 } /* extern "C" */
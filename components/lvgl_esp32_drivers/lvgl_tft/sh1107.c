@@ -12,6 +12,7 @@
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include <string.h>
 
 /*********************
  *      DEFINES
@@ -35,10 +36,17 @@ typedef struct {
 static void sh1107_send_cmd(uint8_t cmd);
 static void sh1107_send_data(void * data, uint16_t length);
 static void sh1107_send_color(void * data, uint16_t length);
+#if defined CONFIG_LV_TFT_DISPLAY_MONO_PAGE
+static void sh1107_flush_changed(lv_disp_drv_t * drv, const lv_area_t * area, uint8_t * buf);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if defined CONFIG_LV_TFT_DISPLAY_MONO_PAGE
+/* Copy of the display RAM to send only the changed columns */
+static uint8_t shadow[LV_HOR_RES_MAX * (LV_VER_RES_MAX / 8)];
+#endif
 
 /**********************
  *      MACROS
@@ -113,6 +121,17 @@ void sh1107_init(void)
 	    }
 	    cmd++;
 	}
+
+#if defined CONFIG_LV_TFT_DISPLAY_MONO_PAGE
+	/* The content of the display RAM is unknown, clear it together with the shadow */
+	memset(shadow, 0, sizeof(shadow));
+	for (uint8_t page = 0; page < LV_VER_RES_MAX / 8; page++) {
+	    sh1107_send_cmd(0x10);          // Set Higher Column Start Address for Page Addressing Mode
+	    sh1107_send_cmd(0x00);          // Set Lower Column Start Address for Page Addressing Mode
+	    sh1107_send_cmd(0xB0 | page);   // Set Page Start Address for Page Addressing Mode
+	    sh1107_send_data(shadow + page * LV_HOR_RES_MAX, LV_HOR_RES_MAX);
+	}
+#endif
 }
 
 void sh1107_set_px_cb(struct _disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
@@ -140,6 +159,9 @@ void sh1107_set_px_cb(struct _disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t b
 
 void sh1107_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map)
 {
+#if defined CONFIG_LV_TFT_DISPLAY_MONO_PAGE
+    sh1107_flush_changed(drv, area, (uint8_t *) color_map);
+#else
     uint8_t columnLow = area->x1 & 0x0F;
 	uint8_t columnHigh = (area->x1 >> 4) & 0x0F;
     uint8_t row1 = 0, row2 = 0;
@@ -170,15 +192,22 @@ void sh1107_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * colo
 	    sh1107_send_color( (void *) ptr, size);
 	}
     }
+#endif
 }
 
 void sh1107_rounder(struct _disp_drv_t * disp_drv, lv_area_t *area)
 {
+#if defined CONFIG_LV_TFT_DISPLAY_MONO_PAGE
+    /* Only whole pages can be written, the columns are addressed one by one */
+    area->y1 &= ~0x7;
+    area->y2 |= 0x7;
+#else
     // workaround: always send complete size display buffer
     area->x1 = 0;
     area->y1 = 0;
     area->x2 = LV_HOR_RES_MAX-1;
     area->y2 = LV_VER_RES_MAX-1;
+#endif
 }
 
 void sh1107_sleep_in()
@@ -216,3 +245,48 @@ static void sh1107_send_color(void * data, uint16_t length)
     gpio_set_level(SH1107_DC, 1);   /*Data mode*/
     disp_spi_send_colors(data, length);
 }
+
+#if defined CONFIG_LV_TFT_DISPLAY_MONO_PAGE
+/* Send only the changed columns of every page of a page aligned area (portrait only) */
+static void sh1107_flush_changed(lv_disp_drv_t * drv, const lv_area_t * area, uint8_t * buf)
+{
+    uint16_t w = area->x2 - area->x1 + 1;
+    uint8_t page1 = area->y1 >> 3;
+    uint8_t page2 = area->y2 >> 3;
+    uint8_t * last_ptr = NULL;
+    uint16_t last_size = 0;
+
+    for (uint8_t page = page1; page <= page2; page++) {
+        uint8_t * src = buf + (page - page1) * w;
+        uint8_t * dst = shadow + page * LV_HOR_RES_MAX + area->x1;
+
+        /* Find the first and the last changed column */
+        int16_t first = 0;
+        int16_t last = w - 1;
+        while (first < w && src[first] == dst[first]) first++;
+        if (first == w) continue;
+        while (src[last] == dst[last]) last--;
+
+        /* The previous span is sent here, the last one completes the flush */
+        if (last_ptr) {
+            sh1107_send_data(last_ptr, last_size);
+        }
+
+        uint8_t column = area->x1 + first;
+        sh1107_send_cmd(0x10 | ((column >> 4) & 0x0F));   // Set Higher Column Start Address for Page Addressing Mode
+        sh1107_send_cmd(0x00 | (column & 0x0F));          // Set Lower Column Start Address for Page Addressing Mode
+        sh1107_send_cmd(0xB0 | page);                     // Set Page Start Address for Page Addressing Mode
+
+        last_ptr = src + first;
+        last_size = last - first + 1;
+        memcpy(dst + first, last_ptr, last_size);
+    }
+
+    if (last_ptr) {
+        // complete sending data by sh1107_send_color() and thus call lv_flush_ready()
+        sh1107_send_color(last_ptr, last_size);
+    } else {
+        lv_disp_flush_ready(drv);
+    }
+}
+#endif
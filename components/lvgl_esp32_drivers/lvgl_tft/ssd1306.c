@@ -15,6 +15,7 @@
  *********************/
 #include "driver/i2c.h"
 #include "assert.h"
+#include <string.h>
 
 #include "lvgl_i2c_conf.h"
 
@@ -81,10 +82,18 @@
  **********************/
 static uint8_t send_data(lv_disp_drv_t *disp_drv, void *bytes, size_t bytes_len);
 static uint8_t send_pixels(lv_disp_drv_t *disp_drv, void *color_buffer, size_t buffer_len);
+#if defined (CONFIG_LV_TFT_DISPLAY_MONO_PAGE)
+static void flush_changed(lv_disp_drv_t * disp_drv, const lv_area_t * area, const uint8_t * buf);
+static void send_columns(lv_disp_drv_t * disp_drv, uint8_t page, uint8_t col1, uint8_t col2, const uint8_t * buf);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if defined (CONFIG_LV_TFT_DISPLAY_MONO_PAGE)
+/* Copy of the GDDRAM to send only the changed columns */
+static uint8_t shadow[OLED_COLUMNS * OLED_PAGES];
+#endif
 
 /**********************
  *      MACROS
@@ -133,6 +142,14 @@ void ssd1306_init(void)
 
     uint8_t err = send_data(NULL, conf, sizeof(conf));
     assert(0 == err);
+
+#if defined (CONFIG_LV_TFT_DISPLAY_MONO_PAGE)
+    /* The content of the GDDRAM is unknown, clear it together with the shadow */
+    memset(shadow, 0, sizeof(shadow));
+    for (uint8_t page = 0; page < OLED_PAGES; page++) {
+        send_columns(NULL, page, 0, OLED_COLUMNS - 1, shadow + page * OLED_COLUMNS);
+    }
+#endif
 }
 
 void ssd1306_set_px_cb(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
@@ -150,6 +167,9 @@ void ssd1306_set_px_cb(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w
 
 void ssd1306_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
 {
+#if defined (CONFIG_LV_TFT_DISPLAY_MONO_PAGE)
+    flush_changed(disp_drv, area, (const uint8_t *) color_p);
+#else
     /* Divide by 8 */
     uint8_t row1 = area->y1 >> 3;
     uint8_t row2 = area->y2 >> 3;
@@ -168,14 +188,20 @@ void ssd1306_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t
 
     uint8_t err = send_data(disp_drv, conf, sizeof(conf));
     assert(0 == err);
-    err = send_pixels(disp_drv, color_p, OLED_COLUMNS * (1 + row2 - row1));
+    err = send_pixels(disp_drv, color_p, (1 + area->x2 - area->x1) * (1 + row2 - row1));
     assert(0 == err);
+#endif
 
     lv_disp_flush_ready(disp_drv);
 }
 
 void ssd1306_rounder(lv_disp_drv_t * disp_drv, lv_area_t *area)
 {
+#if defined (CONFIG_LV_TFT_DISPLAY_MONO_PAGE)
+    /* Only whole pages can be written, the columns are addressed one by one */
+    area->y1 &= ~0x7;
+    area->y2 |= 0x7;
+#else
     uint8_t hor_max = disp_drv->hor_res;
     uint8_t ver_max = disp_drv->ver_res;
 
@@ -183,6 +209,7 @@ void ssd1306_rounder(lv_disp_drv_t * disp_drv, lv_area_t *area)
     area->y1 = 0;
     area->x2 = hor_max - 1;
     area->y2 = ver_max - 1;
+#endif
 }
 
 void ssd1306_sleep_in(void)
@@ -254,3 +281,49 @@ static uint8_t send_pixels(lv_disp_drv_t *disp_drv, void *color_buffer, size_t b
 
     return ESP_OK == err ? 0 : 1;
 }
+
+#if defined (CONFIG_LV_TFT_DISPLAY_MONO_PAGE)
+/* Send only the changed columns of every page of a page aligned area */
+static void flush_changed(lv_disp_drv_t * disp_drv, const lv_area_t * area, const uint8_t * buf)
+{
+    uint16_t w = area->x2 - area->x1 + 1;
+    uint8_t page1 = area->y1 >> 3;
+    uint8_t page2 = area->y2 >> 3;
+
+    for (uint8_t page = page1; page <= page2; page++) {
+        const uint8_t *src = buf + (page - page1) * w;
+        uint8_t *dst = shadow + page * OLED_COLUMNS + area->x1;
+
+        /* Find the first and the last changed column */
+        int16_t first = 0;
+        int16_t last = w - 1;
+        while (first < w && src[first] == dst[first]) first++;
+        if (first == w) continue;
+        while (src[last] == dst[last]) last--;
+
+        send_columns(disp_drv, page, area->x1 + first, area->x1 + last, src + first);
+        memcpy(dst + first, src + first, last - first + 1);
+    }
+}
+
+/* Send the columns `col1`..`col2` of a page */
+static void send_columns(lv_disp_drv_t * disp_drv, uint8_t page, uint8_t col1, uint8_t col2, const uint8_t * buf)
+{
+    uint8_t conf[] = {
+        OLED_CONTROL_BYTE_CMD_STREAM,
+        OLED_CMD_SET_MEMORY_ADDR_MODE,
+        0x00,
+        OLED_CMD_SET_COLUMN_RANGE,
+        col1,
+        col2,
+        OLED_CMD_SET_PAGE_RANGE,
+        page,
+        page,
+    };
+
+    uint8_t err = send_data(disp_drv, conf, sizeof(conf));
+    assert(0 == err);
+    err = send_pixels(disp_drv, (void *) buf, col2 - col1 + 1);
+    assert(0 == err);
+}
+#endif
@@ -0,0 +1,223 @@
+/**
+ * @file tft_vscroll.c
+ *
+ * The vertical scroll area is a range of the controller's lines (TFA: lines
+ * above it, VSA: its height). The controller shows the line VSCRSADD at the
+ * top of the area and the following ones after it, wrapping at the end of the
+ * area. So the content of the area is moved by changing VSCRSADD, and the rows
+ * written later are stored with the same offset.
+ *
+ * The lines are the rows of the controller's memory (gate lines), i.e. the
+ * display's rows only if MADCTL doesn't exchange the rows and columns (MV).
+ * In landscape orientations (MV set) the lines are the display's columns, so
+ * only horizontal scrolls can be moved. Vertical scrolls are redrawn as usual.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "esp_log.h"
+
+#include "tft_vscroll.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TAG "tft_vscroll"
+
+#define MADCTL_MY   0x80    /* Row address order: the rows are written from the last line */
+#define MADCTL_MX   0x40    /* Column address order: with MV the columns are written from the last line */
+#define MADCTL_MV   0x20    /* Row/column exchange */
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_coord_t row_to_line(lv_coord_t y);
+static lv_coord_t map_lines(lv_coord_t p1, lv_coord_t p2, lv_coord_t *mem_p1);
+static void send_area(void);
+static void send_start(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static tft_vscroll_panel_t vscroll_panel;
+static uint8_t vscroll_madctl;
+static bool vscroll_valid = false;  /* The scroll area is defined */
+static bool vscroll_cols;           /* The lines are the display's columns (MV) */
+static bool vscroll_mirror;         /* The lines are in reverse order */
+static lv_coord_t vscroll_lines;    /* Number of lines of the controller */
+static lv_coord_t vscroll_tfa;      /* First line of the scroll area */
+static lv_coord_t vscroll_vsa;      /* Height of the scroll area */
+static lv_coord_t vscroll_ofs;      /* VSCRSADD - TFA, 0..VSA-1 */
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void tft_vscroll_init(const tft_vscroll_panel_t *panel, uint8_t madctl)
+{
+    vscroll_panel = *panel;
+    vscroll_madctl = madctl;
+
+    if (vscroll_valid && vscroll_ofs != 0) {
+        vscroll_ofs = 0;
+        send_start();
+    }
+    vscroll_valid = false;
+
+    /* With MV the column address is sent to the gate lines so MX mirrors them */
+    vscroll_cols = (madctl & MADCTL_MV) != 0;
+    vscroll_mirror = (madctl & (vscroll_cols ? MADCTL_MX : MADCTL_MY)) != 0;
+
+    if (vscroll_cols) {
+        ESP_LOGI(TAG, "The lines are the columns in this orientation, only horizontal scrolls are moved");
+    }
+}
+
+bool tft_vscroll_scroll(lv_disp_drv_t *drv, const lv_area_t *area, lv_coord_t dx, lv_coord_t dy)
+{
+    if (vscroll_panel.send_cmd == NULL) return false;
+
+    /* Only the content of full width (height with MV) areas moved along the lines can be moved */
+    lv_coord_t d;
+    lv_coord_t p1;
+    lv_coord_t p2;
+    if (vscroll_cols) {
+        if (dy != 0 || dx == 0) return false;
+        if (area->y1 != 0 || area->y2 != drv->ver_res - 1) return false;
+        vscroll_lines = drv->hor_res;
+        d = dx;
+        p1 = area->x1;
+        p2 = area->x2;
+    } else {
+        if (dx != 0 || dy == 0) return false;
+        if (area->x1 != 0 || area->x2 != drv->hor_res - 1) return false;
+        vscroll_lines = drv->ver_res;
+        d = dy;
+        p1 = area->y1;
+        p2 = area->y2;
+    }
+
+    lv_coord_t line1 = row_to_line(p1);
+    lv_coord_t line2 = row_to_line(p2);
+    lv_coord_t tfa = LV_MATH_MIN(line1, line2);
+    lv_coord_t vsa = LV_MATH_ABS(line2 - line1) + 1;
+
+    if (!vscroll_valid || tfa != vscroll_tfa || vsa != vscroll_vsa) {
+        /* The old area shows its lines rotated. Show them in order and redraw them. */
+        if (vscroll_valid && vscroll_ofs != 0) {
+            lv_coord_t row1 = row_to_line(vscroll_tfa);
+            lv_coord_t row2 = row_to_line(vscroll_tfa + vscroll_vsa - 1);
+            lv_area_t old_area;
+            if (vscroll_cols) {
+                old_area.x1 = LV_MATH_MIN(row1, row2);
+                old_area.x2 = LV_MATH_MAX(row1, row2);
+                old_area.y1 = 0;
+                old_area.y2 = drv->ver_res - 1;
+            } else {
+                old_area.x1 = 0;
+                old_area.x2 = drv->hor_res - 1;
+                old_area.y1 = LV_MATH_MIN(row1, row2);
+                old_area.y2 = LV_MATH_MAX(row1, row2);
+            }
+            _lv_inv_area(_lv_refr_get_disp_refreshing(), &old_area);
+        }
+
+        vscroll_tfa = tfa;
+        vscroll_vsa = vsa;
+        vscroll_ofs = 0;
+        vscroll_valid = true;
+        send_area();
+    }
+
+    /* Moving the content down (right with MV) by `n` lines means showing `n` lines earlier first */
+    lv_coord_t dline = vscroll_mirror ? -d : d;
+    vscroll_ofs = (vscroll_ofs - dline) % vscroll_vsa;
+    if (vscroll_ofs < 0) vscroll_ofs += vscroll_vsa;
+    send_start();
+
+    return true;
+}
+
+lv_coord_t tft_vscroll_map_rows(lv_coord_t y1, lv_coord_t y2, lv_coord_t *mem_y1)
+{
+    if (vscroll_cols) {
+        *mem_y1 = y1;
+        return y2;
+    }
+
+    return map_lines(y1, y2, mem_y1);
+}
+
+lv_coord_t tft_vscroll_map_cols(lv_coord_t x1, lv_coord_t x2, lv_coord_t *mem_x1)
+{
+    if (!vscroll_cols) {
+        *mem_x1 = x1;
+        return x2;
+    }
+
+    return map_lines(x1, x2, mem_x1);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/* Convert a row (a column with MV) to a line of the controller and vice versa */
+static lv_coord_t row_to_line(lv_coord_t y)
+{
+    return vscroll_mirror ? vscroll_lines - 1 - y : y;
+}
+
+/* Find where the rows (columns with MV) `p1..p2` are stored, see `tft_vscroll_map_rows()` */
+static lv_coord_t map_lines(lv_coord_t p1, lv_coord_t p2, lv_coord_t *mem_p1)
+{
+    if (!vscroll_valid || vscroll_ofs == 0) {
+        *mem_p1 = p1;
+        return p2;
+    }
+
+    /* Find the last line stored right after the previous one */
+    lv_coord_t line = row_to_line(p1);
+    if (line >= vscroll_tfa && line < vscroll_tfa + vscroll_vsa) {
+        line = vscroll_tfa + (line - vscroll_tfa + vscroll_ofs) % vscroll_vsa;
+    }
+    *mem_p1 = row_to_line(line);
+
+    lv_coord_t p;
+    for (p = p1 + 1; p <= p2; p++) {
+        line = row_to_line(p);
+        if (line >= vscroll_tfa && line < vscroll_tfa + vscroll_vsa) {
+            line = vscroll_tfa + (line - vscroll_tfa + vscroll_ofs) % vscroll_vsa;
+        }
+        if (row_to_line(line) != *mem_p1 + (p - p1)) break;
+    }
+
+    return p - 1;
+}
+
+static void send_area(void)
+{
+    lv_coord_t bfa = vscroll_lines - vscroll_tfa - vscroll_vsa;
+    uint8_t data[6];
+    data[0] = (vscroll_tfa >> 8) & 0xFF;
+    data[1] = vscroll_tfa & 0xFF;
+    data[2] = (vscroll_vsa >> 8) & 0xFF;
+    data[3] = vscroll_vsa & 0xFF;
+    data[4] = (bfa >> 8) & 0xFF;
+    data[5] = bfa & 0xFF;
+
+    vscroll_panel.send_cmd(TFT_VSCROLL_CMD_VSCRDEF);
+    vscroll_panel.send_data(data, 6);
+}
+
+static void send_start(void)
+{
+    lv_coord_t start = vscroll_tfa + vscroll_ofs;
+    uint8_t data[2];
+    data[0] = (start >> 8) & 0xFF;
+    data[1] = start & 0xFF;
+
+    vscroll_panel.send_cmd(TFT_VSCROLL_CMD_VSCRSADD);
+    vscroll_panel.send_data(data, 2);
+}
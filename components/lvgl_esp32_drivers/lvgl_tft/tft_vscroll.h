@@ -0,0 +1,77 @@
+/**
+ * @file tft_vscroll.h
+ *
+ * Hardware vertical scrolling of MIPI DCS controllers (ILI9341, ST7796S):
+ * the content of a page scrolled by LVGL is moved with the controller's
+ * vertical scroll area (VSCRDEF/VSCRSADD) so only the newly exposed band
+ * has to be rendered and sent. In landscape orientations the controller's
+ * lines are the display's columns so horizontal scrolls are moved instead.
+ */
+
+#ifndef TFT_VSCROLL_H
+#define TFT_VSCROLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TFT_VSCROLL_CMD_VSCRDEF     0x33
+#define TFT_VSCROLL_CMD_VSCRSADD    0x37
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/* Command interface of the controller */
+typedef struct {
+    void (*send_cmd)(uint8_t cmd);
+    void (*send_data)(void *data, uint16_t length);
+} tft_vscroll_panel_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/* Set the controller and its memory access control (0x36) value.
+ * Call it again when the orientation changes, it resets the scrolling. */
+void tft_vscroll_init(const tft_vscroll_panel_t *panel, uint8_t madctl);
+
+/* Display scroll callback: move the content of `area` with the vertical scroll area.
+ * Only full width areas scrolled vertically can be moved if the controller's lines
+ * are the display's rows (portrait orientations), and only full height areas
+ * scrolled horizontally if they are the columns (landscape orientations, MADCTL MV). */
+bool tft_vscroll_scroll(lv_disp_drv_t *drv, const lv_area_t *area, lv_coord_t dx, lv_coord_t dy);
+
+/* Get where the rows starting at `y1` are stored in the controller's memory.
+ * The rows up to the returned one (<= `y2`) are stored contiguously from `*mem_y1`.
+ * Used by the flush callbacks to split the areas wrapping in the scroll area. */
+lv_coord_t tft_vscroll_map_rows(lv_coord_t y1, lv_coord_t y2, lv_coord_t *mem_y1);
+
+/* Same as `tft_vscroll_map_rows()` for the columns, they are moved in landscape orientations.
+ * The columns of a split area aren't contiguous in the color map, send them row by row. */
+lv_coord_t tft_vscroll_map_cols(lv_coord_t x1, lv_coord_t x2, lv_coord_t *mem_x1);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*TFT_VSCROLL_H*/
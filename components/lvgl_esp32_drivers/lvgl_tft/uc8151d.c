@@ -45,8 +45,8 @@
 #define PIN_BUSY_BIT        ((1ULL << (uint8_t)(CONFIG_LV_DISP_PIN_BUSY)))
 #define EVT_BUSY            (1UL << 0UL)
 #define EPD_WIDTH           LV_HOR_RES_MAX
-#define EPD_HEIGHT          LV_VER_RES_MAX
-#define EPD_ROW_LEN         (EPD_HEIGHT / 8u)
+#define EPD_HEIGHT          UC8151D_ROW_CNT
+#define EPD_ROW_LEN         UC8151D_ROW_LEN
 
 #define BIT_SET(a, b)       ((a) |= (1U << (b)))
 #define BIT_CLEAR(a, b)     ((a) &= ~(1U << (b)))
@@ -208,6 +208,71 @@ void uc8151d_lv_fb_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *
     ESP_LOGD(TAG, "Ready");
 }
 
+#if defined (CONFIG_LV_EPD_REFRESH_MANAGER)
+/* Full refresh callback of the e-paper refresh manager */
+void uc8151d_epd_full(const uint8_t *fb, const uint8_t *old_fb, uint32_t stride)
+{
+    uc8151d_panel_init();
+
+    // Fill old data with what the panel shows
+    uc8151d_spi_send_cmd(0x10);
+    for (size_t h_idx = 0; h_idx < EPD_HEIGHT; h_idx++) {
+        uc8151d_spi_send_data((uint8_t *) &old_fb[h_idx * stride], EPD_ROW_LEN);
+    }
+
+    // Fill new data
+    uc8151d_spi_send_cmd(0x13);
+    for (size_t h_idx = 0; h_idx < EPD_HEIGHT; h_idx++) {
+        uc8151d_spi_send_data((uint8_t *) &fb[h_idx * stride], EPD_ROW_LEN);
+    }
+
+    // Issue refresh
+    uc8151d_spi_send_cmd(0x12);
+    vTaskDelay(pdMS_TO_TICKS(10));
+    uc8151d_wait_busy(0);
+
+    uc8151d_sleep();
+}
+
+/* Partial refresh callback of the e-paper refresh manager.
+ * Only the window is refreshed, with the waveform from OTP. */
+void uc8151d_epd_partial(const lv_area_t *area, const uint8_t *fb, const uint8_t *old_fb, uint32_t stride)
+{
+    uc8151d_panel_init();
+    ESP_LOGD(TAG, "x1: 0x%x, x2: 0x%x, y1: 0x%x, y2: 0x%x", area->x1, area->x2, area->y1, area->y2);
+
+    size_t row_len = (area->x2 - area->x1 + 1) / 8;
+    size_t col = area->x1 >> 3;
+
+    // Partial in and set the window
+    uint8_t ptl_setting[7] = { area->x1, area->x2, area->y1 >> 8, area->y1 & 0xff, area->y2 >> 8, area->y2 & 0xff, 0x01 };
+    uc8151d_spi_send_cmd(0x91);
+    uc8151d_spi_send_cmd(0x90);
+    uc8151d_spi_send_data(ptl_setting, sizeof(ptl_setting));
+
+    // Fill old and new data of the window
+    uc8151d_spi_send_cmd(0x10);
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        uc8151d_spi_send_data((uint8_t *) &old_fb[y * stride + col], row_len);
+    }
+
+    uc8151d_spi_send_cmd(0x13);
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        uc8151d_spi_send_data((uint8_t *) &fb[y * stride + col], row_len);
+    }
+
+    // Issue refresh
+    uc8151d_spi_send_cmd(0x12);
+    vTaskDelay(pdMS_TO_TICKS(10));
+    uc8151d_wait_busy(0);
+
+    // Partial out
+    uc8151d_spi_send_cmd(0x92);
+
+    uc8151d_sleep();
+}
+#endif
+
 void uc8151d_lv_set_fb_cb(struct _disp_drv_t *disp_drv, uint8_t *buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
                            lv_color_t color, lv_opa_t opa)
 {
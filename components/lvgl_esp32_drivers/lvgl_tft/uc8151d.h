@@ -29,6 +29,10 @@
 
 #include <lvgl.h>
 
+/* Framebuffer layout of the panel: number of rows and length of a row in bytes */
+#define UC8151D_ROW_CNT         LV_VER_RES_MAX
+#define UC8151D_ROW_LEN         (UC8151D_ROW_CNT / 8u)
+
 void uc8151d_init();
 void uc8151d_lv_set_fb_cb(struct _disp_drv_t *disp_drv, uint8_t *buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
                           lv_color_t color, lv_opa_t opa);
@@ -36,4 +40,9 @@ void uc8151d_lv_set_fb_cb(struct _disp_drv_t *disp_drv, uint8_t *buf, lv_coord_t
 void uc8151d_lv_rounder_cb(struct _disp_drv_t *disp_drv, lv_area_t *area);
 void uc8151d_lv_fb_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
 
+#if defined (CONFIG_LV_EPD_REFRESH_MANAGER)
+void uc8151d_epd_full(const uint8_t *fb, const uint8_t *old_fb, uint32_t stride);
+void uc8151d_epd_partial(const lv_area_t *area, const uint8_t *fb, const uint8_t *old_fb, uint32_t stride);
+#endif
+
 #endif //LVGL_DEMO_UC8151D_H
@@ -192,6 +192,12 @@ static void guiTask(void *pvParameter) {
     static lv_disp_buf_t disp_buf;
 	uint32_t size_in_px = DISP_BUF_SIZE;
 
+#if defined CONFIG_LV_TFT_DISPLAY_MONOCHROME && !defined CONFIG_LV_EPD_REFRESH_MANAGER
+    /* Actual size in pixels, not bytes.
+     * The e-paper refresh manager gets true color pixels and packs them on flush. */
+    size_in_px *= 8;
+#endif
+
     /* Initialize the working buffer depending on the selected display.
      * NOTE: buf2 == NULL when using monochrome displays. */
     lv_disp_buf_init(&disp_buf, buf1, buf2, size_in_px);
@@ -200,6 +206,22 @@ static void guiTask(void *pvParameter) {
     lv_disp_drv_init(&disp_drv);
     disp_drv.flush_cb = disp_driver_flush;
 
+#if defined CONFIG_LV_TFT_DISPLAY_MONOCHROME && !defined CONFIG_LV_EPD_REFRESH_MANAGER
+    disp_drv.rounder_cb = disp_driver_rounder;
+#if defined CONFIG_LV_TFT_DISPLAY_MONO_PAGE
+    /* Blend directly into the page format of the controller */
+    disp_drv.mono_page = 1;
+#else
+    disp_drv.set_px_cb = disp_driver_set_px;
+#endif
+#endif
+#if LV_USE_DRAW_BACKEND
+    disp_drv.draw_backend = disp_driver_get_draw_backend();
+#endif
+#if LV_USE_FAST_SCROLL && defined CONFIG_LV_TFT_HW_SCROLL
+    disp_drv.scroll_cb = disp_driver_scroll;
+#endif
+
 
     disp_drv.buffer = &disp_buf;
     lv_disp_drv_register(&disp_drv);